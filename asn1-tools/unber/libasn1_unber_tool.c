@@ -29,6 +29,7 @@
 
 #define ASN_DISABLE_PER_SUPPORT 1
 #define ASN_DISABLE_OER_SUPPORT 1
+#define ASN_DISABLE_JER_SUPPORT 1
 
 #include <asn1parser.h> /* For static string tables */
 
@@ -810,6 +811,14 @@ xer_decode_general(const asn_codec_ctx_t *opt_codec_ctx, asn_struct_ctx_t *ctx,
     return rv;
 }
 
+int
+asn_output_buffer_consume_bytes(const void *buffer, size_t size, void *key) {
+    (void)buffer;
+    (void)size;
+    (void)key;
+    return -1;
+}
+
 size_t
 xer_whitespace_span(const void *chunk_buf, size_t chunk_size) {
     (void)chunk_buf;
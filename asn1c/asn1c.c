@@ -131,10 +131,18 @@ main(int ac, char **av) {
                 asn1_compiler_flags |= A1C_ALL_DEFS_GLOBAL;
             } else if(strcmp(optarg, "bless-SIZE") == 0) {
                 asn1_fixer_flags |= A1F_EXTENDED_SizeConstraint;
+            } else if(strncmp(optarg, "cache-dir=", 10) == 0) {
+                asn1c__set_cache_dir(optarg + 10);
             } else if(strcmp(optarg, "compound-names") == 0) {
                 asn1_compiler_flags |= A1C_COMPOUND_NAMES;
+            } else if(strcmp(optarg, "gen-aggregate-constraints") == 0) {
+                asn1_compiler_flags |= A1C_GEN_AGGREGATE_CONSTRAINTS;
+            } else if(strcmp(optarg, "gen-specialized-codecs") == 0) {
+                asn1_compiler_flags |= A1C_GEN_SPECIALIZED_CODECS;
             } else if(strcmp(optarg, "indirect-choice") == 0) {
                 asn1_compiler_flags |= A1C_INDIRECT_CHOICE;
+            } else if(strcmp(optarg, "inline-optionals") == 0) {
+                asn1_compiler_flags |= A1C_INLINE_OPTIONALS;
             } else if(strncmp(optarg, "known-extern-type=", 18) == 0) {
                 char *known_type = optarg + 18;
                 ret = asn1f_make_known_external_type(known_type);
@@ -144,6 +152,10 @@ main(int ac, char **av) {
                 asn1_compiler_flags &= ~A1C_USE_WIDE_TYPES;
             } else if(strcmp(optarg, "wide-types") == 0) {
                 asn1_compiler_flags |= A1C_USE_WIDE_TYPES;
+            } else if(strcmp(optarg, "packed-sequence-of") == 0) {
+                asn1_compiler_flags |= A1C_PACKED_SEQUENCE_OF;
+            } else if(strcmp(optarg, "set-of-slab") == 0) {
+                asn1_compiler_flags |= A1C_SET_OF_SLAB;
             } else if(strcmp(optarg, "line-refs") == 0) {
                 asn1_compiler_flags |= A1C_LINE_REFS;
             } else if(strcmp(optarg, "no-constraints") == 0) {
@@ -169,10 +181,14 @@ main(int ac, char **av) {
                 asn1_compiler_flags |= A1C_GEN_PER;
             } else if(strcmp(optarg, "en-OER") == 0) {
                 asn1_compiler_flags |= A1C_GEN_OER;
+            } else if(strcmp(optarg, "en-JER") == 0) {
+                asn1_compiler_flags |= A1C_GEN_JER;
             } else if(strcmp(optarg, "en-example") == 0) {
                 asn1_compiler_flags |= A1C_GEN_EXAMPLE;
             } else if(strcmp(optarg, "en-autotools") == 0) {
                 asn1_compiler_flags |= A1C_GEN_AUTOTOOLS_EXAMPLE;
+            } else if(strcmp(optarg, "en-protobuf") == 0) {
+                asn1_compiler_flags |= A1C_GEN_PROTOBUF;
             } else {
                 fprintf(stderr, "-g%s: Invalid argument\n", optarg);
                 exit(EX_USAGE);
@@ -185,6 +201,8 @@ main(int ac, char **av) {
                 asn1_compiler_flags &= ~A1C_GEN_PER;
             } else if(strcmp(optarg, "o-gen-OER") == 0) {
                 asn1_compiler_flags &= ~A1C_GEN_OER;
+            } else if(strcmp(optarg, "o-gen-JER") == 0) {
+                asn1_compiler_flags &= ~A1C_GEN_JER;
             } else if(strcmp(optarg, "o-gen-example") == 0) {
                 asn1_compiler_flags &= ~A1C_GEN_EXAMPLE;
             } else if(strcmp(optarg, "o-gen-autotools") == 0) {
@@ -289,6 +307,11 @@ main(int ac, char **av) {
             exit(EX_USAGE);
         }
     }
+    if((asn1_compiler_flags & A1C_PACKED_SEQUENCE_OF)
+       && (asn1_compiler_flags & A1C_GEN_PROTOBUF)) {
+        fprintf(stderr,
+                "WARNING: -fpacked-sequence-of is ignored with -gen-protobuf\n");
+    }
 
     /*
      * Ensure that there are some input files present.
@@ -357,7 +380,7 @@ main(int ac, char **av) {
         if(asn) {
             asn1p_module_t *mod;
             while((mod = TQ_REMOVE(&(new_asn->modules), mod_next)))
-                TQ_ADD(&(asn->modules), mod, mod_next);
+                asn1p_add_module(asn, mod);
             asn1p_delete(new_asn);
         } else {
             asn = new_asn;
@@ -524,7 +547,7 @@ importStandardModules(asn1p_t *asn, const char *skeletons_dir) {
         /* Import these modules and mark them as "standard" */
         while((mod = TQ_REMOVE(&(new_asn->modules), mod_next))) {
             mod->_tags |= MT_STANDARD_MODULE;
-            TQ_ADD(&(asn->modules), mod, mod_next);
+            asn1p_add_module(asn, mod);
         }
         asn1p_delete(new_asn);
         asn1p_lex_destroy();
@@ -576,13 +599,19 @@ usage(const char *av0) {
 "\n"
 
 "  -fbless-SIZE          Allow SIZE() constraint for INTEGER etc (non-std.)\n"
+"  -fcache-dir=<dir>     Reuse the compiled output of the unchanged modules\n"
 "  -fcompound-names      Disambiguate C's struct NAME's inside top-level types\n"
+"  -fgen-aggregate-constraints Generate in-place constraint checks for SEQUENCE\n"
+"  -fgen-specialized-codecs    Generate straight-line UPER codecs for SEQUENCE\n"
 "  -findirect-choice     Compile members of CHOICE as indirect pointers\n"
 "  -fincludes-quoted     Generate #includes in \"double\" instead of <angle> quotes\n"
+"  -finline-optionals    Store simple OPTIONAL members of SEQUENCE inline\n"
 "  -fknown-extern-type=<name>    Pretend the specified type is known\n"
 "  -fline-refs           Include ASN.1 module's line numbers in comments\n"
 "  -fno-constraints      Do not generate the constraint checking code\n"
 "  -fno-include-deps     Do not generate the courtesy #includes for dependencies\n"
+"  -fpacked-sequence-of  Keep simple SEQUENCE OF values in a contiguous array\n"
+"  -fset-of-slab         Decode SET OF elements from PER and OER in one block\n"
 "  -funnamed-unions      Enable unnamed unions in structures\n"
 "  -fwide-types          Use INTEGER_t instead of \"long\" by default, etc.\n"
 "\n"
@@ -590,7 +619,9 @@ usage(const char *av0) {
 "  -no-gen-OER           Do not generate the OER (X.696) support code\n"
 "  -no-gen-PER           Do not generate the PER (X.691) support code\n"
 "  -no-gen-example       Do not generate the ASN.1 format converter example\n"
+"  -gen-JER              Generate the JER (X.697, JSON) support code\n"
 "  -gen-autotools        Generate example top-level configure.ac and Makefile.am\n"
+"  -gen-protobuf         Generate protobuf wire format codecs matching -B\n"
 "  -pdu={all|auto|Type}  Generate PDU table (discover PDUs automatically)\n"
 "\n"
 
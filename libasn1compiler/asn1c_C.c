@@ -54,13 +54,23 @@ static int emit_member_PER_constraints(arg_t *arg, asn1p_expr_t *expr, const cha
 static int emit_member_table(arg_t *arg, asn1p_expr_t *expr,
                              asn1c_ioc_table_and_objset_t *);
 static int emit_tag2member_map(arg_t *arg, tag2el_t *tag2el, int tag2el_count, const char *opt_modifier);
+static int emit_name2member_map(arg_t *arg);
 static int emit_include_dependencies(arg_t *arg);
 static asn1p_expr_t *terminal_structable(arg_t *arg, asn1p_expr_t *expr);
 static int expr_defined_recursively(arg_t *arg, asn1p_expr_t *expr);
 static int asn1c_recurse(arg_t *arg, asn1p_expr_t *expr, int (*callback)(arg_t *arg, void *key), void *key);
 static asn1p_expr_type_e expr_get_type(arg_t *arg, asn1p_expr_t *expr);
 static int try_inline_default(arg_t *arg, asn1p_expr_t *expr, int out);
+static int try_inline_optional(arg_t *arg, asn1p_expr_t *expr);
 static int *compute_canonical_members_order(arg_t *arg, int el_count);
+static int expr_specialized_codecs(arg_t *arg, asn1p_expr_t *expr);
+static int emit_SEQUENCE_specialized_codecs(arg_t *arg);
+static int expr_aggregate_constraints(arg_t *arg, asn1p_expr_t *expr);
+static int emit_SEQUENCE_aggregate_constraints(arg_t *arg);
+static abuf *aggr_member_test(arg_t *arg, asn1p_expr_t *v, const char *value);
+static int emit_SEQUENCE_OF_values_constraint(arg_t *arg, asn1p_expr_t *v);
+static int expr_protobuf_codec(arg_t *arg, asn1p_expr_t *expr);
+static int emit_protobuf_codec(arg_t *arg);
 
 enum tvm_compat {
 	_TVM_SAME	= 0,	/* tags and all_tags are same */
@@ -78,6 +88,9 @@ static int emit_type_DEF(arg_t *arg, asn1p_expr_t *expr, enum tvm_compat tv_mode
 #define	C99_MODE	(!(arg->flags & A1C_NO_C99))
 #define	UNNAMED_UNIONS	(arg->flags & A1C_UNNAMED_UNIONS)
 #define	HIDE_INNER_DEFS	(arg->embed && !(arg->flags & A1C_ALL_DEFS_GLOBAL))
+/* OPTIONAL member made inline by -finline-optionals */
+#define	INLINE_OPTIONAL(expr)	\
+	(((expr)->marker.flags & EM_DEFAULT) == (EM_OPTIONAL & ~EM_INDIRECT))
 
 #define	PCTX_DEF INDENTED(		\
 	OUT("\n");			\
@@ -327,7 +340,10 @@ asn1c_lang_C_type_SEQUENCE(arg_t *arg) {
 	asn1p_expr_t *expr = arg->expr;
 	asn1p_expr_t *v;
 	int comp_mode = 0;	/* {root,ext=1,root,root,...} */
+	int elements = 0;	/* Number of elements */
+	int presence_bits = 0;	/* Bits of the -finline-optionals map */
 	int saved_target = arg->target->target;
+	const char *id;
     asn1c_ioc_table_and_objset_t ioc_tao;
 
 	DEPENDENCIES;
@@ -361,6 +377,11 @@ asn1c_lang_C_type_SEQUENCE(arg_t *arg) {
 		if(comp_mode == 1)
 			v->marker.flags |= EM_OMITABLE | EM_INDIRECT;
 		try_inline_default(arg, v, 1);
+		if(v->expr_type != A1TC_EXTENSIBLE) {
+			if(!ioc_tao.ioct && try_inline_optional(arg, v))
+				presence_bits = elements + 1;
+			elements++;
+		}
         if(is_open_type(arg, v, ioc_tao.ioct ? &ioc_tao : 0)) {
             arg_t tmp_arg = *arg;
             tmp_arg.embed++;
@@ -380,6 +401,17 @@ asn1c_lang_C_type_SEQUENCE(arg_t *arg) {
 
 	PCTX_DEF;
 
+	if(presence_bits) {
+		/* Must follow _asn_ctx, see ASN_SEQUENCE_PRESENCE_MAP() */
+		INDENTED(
+			id = MKID(expr);
+			OUT("\n");
+			OUT("/* Presence bitmask: ASN_SEQUENCE_ISPRESENT(p%s, member index) */\n", id);
+			OUT("unsigned int _presence_map\n");
+			OUT("\t[((%d+(8*sizeof(unsigned int))-1)/(8*sizeof(unsigned int)))];\n", presence_bits);
+		);
+	}
+
 	if (arg->embed && expr->_anonymous_type) {
 		OUT("} %s%s;\n", (expr->marker.flags & EM_INDIRECT)?"*":"",
 			c_name(arg).base_name);
@@ -410,6 +442,13 @@ emit_tag2member_reference(arg_t *arg, asn1p_expr_t *expr,
     }
 }
 
+static void
+emit_name2member_reference(arg_t *arg, asn1p_expr_t *expr) {
+    if(C99_MODE) OUT(".name2el = ");
+    OUT("&asn_MAP_%s_name2el_%d\t/* Member names */\n", MKID(expr),
+        expr->_type_unique_index);
+}
+
 static int
 asn1c_lang_C_type_SEQUENCE_def(arg_t *arg, asn1c_ioc_table_and_objset_t *opt_ioc) {
 	asn1p_expr_t *expr = arg->expr;
@@ -423,6 +462,7 @@ asn1c_lang_C_type_SEQUENCE_def(arg_t *arg, asn1c_ioc_table_and_objset_t *opt_ioc
 	enum tvm_compat tv_mode;
 	int roms_count;		/* Root optional members */
 	int aoms_count;		/* Additions optional members */
+	int name2el;		/* Whether the name hash is emitted */
 	int saved_target = arg->target->target;
 
 	/*
@@ -528,6 +568,7 @@ asn1c_lang_C_type_SEQUENCE_def(arg_t *arg, asn1c_ioc_table_and_objset_t *opt_ioc
 	 * Tags to elements map.
 	 */
 	emit_tag2member_map(arg, tag2el, tag2el_count, 0);
+	name2el = emit_name2member_map(arg);
 
 	if(!(expr->_type_referenced)) OUT("static ");
 	OUT("asn_SEQUENCE_specifics_t asn_SPC_%s_specs_%d = {\n",
@@ -544,9 +585,21 @@ asn1c_lang_C_type_SEQUENCE_def(arg_t *arg, asn1c_ioc_table_and_objset_t *opt_ioc
 		OUT("0, 0, 0,\t/* Optional elements (not needed) */\n");
 	}
 	OUT("%d,\t/* First extension addition */\n", first_extension);
+	if(name2el) emit_name2member_reference(arg, expr);
 	INDENT(-1);
 	OUT("};\n");
 
+	if(expr_specialized_codecs(arg, expr)
+	&& emit_SEQUENCE_specialized_codecs(arg))
+		return -1;
+
+	if(expr_aggregate_constraints(arg, expr)
+	&& emit_SEQUENCE_aggregate_constraints(arg))
+		return -1;
+
+	if(expr_protobuf_codec(arg, expr) && emit_protobuf_codec(arg))
+		return -1;
+
 	/*
 	 * Emit asn_DEF_xxx table.
 	 */
@@ -651,6 +704,7 @@ asn1c_lang_C_type_SET_def(arg_t *arg) {
 	int all_tags_count;
 	enum tvm_compat tv_mode;
 	const char *p;
+	int name2el;		/* Whether the name hash is emitted */
 	int saved_target = arg->target->target;
 
 	/*
@@ -712,6 +766,7 @@ asn1c_lang_C_type_SET_def(arg_t *arg) {
 	emit_tag2member_map(arg, tag2el, tag2el_count, 0);
 	if(tag2el_cxer)
 	emit_tag2member_map(arg, tag2el_cxer, tag2el_cxer_count, "_cxer");
+	name2el = emit_name2member_map(arg);
 
 	/*
 	 * Emit a map of mandatory elements.
@@ -763,8 +818,9 @@ asn1c_lang_C_type_SET_def(arg_t *arg) {
 			tag2el_cxer_count);
 		OUT("%d,\t/* Whether extensible */\n",
 			compute_extensions_start(expr) == -1 ? 0 : 1);
-		OUT("(const unsigned int *)asn_MAP_%s_mmap_%d\t/* Mandatory elements map */\n",
-			p, expr->_type_unique_index);
+		OUT("(const unsigned int *)asn_MAP_%s_mmap_%d%s\t/* Mandatory elements map */\n",
+			p, expr->_type_unique_index, name2el ? "," : "");
+		if(name2el) emit_name2member_reference(arg, expr);
 	);
 	OUT("};\n");
 
@@ -782,6 +838,28 @@ asn1c_lang_C_type_SET_def(arg_t *arg) {
 	return 0;
 } /* _SET_def() */
 
+/*
+ * Whether the element of SET OF is defined right inside the list.
+ */
+static int
+expr_inline_element(arg_t *arg, asn1p_expr_t *memb) {
+	return (memb->expr_type & ASN_CONSTR_MASK)
+		|| ((memb->expr_type == ASN_BASIC_ENUMERATED
+			|| (0 /* -- prohibited by X.693:8.3.4 */
+				&& memb->expr_type == ASN_BASIC_INTEGER))
+		    && expr_elements_count(arg, memb));
+}
+
+/*
+ * Whether the decoders take the elements of SET OF from the slab
+ * (-fset-of-slab).
+ */
+static int
+expr_set_of_slab(arg_t *arg, asn1p_expr_t *expr) {
+	return (arg->flags & A1C_SET_OF_SLAB)
+		&& !asn1c_type_packed_values(arg, expr);
+}
+
 int
 asn1c_lang_C_type_SEx_OF(arg_t *arg) {
 	asn1p_expr_t *expr = arg->expr;
@@ -801,9 +879,10 @@ asn1c_lang_C_type_SEx_OF(arg_t *arg) {
 	}
 
 	INDENT(+1);
-	OUT("A_%s_OF(",
+	OUT("A_%s_OF%s(",
 		(arg->expr->expr_type == ASN_CONSTR_SET_OF)
-			? "SET" : "SEQUENCE");
+			? "SET" : "SEQUENCE",
+		asn1c_type_packed_values(arg, expr) ? "_VALUES" : "");
 
 	/*
 	 * README README
@@ -811,11 +890,7 @@ asn1c_lang_C_type_SEx_OF(arg_t *arg) {
 	 */
 	memb->marker.flags |= EM_INDIRECT;
 
-	if(memb->expr_type & ASN_CONSTR_MASK
-	|| ((memb->expr_type == ASN_BASIC_ENUMERATED
-		|| (0 /* -- prohibited by X.693:8.3.4 */
-			&& memb->expr_type == ASN_BASIC_INTEGER))
-	    	&& expr_elements_count(arg, memb))) {
+	if(expr_inline_element(arg, memb)) {
 		arg_t tmp;
 		asn1p_expr_t *tmp_memb = memb;
 		enum asn1p_expr_marker_e flags = memb->marker.flags;
@@ -850,6 +925,15 @@ asn1c_lang_C_type_SEx_OF(arg_t *arg) {
 
 	PCTX_DEF;
 
+	if(expr_set_of_slab(arg, expr)) {
+		/* See (.slab_offset) of asn_SET_OF_specifics_t */
+		INDENTED(
+			OUT("\n");
+			OUT("/* Elements allocated at once by the decoders */\n");
+			OUT("void *_asn_slab;\n");
+		);
+	}
+
 	if (arg->embed && expr->_anonymous_type) {
 		OUT("} %s%s;\n", (expr->marker.flags & EM_INDIRECT)?"*":"",
 			c_name(arg).base_name);
@@ -878,11 +962,16 @@ asn1c_lang_C_type_SEx_OF_def(arg_t *arg, int seq_of) {
 	int all_tags_count;
 	enum tvm_compat tv_mode;
 	int saved_target = arg->target->target;
+	int packed = seq_of && asn1c_type_packed_values(arg, expr);
+	int slab = expr_set_of_slab(arg, expr);
+	int values_checked = 0;
 
 	/*
 	 * Print out the table according to which parsing is performed.
 	 */
-	if(seq_of) {
+	if(packed) {
+		GEN_INCLUDE_STD("constr_SEQUENCE_OF_packed");
+	} else if(seq_of) {
 		GEN_INCLUDE_STD("constr_SEQUENCE_OF");
 	} else {
 		GEN_INCLUDE_STD("constr_SET_OF");
@@ -908,6 +997,10 @@ asn1c_lang_C_type_SEx_OF_def(arg_t *arg, int seq_of) {
 		arg->embed++;
 		emit_member_table(arg, v, NULL);
 		arg->embed--;
+		if(packed && !(arg->flags & A1C_NO_CONSTRAINTS)) {
+			values_checked = emit_SEQUENCE_OF_values_constraint(arg, v);
+			REDIR(OT_STAT_DEFS);
+		}
 		free(v->Identifier);
 		v->Identifier = (char *)NULL;
 	INDENT(-1);
@@ -930,9 +1023,32 @@ asn1c_lang_C_type_SEx_OF_def(arg_t *arg, int seq_of) {
 			as_xvl,
 			as_xvl ? "XMLValueList" : "XMLDelimitedItemList");
 		}
+		if(packed)
+			OUT("sizeof(((%s *)0)->list.array[0]),"
+				"\t/* Value size */\n",
+				c_name(arg).full_name);
+		else if(slab && expr_inline_element(arg, v))
+			OUT("sizeof(*((%s *)0)->list.array[0]),"
+				"\t/* Element size */\n",
+				c_name(arg).full_name);
+		else if(slab)
+			/* The list may only have a forward declaration of it */
+			OUT("sizeof(%s),\t/* Element size */\n",
+				asn1c_type_name(arg, v, TNF_CTYPE));
+		if(values_checked)
+			OUT("values_%s_constraint_%d,\n",
+				MKID(expr), expr->_type_unique_index);
+		else if(slab)
+			OUT("0,\t/* No values constraint */\n");
+		if(slab)
+			OUT("offsetof(%s, _asn_slab),\t/* Element slab */\n",
+				c_name(arg).full_name);
 	);
 	OUT("};\n");
 
+	if(expr_protobuf_codec(arg, expr) && emit_protobuf_codec(arg))
+		return -1;
+
 	/*
 	 * Emit asn_DEF_xxx table.
 	 */
@@ -1091,6 +1207,7 @@ asn1c_lang_C_type_CHOICE_def(arg_t *arg) {
 	int all_tags_count;
 	enum tvm_compat tv_mode;
 	int *cmap = 0;
+	int name2el;		/* Whether the name hash is emitted */
 	int saved_target = arg->target->target;
 
 	/*
@@ -1172,6 +1289,7 @@ asn1c_lang_C_type_CHOICE_def(arg_t *arg) {
 	 * Tags to elements map.
 	 */
 	emit_tag2member_map(arg, tag2el, tag2el_count, 0);
+	name2el = emit_name2member_map(arg);
 
     if(!(expr->_type_referenced)) OUT("static ");
     OUT("asn_CHOICE_specifics_t asn_SPC_%s_specs_%d = {\n", MKID(expr),
@@ -1191,10 +1309,15 @@ asn1c_lang_C_type_CHOICE_def(arg_t *arg) {
                 expr->_type_unique_index);
         } else { OUT("0, 0,\n"); }
         if(C99_MODE) OUT(".first_extension = ");
-        OUT("%d\t/* Extensions start */\n", compute_extensions_start(expr));
+        OUT("%d%s\t/* Extensions start */\n", compute_extensions_start(expr),
+            name2el ? "," : "");
+        if(name2el) emit_name2member_reference(arg, expr);
     );
     OUT("};\n");
 
+	if(expr_protobuf_codec(arg, expr) && emit_protobuf_codec(arg))
+		return -1;
+
 	/*
 	 * Emit asn_DEF_xxx table.
 	 */
@@ -1295,8 +1418,8 @@ asn1c_lang_C_type_SIMPLE_TYPE(arg_t *arg) {
 				OUT("\t/* DEFAULT %s */",
 					asn1f_printable_value(
 						expr->marker.default_value));
-			else if((expr->marker.flags & EM_OPTIONAL)
-					== EM_OPTIONAL)
+			else if((expr->marker.flags & (EM_OPTIONAL & ~EM_INDIRECT))
+					== (EM_OPTIONAL & ~EM_INDIRECT))
 				OUT("\t/* OPTIONAL */");
 		}
 
@@ -1432,6 +1555,10 @@ asn1c_lang_C_type_SIMPLE_TYPE(arg_t *arg) {
 		OUT("der_type_encoder_f %s_encode_der;\n", p);
 		OUT("xer_type_decoder_f %s_decode_xer;\n", p);
 		OUT("xer_type_encoder_f %s_encode_xer;\n", p);
+		if(arg->flags & A1C_GEN_JER) {
+		OUT("jer_type_decoder_f %s_decode_jer;\n", p);
+		OUT("jer_type_encoder_f %s_encode_jer;\n", p);
+		}
 		if(arg->flags & A1C_GEN_OER) {
 		OUT("oer_type_decoder_f %s_decode_oer;\n", p);
 		OUT("oer_type_encoder_f %s_encode_oer;\n", p);
@@ -1442,6 +1569,9 @@ asn1c_lang_C_type_SIMPLE_TYPE(arg_t *arg) {
 		}
 	}
 
+	if(expr_protobuf_codec(arg, expr) && emit_protobuf_codec(arg))
+		return -1;
+
 	REDIR(saved_target);
 
 	return 0;
@@ -1710,6 +1840,187 @@ emit_tag2member_map(arg_t *arg, tag2el_t *tag2el, int tag2el_count, const char *
 	return 0;
 }
 
+/*
+ * The types with fewer members are scanned for the XML member names.
+ */
+#define	NAME2EL_MIN_MEMBERS	8
+
+/*
+ * The hash of the member name and its slot, see asn_TYPE_name2member_t.
+ * Must match xer_name_hash() and xer_name_slot() in skeletons/xer_decoder.c.
+ */
+static uint32_t
+name2el_hash(const char *name) {
+	uint32_t h = 2166136261u;	/* FNV-1a */
+	for(; *name; name++) {
+		h ^= (uint8_t)*name;
+		h *= 16777619u;
+	}
+	return h;
+}
+
+static uint32_t
+name2el_slot(uint32_t hash, unsigned displacement) {
+	uint32_t h = hash + displacement * 0x9e3779b9u;
+	h ^= h >> 16;
+	h *= 0x85ebca6bu;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35u;
+	h ^= h >> 16;
+	return h;
+}
+
+/*
+ * Find the displacement for each bucket of the names (the biggest buckets
+ * go first) which puts every name into a slot of its own.
+ */
+static int
+_build_name2el_map(const uint32_t *hashes, int count, unsigned buckets,
+		unsigned *displacement, unsigned slots, int *slot2el) {
+	int *bucket_size = calloc(buckets, sizeof(int));
+	unsigned *taken = calloc(count, sizeof(unsigned));
+	unsigned b;
+	int size;
+	int i, j;
+
+	assert(bucket_size && taken);
+
+	for(i = 0; i < count; i++) {
+		for(j = 0; j < i; j++) {
+			if(hashes[i] == hashes[j]) {
+				free(bucket_size);
+				free(taken);
+				return -1;	/* Inseparable */
+			}
+		}
+		bucket_size[hashes[i] & (buckets - 1)]++;
+	}
+
+	for(b = 0; b < buckets; b++) displacement[b] = 0;
+	for(b = 0; b < slots; b++) slot2el[b] = -1;
+
+	for(size = count; size > 0; size--) {
+		for(b = 0; b < buckets; b++) {
+			unsigned d;
+			int n;
+			if(bucket_size[b] != size) continue;
+			for(d = 0; d < (1u << 20); d++) {
+				for(n = 0, i = 0; i < count; i++) {
+					unsigned slot;
+					if((hashes[i] & (buckets - 1)) != b) continue;
+					slot = name2el_slot(hashes[i], d) & (slots - 1);
+					if(slot2el[slot] != -1) break;
+					for(j = 0; j < n && taken[j] != slot; j++);
+					if(j < n) break;
+					taken[n++] = slot;
+				}
+				if(i == count) break;
+			}
+			if(d == (1u << 20)) {
+				free(bucket_size);
+				free(taken);
+				return -1;
+			}
+			displacement[b] = d;
+			for(i = 0; i < count; i++) {
+				if((hashes[i] & (buckets - 1)) == b)
+					slot2el[name2el_slot(hashes[i], d) & (slots - 1)] = i;
+			}
+		}
+	}
+
+	free(bucket_size);
+	free(taken);
+	return 0;
+}
+
+/*
+ * Emit the perfect hash of the member names for the XER decoder.
+ * Returns 1 if the asn_MAP_<type>_name2el_<N> is emitted.
+ */
+static int
+emit_name2member_map(arg_t *arg) {
+	asn1p_expr_t *expr = arg->expr;
+	asn1p_expr_t *v;
+	uint32_t *hashes;
+	unsigned *displacement;
+	int *slot2el;
+	unsigned buckets = 1;
+	unsigned slots = 1;
+	unsigned i;
+	int count = 0;
+
+	TQ_FOR(v, &(expr->members), next) {
+		if(v->expr_type == A1TC_EXTENSIBLE) continue;
+		if(!v->Identifier || !*v->Identifier
+		|| (v->_anonymous_type && !strcmp(v->Identifier, "Member")))
+			return 0;	/* Not to be looked up by name */
+		count++;
+	}
+	if(count < NAME2EL_MIN_MEMBERS) return 0;
+
+	while(slots <= (unsigned)count) slots <<= 1;
+	while(buckets < (unsigned)(count + 1) / 2) buckets <<= 1;
+
+	hashes = calloc(count, sizeof(hashes[0]));
+	displacement = calloc(buckets, sizeof(displacement[0]));
+	slot2el = calloc(slots, sizeof(slot2el[0]));
+	assert(hashes && displacement && slot2el);
+
+	count = 0;
+	TQ_FOR(v, &(expr->members), next) {
+		if(v->expr_type == A1TC_EXTENSIBLE) continue;
+		hashes[count++] = name2el_hash(v->Identifier);
+	}
+
+	if(_build_name2el_map(hashes, count, buckets, displacement, slots,
+			slot2el)) {
+		free(hashes);
+		free(displacement);
+		free(slot2el);
+		return 0;
+	}
+
+	OUT("static const unsigned asn_MAP_%s_name2el_displacement_%d[] = {",
+		MKID(expr), expr->_type_unique_index);
+	for(i = 0; i < buckets; i++) {
+		if(i && !(i % 16)) {
+			OUT(",\n");
+			OUT("   ");
+		} else if(i) {
+			OUT(",");
+		}
+		OUT(" %u", displacement[i]);
+	}
+	OUT(" };\n");
+	OUT("static const int asn_MAP_%s_name2el_slots_%d[] = {",
+		MKID(expr), expr->_type_unique_index);
+	for(i = 0; i < slots; i++) {
+		if(i && !(i % 16)) {
+			OUT(",\n");
+			OUT("   ");
+		} else if(i) {
+			OUT(",");
+		}
+		OUT(" %d", slot2el[i]);
+	}
+	OUT(" };\n");
+	OUT("static const asn_TYPE_name2member_t asn_MAP_%s_name2el_%d = {\n",
+		MKID(expr), expr->_type_unique_index);
+	INDENT(+1);
+	OUT("asn_MAP_%s_name2el_displacement_%d, %u,\n",
+		MKID(expr), expr->_type_unique_index, buckets);
+	OUT("asn_MAP_%s_name2el_slots_%d, %u\n",
+		MKID(expr), expr->_type_unique_index, slots);
+	INDENT(-1);
+	OUT("};\n");
+
+	free(hashes);
+	free(displacement);
+	free(slot2el);
+	return 1;
+}
+
 static enum tvm_compat
 emit_tags_vectors(arg_t *arg, asn1p_expr_t *expr, int *tags_count_r, int *all_tags_count_r) {
 	struct asn1p_type_tag_s *tags = 0;	/* Effective tags */
@@ -2486,6 +2797,43 @@ try_inline_default(arg_t *arg, asn1p_expr_t *expr, int out) {
 	return 0;
 }
 
+/*
+ * -finline-optionals: store the OPTIONAL member of a simple type inline,
+ * its presence being tracked by the parent's _presence_map.
+ */
+static int
+try_inline_optional(arg_t *arg, asn1p_expr_t *expr) {
+	asn1p_expr_type_e etype;
+
+	if(!(arg->flags & A1C_INLINE_OPTIONALS)
+	|| (expr->marker.flags & EM_DEFAULT) != EM_OPTIONAL
+	|| (expr->marker.flags & EM_UNRECURSE))
+		return 0;
+
+	etype = expr_get_type(arg, expr);
+	switch(etype) {
+	case ASN_BASIC_BOOLEAN:
+	case ASN_BASIC_NULL:
+	case ASN_BASIC_INTEGER:
+	case ASN_BASIC_REAL:
+	case ASN_BASIC_ENUMERATED:
+	case ASN_BASIC_BIT_STRING:
+	case ASN_BASIC_OCTET_STRING:
+	case ASN_BASIC_OBJECT_IDENTIFIER:
+	case ASN_BASIC_RELATIVE_OID:
+	case ASN_BASIC_UTCTime:
+	case ASN_BASIC_GeneralizedTime:
+		break;
+	default:
+		if(etype & ASN_STRING_MASK)
+			break;
+		return 0;
+	}
+
+	expr->marker.flags &= ~EM_INDIRECT;
+	return 1;
+}
+
 static int
 emit_member_type_selector(arg_t *arg, asn1p_expr_t *expr, asn1c_ioc_table_and_objset_t *opt_ioc) {
 	int save_target = arg->target->target;
@@ -2749,7 +3097,8 @@ emit_member_table(arg_t *arg, asn1p_expr_t *expr, asn1c_ioc_table_and_objset_t *
         OUT("ATF_ANY_TYPE | ");
     }
     OUT("%s, ",
-		(expr->marker.flags & EM_INDIRECT)?"ATF_POINTER":"ATF_NOFLAGS");
+		(expr->marker.flags & EM_INDIRECT)?"ATF_POINTER"
+		: INLINE_OPTIONAL(expr)?"ATF_PRESENCE_MAP":"ATF_NOFLAGS");
 	if((expr->marker.flags & EM_OMITABLE) == EM_OMITABLE) {
 		asn1p_expr_t *tv;
 		int opts = 0;
@@ -2925,58 +3274,2295 @@ emit_member_table(arg_t *arg, asn1p_expr_t *expr, asn1c_ioc_table_and_objset_t *
 }
 
 /*
- * Generate "asn_DEF_XXX" type definition.
+ * How a SEQUENCE member is coded by the -fgen-specialized-codecs codec.
+ */
+typedef struct spec_member_s {
+	asn1p_expr_t *expr;
+	char *name;		/* C name of the member */
+	int index;		/* Index in the asn_MBR_xxx[] table */
+	int addition;		/* Extension addition */
+	int opt_bit;		/* Bit in the presence bitmap, or -1 */
+	enum {
+		SPEC_GENERIC,	/* Through the member's type descriptor */
+		SPEC_NULL,	/* No bits */
+		SPEC_BOOLEAN,	/* A single bit */
+		SPEC_WHOLE,	/* Constrained whole number */
+	} kind;
+	int extensible;		/* Whole number's constraint is extensible */
+	int is_unsigned;	/* Whole number is "unsigned long" */
+	int range_bits;
+	asn1c_integer_t lb;
+	asn1c_integer_t ub;
+} spec_member_t;
+
+/*
+ * Whether the SEQUENCE gets its own UPER codec (-fgen-specialized-codecs).
+ * The layouts the table-driven codec has special provisions for
+ * (open types, root members after the extensions, big presence bitmaps)
+ * are left to it.
  */
 static int
-emit_type_DEF(arg_t *arg, asn1p_expr_t *expr, enum tvm_compat tv_mode, int tags_count, int all_tags_count, int elements_count, enum etd_spec spec) {
-	asn1p_expr_t *terminal;
-	int using_type_name = 0;
-	char *expr_id = strdup(MKID(expr));
-	char *p = expr_id;
-	char *p2 = (char *)0;
+expr_specialized_codecs(arg_t *arg, asn1p_expr_t *expr) {
+	asn1p_expr_t *v;
+	int comp_mode = 0;	/* {root,ext=1,root,root,...} */
+	int elements = 0;
+	int roms = 0;
 
-	terminal = asn1f_find_terminal_type_ex(arg->asn, arg->ns, expr);
+	if(!(arg->flags & A1C_GEN_SPECIALIZED_CODECS)
+	|| !(arg->flags & A1C_GEN_PER)
+	|| arg->embed
+	|| expr->expr_type != ASN_CONSTR_SEQUENCE)
+		return 0;
 
-	if(emit_member_OER_constraints(arg, expr, "type"))
-		return -1;
+	TQ_FOR(v, &(expr->members), next) {
+		if(v->expr_type == A1TC_EXTENSIBLE) {
+			comp_mode++;
+			continue;
+		}
+		if(comp_mode > 1
+		|| asn1p_get_component_relation_constraint(v->constraints)
+		|| (v->reference && v->reference->comp_count == 2
+		    && v->reference->components[1].lex_type == RLT_AmpUppercase))
+			return 0;
+		if(comp_mode == 1) {
+			if(!(v->marker.flags & EM_INDIRECT) && !INLINE_OPTIONAL(v))
+				return 0;
+		} else if(v->marker.flags & EM_OMITABLE) {
+			roms++;
+		}
+		elements++;
+	}
 
-	if(emit_member_PER_constraints(arg, expr, "type"))
-		return -1;
+	/* The presence bitmap goes in one per_put_few_bits() */
+	return elements && roms <= 30;
+}
 
-	if(HIDE_INNER_DEFS)
-		OUT("static /* Use -fall-defs-global to expose */\n");
-	OUT("asn_TYPE_descriptor_t asn_DEF_%s", p);
-    if(HIDE_INNER_DEFS || (arg->flags & A1C_ALL_DEFS_GLOBAL))
-        OUT("_%d", expr->_type_unique_index);
-    OUT(" = {\n");
-	INDENT(+1);
+/*
+ * Find out whether the value of the member can be coded in place,
+ * and fold its PER constraints the same way the asn_PER_xxx tables do.
+ */
+static void
+spec_member_kind(arg_t *arg, spec_member_t *sm) {
+	asn1p_expr_t *v = sm->expr;
+	asn1p_expr_t *cexpr = v;	/* Where the PER constraints come from */
+	asn1p_expr_type_e etype = expr_get_type(arg, v);
+	enum asn1c_fitslong_e fits;
+	asn1c_integer_t cover;
 
-		if(expr->_anonymous_type) {
-			p = strdup(ASN_EXPR_TYPE2STR(expr->expr_type));
-			OUT("\"%s\",\n", p?p:"");
-			OUT("\"%s\",\n",
-				p ? asn1c_make_identifier(AMI_CHECK_RESERVED,
-					0, p, 0) : "");
-		} else {
-			OUT("\"%s\",\n", expr->Identifier);
-			OUT("\"%s\",\n", expr->Identifier);
+	sm->kind = SPEC_GENERIC;
+
+	switch(etype) {
+	case ASN_BASIC_NULL:
+		sm->kind = SPEC_NULL;
+		return;
+	case ASN_BASIC_BOOLEAN:
+		sm->kind = SPEC_BOOLEAN;
+		return;
+	case ASN_BASIC_INTEGER:
+	case ASN_BASIC_ENUMERATED:
+		break;
+	default:
+		return;
+	}
+
+	fits = asn1c_type_fits_long(arg, v);
+	if(fits == FL_NOTFIT)
+		return;
+
+	/* The unconstrained member uses the referenced type's constraints */
+	if(!v->constraints && v->expr_type == A1TC_REFERENCE) {
+		cexpr = WITH_MODULE_NAMESPACE(
+			v->module, expr_ns,
+			asn1f_lookup_symbol_ex(arg->asn, expr_ns, v, v->reference));
+		if(!cexpr || cexpr->expr_type != etype)
+			return;
+	}
+
+	if(etype == ASN_BASIC_ENUMERATED) {
+		asn1p_expr_t *terminal;
+		asn1p_expr_t *ev;
+		asn1c_integer_t idx = 0;
+		asn1c_integer_t roots = -1;
+
+		terminal = asn1f_find_terminal_type_ex(arg->asn, arg->ns, v);
+		if(!terminal)
+			return;
+
+		/* Enumerators must be their own PER indexes */
+		TQ_FOR(ev, &(terminal->members), next) {
+			if(ev->expr_type == A1TC_EXTENSIBLE) {
+				if(roots < 0) roots = idx;
+				sm->extensible = 1;
+				continue;
+			}
+			if(ev->expr_type != A1TC_UNIVERVAL
+			|| ev->value->value.v_integer != idx)
+				return;
+			idx++;
+		}
+		if(roots < 0) roots = idx;
+		if(roots == 0)
+			return;
+		sm->lb = 0;
+		sm->ub = roots - 1;
+	} else {
+		asn1cnst_range_t *range;
+
+		if(!cexpr->combined_constraints)
+			return;
+
+		range = asn1constraint_compute_PER_range(cexpr->Identifier, etype,
+				cexpr->combined_constraints, ACT_EL_RANGE, 0, 0, 0);
+		if(!range)
+			return;
+		if(range->incompatible || range->not_PER_visible
+		|| range->empty_constraint
+		|| range->left.type != ARE_VALUE
+		|| range->right.type != ARE_VALUE
+		|| range->left.value < -2147483647
+		|| range->right.value > 2147483647) {
+			asn1constraint_range_free(range);
+			return;
 		}
+		sm->lb = range->left.value;
+		sm->ub = range->right.value;
+		sm->extensible = range->extensible;
+		sm->is_unsigned = (fits == FL_FITS_UNSIGN);
+		asn1constraint_range_free(range);
+	}
 
-		if(expr->expr_type & ASN_CONSTR_MASK) {
-			using_type_name = 1;
-			p = strdup(asn1c_type_name(arg, arg->expr, TNF_SAFE));
+	/* See emit_single_member_PER_constraint() */
+	for(sm->range_bits = 0, cover = 1; cover < sm->ub - sm->lb + 1;
+	    sm->range_bits++)
+		cover *= 2;
+	if(sm->range_bits > 30)
+		return;
+
+	sm->kind = SPEC_WHOLE;
+}
+
+/*
+ * Whether the DEFAULT member has the asn_DFL_xxx_cmp/set functions
+ * (see try_inline_default()), and whether they compare a native value.
+ */
+static int
+spec_default_native(arg_t *arg, asn1p_expr_t *v, int *native) {
+	asn1p_expr_type_e etype = expr_get_type(arg, v);
+
+	*native = 0;
+	if(!(v->marker.flags & EM_DEFAULT & ~EM_OPTIONAL)
+	|| v->marker.default_value == NULL)
+		return 0;
+	switch(etype) {
+	case ASN_BASIC_BOOLEAN:
+	case ASN_BASIC_INTEGER:
+	case ASN_BASIC_ENUMERATED:
+		break;
+	default:
+		return 0;
+	}
+	switch(v->marker.default_value->type) {
+	case ATV_INTEGER:
+	case ATV_TRUE:
+	case ATV_FALSE:
+		break;
+	default:
+		return 0;
+	}
+	*native = (etype == ASN_BASIC_BOOLEAN
+		|| asn1c_type_fits_long(arg, v) != FL_NOTFIT);
+	return 1;
+}
+
+static void
+emit_spec_encode_generic(arg_t *arg, const spec_member_t *sm) {
+	OUT("elm = &td->elements[%d];\n", sm->index);
+	OUT("er = elm->type->op->uper_encoder(elm->type,\n");
+	OUT("\t\telm->encoding_constraints.per_constraints, %sst->%s, po);\n",
+		(sm->expr->marker.flags & EM_INDIRECT) ? "" : "&", sm->name);
+	OUT("if(er.encoded == -1) return er;\n");
+}
+
+static void
+emit_spec_decode_generic(arg_t *arg, const spec_member_t *sm) {
+	OUT("elm = &td->elements[%d];\n", sm->index);
+	if(!(sm->expr->marker.flags & EM_INDIRECT))
+		OUT("memb_ptr = &st->%s;\n", sm->name);
+	OUT("rv = elm->type->op->uper_decoder(opt_codec_ctx, elm->type,\n");
+	if(sm->expr->marker.flags & EM_INDIRECT)
+		OUT("\t\telm->encoding_constraints.per_constraints, "
+			"(void **)&st->%s, pd);\n", sm->name);
+	else
+		OUT("\t\telm->encoding_constraints.per_constraints, "
+			"&memb_ptr, pd);\n");
+	OUT("if(rv.code != RC_OK) return rv;\n");
+}
+
+/* The whole number rebased to the constraint's lower bound */
+static void
+emit_spec_rebased(arg_t *arg, const char *value, asn1c_integer_t lb) {
+	if(lb > 0)
+		OUT("%s - %s", value, asn1p_itoa(lb));
+	else if(lb < 0)
+		OUT("%s + %s", value, asn1p_itoa(-lb));
+	else
+		OUT("%s", value);
+}
+
+static void
+emit_spec_encode_member(arg_t *arg, const spec_member_t *sm) {
+	char value[256];
+
+	switch(sm->kind) {
+	case SPEC_GENERIC:
+		emit_spec_encode_generic(arg, sm);
+		break;
+	case SPEC_NULL:
+		OUT("/* NULL has no bits */\n");
+		break;
+	case SPEC_BOOLEAN:
+		OUT("if(per_put_few_bits(po, st->%s ? 1 : 0, 1))\n", sm->name);
+		OUT("\tASN__ENCODE_FAILED;\n");
+		break;
+	case SPEC_WHOLE:
+		snprintf(value, sizeof(value), "st->%s", sm->name);
+		if(sm->lb == sm->ub) {
+			OUT("if(%s != %s)", value, asn1p_itoa(sm->lb));
+		} else if(sm->is_unsigned && sm->lb == 0) {
+			OUT("if(%s > %s)", value, asn1p_itoa(sm->ub));
 		} else {
-			if (expr->expr_type == A1TC_REFERENCE) {
-				p2 = strdup(asn1c_type_name(arg, terminal, TNF_SAFE));
-			} else {
-				p2 = strdup(asn1c_type_name(arg, expr, TNF_SAFE));
+			/* asn1p_itoa() reuses its buffer */
+			OUT("if(%s < %s", value, asn1p_itoa(sm->lb));
+			OUT(" || %s > %s)", value, asn1p_itoa(sm->ub));
+		}
+		if(sm->extensible) {
+			OUT(" {\n");
+			INDENTED(
+				OUT("/* Outside of the extension root */\n");
+				emit_spec_encode_generic(arg, sm);
+			);
+			/* The extension bit (0) goes in front of the value */
+			OUT("} else if(per_put_few_bits(po, ");
+			emit_spec_rebased(arg, value, sm->lb);
+			OUT(", %d)) {\n", 1 + sm->range_bits);
+			OUT("\tASN__ENCODE_FAILED;\n");
+			OUT("}\n");
+		} else {
+			OUT("\n");
+			OUT("\tASN__ENCODE_FAILED;\n");
+			if(sm->range_bits) {
+				OUT("if(per_put_few_bits(po, ");
+				emit_spec_rebased(arg, value, sm->lb);
+				OUT(", %d))\n", sm->range_bits);
+				OUT("\tASN__ENCODE_FAILED;\n");
+			}
+		}
+		break;
+	}
+}
+
+static void
+emit_spec_decode_member(arg_t *arg, const spec_member_t *sm) {
+	switch(sm->kind) {
+	case SPEC_GENERIC:
+		emit_spec_decode_generic(arg, sm);
+		break;
+	case SPEC_NULL:
+		OUT("/* NULL has no bits */\n");
+		break;
+	case SPEC_BOOLEAN:
+		OUT("value = per_get_few_bits(pd, 1);\n");
+		OUT("if(value < 0) ASN__DECODE_STARVED;\n");
+		OUT("st->%s = value;\n", sm->name);
+		break;
+	case SPEC_WHOLE:
+		if(sm->extensible) {
+			OUT("value = per_get_few_bits(pd, 1);\n");
+			OUT("if(value < 0) ASN__DECODE_STARVED;\n");
+			OUT("if(value) {\n");
+			INDENTED(
+				OUT("/* Outside of the extension root */\n");
+				OUT("per_get_undo(pd, 1);\n");
+				emit_spec_decode_generic(arg, sm);
+			);
+			OUT("} else {\n");
+			INDENT(+1);
+		}
+		if(sm->range_bits) {
+			OUT("value = per_get_few_bits(pd, %d);\n", sm->range_bits);
+			OUT("if(value < 0) ASN__DECODE_STARVED;\n");
+			/* Mimic per_long_range_unrebase() */
+			if(!sm->is_unsigned
+			&& sm->ub - sm->lb + 1 < ((asn1c_integer_t)1 << sm->range_bits))
+				OUT("if(value > %s) ASN__DECODE_FAILED;\n",
+					asn1p_itoa(sm->ub - sm->lb));
+			OUT("st->%s = ", sm->name);
+			emit_spec_rebased(arg, "value", -sm->lb);
+			OUT(";\n");
+		} else {
+			OUT("st->%s = %s;\n", sm->name, asn1p_itoa(sm->lb));
+		}
+		if(sm->extensible) {
+			INDENT(-1);
+			OUT("}\n");
+		}
+		break;
+	}
+}
+
+/*
+ * Emit the straight-line UPER encoder and decoder of a SEQUENCE
+ * along with the asn_OP_xxx_specialized table referring to them.
+ */
+static int
+emit_SEQUENCE_specialized_codecs(arg_t *arg) {
+	asn1p_expr_t *expr = arg->expr;
+	int saved_target = arg->target->target;
+	spec_member_t *members;
+	spec_member_t *sm;
+	asn1p_expr_t *v;
+	char *type;
+	char *id;
+	int comp_mode = 0;	/* {root,ext=1,root,root,...} */
+	int extensible = 0;
+	int additions = 0;
+	int elements = 0;
+	int generic = 0;	/* Members coded by their type descriptors */
+	int inline_generic = 0;
+	int roms = 0;
+	int values = 0;		/* Members needing the "value" variable */
+	int default_additions = 0;
+	int native;
+	int i;
+
+	members = calloc(expr_elements_count(arg, expr) + 1, sizeof(*members));
+	assert(members);
+
+	TQ_FOR(v, &(expr->members), next) {
+		if(v->expr_type == A1TC_EXTENSIBLE) {
+			comp_mode++;
+			extensible = 1;
+			continue;
+		}
+		sm = &members[elements];
+		sm->expr = v;
+		sm->name = strdup(MKID_safe(v));
+		sm->index = elements++;
+		sm->addition = (comp_mode == 1);
+		sm->opt_bit = -1;
+		if(sm->addition) {
+			additions++;
+			if(spec_default_native(arg, v, &native))
+				default_additions++;
+			continue;
+		}
+		if(v->marker.flags & EM_OMITABLE)
+			sm->opt_bit = roms++;
+		/* The members kept by pointer are left to their types */
+		if(!(v->marker.flags & EM_INDIRECT))
+			spec_member_kind(arg, sm);
+		switch(sm->kind) {
+		case SPEC_GENERIC:
+			generic++;
+			if(!(v->marker.flags & EM_INDIRECT))
+				inline_generic++;
+			break;
+		case SPEC_WHOLE:
+			if(sm->extensible) {
+				generic++;
+				inline_generic++;
+			}
+			/* Fall through */
+		case SPEC_BOOLEAN:
+			values++;
+			break;
+		case SPEC_NULL:
+			break;
+		}
+	}
+	/* Bitmap is written from the most significant bit */
+	for(i = 0; i < elements; i++) {
+		if(members[i].opt_bit >= 0)
+			members[i].opt_bit = roms - 1 - members[i].opt_bit;
+	}
+
+	type = strdup(c_name(arg).full_name);
+	id = strdup(MKID(expr));
+
+	REDIR(OT_CODE);
+
+	OUT_NOINDENT("#ifndef\tASN_DISABLE_PER_SUPPORT\n");
+	OUT("/*\n");
+	OUT(" * UPER codec of %s, generated by -fgen-specialized-codecs.\n",
+		expr->Identifier);
+	if(extensible)
+		OUT(" * The extensions are handled by the table-driven codec.\n");
+	OUT(" */\n");
+
+	/*
+	 * The encoder.
+	 */
+	OUT("static asn_enc_rval_t\n");
+	OUT("%s_encode_uper_specialized(const asn_TYPE_descriptor_t *td,\n", id);
+	OUT("\t\tconst asn_per_constraints_t *constraints, const void *sptr,\n");
+	OUT("\t\tasn_per_outp_t *po) {\n");
+	INDENT(+1);
+	OUT("const %s *st = (const %s *)sptr;\n", type, type);
+	OUT("asn_enc_rval_t er = {0, 0, 0};\n");
+	if(generic) OUT("const asn_TYPE_member_t *elm;\n");
+	if(roms) OUT("uint32_t present = 0;\n");
+	OUT("\n");
+	OUT("(void)constraints;\n");
+	OUT("\n");
+	OUT("if(!st) ASN__ENCODE_FAILED;\n");
+	OUT("\n");
+	OUT("/* The table-driven codec checks the constraints as it encodes */\n");
+	OUT("if(asn__encode_constraints)\n");
+	OUT("\treturn SEQUENCE_encode_uper(td, constraints, sptr, po);\n");
+	OUT("\n");
+
+	if(additions) {
+		int first = 1;
+		OUT("/* Extension additions are left to the table-driven codec */\n");
+		OUT("if(");
+		for(i = 0; i < elements; i++) {
+			sm = &members[i];
+			if(!sm->addition) continue;
+			if(!first) {
+				OUT("\n");
+				OUT("|| ");
+			}
+			first = 0;
+			if(sm->expr->marker.flags & EM_INDIRECT)
+				OUT("st->%s", sm->name);
+			else
+				OUT("ASN_SEQUENCE_ISPRESENT(st, %d)", sm->index);
+		}
+		OUT(")\n");
+		OUT("\treturn SEQUENCE_encode_uper(td, constraints, sptr, po);\n");
+		OUT("\n");
+	}
+
+	if(roms) {
+		OUT("/* Presence bitmap */\n");
+		for(i = 0; i < elements; i++) {
+			sm = &members[i];
+			if(sm->opt_bit < 0) continue;
+			OUT("if(");
+			if(INLINE_OPTIONAL(sm->expr)) {
+				OUT("ASN_SEQUENCE_ISPRESENT(st, %d)", sm->index);
+			} else if(spec_default_native(arg, sm->expr, &native)) {
+				const char *dv = asn1p_itoa(
+					sm->expr->marker.default_value->value.v_integer);
+				if(!(sm->expr->marker.flags & EM_INDIRECT))
+					OUT("st->%s != %s", sm->name, dv);
+				else if(native)
+					OUT("st->%s && *st->%s != %s", sm->name, sm->name, dv);
+				else
+					OUT("st->%s && td->elements[%d].default_value_cmp("
+						"st->%s) != 0", sm->name, sm->index, sm->name);
+			} else {
+				OUT("st->%s", sm->name);
+			}
+			OUT(") present |= 1U << %d;\n", sm->opt_bit);
+		}
+		if(extensible)
+			OUT("/* Preceded by the extension bit (0) */\n");
+		OUT("if(per_put_few_bits(po, present, %d))\n", extensible + roms);
+		OUT("\tASN__ENCODE_FAILED;\n");
+		OUT("\n");
+	} else if(extensible) {
+		OUT("/* Extension bit */\n");
+		OUT("if(per_put_few_bits(po, 0, 1))\n");
+		OUT("\tASN__ENCODE_FAILED;\n");
+		OUT("\n");
+	}
+
+	for(i = 0; i < elements; i++) {
+		sm = &members[i];
+		if(sm->addition) continue;
+		OUT("/* %s */\n", sm->expr->Identifier);
+		if(sm->opt_bit >= 0 && sm->kind != SPEC_NULL) {
+			OUT("if(present & (1U << %d)) {\n", sm->opt_bit);
+			INDENTED(emit_spec_encode_member(arg, sm));
+			OUT("}\n");
+		} else {
+			if(sm->expr->marker.flags & EM_INDIRECT)
+				OUT("if(!st->%s) ASN__ENCODE_FAILED;\n", sm->name);
+			emit_spec_encode_member(arg, sm);
+		}
+		OUT("\n");
+	}
+
+	OUT("ASN__ENCODED_OK(er);\n");
+	INDENT(-1);
+	OUT("}\n");
+	OUT("\n");
+
+	/*
+	 * The decoder.
+	 */
+	OUT("static asn_dec_rval_t\n");
+	OUT("%s_decode_uper_specialized(const asn_codec_ctx_t *opt_codec_ctx,\n",
+		id);
+	OUT("\t\tconst asn_TYPE_descriptor_t *td,\n");
+	OUT("\t\tconst asn_per_constraints_t *constraints, void **sptr,\n");
+	OUT("\t\tasn_per_data_t *pd) {\n");
+	INDENT(+1);
+	OUT("%s *st = (%s *)*sptr;\n", type, type);
+	OUT("asn_dec_rval_t rv = {RC_OK, 0};\n");
+	if(generic) OUT("const asn_TYPE_member_t *elm;\n");
+	if(inline_generic) OUT("void *memb_ptr;\n");
+	if(roms) OUT("int32_t present;\n");
+	if(values || extensible) OUT("int32_t value;\n");
+	OUT("\n");
+	OUT("if(ASN__STACK_OVERFLOW_CHECK(opt_codec_ctx))\n");
+	OUT("\tASN__DECODE_FAILED;\n");
+	OUT("\n");
+	OUT("if(!st) {\n");
+	OUT("\tst = (%s *)(*sptr = CALLOC(1, sizeof(*st)));\n", type);
+	OUT("\tif(!st) ASN__DECODE_FAILED;\n");
+	OUT("}\n");
+	OUT("\n");
+
+	if(extensible) {
+		OUT("/* Extension bit */\n");
+		OUT("value = per_get_few_bits(pd, 1);\n");
+		OUT("if(value < 0) ASN__DECODE_STARVED;\n");
+		OUT("if(value) {\n");
+		OUT("\tper_get_undo(pd, 1);\n");
+		OUT("\treturn SEQUENCE_decode_uper(opt_codec_ctx, td, constraints, "
+			"sptr, pd);\n");
+		OUT("}\n");
+		OUT("\n");
+	} else {
+		OUT("(void)constraints;\n");
+		OUT("\n");
+	}
+
+	if(roms) {
+		OUT("/* Presence bitmap */\n");
+		OUT("present = per_get_few_bits(pd, %d);\n", roms);
+		OUT("if(present < 0) ASN__DECODE_STARVED;\n");
+		OUT("\n");
+	}
+
+	for(i = 0; i < elements; i++) {
+		int has_default;
+		sm = &members[i];
+		if(sm->addition) continue;
+		OUT("/* %s */\n", sm->expr->Identifier);
+		if(sm->opt_bit < 0) {
+			emit_spec_decode_member(arg, sm);
+			OUT("\n");
+			continue;
+		}
+		has_default = spec_default_native(arg, sm->expr, &native);
+		if(sm->kind == SPEC_NULL && !INLINE_OPTIONAL(sm->expr)
+		&& !has_default) {
+			emit_spec_decode_member(arg, sm);
+			OUT("\n");
+			continue;
+		}
+		OUT("if(present & (1 << %d)) {\n", sm->opt_bit);
+		INDENTED(
+			if(sm->kind != SPEC_NULL)
+				emit_spec_decode_member(arg, sm);
+			if(INLINE_OPTIONAL(sm->expr))
+				OUT("ASN_SEQUENCE_MKPRESENT(&st->_presence_map, %d);\n",
+					sm->index);
+		);
+		if(has_default) {
+			OUT("} else {\n");
+			INDENT(+1);
+			OUT("/* Fill-in DEFAULT */\n");
+			if(native && !(sm->expr->marker.flags & EM_INDIRECT)) {
+				OUT("st->%s = %s;\n", sm->name, asn1p_itoa(
+					sm->expr->marker.default_value->value.v_integer));
+			} else if(sm->expr->marker.flags & EM_INDIRECT) {
+				OUT("if(td->elements[%d].default_value_set("
+					"(void **)&st->%s))\n", sm->index, sm->name);
+				OUT("\tASN__DECODE_FAILED;\n");
+			} else {
+				OUT("memb_ptr = &st->%s;\n", sm->name);
+				OUT("if(td->elements[%d].default_value_set(&memb_ptr))\n",
+					sm->index);
+				OUT("\tASN__DECODE_FAILED;\n");
+			}
+			INDENT(-1);
+		}
+		OUT("}\n");
+		OUT("\n");
+	}
+
+	if(default_additions) {
+		OUT("/* Fill-in DEFAULT extension additions */\n");
+		for(i = 0; i < elements; i++) {
+			sm = &members[i];
+			if(!sm->addition
+			|| !(sm->expr->marker.flags & EM_INDIRECT)
+			|| !spec_default_native(arg, sm->expr, &native))
+				continue;
+			OUT("if(!st->%s && td->elements[%d].default_value_set("
+				"(void **)&st->%s))\n", sm->name, sm->index, sm->name);
+			OUT("\tASN__DECODE_FAILED;\n");
+		}
+		OUT("\n");
+	}
+
+	OUT("rv.code = RC_OK;\n");
+	OUT("rv.consumed = 0;\n");
+	OUT("return rv;\n");
+	INDENT(-1);
+	OUT("}\n");
+	OUT_NOINDENT("#endif\t/* ASN_DISABLE_PER_SUPPORT */\n");
+	OUT("\n");
+
+	/*
+	 * The table of operations, same as asn_OP_SEQUENCE otherwise.
+	 */
+	REDIR(OT_STAT_DEFS);
+	OUT("static asn_TYPE_operation_t asn_OP_%s_specialized = {\n", id);
+	INDENT(+1);
+	OUT("SEQUENCE_free,\n");
+	OUT("SEQUENCE_print,\n");
+	OUT("SEQUENCE_compare,\n");
+	OUT("SEQUENCE_copy,\n");
+	OUT("SEQUENCE_decode_ber,\n");
+	OUT("SEQUENCE_encode_der,\n");
+	OUT("SEQUENCE_decode_xer,\n");
+	OUT("SEQUENCE_encode_xer,\n");
+	OUT_NOINDENT("#ifdef\tASN_DISABLE_JER_SUPPORT\n");
+	OUT("0,\n");
+	OUT("0,\n");
+	OUT_NOINDENT("#else\n");
+	OUT("SEQUENCE_decode_jer,\n");
+	OUT("SEQUENCE_encode_jer,\n");
+	OUT_NOINDENT("#endif\t/* ASN_DISABLE_JER_SUPPORT */\n");
+	OUT_NOINDENT("#ifdef\tASN_DISABLE_OER_SUPPORT\n");
+	OUT("0,\n");
+	OUT("0,\n");
+	OUT_NOINDENT("#else\n");
+	OUT("SEQUENCE_decode_oer,\n");
+	OUT("SEQUENCE_encode_oer,\n");
+	OUT_NOINDENT("#endif\t/* ASN_DISABLE_OER_SUPPORT */\n");
+	OUT_NOINDENT("#ifdef\tASN_DISABLE_PER_SUPPORT\n");
+	OUT("0,\n");
+	OUT("0,\n");
+	OUT_NOINDENT("#else\n");
+	OUT("%s_decode_uper_specialized,\n", id);
+	OUT("%s_encode_uper_specialized,\n", id);
+	OUT_NOINDENT("#endif\t/* ASN_DISABLE_PER_SUPPORT */\n");
+	OUT("SEQUENCE_random_fill,\n");
+	OUT("0\t/* Use generic outmost tag fetcher */\n");
+	INDENT(-1);
+	OUT("};\n");
+
+	REDIR(saved_target);
+
+	for(i = 0; i < elements; i++)
+		free(members[i].name);
+	free(members);
+	free(type);
+	free(id);
+
+	return 0;
+}
+
+/*
+ * Whether the SEQUENCE gets its own constraint checker
+ * (-fgen-aggregate-constraints).
+ */
+static int
+expr_aggregate_constraints(arg_t *arg, asn1p_expr_t *expr) {
+	return (arg->flags & A1C_GEN_AGGREGATE_CONSTRAINTS)
+		&& !(arg->flags & A1C_NO_CONSTRAINTS)
+		&& !arg->embed
+		&& expr->expr_type == ASN_CONSTR_SEQUENCE
+		&& !expr->combined_constraints;
+}
+
+/*
+ * The test of the member's value the constraint checker of the member
+ * (or, if it has no constraints of its own, of its type) would make.
+ * Returns an empty buffer if there is nothing to test,
+ * and NULL if the checker is to be called.
+ */
+static abuf *
+aggr_member_test(arg_t *arg, asn1p_expr_t *v, const char *value) {
+	asn1p_expr_type_e etype = expr_get_type(arg, v);
+	asn1p_expr_t *cexpr = v;	/* Whose checker it is */
+
+	switch(etype) {
+	case ASN_BASIC_NULL:
+		if(v->constraints)
+			return NULL;
+		return abuf_new();
+	case ASN_BASIC_BOOLEAN:
+	case ASN_BASIC_INTEGER:
+	case ASN_BASIC_ENUMERATED:
+		break;
+	default:
+		return NULL;
+	}
+
+	if(!v->constraints) {
+		if(v->expr_type != A1TC_REFERENCE) {
+			/* The basic type's checker has nothing to check */
+			if(v->combined_constraints)
+				return NULL;
+			return abuf_new();
+		}
+		cexpr = WITH_MODULE_NAMESPACE(
+			v->module, expr_ns,
+			asn1f_lookup_symbol_ex(arg->asn, expr_ns, v, v->reference));
+		if(!cexpr || cexpr->expr_type != etype)
+			return NULL;
+	}
+
+	return asn1c_native_constraint_test(arg, cexpr, etype, value);
+}
+
+/*
+ * Emit the checker of all the values of the SEQUENCE OF kept in place
+ * (-fpacked-sequence-of), testing them in a loop without branching.
+ * Returns 1 if emitted, 0 if the values are not tested in place.
+ */
+static int
+emit_SEQUENCE_OF_values_constraint(arg_t *arg, asn1p_expr_t *v) {
+	asn1p_expr_t *expr = arg->expr;
+	abuf *test;
+
+	test = aggr_member_test(arg, v, "st->list.array[i]");
+	if(!test || !test->length) {
+		/* Checked by the element's checker, if anything */
+		if(test) abuf_free(test);
+		return 0;
+	}
+
+	REDIR(OT_CODE);
+
+	OUT("static int\n");
+	OUT("values_%s_constraint_%d(const void *sptr) {\n",
+		MKID(expr), expr->_type_unique_index);
+	INDENT(+1);
+	OUT("const %s *st = (const %s *)sptr;\n",
+		c_name(arg).full_name, c_name(arg).full_name);
+	OUT("int bad = 0;\n");
+	OUT("int i;\n");
+	OUT("\n");
+	OUT("for(i = 0; i < st->list.count; i++)\n");
+	OUT("\tbad |= !(%s);\n", test->buffer);
+	OUT("\n");
+	OUT("return bad ? -1 : 0;\n");
+	INDENT(-1);
+	OUT("}\n");
+	OUT("\n");
+
+	abuf_free(test);
+	return 1;
+}
+
+/*
+ * Emit the constraint checker of a SEQUENCE testing the values of the
+ * simple members in place, and calling the checkers of the other ones.
+ */
+static int
+emit_SEQUENCE_aggregate_constraints(arg_t *arg) {
+	asn1p_expr_t *expr = arg->expr;
+	int saved_target = arg->target->target;
+	asn1p_expr_t *v;
+	char *type;
+	int elements = 0;
+	int tested = 0;		/* Members tested in place */
+	int generic = 0;	/* Members checked by their checkers */
+
+	type = strdup(c_name(arg).full_name);
+
+	REDIR(OT_CODE);
+
+	OUT("/*\n");
+	OUT(" * Constraint checker of %s, generated by -fgen-aggregate-constraints.\n",
+		expr->Identifier);
+	OUT(" */\n");
+	OUT("static int\n");
+	OUT("%s_constraint_aggregated(const asn_TYPE_descriptor_t *td,\n",
+		MKID(expr));
+	OUT("\t\tconst void *sptr, asn_app_constraint_failed_f *ctfailcb,\n");
+	OUT("\t\tvoid *app_key) {\n");
+	INDENT(+1);
+	OUT("const %s *st = (const %s *)sptr;\n", type, type);
+	OUT("const asn_TYPE_member_t *elm;\n");
+	OUT("int ret;\n");
+	OUT("\n");
+	OUT("if(!st) {\n");
+	OUT("\tASN__CTFAIL(app_key, td, sptr,\n");
+	OUT("\t\t\"%%s: value not given (%%s:%%d)\",\n");
+	OUT("\t\ttd->name, __FILE__, __LINE__);\n");
+	OUT("\treturn -1;\n");
+	OUT("}\n");
+	OUT("\n");
+	OUT("/* The members are checked by the encoder as it gets to them */\n");
+	OUT("if(asn__encode_constraints) return 0;\n");
+	OUT("\n");
+	OUT("/* Checked by asn_decode() already */\n");
+	OUT("if(ASN_SEQUENCE_CONSTRAINTS_OK(st)) return 0;\n");
+	OUT("\n");
+
+	TQ_FOR(v, &(expr->members), next) {
+		char value[256];
+		const char *name;
+		int indirect = (v->marker.flags & EM_INDIRECT);
+		int index;
+		abuf *test;
+
+		if(v->expr_type == A1TC_EXTENSIBLE)
+			continue;
+		index = elements++;
+		name = MKID_safe(v);
+
+		snprintf(value, sizeof(value), "%sst->%s", indirect ? "*" : "",
+			name);
+		test = aggr_member_test(arg, v, value);
+		if(test && !test->length) {
+			abuf_free(test);
+			if(!indirect || (v->marker.flags & EM_OMITABLE))
+				continue;
+			test = NULL;	/* Check the presence */
+		}
+
+		OUT("/* %s */\n", v->Identifier);
+		if(test) {
+			tested++;
+			OUT("if(");
+			if(indirect)
+				OUT("st->%s && ", name);
+			else if(INLINE_OPTIONAL(v))
+				OUT("ASN_SEQUENCE_ISPRESENT(st, %d) && ", index);
+			OUT("!(%s)) {\n", test->buffer);
+			abuf_free(test);
+			INDENT(+1);
+			OUT("elm = &td->elements[%d];\n", index);
+			OUT("ASN__CTFAIL(app_key, elm->type, ");
+			OUT("%sst->%s,\n", indirect ? "" : "&", name);
+			OUT("\t\"%%s: constraint failed (%%s:%%d)\",\n");
+			OUT("\telm->type->name, __FILE__, __LINE__);\n");
+			OUT("return -1;\n");
+			INDENT(-1);
+			OUT("}\n");
+			OUT("\n");
+			continue;
+		}
+
+		generic++;
+		if(indirect && !(v->marker.flags & EM_OMITABLE)) {
+			OUT("if(!st->%s) {\n", name);
+			OUT("\tASN__CTFAIL(app_key, td, sptr,\n");
+			OUT("\t\t\"%%s: mandatory element %%s absent (%%s:%%d)\",\n");
+			OUT("\t\ttd->name, td->elements[%d].name, __FILE__, __LINE__);\n",
+				index);
+			OUT("\treturn -1;\n");
+			OUT("}\n");
+		} else if(indirect) {
+			OUT("if(st->%s) {\n", name);
+			INDENT(+1);
+		} else if(INLINE_OPTIONAL(v)) {
+			OUT("if(ASN_SEQUENCE_ISPRESENT(st, %d)) {\n", index);
+			INDENT(+1);
+		}
+		OUT("elm = &td->elements[%d];\n", index);
+		if(v->constraints)
+			OUT("ret = elm->encoding_constraints.general_constraints(\n");
+		else
+			OUT("ret = elm->type->encoding_constraints.general_constraints(\n");
+		OUT("\telm->type, %sst->%s, ctfailcb, app_key);\n",
+			indirect ? "" : "&", name);
+		OUT("if(ret) return ret;\n");
+		if((indirect && (v->marker.flags & EM_OMITABLE))
+		|| INLINE_OPTIONAL(v)) {
+			INDENT(-1);
+			OUT("}\n");
+		}
+		OUT("\n");
+	}
+
+	if(!tested && !generic)
+		OUT("(void)elm;\n");
+	if(!generic)
+		OUT("(void)ret;\n");
+	OUT("if(asn__decode_constraints) SEQUENCE_mark_constraints_ok(td, sptr);\n");
+	OUT("\n");
+	OUT("return 0;\n");
+	INDENT(-1);
+	OUT("}\n");
+	OUT("\n");
+
+	REDIR(saved_target);
+
+	free(type);
+
+	return 0;
+}
+
+/*
+ * How a value is represented in the -B protobuf schema (-gen-protobuf).
+ */
+enum pb_kind {
+	PBK_NONE,	/* Not in the schema, can't be coded */
+	PBK_NULL,	/* int32, always 0 */
+	PBK_BOOL,	/* bool from BOOLEAN_t */
+	PBK_LONG,	/* int32 or enum from long */
+	PBK_ULONG,	/* int32 from unsigned long */
+	PBK_INTEGER,	/* int32 or enum from INTEGER_t */
+	PBK_OCTETS,	/* bytes or string from OCTET STRING */
+	PBK_BIT_STRING,	/* asn1.v1.BitString */
+	PBK_MESSAGE,	/* Message of the named type */
+};
+
+/*
+ * A field of the message of the type.
+ */
+typedef struct pb_field_s {
+	asn1p_expr_t *expr;
+	int index;		/* Index in the asn_MBR_xxx[] table */
+	int number;		/* Field number */
+	enum pb_kind kind;
+	char *type_id;		/* PBK_MESSAGE: whose codec it is */
+	char *value;		/* C expression of the member */
+	int pointer;		/* The expression is a pointer to the value */
+	char *elm_td;		/* Type descriptor of the (element) value */
+	int repeated;		/* SEQUENCE OF */
+	int indirect;		/* Member kept by pointer */
+} pb_field_t;
+
+/*
+ * The C expressions to get at the value.
+ */
+typedef struct pb_slot_s {
+	char value[384];	/* The value itself */
+	char addr[384];		/* Pointer to it */
+	char mem[384];		/* Prefix to get at its members */
+} pb_slot_t;
+
+static void
+pb_slot_value(pb_slot_t *slot, const char *value) {
+	snprintf(slot->value, sizeof(slot->value), "%s", value);
+	snprintf(slot->addr, sizeof(slot->addr), "&%s", value);
+	snprintf(slot->mem, sizeof(slot->mem), "%s.", value);
+}
+
+static void
+pb_slot_pointer(pb_slot_t *slot, const char *ptr) {
+	snprintf(slot->value, sizeof(slot->value), "*%s", ptr);
+	snprintf(slot->addr, sizeof(slot->addr), "%s", ptr);
+	snprintf(slot->mem, sizeof(slot->mem), "%s->", ptr);
+}
+
+static int pb_type_supported(arg_t *arg, asn1p_expr_t *expr);
+
+/*
+ * The representation of the value of the type or member.
+ * The references are the messages of the named types, except for the
+ * ENUMERATED types, which are the protobuf enums.
+ */
+static enum pb_kind
+pb_value_kind(arg_t *arg, asn1p_expr_t *v, char **type_id) {
+	asn1p_ref_t *ref = v->reference;
+	asn1p_expr_t *target;
+
+	switch(v->expr_type) {
+	case A1TC_REFERENCE:
+		if(v->meta_type != AMT_TYPEREF || !ref || !ref->comp_count
+		|| ref->components[ref->comp_count - 1].name[0] == '&')
+			return PBK_NONE;
+		target = WITH_MODULE_NAMESPACE(
+			v->module, expr_ns,
+			asn1f_lookup_symbol_ex(arg->asn, expr_ns, v, ref));
+		if(!target)
+			return PBK_NONE;
+		if(target->expr_type == ASN_BASIC_ENUMERATED)
+			break;
+		if(!pb_type_supported(arg, target))
+			return PBK_NONE;
+		if(type_id)
+			*type_id = strdup(asn1c_type_name(arg, v, TNF_SAFE));
+		return PBK_MESSAGE;
+	case ASN_BASIC_NULL:
+		return PBK_NULL;
+	case ASN_BASIC_BOOLEAN:
+		return PBK_BOOL;
+	case ASN_BASIC_INTEGER:
+	case ASN_BASIC_ENUMERATED:
+		break;
+	case ASN_BASIC_OCTET_STRING:
+	case ASN_BASIC_UTCTime:
+	case ASN_BASIC_GeneralizedTime:
+	case ASN_STRING_IA5String:
+	case ASN_STRING_PrintableString:
+	case ASN_STRING_VisibleString:
+	case ASN_STRING_ISO646String:
+	case ASN_STRING_NumericString:
+	case ASN_STRING_UTF8String:
+		return PBK_OCTETS;
+	case ASN_BASIC_BIT_STRING:
+		return PBK_BIT_STRING;
+	default:
+		return PBK_NONE;
+	}
+
+	switch(asn1c_type_fits_long(arg, v)) {
+	case FL_NOTFIT:
+		return PBK_INTEGER;
+	case FL_FITS_UNSIGN:
+		return PBK_ULONG;
+	default:
+		return PBK_LONG;
+	}
+}
+
+/*
+ * Whether the type has a message in the -B schema this tree can code.
+ */
+static int
+pb_type_supported(arg_t *arg, asn1p_expr_t *expr) {
+	switch(expr->expr_type) {
+	case ASN_CONSTR_SEQUENCE:
+	case ASN_CONSTR_CHOICE:
+		return 1;
+	case ASN_CONSTR_SEQUENCE_OF:
+		return pb_value_kind(arg, TQ_FIRST(&(expr->members)), 0)
+			!= PBK_NONE;
+	case ASN_BASIC_ENUMERATED:
+		return 0;	/* A protobuf enum */
+	default:
+		return pb_value_kind(arg, expr, 0) != PBK_NONE;
+	}
+}
+
+/*
+ * Whether the type gets the protobuf codec (-gen-protobuf).
+ */
+static int
+expr_protobuf_codec(arg_t *arg, asn1p_expr_t *expr) {
+	return (arg->flags & A1C_GEN_PROTOBUF)
+		&& !arg->embed
+		&& pb_type_supported(arg, expr);
+}
+
+/*
+ * The value of the scalar field, as the int64_t to send.
+ */
+static const char *
+pb_scalar_int(enum pb_kind kind, const char *value) {
+	static char buf[400];
+
+	switch(kind) {
+	case PBK_NULL:
+		return "0";
+	case PBK_BOOL:
+		snprintf(buf, sizeof(buf), "%s ? 1 : 0", value);
+		break;
+	case PBK_INTEGER:
+		return "value";
+	default:
+		snprintf(buf, sizeof(buf), "(int64_t)%s", value);
+	}
+	return buf;
+}
+
+static int
+pb_scalar(enum pb_kind kind) {
+	switch(kind) {
+	case PBK_NULL:
+	case PBK_BOOL:
+	case PBK_LONG:
+	case PBK_ULONG:
+	case PBK_INTEGER:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+/*
+ * Send the value as the field. With (implicit), the zero values
+ * are not sent, as proto3 does for the fields without presence.
+ */
+static void
+emit_pb_put_value(arg_t *arg, const pb_field_t *f, const pb_slot_t *slot,
+		int implicit) {
+	switch(f->kind) {
+	case PBK_NONE:
+		return;
+	case PBK_NULL:
+		if(implicit) {
+			OUT("/* NULL is 0, not sent */\n");
+			return;
+		}
+		OUT("if(pb_put_int(&po, %d, 0))\n", f->number);
+		break;
+	case PBK_BOOL:
+	case PBK_LONG:
+	case PBK_ULONG:
+		OUT("if(%s%spb_put_int(&po, %d, %s))\n",
+			implicit ? slot->value : "", implicit ? " && " : "",
+			f->number, pb_scalar_int(f->kind, slot->value));
+		break;
+	case PBK_INTEGER:
+		if(implicit) {
+			OUT("if(%ssize && (asn_INTEGER2imax(%s, &value)\n",
+				slot->mem, slot->addr);
+			OUT("\t|| (value && pb_put_int(&po, %d, value))))\n",
+				f->number);
+		} else {
+			OUT("if(asn_INTEGER2imax(%s, &value)\n", slot->addr);
+			OUT("|| pb_put_int(&po, %d, value))\n", f->number);
+		}
+		break;
+	case PBK_OCTETS:
+		OUT("if(%s%spb_put_bytes(&po, %d, %sbuf,\n",
+			implicit ? slot->mem : "", implicit ? "size && " : "",
+			f->number, slot->mem);
+		OUT("\t\t%ssize))\n", slot->mem);
+		break;
+	case PBK_BIT_STRING:
+		OUT("if(%s%spb_put_bit_string(&po, %d, %sbuf, %ssize,\n",
+			implicit ? slot->mem : "", implicit ? "size && " : "",
+			f->number, slot->mem, slot->mem);
+		OUT("\t\t%sbits_unused))\n", slot->mem);
+		break;
+	case PBK_MESSAGE:
+		OUT("if(pb_put_message(&po, %d, %s_encode_protobuf,\n",
+			f->number, f->type_id);
+		OUT("\t\t%s, %s))\n", f->elm_td, slot->addr);
+		break;
+	}
+	OUT("\tASN__ENCODE_FAILED;\n");
+}
+
+/*
+ * Send the SEQUENCE OF, packing the scalars as proto3 does.
+ */
+static void
+emit_pb_put_list(arg_t *arg, const pb_field_t *f, const char *list) {
+	pb_slot_t slot;
+	char ptr[320];
+
+	snprintf(ptr, sizeof(ptr), "%s.array[i]", list);
+	pb_slot_pointer(&slot, ptr);
+
+	if(!pb_scalar(f->kind)) {
+		OUT("for(i = 0; i < %s.count; i++) {\n", list);
+		INDENTED(emit_pb_put_value(arg, f, &slot, 0));
+		OUT("}\n");
+		return;
+	}
+
+	OUT("if(%s.count) {\n", list);
+	INDENT(+1);
+	OUT("size = 0;\n");
+	OUT("for(i = 0; i < %s.count; i++) {\n", list);
+	INDENT(+1);
+	if(f->kind == PBK_INTEGER) {
+		OUT("if(asn_INTEGER2imax(%s, &value))\n", slot.addr);
+		OUT("\tASN__ENCODE_FAILED;\n");
+	}
+	OUT("size += pb_varint_size((uint64_t)(%s));\n",
+		pb_scalar_int(f->kind, slot.value));
+	INDENT(-1);
+	OUT("}\n");
+	OUT("if(pb_put_tag(&po, %d, PB_WT_LEN) || pb_put_varint(&po, size))\n",
+		f->number);
+	OUT("\tASN__ENCODE_FAILED;\n");
+	OUT("for(i = 0; i < %s.count; i++) {\n", list);
+	INDENT(+1);
+	if(f->kind == PBK_INTEGER)
+		OUT("(void)asn_INTEGER2imax(%s, &value);\n", slot.addr);
+	OUT("if(pb_put_varint(&po, (uint64_t)(%s)))\n",
+		pb_scalar_int(f->kind, slot.value));
+	OUT("\tASN__ENCODE_FAILED;\n");
+	INDENT(-1);
+	OUT("}\n");
+	INDENT(-1);
+	OUT("}\n");
+}
+
+/*
+ * Send the member, if it is there.
+ */
+static void
+emit_pb_put_field(arg_t *arg, const pb_field_t *f, int choice) {
+	int mandatory = choice || !(f->expr->marker.flags & EM_OMITABLE);
+	int implicit = !choice;
+	int presence = 0;
+	pb_slot_t slot;
+	char list[288];
+
+	if(f->indirect && mandatory) {
+		OUT("if(!%s)\n", f->value);
+		OUT("\tASN__ENCODE_FAILED;\n");
+		implicit = 0;
+	} else if(f->indirect) {
+		OUT("if(%s) {\n", f->value);
+		presence = 1;
+	} else if(!f->pointer && INLINE_OPTIONAL(f->expr)) {
+		OUT("if(ASN_SEQUENCE_ISPRESENT(st, %d)) {\n", f->index);
+		presence = 1;
+	}
+	if(presence) {
+		INDENT(+1);
+		implicit = 0;
+	}
+
+	snprintf(list, sizeof(list), "%s%slist", f->value,
+		f->pointer ? "->" : ".");
+	if(f->kind == PBK_NONE) {
+		if(f->repeated) {
+			OUT("if(%s.count)\t/* Not in the -B schema */\n", list);
+			OUT("\tASN__ENCODE_FAILED;\n");
+		} else {
+			OUT("ASN__ENCODE_FAILED;\t/* Not in the -B schema */\n");
+		}
+	} else if(f->repeated) {
+		emit_pb_put_list(arg, f, list);
+	} else {
+		if(f->pointer)
+			pb_slot_pointer(&slot, f->value);
+		else
+			pb_slot_value(&slot, f->value);
+		emit_pb_put_value(arg, f, &slot, implicit);
+	}
+
+	if(presence) {
+		INDENT(-1);
+		OUT("}\n");
+	}
+}
+
+/*
+ * The condition which parses the value of the field from the (input)
+ * into the slot, true on failure.
+ */
+static void
+emit_pb_get_cond(arg_t *arg, const pb_field_t *f, const pb_slot_t *slot,
+		const char *input) {
+	switch(f->kind) {
+	case PBK_NONE:
+		break;
+	case PBK_NULL:
+		OUT("pb_get_int64(%s, wt, &value)", input);
+		break;
+	case PBK_BOOL:
+		OUT("pb_get_bool(%s, wt, %s)", input, slot->addr);
+		break;
+	case PBK_LONG:
+		OUT("pb_get_long(%s, wt, %s)", input, slot->addr);
+		break;
+	case PBK_ULONG:
+		OUT("pb_get_ulong(%s, wt, %s)", input, slot->addr);
+		break;
+	case PBK_INTEGER:
+		OUT("pb_get_int64(%s, wt, &value)\n", input);
+		OUT("|| asn_imax2INTEGER(%s, value)", slot->addr);
+		break;
+	case PBK_OCTETS:
+		OUT("pb_get_octets(%s, wt, &%sbuf,\n", input, slot->mem);
+		OUT("\t\t&%ssize)", slot->mem);
+		break;
+	case PBK_BIT_STRING:
+		OUT("pb_get_bit_string(%s, wt, &%sbuf, &%ssize,\n", input,
+			slot->mem, slot->mem);
+		OUT("\t\t&%sbits_unused)", slot->mem);
+		break;
+	case PBK_MESSAGE:
+		OUT("pb_get_message(%s, wt, %s_decode_protobuf,\n", input,
+			f->type_id);
+		if(f->indirect && !f->repeated)
+			OUT("\t\topt_codec_ctx, %s, (void **)&%s)", f->elm_td,
+				slot->addr);
+		else
+			OUT("\t\topt_codec_ctx, %s, &memb_ptr)", f->elm_td);
+		break;
+	}
+}
+
+/*
+ * Parse the elements of the SEQUENCE OF, packed or not.
+ */
+static void
+emit_pb_get_list(arg_t *arg, const pb_field_t *f, const char *list) {
+	const char *input = "&pi";
+	pb_slot_t slot;
+
+	switch(f->kind) {
+	case PBK_OCTETS:
+		pb_slot_pointer(&slot, "((OCTET_STRING_t *)memb_ptr)");
+		break;
+	case PBK_BIT_STRING:
+		pb_slot_pointer(&slot, "((BIT_STRING_t *)memb_ptr)");
+		break;
+	default:
+		pb_slot_pointer(&slot, "memb_ptr");
+	}
+
+	if(pb_scalar(f->kind)) {
+		input = "&values";
+		OUT("if(pb_get_packed(&pi, &wt, &values))\n");
+		OUT("\tASN__DECODE_FAILED;\n");
+		OUT("while(values.ptr < values.end) {\n");
+		INDENT(+1);
+	}
+
+	if(f->kind == PBK_MESSAGE) {
+		OUT("memb_ptr = 0;\n");
+		OUT("if(");
+	} else {
+		OUT("memb_ptr = CALLOC(1, sizeof(*%s.array[0]));\n", list);
+		OUT("if(!memb_ptr\n");
+		OUT("|| ");
+	}
+	emit_pb_get_cond(arg, f, &slot, input);
+	OUT("\n");
+	OUT("|| ASN_SEQUENCE_ADD(&%s, memb_ptr)) {\n", list);
+	OUT("\tASN_STRUCT_FREE(*%s, memb_ptr);\n", f->elm_td);
+	OUT("\tASN__DECODE_FAILED;\n");
+	OUT("}\n");
+
+	if(pb_scalar(f->kind)) {
+		INDENT(-1);
+		OUT("}\n");
+	}
+}
+
+/*
+ * Parse the member, merging it into the value already there.
+ */
+static void
+emit_pb_get_field(arg_t *arg, const pb_field_t *f, int choice) {
+	pb_slot_t slot;
+	char list[288];
+
+	if(choice) {
+		OUT("if(st->present != %s) {\n", c_presence_name(arg, f->expr));
+		OUT("\tASN_STRUCT_RESET(*td, st);\n");
+		OUT("\tst->present = %s;\n", c_presence_name(arg, f->expr));
+		OUT("}\n");
+	}
+
+	/* The message decoder allocates its own structure */
+	if(f->indirect && (f->repeated || f->kind != PBK_MESSAGE)) {
+		OUT("if(!%s) {\n", f->value);
+		OUT("\t%s = CALLOC(1, sizeof(*%s));\n", f->value, f->value);
+		OUT("\tif(!%s) ASN__DECODE_FAILED;\n", f->value);
+		OUT("}\n");
+	}
+
+	if(f->repeated) {
+		snprintf(list, sizeof(list), "%s%slist", f->value,
+			f->pointer ? "->" : ".");
+		emit_pb_get_list(arg, f, list);
+		return;
+	}
+
+	if(f->pointer)
+		pb_slot_pointer(&slot, f->value);
+	else
+		pb_slot_value(&slot, f->value);
+	if(f->kind == PBK_MESSAGE && !f->indirect)
+		OUT("memb_ptr = %s;\n", slot.addr);
+	OUT("if(");
+	emit_pb_get_cond(arg, f, &slot, "&pi");
+	OUT(")\n");
+	OUT("\tASN__DECODE_FAILED;\n");
+	if(!choice && !f->pointer && INLINE_OPTIONAL(f->expr))
+		OUT("ASN_SEQUENCE_MKPRESENT(&st->_presence_map, %d);\n", f->index);
+}
+
+/*
+ * Where the UPER to protobuf converter reads the value from.
+ */
+typedef struct pb_uper_s {
+	const char *pd;		/* The bit stream */
+	int open_type;		/* Contents of the "ot", released on failure */
+} pb_uper_t;
+
+/* Finish the condition with the (action) taken on failure */
+static void
+emit_pb_uper_fail(arg_t *arg, const pb_uper_t *u, const char *action) {
+	if(u->open_type) {
+		OUT(" {\n");
+		OUT("\tFREEMEM(ot.copy);\n");
+		OUT("\t%s;\n", action);
+		OUT("}\n");
+	} else {
+		OUT("\n");
+		OUT("\t%s;\n", action);
+	}
+}
+
+static const char *
+pb_uper_flags(int implicit, int is_unsigned) {
+	if(implicit && is_unsigned)
+		return "PB_UPER_IMPLICIT | PB_UPER_UNSIGNED";
+	else if(implicit)
+		return "PB_UPER_IMPLICIT";
+	else if(is_unsigned)
+		return "PB_UPER_UNSIGNED";
+	return "0";
+}
+
+/* The value of the field, the element if it is SEQUENCE OF */
+static asn1p_expr_t *
+pb_uper_value_expr(const pb_field_t *f, int outer) {
+	if(f->repeated && !outer)
+		return TQ_FIRST(&(f->expr->members));
+	return f->expr;
+}
+
+/*
+ * Whether the value is read into the "value" variable.
+ */
+static int
+pb_uper_needs_value(arg_t *arg, const pb_field_t *f, int outer) {
+	spec_member_t sm;
+
+	switch(f->kind) {
+	case PBK_BOOL:
+		return 1;
+	case PBK_LONG:
+	case PBK_ULONG:
+		memset(&sm, 0, sizeof(sm));
+		sm.expr = pb_uper_value_expr(f, outer);
+		spec_member_kind(arg, &sm);
+		return sm.kind == SPEC_WHOLE && (sm.range_bits || sm.extensible);
+	default:
+		return 0;
+	}
+}
+
+/*
+ * The DEFAULT value the UPER decoder fills in for the absent member,
+ * sent by the encoder unless the member is kept inline (then it is 0):
+ * 1 for the whole numbers and BOOLEAN, 2 for the strings.
+ */
+static int
+pb_uper_default(arg_t *arg, const pb_field_t *f) {
+	asn1p_value_t *dv = f->expr->marker.default_value;
+	int native;
+
+	if(!f->indirect || f->repeated)
+		return 0;
+	if(spec_default_native(arg, f->expr, &native))
+		return pb_scalar(f->kind) ? 1 : 0;
+	if(f->kind == PBK_OCTETS && dv && dv->type == ATV_STRING
+	&& (f->expr->marker.flags & EM_DEFAULT & ~EM_OPTIONAL)
+	&& (expr_get_type(arg, f->expr) & ASN_STRING_KM_MASK))
+		return 2;
+	return 0;
+}
+
+static void
+emit_pb_uper_default(arg_t *arg, const pb_uper_t *u, const pb_field_t *f) {
+	asn1p_value_t *dv = f->expr->marker.default_value;
+
+	switch(pb_uper_default(arg, f)) {
+	case 1:
+		OUT("if(pb_uper_put_int(pb, %d, %s, 0))\t/* DEFAULT */", f->number,
+			asn1p_itoa(dv->value.v_integer));
+		emit_pb_uper_fail(arg, u, "ASN__DECODE_FAILED");
+		break;
+	case 2:
+		OUT("{\t/* DEFAULT */\n");
+		INDENT(+1);
+		emit_default_string_value(arg, dv);
+		OUT("if(pb_put_bytes(&pb->po, %d, defv, sizeof(defv) - 1))",
+			f->number);
+		emit_pb_uper_fail(arg, u, "ASN__DECODE_FAILED");
+		INDENT(-1);
+		OUT("}\n");
+		break;
+	}
+}
+
+/* Convert the value through the pb_uper_put_xxx() helper */
+static void
+emit_pb_uper_helper(arg_t *arg, const pb_uper_t *u, const char *helper,
+		const char *td, const char *ct, int number, const char *flags) {
+	OUT("rv = pb_uper_put_%s(opt_codec_ctx, %s,\n", helper, td);
+	OUT("\t\t%s, %s, pb, %d, %s);\n", ct, u->pd, number, flags);
+	OUT("if(rv.code != RC_OK)");
+	emit_pb_uper_fail(arg, u, "return rv");
+}
+
+/*
+ * Convert the value of the (td) type with the PER constraints (ct)
+ * into the field (number), 0 being the element of the packed field.
+ * The (outer) constraints may override the ones the type has.
+ */
+static void
+emit_pb_uper_value(arg_t *arg, const pb_uper_t *u, const pb_field_t *f,
+		asn1p_expr_t *v, const char *td, const char *ct, int number,
+		int implicit, int outer) {
+	const char *flags = pb_uper_flags(implicit, f->kind == PBK_ULONG);
+	spec_member_t sm;
+
+	switch(f->kind) {
+	case PBK_NONE:
+		return;
+	case PBK_NULL:
+		OUT("/* NULL has no bits */\n");
+		if(implicit)
+			return;
+		OUT("if(pb_uper_put_int(pb, %d, 0, 0))", number);
+		emit_pb_uper_fail(arg, u, "ASN__DECODE_FAILED");
+		return;
+	case PBK_BOOL:
+		OUT("value = per_get_few_bits(%s, 1);\n", u->pd);
+		OUT("if(value < 0)");
+		emit_pb_uper_fail(arg, u, "ASN__DECODE_STARVED");
+		OUT("if(pb_uper_put_int(pb, %d, value, %s))", number, flags);
+		emit_pb_uper_fail(arg, u, "ASN__DECODE_FAILED");
+		return;
+	case PBK_LONG:
+	case PBK_ULONG:
+		break;
+	case PBK_INTEGER:
+		emit_pb_uper_helper(arg, u, "integer", td, ct, number, flags);
+		return;
+	case PBK_OCTETS:
+		emit_pb_uper_helper(arg, u, "octets", td, ct, number, flags);
+		return;
+	case PBK_BIT_STRING:
+		emit_pb_uper_helper(arg, u, "bit_string", td, ct, number, flags);
+		return;
+	case PBK_MESSAGE:
+		OUT("if(pb_begin_message(pb, %d, &mark))", number);
+		emit_pb_uper_fail(arg, u, "ASN__DECODE_FAILED");
+		OUT("rv = %s_uper_to_protobuf(opt_codec_ctx, %s,\n", f->type_id, td);
+		OUT("\t\t%s, %s, pb);\n", ct, u->pd);
+		OUT("if(rv.code != RC_OK)");
+		emit_pb_uper_fail(arg, u, "return rv");
+		OUT("if(pb_end_message(pb, mark))");
+		emit_pb_uper_fail(arg, u, "ASN__DECODE_FAILED");
+		return;
+	}
+
+	/* The constrained whole number is read in place */
+	memset(&sm, 0, sizeof(sm));
+	sm.expr = v;
+	spec_member_kind(arg, &sm);
+	if(sm.kind != SPEC_WHOLE) {
+		emit_pb_uper_helper(arg, u, "long", td, ct, number, flags);
+		return;
+	}
+
+	if(outer) {
+		OUT("if(constraints) {\n");
+		INDENTED(emit_pb_uper_helper(arg, u, "long", td, ct, number, flags));
+		OUT("} else {\n");
+		INDENT(+1);
+	}
+	if(sm.extensible) {
+		OUT("value = per_get_few_bits(%s, 1);\n", u->pd);
+		OUT("if(value < 0)");
+		emit_pb_uper_fail(arg, u, "ASN__DECODE_STARVED");
+		OUT("if(value) {\n");
+		INDENTED(
+			OUT("/* Outside of the extension root */\n");
+			OUT("per_get_undo(%s, 1);\n", u->pd);
+			emit_pb_uper_helper(arg, u, "long", td, ct, number, flags);
+		);
+		OUT("} else {\n");
+		INDENT(+1);
+	}
+	if(sm.range_bits) {
+		OUT("value = per_get_few_bits(%s, %d);\n", u->pd, sm.range_bits);
+		OUT("if(value < 0)");
+		emit_pb_uper_fail(arg, u, "ASN__DECODE_STARVED");
+		/* Mimic per_long_range_unrebase() */
+		if(!sm.is_unsigned
+		&& sm.ub - sm.lb + 1 < ((asn1c_integer_t)1 << sm.range_bits)) {
+			OUT("if(value > %s)", asn1p_itoa(sm.ub - sm.lb));
+			emit_pb_uper_fail(arg, u, "ASN__DECODE_FAILED");
+		}
+		OUT("if(pb_uper_put_int(pb, %d, ", number);
+		emit_spec_rebased(arg, "(int64_t)value", -sm.lb);
+		OUT(", %s))", flags);
+	} else {
+		OUT("if(pb_uper_put_int(pb, %d, %s, %s))", number,
+			asn1p_itoa(sm.lb), flags);
+	}
+	emit_pb_uper_fail(arg, u, "ASN__DECODE_FAILED");
+	if(sm.extensible) {
+		INDENT(-1);
+		OUT("}\n");
+	}
+	if(outer) {
+		INDENT(-1);
+		OUT("}\n");
+	}
+}
+
+/*
+ * Convert the elements of SEQUENCE OF, the way SET_OF_decode_uper()
+ * reads them.
+ */
+static void
+emit_pb_uper_list(arg_t *arg, const pb_uper_t *u, const pb_field_t *f,
+		asn1p_expr_t *ev, const char *td, const char *ct) {
+	int packed = pb_scalar(f->kind);
+
+	OUT("elm = &%s->elements[0];\n", td);
+	OUT("nelems = pb_uper_get_count(%s, %s,\n", u->pd, td);
+	OUT("\t\t%s, &repeat);\n", ct);
+	OUT("if(nelems < 0)");
+	emit_pb_uper_fail(arg, u, "ASN__DECODE_STARVED");
+	if(packed) {
+		OUT("if(nelems) {\t/* The empty packed field is not sent */\n");
+		INDENT(+1);
+		OUT("if(pb_begin_message(pb, %d, &mark))", f->number);
+		emit_pb_uper_fail(arg, u, "ASN__DECODE_FAILED");
+	}
+	OUT("for(;;) {\n");
+	INDENT(+1);
+	if(f->kind == PBK_NULL) {
+		OUT("if(nelems > 200)\t/* SET OF NULL compression bomb */");
+		emit_pb_uper_fail(arg, u, "ASN__DECODE_FAILED");
+	}
+	OUT("for(i = 0; i < nelems; i++) {\n");
+	INDENTED(emit_pb_uper_value(arg, u, f, ev, "elm->type",
+		"elm->encoding_constraints.per_constraints",
+		packed ? 0 : f->number, 0, 0));
+	OUT("}\n");
+	OUT("if(!repeat) break;\n");
+	OUT("nelems = uper_get_length(%s, -1, 0, &repeat);\n", u->pd);
+	OUT("if(nelems < 0)");
+	emit_pb_uper_fail(arg, u, "ASN__DECODE_STARVED");
+	INDENT(-1);
+	OUT("}\n");
+	if(packed) {
+		OUT("if(pb_end_message(pb, mark))");
+		emit_pb_uper_fail(arg, u, "ASN__DECODE_FAILED");
+		INDENT(-1);
+		OUT("}\n");
+	}
+}
+
+/*
+ * Convert the SEQUENCE member or the CHOICE alternative,
+ * or the value of the (outer) type itself.
+ */
+static void
+emit_pb_uper_field(arg_t *arg, const pb_uper_t *u, const pb_field_t *f,
+		int choice, int outer) {
+	int implicit = !(choice || f->indirect
+		|| (!f->pointer && INLINE_OPTIONAL(f->expr)));
+	char td[64];
+	char ct[96];
+
+	if(outer) {
+		snprintf(td, sizeof(td), "td");
+		snprintf(ct, sizeof(ct), "constraints");
+	} else {
+		snprintf(td, sizeof(td), "td->elements[%d].type", f->index);
+		snprintf(ct, sizeof(ct),
+			"td->elements[%d].encoding_constraints.per_constraints",
+			f->index);
+	}
+
+	if(f->kind == PBK_NONE) {
+		if(f->repeated) {
+			OUT("nelems = pb_uper_get_count(%s, %s,\n", u->pd, td);
+			OUT("\t\t%s, &repeat);\n", ct);
+			OUT("if(nelems != 0)\t/* Not in the -B schema */");
+			emit_pb_uper_fail(arg, u, "ASN__DECODE_FAILED");
+		} else {
+			if(u->open_type)
+				OUT("FREEMEM(ot.copy);\n");
+			OUT("ASN__DECODE_FAILED;\t/* Not in the -B schema */\n");
+		}
+	} else if(f->repeated) {
+		emit_pb_uper_list(arg, u, f, pb_uper_value_expr(f, outer), td, ct);
+	} else {
+		emit_pb_uper_value(arg, u, f, f->expr, td, ct, f->number, implicit,
+			outer);
+	}
+}
+
+/* Convert the field coming as the open type */
+static void
+emit_pb_uper_open_field(arg_t *arg, const pb_field_t *f, int choice) {
+	pb_uper_t u = {"&ot.pd", 1};
+
+	OUT("if(pb_uper_open_type_begin(pd, &ot))\n");
+	OUT("\tASN__DECODE_STARVED;\n");
+	emit_pb_uper_field(arg, &u, f, choice, 0);
+	OUT("if(pb_uper_open_type_end(&ot))\n");
+	OUT("\tASN__DECODE_FAILED;\n");
+}
+
+/*
+ * Emit the converter of the UPER encoding into the protobuf message,
+ * which walks the encoding the way the UPER decoder does, writing
+ * the fields as they are read instead of filling in the structure.
+ */
+static void
+emit_protobuf_uper_converter(arg_t *arg, const pb_field_t *fields,
+		int nfields, const char *id) {
+	asn1p_expr_t *expr = arg->expr;
+	pb_uper_t root = {"pd", 0};
+	const pb_field_t *f;
+	asn1p_expr_t *v;
+	int outer = (expr->expr_type != ASN_CONSTR_SEQUENCE
+		&& expr->expr_type != ASN_CONSTR_CHOICE);
+	int *addition;		/* The field comes as the open type */
+	int comp_mode = 0;	/* {root,ext=1,root,root,...} */
+	int extensible = 0;
+	int additions = 0;
+	int default_additions = 0;
+	int roms = 0;
+	int values = 0;
+	int messages = 0;
+	int lists = 0;
+	int elm_lists = 0;
+	int scalar_lists = 0;
+	int i;
+
+	addition = calloc(nfields + 1, sizeof(*addition));
+	assert(addition);
+
+	i = 0;
+	if(!outer) {
+		TQ_FOR(v, &(expr->members), next) {
+			if(v->expr_type == A1TC_EXTENSIBLE) {
+				comp_mode++;
+				extensible = (expr->expr_type == ASN_CONSTR_SEQUENCE);
+				continue;
+			}
+			if(comp_mode == 1) {
+				addition[i] = 1;
+				additions++;
+				if(pb_uper_default(arg, &fields[i]))
+					default_additions++;
+			} else if(v->marker.flags & EM_OMITABLE) {
+				roms++;
+			}
+			i++;
+		}
+	}
+	for(i = 0; i < nfields; i++) {
+		f = &fields[i];
+		if(pb_uper_needs_value(arg, f, outer))
+			values++;
+		if(f->repeated) {
+			lists++;
+			if(f->kind != PBK_NONE)
+				elm_lists++;
+			if(pb_scalar(f->kind))
+				scalar_lists++;
+		}
+		if(f->kind == PBK_MESSAGE)
+			messages++;
+	}
+
+	OUT_NOINDENT("#ifndef\tASN_DISABLE_PER_SUPPORT\n");
+	OUT("asn_dec_rval_t\n");
+	OUT("%s_uper_to_protobuf(const asn_codec_ctx_t *opt_codec_ctx,\n", id);
+	OUT("\t\tconst asn_TYPE_descriptor_t *td,\n");
+	OUT("\t\tconst asn_per_constraints_t *constraints, asn_per_data_t *pd,\n");
+	OUT("\t\tpb_buffer_t *pb) {\n");
+	INDENT(+1);
+
+	if(expr->expr_type == ASN_CONSTR_SEQUENCE && comp_mode > 1) {
+		OUT("/* Root members after the extensions */\n");
+		OUT("return pb_uper_materialize(opt_codec_ctx, td, constraints, pd, pb,\n");
+		OUT("\t\t%s_encode_protobuf);\n", id);
+		INDENT(-1);
+		OUT("}\n");
+		OUT_NOINDENT("#endif\t/* ASN_DISABLE_PER_SUPPORT */\n");
+		OUT("\n");
+		free(addition);
+		return;
+	}
+
+	OUT("asn_dec_rval_t rv = {RC_OK, 0};\n");
+	if(roms) OUT("asn_per_data_t opmd;\n");
+	if(extensible) OUT("asn_per_data_t epmd;\n");
+	if(additions) OUT("pb_uper_open_type_t ot;\n");
+	if(elm_lists) OUT("const asn_TYPE_member_t *elm;\n");
+	if(lists) OUT("ssize_t nelems;\n");
+	if(elm_lists) OUT("ssize_t i;\n");
+	if(lists) OUT("int repeat;\n");
+	if(extensible) OUT("ssize_t bmlength;\n");
+	if(messages || scalar_lists) OUT("size_t mark;\n");
+	if(values || extensible) OUT("int32_t value;\n");
+	if(extensible) OUT("int extpresent;\n");
+	if(expr->expr_type == ASN_CONSTR_CHOICE) OUT("int index;\n");
+	OUT("\n");
+	OUT("if(ASN__STACK_OVERFLOW_CHECK(opt_codec_ctx))\n");
+	OUT("\tASN__DECODE_FAILED;\n");
+	OUT("\n");
+
+	switch(expr->expr_type) {
+	case ASN_CONSTR_SEQUENCE:
+		if(extensible) {
+			OUT("extpresent = per_get_few_bits(pd, 1);\n");
+			OUT("if(extpresent < 0) ASN__DECODE_STARVED;\n");
+		}
+		if(roms) {
+			OUT("if(pb_uper_view(pd, %d, &opmd))\t/* Presence bitmap */\n",
+				roms);
+			OUT("\tASN__DECODE_STARVED;\n");
+		}
+		if(extensible || roms)
+			OUT("\n");
+		for(i = 0; i < nfields; i++) {
+			f = &fields[i];
+			if(addition[i])
+				continue;
+			OUT("/* %s */\n", f->expr->Identifier);
+			if(f->expr->marker.flags & EM_OMITABLE) {
+				OUT("if(per_get_few_bits(&opmd, 1)) {\n");
+				INDENTED(emit_pb_uper_field(arg, &root, f, 0, 0));
+				if(pb_uper_default(arg, f)) {
+					OUT("} else {\n");
+					INDENTED(emit_pb_uper_default(arg, &root, f));
+				}
+				OUT("}\n");
+			} else {
+				emit_pb_uper_field(arg, &root, f, 0, 0);
+			}
+			OUT("\n");
+		}
+		if(!extensible)
+			break;
+		OUT("if(extpresent) {\n");
+		INDENT(+1);
+		OUT("bmlength = uper_get_nslength(pd);\n");
+		OUT("if(bmlength < 0 || pb_uper_view(pd, bmlength, &epmd))\n");
+		OUT("\tASN__DECODE_STARVED;\n");
+		OUT("\n");
+		for(i = 0; i < nfields; i++) {
+			f = &fields[i];
+			if(!addition[i])
+				continue;
+			OUT("/* %s */\n", f->expr->Identifier);
+			OUT("if(per_get_few_bits(&epmd, 1) > 0) {\n");
+			INDENTED(emit_pb_uper_open_field(arg, f, 0));
+			if(pb_uper_default(arg, f)) {
+				OUT("} else {\n");
+				INDENTED(emit_pb_uper_default(arg, &root, f));
+			}
+			OUT("}\n");
+			OUT("\n");
+		}
+		OUT("/* Skip the extensions unknown to this version */\n");
+		OUT("while((value = per_get_few_bits(&epmd, 1)) >= 0) {\n");
+		OUT("\tif(value && pb_uper_open_type_skip(pd))\n");
+		OUT("\t\tASN__DECODE_STARVED;\n");
+		OUT("}\n");
+		INDENT(-1);
+		if(default_additions) {
+			OUT("} else {\n");
+			INDENT(+1);
+			for(i = 0; i < nfields; i++) {
+				if(addition[i])
+					emit_pb_uper_default(arg, &root, &fields[i]);
+			}
+			INDENT(-1);
+		}
+		OUT("}\n");
+		OUT("\n");
+		break;
+	case ASN_CONSTR_CHOICE:
+		OUT("index = pb_uper_choice_index(pd, td, constraints);\n");
+		OUT("switch(index) {\n");
+		for(i = 0; i < nfields; i++) {
+			f = &fields[i];
+			if(f->kind == PBK_NONE)
+				continue;
+			OUT("case %d:\t/* %s */\n", f->index, f->expr->Identifier);
+			INDENT(+1);
+			if(addition[i])
+				emit_pb_uper_open_field(arg, f, 1);
+			else
+				emit_pb_uper_field(arg, &root, f, 1, 0);
+			OUT("break;\n");
+			INDENT(-1);
+		}
+		OUT("default:\n");
+		OUT("\tASN__DECODE_FAILED;\n");
+		OUT("}\n");
+		OUT("\n");
+		break;
+	default:
+		emit_pb_uper_field(arg, &root, &fields[0], 0, 1);
+		OUT("\n");
+		break;
+	}
+
+	OUT("return rv;\n");
+	INDENT(-1);
+	OUT("}\n");
+	OUT_NOINDENT("#endif\t/* ASN_DISABLE_PER_SUPPORT */\n");
+	OUT("\n");
+
+	free(addition);
+}
+
+/*
+ * Emit the protobuf codec of the type (-gen-protobuf). The fields are
+ * numbered the way the -B schema does: after the SEQUENCE members and
+ * the CHOICE alternatives, or field 1 holding the value of the other types.
+ */
+static int
+emit_protobuf_codec(arg_t *arg) {
+	asn1p_expr_t *expr = arg->expr;
+	int saved_target = arg->target->target;
+	int choice = (expr->expr_type == ASN_CONSTR_CHOICE);
+	pb_field_t *fields;
+	pb_field_t *f;
+	pb_slot_t slot;
+	asn1p_expr_t *v;
+	char buf[256];
+	char *type;
+	char *id;
+	int nfields = 0;
+	int lists = 0;
+	int scalar_lists = 0;
+	int enc_value = 0;	/* Members needing the "value" to encode */
+	int dec_value = 0;	/* ... to decode */
+	int memb_ptrs = 0;	/* Members needing the "memb_ptr" to decode */
+	int i;
+
+	fields = calloc(expr_elements_count(arg, expr) + 1, sizeof(*fields));
+	assert(fields);
+
+	switch(expr->expr_type) {
+	case ASN_CONSTR_SEQUENCE:
+	case ASN_CONSTR_CHOICE:
+		TQ_FOR(v, &(expr->members), next) {
+			if(v->expr_type == A1TC_EXTENSIBLE)
+				continue;
+			f = &fields[nfields];
+			f->expr = v;
+			f->index = nfields++;
+			f->number = nfields;
+			f->indirect = (v->marker.flags & EM_INDIRECT) ? 1 : 0;
+			f->pointer = f->indirect;
+			snprintf(buf, sizeof(buf), "st->%s%s",
+				(choice && !UNNAMED_UNIONS) ? "choice." : "",
+				MKID_safe(v));
+			f->value = strdup(buf);
+			if(v->expr_type == ASN_CONSTR_SEQUENCE_OF) {
+				f->repeated = 1;
+				f->kind = pb_value_kind(arg, TQ_FIRST(&(v->members)),
+					&f->type_id);
+				snprintf(buf, sizeof(buf),
+					"td->elements[%d].type->elements[0].type", f->index);
+			} else {
+				f->kind = pb_value_kind(arg, v, &f->type_id);
+				snprintf(buf, sizeof(buf), "td->elements[%d].type",
+					f->index);
+			}
+			f->elm_td = strdup(buf);
+		}
+		break;
+	case ASN_CONSTR_SEQUENCE_OF:
+		f = &fields[nfields++];
+		f->expr = TQ_FIRST(&(expr->members));
+		f->number = 1;
+		f->repeated = 1;
+		f->kind = pb_value_kind(arg, f->expr, &f->type_id);
+		f->value = strdup("st");
+		f->pointer = 1;
+		f->elm_td = strdup("td->elements[0].type");
+		break;
+	default:
+		f = &fields[nfields++];
+		f->expr = expr;
+		f->number = 1;
+		f->kind = pb_value_kind(arg, expr, &f->type_id);
+		f->value = strdup("st");
+		f->pointer = 1;
+		if(f->kind == PBK_MESSAGE) {
+			snprintf(buf, sizeof(buf), "&asn_DEF_%s", f->type_id);
+			f->elm_td = strdup(buf);
+		}
+		break;
+	}
+
+	for(i = 0; i < nfields; i++) {
+		f = &fields[i];
+		if(f->repeated && f->kind != PBK_NONE) {
+			lists++;
+			memb_ptrs++;
+			if(pb_scalar(f->kind))
+				scalar_lists++;
+		}
+		if(f->kind == PBK_INTEGER)
+			enc_value++;
+		if(f->kind == PBK_INTEGER || f->kind == PBK_NULL)
+			dec_value++;
+		if(f->kind == PBK_MESSAGE && !f->indirect)
+			memb_ptrs++;
+	}
+
+	type = strdup(c_name(arg).short_name);
+	id = strdup(MKID(expr));
+
+	GEN_INCLUDE_STD("protobuf_support");
+
+	REDIR(OT_FUNC_DECLS);
+	OUT_NOINDENT("pb_type_encoder_f %s_encode_protobuf;\n", id);
+	OUT_NOINDENT("pb_type_decoder_f %s_decode_protobuf;\n", id);
+	if(arg->flags & A1C_GEN_PER)
+		OUT_NOINDENT("pb_uper_converter_f %s_uper_to_protobuf;\n", id);
+
+	REDIR(OT_CODE);
+
+	/*
+	 * The encoder.
+	 */
+	OUT("/*\n");
+	OUT(" * Protocol Buffers codec of %s, generated by -gen-protobuf.\n",
+		expr->Identifier);
+	OUT(" */\n");
+	OUT("asn_enc_rval_t\n");
+	OUT("%s_encode_protobuf(const asn_TYPE_descriptor_t *td,\n", id);
+	OUT("\t\tconst void *sptr, asn_app_consume_bytes_f *cb, void *app_key) {\n");
+	INDENT(+1);
+	OUT("const %s *st = (const %s *)sptr;\n", type, type);
+	OUT("asn_enc_rval_t er = {0, 0, 0};\n");
+	OUT("pb_output_t po;\n");
+	if(enc_value) OUT("intmax_t value;\n");
+	if(lists) OUT("int i;\n");
+	if(scalar_lists) OUT("size_t size;\n");
+	OUT("\n");
+	OUT("if(!st) ASN__ENCODE_FAILED;\n");
+	OUT("\n");
+	OUT("po.cb = cb;\n");
+	OUT("po.app_key = app_key;\n");
+	OUT("po.encoded = 0;\n");
+	OUT("\n");
+
+	if(choice) {
+		OUT("switch(st->present) {\n");
+		for(i = 0; i < nfields; i++) {
+			f = &fields[i];
+			if(f->kind == PBK_NONE)
+				continue;
+			OUT("case %s:\n", c_presence_name(arg, f->expr));
+			INDENT(+1);
+			emit_pb_put_field(arg, f, 1);
+			OUT("break;\n");
+			INDENT(-1);
+		}
+		OUT("default:\n");
+		OUT("\tASN__ENCODE_FAILED;\n");
+		OUT("}\n");
+		OUT("\n");
+	} else {
+		for(i = 0; i < nfields; i++) {
+			f = &fields[i];
+			if(expr->expr_type == ASN_CONSTR_SEQUENCE)
+				OUT("/* %s */\n", f->expr->Identifier);
+			emit_pb_put_field(arg, f, 0);
+			OUT("\n");
+		}
+	}
+
+	OUT("er.encoded = po.encoded;\n");
+	OUT("ASN__ENCODED_OK(er);\n");
+	INDENT(-1);
+	OUT("}\n");
+	OUT("\n");
+
+	/*
+	 * The decoder.
+	 */
+	OUT("asn_dec_rval_t\n");
+	OUT("%s_decode_protobuf(const asn_codec_ctx_t *opt_codec_ctx,\n", id);
+	OUT("\t\tconst asn_TYPE_descriptor_t *td, void **sptr,\n");
+	OUT("\t\tconst void *buffer, size_t size) {\n");
+	INDENT(+1);
+	OUT("%s *st = (%s *)*sptr;\n", type, type);
+	OUT("asn_dec_rval_t rv = {RC_OK, 0};\n");
+	OUT("pb_input_t pi;\n");
+	if(scalar_lists) OUT("pb_input_t values;\n");
+	OUT("enum pb_wire_type wt;\n");
+	OUT("unsigned field;\n");
+	if(memb_ptrs) OUT("void *memb_ptr;\n");
+	if(dec_value) OUT("int64_t value;\n");
+	OUT("\n");
+	OUT("if(ASN__STACK_OVERFLOW_CHECK(opt_codec_ctx))\n");
+	OUT("\tASN__DECODE_FAILED;\n");
+	OUT("\n");
+	OUT("if(!st) {\n");
+	OUT("\tst = (%s *)(*sptr = CALLOC(1, sizeof(*st)));\n", type);
+	OUT("\tif(!st) ASN__DECODE_FAILED;\n");
+	OUT("}\n");
+	OUT("\n");
+	OUT("pi.ptr = (const uint8_t *)buffer;\n");
+	OUT("pi.end = pi.ptr + size;\n");
+	OUT("while(pi.ptr < pi.end) {\n");
+	INDENT(+1);
+	OUT("if(pb_get_tag(&pi, &field, &wt))\n");
+	OUT("\tASN__DECODE_FAILED;\n");
+	OUT("switch(field) {\n");
+	for(i = 0; i < nfields; i++) {
+		f = &fields[i];
+		if(f->kind == PBK_NONE)
+			continue;
+		if(expr->expr_type == ASN_CONSTR_SEQUENCE || choice)
+			OUT("case %d:\t/* %s */\n", f->number, f->expr->Identifier);
+		else
+			OUT("case %d:\n", f->number);
+		INDENT(+1);
+		emit_pb_get_field(arg, f, choice);
+		OUT("break;\n");
+		INDENT(-1);
+	}
+	OUT("default:\n");
+	OUT("\t/* Unknown to this version of the schema */\n");
+	OUT("\tif(pb_skip(&pi, wt))\n");
+	OUT("\t\tASN__DECODE_FAILED;\n");
+	OUT("}\n");
+	INDENT(-1);
+	OUT("}\n");
+	OUT("\n");
+
+	if(choice) {
+		OUT("if(st->present == %s)\n", c_presence_name(arg, 0));
+		OUT("\tASN__DECODE_FAILED;\n");
+		OUT("\n");
+	} else {
+		for(i = 0; i < nfields; i++) {
+			f = &fields[i];
+			/* INTEGER 0 is not sent, yet must have its octet */
+			if(f->kind == PBK_INTEGER && !f->indirect && !f->repeated
+			&& (f->pointer || !INLINE_OPTIONAL(f->expr))) {
+				if(f->pointer)
+					pb_slot_pointer(&slot, f->value);
+				else
+					pb_slot_value(&slot, f->value);
+				OUT("if(!%sbuf && asn_imax2INTEGER(%s, 0))\n", slot.mem,
+					slot.addr);
+				OUT("\tASN__DECODE_FAILED;\n");
+				OUT("\n");
+				continue;
+			}
+			/* The mandatory members kept by pointer are always sent */
+			if(!f->indirect || (f->expr->marker.flags & EM_OMITABLE)
+			|| f->kind == PBK_NONE)
+				continue;
+			if(f->repeated) {
+				OUT("if(!%s) {\t/* Empty %s */\n", f->value,
+					f->expr->Identifier);
+				OUT("\t%s = CALLOC(1, sizeof(*%s));\n", f->value,
+					f->value);
+				OUT("\tif(!%s) ASN__DECODE_FAILED;\n", f->value);
+				OUT("}\n");
+			} else {
+				OUT("if(!%s)\t/* Mandatory %s */\n", f->value,
+					f->expr->Identifier);
+				OUT("\tASN__DECODE_FAILED;\n");
+			}
+			OUT("\n");
+		}
+	}
+
+	OUT("rv.consumed = size;\n");
+	OUT("return rv;\n");
+	INDENT(-1);
+	OUT("}\n");
+	OUT("\n");
+
+	if(arg->flags & A1C_GEN_PER)
+		emit_protobuf_uper_converter(arg, fields, nfields, id);
+
+	REDIR(saved_target);
+
+	for(i = 0; i < nfields; i++) {
+		free(fields[i].type_id);
+		free(fields[i].value);
+		free(fields[i].elm_td);
+	}
+	free(fields);
+	free(type);
+	free(id);
+
+	return 0;
+}
+
+/*
+ * Generate "asn_DEF_XXX" type definition.
+ */
+static int
+emit_type_DEF(arg_t *arg, asn1p_expr_t *expr, enum tvm_compat tv_mode, int tags_count, int all_tags_count, int elements_count, enum etd_spec spec) {
+	asn1p_expr_t *terminal;
+	int using_type_name = 0;
+	char *expr_id = strdup(MKID(expr));
+	char *p = expr_id;
+	char *p2 = (char *)0;
+
+	terminal = asn1f_find_terminal_type_ex(arg->asn, arg->ns, expr);
+
+	if(emit_member_OER_constraints(arg, expr, "type"))
+		return -1;
+
+	if(emit_member_PER_constraints(arg, expr, "type"))
+		return -1;
+
+	if(HIDE_INNER_DEFS)
+		OUT("static /* Use -fall-defs-global to expose */\n");
+	OUT("asn_TYPE_descriptor_t asn_DEF_%s", p);
+    if(HIDE_INNER_DEFS || (arg->flags & A1C_ALL_DEFS_GLOBAL))
+        OUT("_%d", expr->_type_unique_index);
+    OUT(" = {\n");
+	INDENT(+1);
+
+		if(expr->_anonymous_type) {
+			p = strdup(ASN_EXPR_TYPE2STR(expr->expr_type));
+			OUT("\"%s\",\n", p?p:"");
+			OUT("\"%s\",\n",
+				p ? asn1c_make_identifier(AMI_CHECK_RESERVED,
+					0, p, 0) : "");
+		} else {
+			OUT("\"%s\",\n", expr->Identifier);
+			OUT("\"%s\",\n", expr->Identifier);
+		}
+
+		if(expr->expr_type & ASN_CONSTR_MASK) {
+			using_type_name = 1;
+			p = strdup(asn1c_type_name(arg, arg->expr, TNF_SAFE));
+		} else {
+			if (expr->expr_type == A1TC_REFERENCE) {
+				p2 = strdup(asn1c_type_name(arg, terminal, TNF_SAFE));
+			} else {
+				p2 = strdup(asn1c_type_name(arg, expr, TNF_SAFE));
+			}
+			p = strdup(expr_id);
+		}
+		if (!p2)
+			p2 = strdup(p);
+
+		/* The SEQUENCE OF values kept in place (-fpacked-sequence-of) */
+		if(asn1c_type_packed_values(arg, expr)) {
+			if(strcmp(p, "SEQUENCE_OF") == 0) {
+				free(p);
+				p = strdup("SEQUENCE_OF_packed");
+			}
+			if(strcmp(p2, "SEQUENCE_OF") == 0) {
+				free(p2);
+				p2 = strdup("SEQUENCE_OF_packed");
 			}
-			p = strdup(expr_id);
 		}
-		if (!p2)
-			p2 = strdup(p);
 
-        OUT("&asn_OP_%s,\n", p2);
+        if(spec == ETD_HAS_SPECIFICS && expr_specialized_codecs(arg, expr))
+            OUT("&asn_OP_%s_specialized,\n", expr_id);
+        else
+            OUT("&asn_OP_%s,\n", p2);
 
 		if(tags_count) {
 			OUT("asn_DEF_%s_tags_%d,\n",
@@ -3058,6 +5644,9 @@ emit_type_DEF(arg_t *arg, asn1p_expr_t *expr, enum tvm_compat tv_mode, int tags_
 
         if (arg->flags & A1C_NO_CONSTRAINTS) {
 			OUT("0");
+		} else if(spec == ETD_HAS_SPECIFICS
+				&& expr_aggregate_constraints(arg, expr)) {
+			OUT("%s_constraint_aggregated", MKID(expr));
 		} else {
 			if (!expr->combined_constraints)
 				FUNCREF2(constraint);
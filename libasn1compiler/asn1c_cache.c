@@ -0,0 +1,947 @@
+#include "asn1c_internal.h"
+#include "asn1c_cache.h"
+#include "asn1c_compat.h"
+#include "asn1c_misc.h"
+#include "asn1c_naming.h"
+#include "asn1c_out.h"
+#include "asn1c_build_id.h"
+#include <genhash.h>
+
+#include <stdint.h>
+
+/*
+ * The cache file is a sequence of the length-prefixed records:
+ * the magic, the compiled output streams of every top level type,
+ * and the names which the module's types have yielded to the
+ * name clash finder. The magic carries the checksum of the compiler
+ * sources, so a compiler built from other sources never reuses it.
+ */
+#define	CACHE_MAGIC	"asn1c-cache-1 " VERSION " " ASN1C_BUILD_ID
+
+typedef struct cached_name_s {
+	int *path;	/* Member indices starting from the top level type */
+	int path_len;
+	int detached;	/* Index of the expression not found in the tree */
+	char *identifier;	/* ... and its identifier and line */
+	int lineno;
+	char *name;
+	asn1p_expr_t *expr;	/* Resolved by the path, once loaded */
+} cached_name_t;
+
+typedef struct cached_module_s {
+	asn1p_module_t *mod;
+	uint64_t file_hash;
+	uint64_t fingerprint;
+	int fingerprinted;	/* 1: done, -1: the module can't be hashed */
+	uint64_t key;
+	int cacheable;
+	int loaded;	/* Retrieved from the cache */
+	int compiled;	/* Compiled anew, store it */
+	int visited;
+	genhash_t *top_index;	/* Top level type -> its index + 1 */
+
+	cached_name_t *names;
+	size_t names_count;
+	size_t names_size;
+	asn1p_expr_t **detached;
+	size_t detached_count;
+} cached_module_t;
+
+struct asn1c_cache_s {
+	arg_t *arg;
+	char *dir;	/* With the trailing slash */
+	uint64_t options_hash;
+	cached_module_t *modules;
+	size_t count;
+	genhash_t *by_module;	/* asn1p_module_t * -> cached_module_t * */
+	cached_module_t *current;
+};
+
+/*
+ * 64-bit FNV-1a.
+ */
+#define	FNV_OFFSET	0xcbf29ce484222325ULL
+#define	FNV_PRIME	0x100000001b3ULL
+
+static void
+mix_bytes(uint64_t *h, const void *ptr, size_t size) {
+	const unsigned char *p = ptr;
+	uint64_t v = *h;
+	while(size--) {
+		v ^= *p++;
+		v *= FNV_PRIME;
+	}
+	*h = v;
+}
+
+static void
+mix_int(uint64_t *h, long value) {
+	mix_bytes(h, &value, sizeof(value));
+}
+
+static void
+mix_str(uint64_t *h, const char *str) {
+	if(str) {
+		mix_bytes(h, str, strlen(str) + 1);
+	} else {
+		mix_int(h, -1);
+	}
+}
+
+static int
+hash_file(const char *filename, uint64_t *h) {
+	char buf[16384];
+	size_t len;
+	FILE *fp;
+
+	if(!filename || strcmp(filename, "-") == 0)
+		return -1;
+
+	fp = fopen(filename, "rb");
+	if(!fp) return -1;
+	while((len = fread(buf, 1, sizeof(buf), fp)))
+		mix_bytes(h, buf, len);
+	if(ferror(fp)) {
+		fclose(fp);
+		return -1;
+	}
+	fclose(fp);
+	return 0;
+}
+
+/*
+ * Mix in whatever the fixer has decided about the type
+ * while looking at all the modules together.
+ */
+static void
+fingerprint_expr(uint64_t *h, const asn1p_expr_t *expr) {
+	const asn1p_expr_t *m;
+	int i;
+
+	mix_str(h, expr->Identifier);
+	mix_int(h, expr->meta_type);
+	mix_int(h, expr->expr_type);
+	mix_int(h, expr->_mark & TM_NAMECLASH);
+	mix_int(h, expr->_type_unique_index);
+	mix_int(h, expr->_type_referenced);
+	mix_int(h, expr->spec_index);
+	mix_int(h, expr->specializations.pspecs_count);
+	for(i = 0; i < expr->specializations.pspecs_count; i++)
+		fingerprint_expr(h, expr->specializations.pspec[i].my_clone);
+	TQ_FOR(m, &(expr->members), next) {
+		fingerprint_expr(h, m);
+	}
+	mix_int(h, -1);
+}
+
+static int
+fingerprint_module(asn1c_cache_t *cache, cached_module_t *cm) {
+	asn1p_expr_t *expr;
+	size_t i;
+
+	if(cm->fingerprinted)
+		return cm->fingerprinted > 0 ? 0 : -1;
+	cm->fingerprinted = -1;
+
+	/* Several modules may come from the same file */
+	for(i = 0; &cache->modules[i] != cm; i++) {
+		cached_module_t *prev = &cache->modules[i];
+		if(prev->fingerprinted > 0 && prev->mod->source_file_name
+		&& cm->mod->source_file_name
+		&& strcmp(prev->mod->source_file_name,
+			cm->mod->source_file_name) == 0) {
+			cm->file_hash = prev->file_hash;
+			break;
+		}
+	}
+	if(&cache->modules[i] == cm) {
+		cm->file_hash = FNV_OFFSET;
+		if(hash_file(cm->mod->source_file_name, &cm->file_hash))
+			return -1;
+	}
+
+	cm->fingerprint = cm->file_hash;
+	mix_str(&cm->fingerprint, cm->mod->ModuleName);
+	TQ_FOR(expr, &(cm->mod->members), next) {
+		fingerprint_expr(&cm->fingerprint, expr);
+	}
+
+	cm->fingerprinted = 1;
+	return 0;
+}
+
+static cached_module_t *
+cached_module(asn1c_cache_t *cache, asn1p_module_t *mod) {
+	return mod ? genhash_get(cache->by_module, mod) : NULL;
+}
+
+/*
+ * The key covers the module and everything it imports, transitively,
+ * along with the standard modules, which are imported implicitly.
+ */
+static int
+compute_key(asn1c_cache_t *cache, cached_module_t *cm) {
+	cached_module_t **queue;
+	size_t head = 0, tail = 0;
+	asn1p_expr_t *expr;
+	size_t i;
+	int ret = 0;
+
+	TQ_FOR(expr, &(cm->mod->members), next) {
+		/* Specializations depend on the modules which instantiate them */
+		if(expr->lhs_params && expr->specializations.pspecs_count)
+			return -1;
+	}
+
+	queue = calloc(cache->count, sizeof(*queue));
+	if(!queue) return -1;
+	for(i = 0; i < cache->count; i++)
+		cache->modules[i].visited = 0;
+
+	cm->key = cache->options_hash;
+	cm->visited = 1;
+	queue[tail++] = cm;
+	for(i = 0; i < cache->count; i++) {
+		cached_module_t *std = &cache->modules[i];
+		if((std->mod->_tags & MT_STANDARD_MODULE) && !std->visited) {
+			std->visited = 1;
+			queue[tail++] = std;
+		}
+	}
+
+	while(head < tail) {
+		cached_module_t *m = queue[head++];
+		asn1p_xports_t *xp;
+
+		if(fingerprint_module(cache, m)) {
+			ret = -1;
+			break;
+		}
+		mix_int(&cm->key, (long)m->fingerprint);
+
+		TQ_FOR(xp, &(m->mod->imports), xp_next) {
+			cached_module_t *by_name = cached_module(cache,
+				genhash_get(cache->arg->asn->modules_hash,
+					xp->fromModuleName));
+			cached_module_t *by_oid = xp->identifier.oid
+				? cached_module(cache,
+					genhash_get(cache->arg->asn->modules_oid_hash,
+						xp->identifier.oid))
+				: NULL;
+			if(!by_name && !by_oid) {
+				ret = -1;
+				break;
+			}
+			if(by_name && !by_name->visited) {
+				by_name->visited = 1;
+				queue[tail++] = by_name;
+			}
+			if(by_oid && !by_oid->visited) {
+				by_oid->visited = 1;
+				queue[tail++] = by_oid;
+			}
+		}
+		if(ret) break;
+	}
+
+	free(queue);
+	return ret;
+}
+
+static void observe_name(void *key, asn1p_expr_t *expr, const char *name);
+
+asn1c_cache_t *
+asn1c_cache_new(arg_t *arg, const char *cache_dir, int optc, char **argv) {
+	asn1c_cache_t *cache;
+	asn1p_module_t *mod;
+	size_t dir_len;
+	size_t i;
+	int j;
+
+	cache = calloc(1, sizeof(*cache));
+	if(!cache) return NULL;
+	cache->arg = arg;
+
+	dir_len = strlen(cache_dir);
+	cache->dir = malloc(dir_len + 2);
+	if(!cache->dir) {
+		free(cache);
+		return NULL;
+	}
+	memcpy(cache->dir, cache_dir, dir_len + 1);
+	if(dir_len && cache->dir[dir_len - 1] != '/')
+		strcpy(cache->dir + dir_len, "/");
+
+#ifdef	_WIN32
+	(void)mkdir(cache_dir);
+#else
+	(void)mkdir(cache_dir, 0777);
+#endif
+
+	cache->options_hash = FNV_OFFSET;
+	mix_str(&cache->options_hash, CACHE_MAGIC);
+	mix_int(&cache->options_hash, arg->flags);
+	for(j = 1; j < optc; j++) {
+		int skip = asn1c_neutral_option(optc, argv, j);
+		if(skip) {
+			j += skip - 1;
+			continue;
+		}
+		mix_str(&cache->options_hash, argv[j]);
+	}
+
+	TQ_FOR(mod, &(arg->asn->modules), mod_next) {
+		cache->count++;
+	}
+	cache->modules = calloc(cache->count ? cache->count : 1,
+	                        sizeof(cache->modules[0]));
+	cache->by_module = genhash_new(cmpf_void, hashf_void, NULL, NULL);
+	if(!cache->modules || !cache->by_module) {
+		asn1c_cache_free(cache);
+		return NULL;
+	}
+
+	i = 0;
+	TQ_FOR(mod, &(arg->asn->modules), mod_next) {
+		cache->modules[i].mod = mod;
+		if(genhash_add(cache->by_module, mod, &cache->modules[i])) {
+			asn1c_cache_free(cache);
+			return NULL;
+		}
+		i++;
+	}
+
+	for(i = 0; i < cache->count; i++) {
+		cached_module_t *cm = &cache->modules[i];
+		cm->cacheable = (compute_key(cache, cm) == 0);
+		DEBUG("Module %s is %scacheable (%016llx)", cm->mod->ModuleName,
+		      cm->cacheable ? "" : "not ", (unsigned long long)cm->key);
+	}
+
+	c_name_clash_finder_observe(observe_name, cache);
+
+	return cache;
+}
+
+static void
+free_names(cached_module_t *cm) {
+	size_t i;
+
+	for(i = 0; i < cm->names_count; i++) {
+		free(cm->names[i].path);
+		free(cm->names[i].identifier);
+		free(cm->names[i].name);
+	}
+	free(cm->names);
+	cm->names = NULL;
+	cm->names_count = 0;
+	cm->names_size = 0;
+	free(cm->detached);
+	cm->detached = NULL;
+	cm->detached_count = 0;
+}
+
+void
+asn1c_cache_free(asn1c_cache_t *cache) {
+	size_t i;
+
+	if(!cache) return;
+
+	c_name_clash_finder_observe(NULL, NULL);
+
+	for(i = 0; i < cache->count; i++) {
+		free_names(&cache->modules[i]);
+		genhash_destroy(cache->modules[i].top_index);
+	}
+	free(cache->modules);
+	genhash_destroy(cache->by_module);
+	free(cache->dir);
+	free(cache);
+}
+
+static int
+member_index(const asn1p_expr_t *parent, const asn1p_expr_t *child) {
+	const asn1p_expr_t *m;
+	int idx = 0;
+	TQ_FOR(m, &(parent->members), next) {
+		if(m == child) return idx;
+		idx++;
+	}
+	return -1;
+}
+
+static int
+top_level_index(cached_module_t *cm, const asn1p_expr_t *expr) {
+	asn1p_expr_t *m;
+	intptr_t idx = 0;
+
+	if(!cm->top_index) {
+		cm->top_index = genhash_new(cmpf_void, hashf_void, NULL, NULL);
+		if(!cm->top_index) return -1;
+		TQ_FOR(m, &(cm->mod->members), next) {
+			if(genhash_add(cm->top_index, m, (void *)++idx)) {
+				genhash_destroy(cm->top_index);
+				cm->top_index = NULL;
+				return -1;
+			}
+		}
+	}
+
+	idx = (intptr_t)genhash_get(cm->top_index, expr);
+	return idx - 1;
+}
+
+/*
+ * Locate the expression within its module.
+ * Returns 1 with the path filled in, 0 if the expression is not
+ * reachable from the module, and -1 for a parameterized type
+ * specialization, which never gets cached.
+ */
+static int
+expr_path(asn1p_expr_t *expr, cached_module_t **owner, int **path_r,
+          int *path_len_r) {
+	asn1p_expr_t *e;
+	int *path;
+	int depth = 1;
+	int i;
+
+	for(e = expr; e->parent_expr; e = e->parent_expr)
+		depth++;
+	if(e->spec_index != -1)
+		return -1;
+	if(!*owner) return 0;
+
+	path = malloc(depth * sizeof(*path));
+	if(!path) return -1;
+
+	for(e = expr, i = depth - 1; e->parent_expr; e = e->parent_expr, i--) {
+		path[i] = member_index(e->parent_expr, e);
+		if(path[i] < 0) {
+			free(path);
+			return 0;
+		}
+	}
+	path[0] = top_level_index(*owner, e);
+	if(path[0] < 0) {
+		free(path);
+		return 0;
+	}
+
+	*path_r = path;
+	*path_len_r = depth;
+	return 1;
+}
+
+static asn1p_expr_t *
+path_expr(asn1p_expr_t **tops, size_t tops_count, const int *path,
+          int path_len) {
+	asn1p_expr_t *e;
+	int i;
+
+	if((size_t)path[0] >= tops_count)
+		return NULL;
+
+	e = tops[path[0]];
+	for(i = 1; e && i < path_len; i++) {
+		asn1p_expr_t *m;
+		int idx = 0;
+		TQ_FOR(m, &(e->members), next) {
+			if(idx++ == path[i]) break;
+		}
+		e = m;
+	}
+
+	return e;
+}
+
+static void
+observe_name(void *key, asn1p_expr_t *expr, const char *name) {
+	asn1c_cache_t *cache = key;
+	asn1p_expr_t *top;
+	cached_module_t *cm;
+	cached_name_t *cn;
+	int *path = NULL;
+	int path_len = 0;
+	int ret;
+
+	for(top = expr; top->parent_expr; top = top->parent_expr)
+		;
+	cm = cached_module(cache, top->module);
+
+	/* Nobody to record it for */
+	if((!cm || !cm->cacheable || cm->loaded)
+	&& (!cache->current || !cache->current->cacheable))
+		return;
+
+	ret = expr_path(expr, &cm, &path, &path_len);
+	if(ret < 0) return;
+	if(ret == 0) cm = cache->current;	/* A temporary expression */
+	if(!cm || !cm->cacheable || cm->loaded) {
+		free(path);
+		return;
+	}
+
+	if(cm->names_count == cm->names_size) {
+		size_t size = cm->names_size ? 2 * cm->names_size : 64;
+		void *p = realloc(cm->names, size * sizeof(cm->names[0]));
+		if(!p) {
+			cm->cacheable = 0;
+			free(path);
+			return;
+		}
+		cm->names = p;
+		cm->names_size = size;
+	}
+
+	cn = &cm->names[cm->names_count];
+	memset(cn, 0, sizeof(*cn));
+	cn->path = path;
+	cn->path_len = path_len;
+	if(!path) {
+		size_t i;
+		for(i = 0; i < cm->detached_count; i++) {
+			if(cm->detached[i] == expr) break;
+		}
+		if(i == cm->detached_count) {
+			void *p = realloc(cm->detached,
+			                  (i + 1) * sizeof(cm->detached[0]));
+			if(!p) {
+				cm->cacheable = 0;
+				return;
+			}
+			cm->detached = p;
+			cm->detached[cm->detached_count++] = expr;
+		}
+		cn->detached = i;
+		cn->identifier = strdup(expr->Identifier ? expr->Identifier : "");
+		cn->lineno = expr->_lineno;
+	}
+	cn->name = strdup(name);
+	if(!cn->name || (!path && !cn->identifier)) {
+		free(cn->identifier);
+		free(cn->name);
+		cm->cacheable = 0;
+		return;
+	}
+	cm->names_count++;
+}
+
+void
+asn1c_cache_compiling(asn1c_cache_t *cache, asn1p_module_t *mod) {
+	cache->current = cached_module(cache, mod);
+	if(cache->current)
+		cache->current->compiled = 1;
+}
+
+/*
+ * Writing and reading the cache file.
+ */
+
+static void
+put_num(FILE *fp, long num) {
+	fprintf(fp, "%ld\n", num);
+}
+
+static void
+put_bytes(FILE *fp, const char *buf, size_t len) {
+	put_num(fp, (long)len);
+	fwrite(buf, len, 1, fp);
+	fputc('\n', fp);
+}
+
+static int
+get_num(FILE *fp, long *num) {
+	int negative = 0;
+	long value = 0;
+	int digits = 0;
+	int ch;
+
+	ch = getc(fp);
+	if(ch == '-') {
+		negative = 1;
+		ch = getc(fp);
+	}
+	for(; ch >= '0' && ch <= '9'; ch = getc(fp), digits++) {
+		if(value > (LONG_MAX - 9) / 10)
+			return -1;
+		value = value * 10 + (ch - '0');
+	}
+	if(!digits || ch != '\n')
+		return -1;
+
+	*num = negative ? -value : value;
+	return 0;
+}
+
+static char *
+get_bytes(FILE *fp, long *len_r) {
+	char *buf;
+	long len;
+
+	if(get_num(fp, &len) || len < 0 || len > INT_MAX)
+		return NULL;
+	buf = malloc(len + 1);
+	if(!buf) return NULL;
+	if((len && fread(buf, len, 1, fp) != 1) || fgetc(fp) != '\n') {
+		free(buf);
+		return NULL;
+	}
+	buf[len] = '\0';
+	if(len_r) *len_r = len;
+	return buf;
+}
+
+static void
+cache_filename(cached_module_t *cm, char *buf, size_t size) {
+	snprintf(buf, size, "%s-%016llx", cm->mod->ModuleName,
+	         (unsigned long long)cm->key);
+}
+
+static int
+store_module(asn1c_cache_t *cache, cached_module_t *cm) {
+	arg_t *arg = cache->arg;
+	char base[PATH_MAX];
+	char fname[PATH_MAX];
+	char *tmpname = NULL;
+	asn1p_expr_t *expr;
+	size_t count = 0;
+	size_t i;
+	FILE *fp;
+	int ret;
+
+	TQ_FOR(expr, &(cm->mod->members), next) {
+		if(!expr->data) return -1;
+		count++;
+	}
+
+	cache_filename(cm, base, sizeof(base));
+	fp = asn1c_open_file(cache->dir, base, ".cache", &tmpname);
+	if(!fp) return -1;
+
+	put_bytes(fp, CACHE_MAGIC, strlen(CACHE_MAGIC));
+	put_num(fp, (long)count);
+	TQ_FOR(expr, &(cm->mod->members), next) {
+		compiler_streams_t *cs = expr->data;
+		const char *id = expr->Identifier ? expr->Identifier : "";
+		int ot;
+		put_bytes(fp, id, strlen(id));
+		for(ot = 0; ot < OT_MAX; ot++) {
+			out_chunk_t *chunk;
+			long chunks = 0;
+			TQ_FOR(chunk, &(cs->destination[ot].chunks), next)
+				chunks++;
+			put_num(fp, chunks);
+			TQ_FOR(chunk, &(cs->destination[ot].chunks), next)
+				put_bytes(fp, chunk->buf, chunk->len);
+		}
+	}
+
+	put_num(fp, (long)cm->names_count);
+	for(i = 0; i < cm->names_count; i++) {
+		cached_name_t *cn = &cm->names[i];
+		int p;
+		put_num(fp, cn->path_len);
+		for(p = 0; p < cn->path_len; p++)
+			put_num(fp, cn->path[p]);
+		if(!cn->path) {
+			put_num(fp, cn->detached);
+			put_bytes(fp, cn->identifier, strlen(cn->identifier));
+			put_num(fp, cn->lineno);
+		}
+		put_bytes(fp, cn->name, strlen(cn->name));
+	}
+
+	ret = (ferror(fp) | fclose(fp)) ? -1 : 0;
+
+	if(ret || snprintf(fname, sizeof(fname), "%s%s.cache", cache->dir, base)
+			  >= (int)sizeof(fname)
+	|| rename(tmpname, fname)) {
+		unlink(tmpname);
+		ret = -1;
+	} else {
+		DEBUG("Stored module %s into %s", cm->mod->ModuleName, fname);
+	}
+	free(tmpname);
+
+	return ret;
+}
+
+void
+asn1c_cache_store(asn1c_cache_t *cache) {
+	arg_t *arg = cache->arg;
+	size_t i;
+
+	for(i = 0; i < cache->count; i++) {
+		cached_module_t *cm = &cache->modules[i];
+		if(cm->cacheable && cm->compiled && !cm->loaded) {
+			if(store_module(cache, cm)) {
+				WARNING("Could not cache the compiled module %s in %s",
+				        cm->mod->ModuleName, cache->dir);
+			}
+		}
+	}
+}
+
+static compiler_streams_t *
+new_streams() {
+	compiler_streams_t *cs;
+	int ot;
+
+	cs = calloc(1, sizeof(*cs));
+	if(!cs) return NULL;
+	for(ot = 0; ot < OT_MAX; ot++) {
+		TQ_INIT(&(cs->destination[ot].chunks));
+	}
+
+	return cs;
+}
+
+static void
+free_streams(compiler_streams_t *cs) {
+	out_chunk_t *chunk;
+	int ot;
+
+	if(!cs) return;
+	for(ot = 0; ot < OT_MAX; ot++) {
+		while((chunk = TQ_REMOVE(&(cs->destination[ot].chunks), next))) {
+			free(chunk->buf);
+			free(chunk);
+		}
+	}
+	free(cs);
+}
+
+static int
+load_streams(FILE *fp, compiler_streams_t *cs) {
+	int ot;
+
+	for(ot = 0; ot < OT_MAX; ot++) {
+		long chunks;
+		if(get_num(fp, &chunks) || chunks < 0)
+			return -1;
+		while(chunks--) {
+			out_chunk_t *chunk = calloc(1, sizeof(*chunk));
+			long len;
+			if(!chunk) return -1;
+			chunk->buf = get_bytes(fp, &len);
+			if(!chunk->buf) {
+				free(chunk);
+				return -1;
+			}
+			chunk->len = len;
+			TQ_ADD(&(cs->destination[ot].chunks), chunk, next);
+		}
+	}
+
+	return 0;
+}
+
+static int
+load_names(FILE *fp, cached_module_t *cm, asn1p_expr_t **tops,
+           size_t tops_count) {
+	long count;
+	long i;
+
+	if(get_num(fp, &count) || count < 0)
+		return -1;
+
+	for(i = 0; i < count; i++) {
+		cached_name_t *cn;
+		long path_len;
+		long num;
+		int p;
+
+		if(cm->names_count == cm->names_size) {
+			size_t size = cm->names_size ? 2 * cm->names_size : 64;
+			void *ptr = realloc(cm->names, size * sizeof(cm->names[0]));
+			if(!ptr) return -1;
+			cm->names = ptr;
+			cm->names_size = size;
+		}
+		cn = &cm->names[cm->names_count++];
+		memset(cn, 0, sizeof(*cn));
+
+		if(get_num(fp, &path_len) || path_len < 0 || path_len > 1024)
+			return -1;
+		if(path_len) {
+			cn->path = malloc(path_len * sizeof(cn->path[0]));
+			if(!cn->path) return -1;
+			cn->path_len = path_len;
+			for(p = 0; p < path_len; p++) {
+				if(get_num(fp, &num) || num < 0 || num > INT_MAX)
+					return -1;
+				cn->path[p] = num;
+			}
+			cn->expr = path_expr(tops, tops_count, cn->path, cn->path_len);
+			if(!cn->expr)
+				return -1;
+		} else {
+			if(get_num(fp, &num) || num < 0 || num > INT_MAX)
+				return -1;
+			cn->detached = num;
+			cn->identifier = get_bytes(fp, NULL);
+			if(!cn->identifier || get_num(fp, &num))
+				return -1;
+			cn->lineno = num;
+		}
+		cn->name = get_bytes(fp, NULL);
+		if(!cn->name) return -1;
+	}
+
+	return 0;
+}
+
+/*
+ * Give the cached names back to the name clash finder, so that the
+ * clashes with the names of the modules compiled anew are still found.
+ */
+static void
+replay_names(cached_module_t *cm) {
+	asn1p_expr_t **detached = NULL;
+	size_t detached_count = 0;
+	size_t i;
+
+	for(i = 0; i < cm->names_count; i++) {
+		cached_name_t *cn = &cm->names[i];
+		if(!cn->path && (size_t)cn->detached >= detached_count)
+			detached_count = cn->detached + 1;
+	}
+	if(detached_count) {
+		detached = calloc(detached_count, sizeof(detached[0]));
+		assert(detached);
+	}
+
+	for(i = 0; i < cm->names_count; i++) {
+		cached_name_t *cn = &cm->names[i];
+		asn1p_expr_t *expr;
+
+		if(cn->path) {
+			expr = cn->expr;
+		} else {
+			expr = detached[cn->detached];
+			if(!expr) {
+				expr = asn1p_expr_new(cn->lineno, cm->mod);
+				assert(expr);
+				expr->Identifier = strdup(cn->identifier);
+				detached[cn->detached] = expr;
+			}
+		}
+		c_name_clash_finder_replay(expr, cn->name);
+	}
+
+	for(i = 0; i < cm->names_count; i++) {
+		cached_name_t *cn = &cm->names[i];
+		if(cn->path) {
+			cn->expr->_mark |= TM_NAMEGIVEN;
+		}
+	}
+
+	/* The clash finder holds the references it needs */
+	for(i = 0; i < detached_count; i++)
+		asn1p_expr_free(detached[i]);
+	free(detached);
+}
+
+int
+asn1c_cache_load(asn1c_cache_t *cache, asn1p_module_t *mod) {
+	cached_module_t *cm = cached_module(cache, mod);
+	arg_t *arg = cache->arg;
+	compiler_streams_t **streams;
+	asn1p_expr_t **tops;
+	cached_module_t observed;
+	char base[PATH_MAX];
+	char fname[PATH_MAX];
+	asn1p_expr_t *expr;
+	size_t count = 0;
+	char *magic;
+	long types;
+	size_t i;
+	FILE *fp;
+	int ret = -1;
+
+	if(!cm || !cm->cacheable)
+		return -1;
+
+	cache_filename(cm, base, sizeof(base));
+	if(snprintf(fname, sizeof(fname), "%s%s.cache", cache->dir, base)
+	   >= (int)sizeof(fname))
+		return -1;
+	fp = fopen(fname, "rb");
+	if(!fp) return -1;
+
+	TQ_FOR(expr, &(mod->members), next) {
+		if(expr->data) {
+			fclose(fp);
+			return -1;
+		}
+		count++;
+	}
+	streams = calloc(count ? count : 1, sizeof(streams[0]));
+	tops = calloc(count ? count : 1, sizeof(tops[0]));
+	if(!streams || !tops) {
+		free(streams);
+		free(tops);
+		fclose(fp);
+		return -1;
+	}
+
+	magic = get_bytes(fp, NULL);
+	if(!magic || strcmp(magic, CACHE_MAGIC) || get_num(fp, &types)
+	|| types != (long)count) {
+		goto end;
+	}
+
+	i = 0;
+	TQ_FOR(expr, &(mod->members), next) {
+		char *id = get_bytes(fp, NULL);
+		int mismatch = !id
+			|| strcmp(id, expr->Identifier ? expr->Identifier : "");
+		free(id);
+		if(mismatch) goto end;
+		tops[i] = expr;
+		streams[i] = new_streams();
+		if(!streams[i] || load_streams(fp, streams[i]))
+			goto end;
+		i++;
+	}
+
+	/* Set aside the names observed while compiling the other modules */
+	observed = *cm;
+	cm->names = NULL;
+	cm->names_count = 0;
+	cm->names_size = 0;
+	cm->detached = NULL;
+	cm->detached_count = 0;
+
+	if(load_names(fp, cm, tops, count) || fgetc(fp) != EOF) {
+		free_names(cm);
+		cm->names = observed.names;
+		cm->names_count = observed.names_count;
+		cm->names_size = observed.names_size;
+		cm->detached = observed.detached;
+		cm->detached_count = observed.detached_count;
+		goto end;
+	}
+	free_names(&observed);
+
+	/* Everything is in place, use it */
+	i = 0;
+	TQ_FOR(expr, &(mod->members), next) {
+		expr->data = streams[i];
+		streams[i++] = NULL;
+	}
+	cm->loaded = 1;
+	replay_names(cm);
+	ret = 0;
+
+	DEBUG("Retrieved module %s from %s", mod->ModuleName, fname);
+
+end:
+	for(i = 0; i < count; i++)
+		free_streams(streams[i]);
+	free(streams);
+	free(tops);
+	free(magic);
+	fclose(fp);
+	return ret;
+}
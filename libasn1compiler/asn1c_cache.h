@@ -0,0 +1,38 @@
+#ifndef	ASN1C_CACHE_H
+#define	ASN1C_CACHE_H
+
+/*
+ * The cache of the compiled output of the ASN.1 modules (-fcache-dir).
+ * A module is retrieved from the cache when neither its source nor
+ * the sources of its (transitive) imports nor the compiler options
+ * have changed since it was compiled last time.
+ */
+typedef struct asn1c_cache_s asn1c_cache_t;
+
+/*
+ * Compute the cache keys for all the modules of the (fixed) tree.
+ */
+asn1c_cache_t *asn1c_cache_new(arg_t *arg, const char *cache_dir, int optc,
+                               char **argv);
+
+/*
+ * Attach the cached output streams to the module's top level types
+ * and give their names back to the name clash finder.
+ * Returns 0 if the module has been retrieved from the cache, -1 otherwise.
+ */
+int asn1c_cache_load(asn1c_cache_t *, asn1p_module_t *mod);
+
+/*
+ * Mark the beginning (mod) or the end (NULL) of the module compilation.
+ */
+void asn1c_cache_compiling(asn1c_cache_t *, asn1p_module_t *mod);
+
+/*
+ * Store the compiled modules into the cache.
+ * Must be invoked while the output streams are still attached.
+ */
+void asn1c_cache_store(asn1c_cache_t *);
+
+void asn1c_cache_free(asn1c_cache_t *);
+
+#endif	/* ASN1C_CACHE_H */
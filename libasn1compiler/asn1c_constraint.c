@@ -17,6 +17,8 @@ static abuf *emit_range_comparison_code(asn1cnst_range_t *range,
                                           asn1c_integer_t natural_start,
                                           asn1c_integer_t natural_stop);
 static int native_long_sign(arg_t *arg, asn1cnst_range_t *r);	/* -1, 0, 1 */
+static void compute_checked_ranges(asn1p_expr_t *expr, asn1p_expr_type_e etype,
+		asn1cnst_range_t **r_value, asn1cnst_range_t **r_size);
 
 static int
 ulong_optimization(arg_t *arg, asn1p_expr_type_e etype, asn1cnst_range_t *r_size,
@@ -47,31 +49,7 @@ asn1c_emit_constraint_checking_code(arg_t *arg) {
 
 	etype = _find_terminal_type(arg);
 
-	r_value=asn1constraint_compute_constraint_range(expr->Identifier, etype, ct, ACT_EL_RANGE,0,0,0);
-	r_size =asn1constraint_compute_constraint_range(expr->Identifier, etype, ct, ACT_CT_SIZE, 0,0,0);
-	if(r_value) {
-		if(r_value->incompatible
-		|| r_value->empty_constraint
-		|| (r_value->left.type == ARE_MIN
-			&& r_value->right.type == ARE_MAX)
-		|| (etype == ASN_BASIC_BOOLEAN
-			&& r_value->left.value == 0
-			&& r_value->right.value == 1)
-		) {
-			asn1constraint_range_free(r_value);
-			r_value = 0;
-		}
-	}
-	if(r_size) {
-		if(r_size->incompatible
-		|| r_size->empty_constraint
-		|| (r_size->left.value == 0	/* or .type == MIN */
-			&& r_size->right.type == ARE_MAX)
-		) {
-			asn1constraint_range_free(r_size);
-			r_size = 0;
-		}
-	}
+	compute_checked_ranges(expr, etype, &r_value, &r_size);
 
 	/*
 	 * Do we really need an "*st = sptr" pointer?
@@ -229,7 +207,8 @@ asn1c_emit_constraint_checking_code(arg_t *arg) {
 		switch(etype) {
 		case ASN_CONSTR_SEQUENCE_OF:
 			OUT("/* Perform validation of the inner elements */\n");
-			OUT("return SEQUENCE_OF_constraint(td, sptr, ctfailcb, app_key);\n");
+			OUT("return SEQUENCE_OF%s_constraint(td, sptr, ctfailcb, app_key);\n",
+				asn1c_type_packed_values(arg, arg->expr) ? "_packed" : "");
 			break;
 		case ASN_CONSTR_SET_OF:
 			OUT("/* Perform validation of the inner elements */\n");
@@ -256,6 +235,105 @@ end:
 	return ret;
 }
 
+/*
+ * The value and size ranges worth checking at run time.
+ */
+static void
+compute_checked_ranges(asn1p_expr_t *expr, asn1p_expr_type_e etype,
+		asn1cnst_range_t **r_value, asn1cnst_range_t **r_size) {
+	asn1p_constraint_t *ct = expr->combined_constraints;
+
+	*r_value = asn1constraint_compute_constraint_range(expr->Identifier,
+			etype, ct, ACT_EL_RANGE, 0, 0, 0);
+	*r_size = asn1constraint_compute_constraint_range(expr->Identifier,
+			etype, ct, ACT_CT_SIZE, 0, 0, 0);
+	if(*r_value) {
+		if((*r_value)->incompatible
+		|| (*r_value)->empty_constraint
+		|| ((*r_value)->left.type == ARE_MIN
+			&& (*r_value)->right.type == ARE_MAX)
+		|| (etype == ASN_BASIC_BOOLEAN
+			&& (*r_value)->left.value == 0
+			&& (*r_value)->right.value == 1)
+		) {
+			asn1constraint_range_free(*r_value);
+			*r_value = 0;
+		}
+	}
+	if(*r_size) {
+		if((*r_size)->incompatible
+		|| (*r_size)->empty_constraint
+		|| ((*r_size)->left.value == 0	/* or .type == MIN */
+			&& (*r_size)->right.type == ARE_MAX)
+		) {
+			asn1constraint_range_free(*r_size);
+			*r_size = 0;
+		}
+	}
+}
+
+/*
+ * Produce the test of the native INTEGER, ENUMERATED or BOOLEAN value
+ * of the expression, equivalent to the constraint checking function
+ * asn1c_emit_constraint_checking_code() would generate for it.
+ * Returns an empty buffer if the value is always good, and NULL if the
+ * constraints do not reduce to a range test.
+ */
+abuf *
+asn1c_native_constraint_test(arg_t *arg, asn1p_expr_t *expr,
+		asn1p_expr_type_e etype, const char *value) {
+	asn1cnst_range_t *r_value;
+	asn1cnst_range_t *r_size;
+	char varname[256];
+	abuf *ab;
+
+	switch(etype) {
+	case ASN_BASIC_INTEGER:
+	case ASN_BASIC_ENUMERATED:
+		if(asn1c_type_fits_long(arg, expr) == FL_NOTFIT)
+			return NULL;
+		break;
+	case ASN_BASIC_BOOLEAN:
+		break;
+	default:
+		return NULL;
+	}
+
+	if(!expr->combined_constraints)
+		return abuf_new();
+
+	compute_checked_ranges(expr, etype, &r_value, &r_size);
+	if(r_size || !r_value) {
+		/* The checker would defer to the type's one */
+		if(r_value) asn1constraint_range_free(r_value);
+		if(r_size) asn1constraint_range_free(r_size);
+		return NULL;
+	}
+
+	if(etype == ASN_BASIC_BOOLEAN) {
+		snprintf(varname, sizeof(varname), "(%s ? 1 : 0)", value);
+		ab = emit_range_comparison_code(r_value, varname, 0, 1);
+	} else if(native_long_sign(arg, r_value) >= 0) {
+		if(ulong_optimization(arg, etype, r_size, r_value)) {
+			asn1constraint_range_free(r_value);
+			return abuf_new();
+		}
+		snprintf(varname, sizeof(varname), "(unsigned long)%s", value);
+		ab = emit_range_comparison_code(r_value, varname, 0, -1);
+	} else {
+		ab = emit_range_comparison_code(r_value, value, -1, -1);
+	}
+	asn1constraint_range_free(r_value);
+
+	if(!ab->length) {
+		/* No applicable constraints, the checker defers to the type's one */
+		abuf_free(ab);
+		return NULL;
+	}
+
+	return ab;
+}
+
 static int
 asn1c_emit_constraint_tables(arg_t *arg, int got_size) {
 	asn1c_integer_t range_start;
@@ -715,7 +793,7 @@ emit_value_determination_code(arg_t *arg, asn1p_expr_type_e etype, asn1cnst_rang
 		}
 		break;
 	case ASN_BASIC_BOOLEAN:
-		OUT("value = (*(const long *)sptr) ? 1 : 0;\n");
+		OUT("value = (*(const BOOLEAN_t *)sptr) ? 1 : 0;\n");
 		break;
 	default:
 		WARNING("%s:%d: Value cannot be determined "
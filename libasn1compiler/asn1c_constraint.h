@@ -3,4 +3,7 @@
 
 int asn1c_emit_constraint_checking_code(arg_t *arg);
 
+abuf *asn1c_native_constraint_test(arg_t *arg, asn1p_expr_t *expr,
+		asn1p_expr_type_e etype, const char *value);
+
 #endif	/* ASN1C_CONSTRAINT_H */
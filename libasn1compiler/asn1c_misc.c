@@ -492,3 +492,53 @@ asn1c_type_fits_long(arg_t *arg, asn1p_expr_t *expr) {
 	return FL_FITS_SIGNED;
 }
 
+/*
+ * Check whether the SEQUENCE OF type keeps its values in place
+ * (-fpacked-sequence-of): the values of the simple types which are
+ * represented by the native C types are stored in a contiguous array.
+ */
+int
+asn1c_type_packed_values(arg_t *arg, asn1p_expr_t *expr) {
+	asn1p_expr_t *terminal;
+	asn1p_expr_t *memb;
+	arg_t tmp;
+
+	/* The protobuf codecs are of the pointer lists */
+	if(!(arg->flags & A1C_PACKED_SEQUENCE_OF)
+	|| (arg->flags & A1C_GEN_PROTOBUF))
+		return 0;
+
+	terminal = WITH_MODULE_NAMESPACE(
+		expr->module, expr_ns,
+		asn1f_find_terminal_type_ex(arg->asn, expr_ns, expr));
+	if(!terminal || terminal->expr_type != ASN_CONSTR_SEQUENCE_OF)
+		return 0;
+	memb = TQ_FIRST(&terminal->members);
+	if(!memb) return 0;
+
+	tmp = *arg;
+	tmp.expr = memb;
+	switch(expr_get_type(&tmp, memb)) {
+	case ASN_BASIC_BOOLEAN:
+		return 1;
+	case ASN_BASIC_INTEGER:
+	case ASN_BASIC_ENUMERATED:
+		return asn1c_type_fits_long(&tmp, memb) != FL_NOTFIT;
+	case ASN_BASIC_REAL:
+		return !(arg->flags & A1C_USE_WIDE_TYPES)
+			|| asn1c_REAL_fits(&tmp, memb) != RL_NOTFIT;
+	default:
+		return 0;
+	}
+}
+
+int
+asn1c_neutral_option(int optc, char **argv, int i) {
+	/* The location of the compiled output cache */
+	if(strncmp(argv[i], "-fcache-dir=", 12) == 0)
+		return 1;
+	if(strcmp(argv[i], "-f") == 0 && i + 1 < optc
+	&& strncmp(argv[i + 1], "cache-dir=", 10) == 0)
+		return 2;
+	return 0;
+}
@@ -53,4 +53,18 @@ enum asn1c_fitsfloat_e {
 };
 enum asn1c_fitsfloat_e asn1c_REAL_fits(arg_t *arg, asn1p_expr_t *expr);
 
+/*
+ * Check whether the SEQUENCE OF type keeps its INTEGER, ENUMERATED,
+ * BOOLEAN or REAL values in place (-fpacked-sequence-of).
+ * Returns 1 if the values are kept in a contiguous array, 0 otherwise.
+ */
+int asn1c_type_packed_values(arg_t *arg, asn1p_expr_t *expr);
+
+/*
+ * Check whether the command line option at argv[i] does not affect
+ * the generated code (-fcache-dir).
+ * Returns the number of arguments taken by such an option, 0 otherwise.
+ */
+int asn1c_neutral_option(int optc, char **argv, int i);
+
 #endif	/* ASN1_COMPILER_MISC_H */
@@ -14,6 +14,9 @@ struct intl_name {
 
 genhash_t *used_names_hash;
 
+static void (*name_observer)(void *key, asn1p_expr_t *expr, const char *name);
+static void *name_observer_key;
+
 static void
 name_entry_destroy(void *np) {
     struct intl_name *n = np;
@@ -44,10 +47,21 @@ c_name_clash_finder_destroy() {
     used_names_hash = NULL;
 }
 
+void
+c_name_clash_finder_observe(void (*cb)(void *key, asn1p_expr_t *expr,
+                                       const char *name),
+                            void *key) {
+    name_observer = cb;
+    name_observer_key = key;
+}
+
 static void
 register_global_name(asn1p_expr_t *expr, const char *name) {
     struct intl_name *n;
 
+    if(name_observer && !(expr->_mark & TM_NAMEGIVEN))
+        name_observer(name_observer_key, expr, name);
+
     n = genhash_get(used_names_hash, (const void *)name);
     if(n) {
         if(!(expr->_mark & TM_NAMEGIVEN) && (expr != n->expr)) {
@@ -71,6 +85,18 @@ register_global_name(asn1p_expr_t *expr, const char *name) {
     assert(ret == 0);
 }
 
+void
+c_name_clash_finder_replay(asn1p_expr_t *expr, const char *name) {
+    struct intl_name *n;
+
+    n = genhash_get(used_names_hash, (const void *)name);
+    if(n && n->expr == expr)
+        return; /* Already given by this very expression */
+
+    expr->_mark &= ~TM_NAMEGIVEN;
+    register_global_name(expr, name);
+}
+
 int
 c_name_clash(arg_t *arg) {
     struct intl_name *n;
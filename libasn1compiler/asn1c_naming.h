@@ -44,4 +44,18 @@ void c_name_clash_finder_init(void);
 
 void c_name_clash_finder_destroy(void);
 
+/*
+ * Invoke the callback for every name entering the clash finder,
+ * so that the names given while compiling a module could be cached.
+ */
+void c_name_clash_finder_observe(void (*cb)(void *key, asn1p_expr_t *expr,
+                                            const char *name),
+                                 void *key);
+
+/*
+ * Register a name previously given to the expression, e.g. by the
+ * cached compilation of the expression's module.
+ */
+void c_name_clash_finder_replay(asn1p_expr_t *expr, const char *name);
+
 #endif	/* ASN1_COMPILER_NAMING_H */
@@ -10,6 +10,13 @@
 #define symlink(a,b) (errno=ENOSYS, -1)
 #endif
 
+/* The converter example transcodes on several threads where it can */
+#ifdef HAVE_LIBPTHREAD
+#define CONVERTER_EXAMPLE_LIBS "-lm -lpthread"
+#else
+#define CONVERTER_EXAMPLE_LIBS "-lm"
+#endif
+
 /* Pedantically check fprintf's return value. */
 static int safe_fprintf(FILE *fp, const char *fmt, ...) {
     va_list ap;
@@ -145,9 +152,10 @@ asn1c__save_library_makefile(arg_t *arg, const asn1c_dep_chainset *deps,
 	safe_fprintf(
 		mkf,
 		"\n"
-		"ASN_MODULE_CFLAGS=%s%s",
+		"ASN_MODULE_CFLAGS=%s%s%s",
 		(arg->flags & A1C_GEN_OER) ? "" : "-DASN_DISABLE_OER_SUPPORT ",
-		(arg->flags & A1C_GEN_PER) ? "" : "-DASN_DISABLE_PER_SUPPORT ");
+		(arg->flags & A1C_GEN_PER) ? "" : "-DASN_DISABLE_PER_SUPPORT ",
+		(arg->flags & A1C_GEN_JER) ? "" : "-DASN_DISABLE_JER_SUPPORT ");
 
 	safe_fprintf(
 		mkf,
@@ -182,7 +190,7 @@ asn1c__save_example_mk_makefile(arg_t *arg, const asn1c_dep_chainset *deps,
     safe_fprintf(
         mkf,
         "include %s%s\n\n"
-        "LIBS += -lm\n"
+        "LIBS += " CONVERTER_EXAMPLE_LIBS "\n"
         "CFLAGS += $(ASN_MODULE_CFLAGS) %s%s-I.\n"
         "ASN_LIBRARY ?= libasncodec.a\n"
         "ASN_PROGRAM ?= converter-example\n"
@@ -616,11 +624,19 @@ generate_preamble(arg_t *arg, FILE *fp, int optc, char **argv) {
 		arg->expr->module->ModuleName,
 		arg->expr->module->source_file_name);
 	if(optc > 1) {
+		int printed = 0;
 		int i;
-		safe_fprintf(fp, " * \t`asn1c ");
-		for(i = 1; i < optc; i++)
-			safe_fprintf(fp, "%s%s", i>1?" ":"", argv[i]);
-		safe_fprintf(fp, "`\n");
+		for(i = 1; i < optc; i++) {
+			int skip = asn1c_neutral_option(optc, argv, i);
+			if(skip) {
+				i += skip - 1;
+				continue;
+			}
+			safe_fprintf(fp, printed++ ? " %s" : " * \t`asn1c %s",
+				argv[i]);
+		}
+		if(printed)
+			safe_fprintf(fp, "`\n");
 	}
 	safe_fprintf(fp, " */\n\n");
 	return 0;
@@ -4,17 +4,26 @@
 #include "asn1c_save.h"
 #include "asn1c_ioc.h"
 #include "asn1c_naming.h"
+#include "asn1c_cache.h"
 
 static void default_logger_cb(int, const char *fmt, ...);
 static int asn1c_compile_expr(arg_t *arg, const asn1c_ioc_table_and_objset_t *);
 static int asn1c_attach_streams(asn1p_expr_t *expr);
 static int asn1c_detach_streams(asn1p_expr_t *expr);
 
+static const char *asn1c__cache_dir;
+
+void
+asn1c__set_cache_dir(const char *cache_dir) {
+	asn1c__cache_dir = cache_dir;
+}
+
 int
 asn1_compile(asn1p_t *asn, const char *datadir, const char *destdir, enum asn1c_flags flags,
 		int argc, int optc, char **argv) {
 	arg_t arg_s;
 	arg_t *arg = &arg_s;
+	asn1c_cache_t *cache = NULL;
 	asn1p_module_t *mod;
 	int ret;
 
@@ -32,17 +41,31 @@ asn1_compile(asn1p_t *asn, const char *datadir, const char *destdir, enum asn1c_
 	arg->flags = flags;
 	arg->asn = asn;
 
+	if(asn1c__cache_dir) {
+		cache = asn1c_cache_new(arg, asn1c__cache_dir, optc, argv);
+		if(!cache)
+			WARNING("Could not use the cache in %s", asn1c__cache_dir);
+	}
+
 	/*
 	 * Compile each individual top level structure.
 	 */
 	TQ_FOR(mod, &(asn->modules), mod_next) {
+		if(cache) {
+			if(asn1c_cache_load(cache, mod) == 0)
+				continue;
+			asn1c_cache_compiling(cache, mod);
+		}
+
 		TQ_FOR(arg->expr, &(mod->members), next) {
 			arg->ns = asn1_namespace_new_from_module(mod, 0);
 
 			compiler_streams_t *cs = NULL;
 
-			if(asn1c_attach_streams(arg->expr))
+			if(asn1c_attach_streams(arg->expr)) {
+				asn1c_cache_free(cache);
 				return -1;
+			}
 
 			cs = arg->expr->data;
 			cs->target = OT_TYPE_DECLS;
@@ -55,15 +78,20 @@ asn1_compile(asn1p_t *asn, const char *datadir, const char *destdir, enum asn1c_
 					arg->expr->expr_type,
 					arg->expr->meta_type,
 					arg->expr->_lineno);
+				asn1c_cache_free(cache);
 				return ret;
 			}
 
 			asn1_namespace_free(arg->ns);
 			arg->ns = 0;
 		}
+
+		if(cache) asn1c_cache_compiling(cache, NULL);
 	}
 
 	if(c_name_clash(arg)) {
+		asn1c_cache_free(cache);
+		cache = NULL;
 		if(arg->flags & A1C_COMPOUND_NAMES) {
 			FATAL("Name clashes encountered even with -fcompound-names flag");
 			/* Proceed further for better debugging. */
@@ -77,6 +105,11 @@ asn1_compile(asn1p_t *asn, const char *datadir, const char *destdir, enum asn1c_
 		}
 	}
 
+	if(cache) {
+		asn1c_cache_store(cache);
+		asn1c_cache_free(cache);
+	}
+
 	DEBUG("Saving compiled data");
 
 	c_name_clash_finder_destroy();
@@ -97,6 +97,47 @@ enum asn1c_flags {
 	 * -debug-output-origin-lines
 	 */
 	A1C_DEBUG_OUTPUT_ORIGIN_LINES = 0x400000,
+	/*
+	 * -finline-optionals
+	 * Store OPTIONAL members of simple types inline in SEQUENCE,
+	 * accompanied by a presence bitmap, rather than by pointer.
+	 */
+	A1C_INLINE_OPTIONALS	= 0x800000,
+	/*
+	 * -fgen-specialized-codecs
+	 * Generate the straight-line UPER codecs for SEQUENCE types,
+	 * falling back to the table-driven ones where it doesn't pay off.
+	 */
+	A1C_GEN_SPECIALIZED_CODECS	= 0x1000000,
+	/*
+	 * -fgen-aggregate-constraints
+	 * Generate the constraint checkers of SEQUENCE types testing the
+	 * values of the simple members in place.
+	 */
+	A1C_GEN_AGGREGATE_CONSTRAINTS	= 0x2000000,
+	/*
+	 * -gen-protobuf
+	 * Generate the Protocol Buffers wire format codecs
+	 * following the field numbering of the -B schema.
+	 */
+	A1C_GEN_PROTOBUF	= 0x4000000,
+	/*
+	 * -gen-JER
+	 * Generate JSON Encoding Rules support code
+	 */
+	A1C_GEN_JER			= 0x8000000,
+	/*
+	 * -fpacked-sequence-of
+	 * Keep the simple values of SEQUENCE OF (INTEGER, ENUMERATED,
+	 * BOOLEAN, REAL) in a contiguous array rather than by pointer.
+	 */
+	A1C_PACKED_SEQUENCE_OF	= 0x10000000,
+	/*
+	 * -fset-of-slab
+	 * Let the PER and OER decoders allocate the elements of SET OF
+	 * and SEQUENCE OF in one block, the slab, rather than one by one.
+	 */
+	A1C_SET_OF_SLAB		= 0x20000000,
 };
 
 /*
@@ -110,4 +151,9 @@ void asn1c_debug_type_naming(asn1p_t *asn, enum asn1c_flags,
 
 void asn1c__add_pdu_type(const char *typename);
 
+/*
+ * Reuse the compiled output of the unchanged modules (-fcache-dir).
+ */
+void asn1c__set_cache_dir(const char *cache_dir);
+
 #endif	/* ASN1_COMPILER_H */
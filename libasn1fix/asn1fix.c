@@ -75,6 +75,9 @@ asn1f_process(asn1p_t *asn, enum asn1f_flags flags,
 		return -1;
 	}
 
+    /* The passes below modify the tree: do not trust the resolutions */
+    asn1f_memoize_resolutions(0);
+
     /*
      * Process each module in the list.
      * PHASE I.
@@ -103,6 +106,9 @@ asn1f_process(asn1p_t *asn, enum asn1f_flags flags,
 
     memset(&a1f_replace_me_with_proper_interface_arg, 0, sizeof(arg_t));
 
+    /* The tree is fixed, the compiler may reuse the type resolutions */
+    asn1f_memoize_resolutions(1);
+
 	/*
 	 * Compute a return value.
 	 */
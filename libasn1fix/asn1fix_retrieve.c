@@ -7,6 +7,7 @@ enum ftt_what {
 };
 
 static asn1p_expr_t *asn1f_find_terminal_thing(arg_t *arg, asn1p_expr_t *expr, enum ftt_what);
+static asn1p_expr_t *asn1f_follow_terminal_thing(arg_t *arg, asn1p_ref_t *ref, asn1p_expr_t *tc, enum ftt_what);
 static int asn1f_compatible_with_exports(arg_t *arg, asn1p_module_t *mod, const char *name);
 
 
@@ -32,42 +33,63 @@ static asn1p_expr_t *
 asn1f_lookup_in_module(asn1p_module_t *mod, const char *name) {
     asn1p_expr_t *expr = genhash_get(mod->members_hash, name);
     if(!expr) {
-        asn1p_expr_t *memb;
-        TQ_FOR(memb, &mod->members, next) {
-            if(memb->expr_type == ASN_BASIC_ENUMERATED) {
-                asn1p_expr_t *v = asn1f_lookup_child(memb, name);
-                if(v) return v;
-            }
-        }
+        /* The value of some ENUMERATED type defined in this module */
+        expr = genhash_get(mod->enumerators_hash, name);
     }
 
     return expr;
 }
 
+/*
+ * Find the IMPORTS clause explicitly listing the given symbol.
+ * The index is built on first use: IMPORTS do not change after parsing.
+ */
+static asn1p_xports_t *
+asn1f_lookup_import_clause(asn1p_module_t *mod, const char *name) {
+	if(mod->imports_hash == NULL) {
+		asn1p_xports_t *xp;
+		asn1p_expr_t *tc;
+
+		mod->imports_hash = genhash_new(cmpf_string, hashf_string, NULL, NULL);
+		if(mod->imports_hash == NULL)
+			return NULL;
+
+		TQ_FOR(xp, &(mod->imports), xp_next) {
+			TQ_FOR(tc, &(xp->xp_members), next) {
+				(void)genhash_addunique(mod->imports_hash,
+					tc->Identifier, xp);
+			}
+		}
+	}
+
+	return genhash_get(mod->imports_hash, name);
+}
+
 asn1p_module_t *
 asn1f_lookup_in_imports(arg_t *arg, asn1p_module_t *mod, const char *name) {
+	asn1p_xports_t *listed_in;
 	asn1p_xports_t *xp;
 
 	/*
 	 * Search in which exactly module this name is defined.
 	 */
+	listed_in = asn1f_lookup_import_clause(mod, name);
 	TQ_FOR(xp, &(mod->imports), xp_next) {
-        asn1p_module_t *fromModule =
-            asn1f_lookup_module(arg, xp->fromModuleName, NULL);
-        asn1p_expr_t *tc = (asn1p_expr_t *)0;
+		asn1p_module_t *fromModule;
 
-        TQ_FOR(tc, &(xp->xp_members), next) {
-            if(strcmp(name, tc->Identifier) == 0)
-				break;
+		if(xp == listed_in)
+			break;
 
-			if(!fromModule)
-				continue;
+		if(TQ_FIRST(&(xp->xp_members)) == NULL)
+			continue;
 
-            asn1p_expr_t *v =
-                asn1f_lookup_in_module(fromModule, name);
-            if(v) break;
-		}
-		if(tc) break;
+		/*
+		 * An earlier IMPORTS clause may bring in a module
+		 * which happens to define this symbol, too.
+		 */
+		fromModule = asn1f_lookup_module(arg, xp->fromModuleName, NULL);
+		if(fromModule && asn1f_lookup_in_module(fromModule, name))
+			break;
 	}
 	if(xp == NULL) {
 		errno = ESRCH;
@@ -145,26 +167,15 @@ asn1f_lookup_module(arg_t *arg, const char *module_name, const asn1p_oid_t *oid)
 
 	/*
 	 * Perform lookup using OID or module_name.
+	 * An OID match is accepted even if the name doesn't match.
 	 */
-	TQ_FOR(mod, &(arg->asn->modules), mod_next) {
-		if(oid) {
-			if(mod->module_oid) {
-				if(asn1p_oid_compare(oid,
-					mod->module_oid)) {
-					continue;
-				} else {
-					/* Match! Even if name doesn't. */
-					return mod;
-				}
-			} else {
-				/* Not match, even if name is the same. */
-				continue;
-			}
-		}
-	
-		if(strcmp(module_name, mod->ModuleName) == 0)
-			return mod;
+	if(oid) {
+		mod = genhash_get(arg->asn->modules_oid_hash, oid);
+	} else {
+		mod = genhash_get(arg->asn->modules_hash, module_name);
 	}
+	if(mod)
+		return mod;
 
 	DEBUG("\tModule \"%s\" not found", module_name);
 
@@ -460,11 +471,48 @@ asn1f_find_ancestor_type_with_PER_constraint(arg_t *arg, asn1p_expr_t *expr) {
 	return asn1f_find_terminal_thing(arg, expr, FTT_CONSTR_TYPE);
 }
 
+/*
+ * Non-zero generation means the tree is not modified anymore,
+ * so the type references resolved so far may be reused.
+ */
+static unsigned asn1f_resolution_generation;
+static unsigned asn1f_resolution_generations_used;
+
+void
+asn1f_memoize_resolutions(int enable) {
+    if(enable) {
+        asn1f_resolution_generation = ++asn1f_resolution_generations_used;
+    } else {
+        asn1f_resolution_generation = 0;
+    }
+}
+
+static asn1p_expr_t *
+asn1f_memoized_resolution(asn1p_expr_t *expr) {
+    if(asn1f_resolution_generation
+       && expr->_resolved_generation == asn1f_resolution_generation) {
+        return expr->_resolved_reference;
+    }
+    return NULL;
+}
+
 static asn1p_expr_t *
 asn1f_find_terminal_thing(arg_t *arg, asn1p_expr_t *expr, enum ftt_what what) {
 	asn1p_ref_t *ref = 0;
 	asn1p_expr_t *tc;
 
+    if(what != FTT_VALUE) {
+        /* Expression may be a terminal type itself */
+        if(expr->expr_type != A1TC_REFERENCE) {
+            return expr;
+        }
+        /* The symbol lookup is not necessary if it was done already */
+        tc = asn1f_memoized_resolution(expr);
+        if(tc) {
+            return asn1f_follow_terminal_thing(arg, expr->reference, tc, what);
+        }
+    }
+
     if(arg->mod != expr->module) {
         return WITH_MODULE(expr->module,
                            asn1f_find_terminal_thing(arg, expr, what));
@@ -473,10 +521,6 @@ asn1f_find_terminal_thing(arg_t *arg, asn1p_expr_t *expr, enum ftt_what what) {
     switch(what) {
     case FTT_TYPE:
     case FTT_CONSTR_TYPE:
-        /* Expression may be a terminal type itself */
-        if(expr->expr_type != A1TC_REFERENCE) {
-            return expr;
-        }
         ref = expr->reference;
         break;
     case FTT_VALUE:
@@ -538,6 +582,22 @@ asn1f_find_terminal_thing(arg_t *arg, asn1p_expr_t *expr, enum ftt_what what) {
 		}
 	}
 
+    if(what != FTT_VALUE && asn1f_resolution_generation) {
+        expr->_resolved_reference = tc;
+        expr->_resolved_generation = asn1f_resolution_generation;
+    }
+
+    return asn1f_follow_terminal_thing(arg, ref, tc, what);
+}
+
+/*
+ * Continue the search from the expression (tc) the reference resolved to.
+ */
+static asn1p_expr_t *
+asn1f_follow_terminal_thing(arg_t *arg, asn1p_ref_t *ref, asn1p_expr_t *tc,
+                            enum ftt_what what) {
+    asn1p_expr_t *expr;
+
 	/*
 	 * Recursive loops detection.
 	 */
@@ -555,7 +615,14 @@ asn1f_find_terminal_thing(arg_t *arg, asn1p_expr_t *expr, enum ftt_what what) {
     }
 
     tc->_mark |= TM_RECURSION;
-    expr = WITH_MODULE(tc->module, asn1f_find_terminal_thing(arg, tc, what));
+    if(what != FTT_VALUE
+       && (tc->expr_type != A1TC_REFERENCE || asn1f_memoized_resolution(tc))) {
+        /* No symbol lookup, thus no namespace is needed */
+        expr = asn1f_find_terminal_thing(arg, tc, what);
+    } else {
+        expr = WITH_MODULE(tc->module,
+                           asn1f_find_terminal_thing(arg, tc, what));
+    }
     tc->_mark &= ~TM_RECURSION;
 
     return expr;
@@ -72,5 +72,12 @@ asn1p_expr_t *asn1f_find_terminal_value(arg_t *arg, asn1p_expr_t *tc);
  */
 asn1p_expr_t *asn1f_find_ancestor_type_with_PER_constraint(arg_t *arg, asn1p_expr_t *tc);
 
+/*
+ * Enable (1) or disable (0) memoization of the type references resolved
+ * by the functions above. Any call invalidates the memoized resolutions.
+ * Must stay disabled while the fixer passes modify the tree.
+ */
+void asn1f_memoize_resolutions(int enable);
+
 
 #endif	/* ASN1FIX_RETRIEVE_H */
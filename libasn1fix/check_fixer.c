@@ -217,7 +217,7 @@ check(const char *fname,
 			asn1p_module_t *mod;
 			while((mod = TQ_REMOVE(&(std_asn->modules), mod_next))) {
 				mod->_tags |= MT_STANDARD_MODULE;
-				TQ_ADD(&(asn->modules), mod, mod_next);
+				asn1p_add_module(asn, mod);
 			}
 			asn1p_delete(std_asn);
 
@@ -263,6 +263,13 @@ typedef struct asn1p_expr_s {
 	int _type_unique_index;	/* A per top-level-type unique index */
 	int _type_referenced;	/* This type is referenced from another place */
 
+	/*
+	 * The type this reference resolves to, memoized by the fixer.
+	 * Valid only while the generation matches the fixer's one.
+	 */
+	struct asn1p_expr_s *_resolved_reference;
+	unsigned _resolved_generation;
+
 	/*
 	 * Opaque data may be attached to this structure,
 	 * probably by compiler.
@@ -18,7 +18,9 @@ asn1p_module_new() {
 		TQ_INIT(&(mod->members));
 
         mod->members_hash = genhash_new(cmpf_string, hashf_string, NULL, NULL);
-        assert(mod->members_hash);
+        mod->enumerators_hash =
+            genhash_new(cmpf_string, hashf_string, NULL, NULL);
+        assert(mod->members_hash && mod->enumerators_hash);
     }
 	return mod;
 }
@@ -48,17 +50,44 @@ asn1p_module_free(asn1p_module_t *mod) {
 
         genhash_destroy(mod->members_hash);
         mod->members_hash = NULL;
+        genhash_destroy(mod->enumerators_hash);
+        mod->enumerators_hash = NULL;
+        genhash_destroy(mod->imports_hash);
+        mod->imports_hash = NULL;
 
 		free(mod);
 	}
 }
 
+/*
+ * Module OIDs are compared by arc numbers only, see asn1p_oid_compare().
+ */
+static unsigned int
+hashf_oid(const void *key) {
+    const asn1p_oid_t *oid = key;
+    unsigned int h = oid->arcs_count;
+    int i;
+
+    for(i = 0; i < oid->arcs_count; i++)
+        h = h * 31 + (unsigned int)oid->arcs[i].number;
+
+    return h;
+}
+
+static int
+cmpf_oid(const void *key1, const void *key2) {
+    return asn1p_oid_compare(key1, key2);
+}
+
 asn1p_t *
 asn1p_new() {
 	asn1p_t *asn;
 	asn = calloc(1, sizeof(*asn));
 	if(asn) {
 		TQ_INIT(&(asn->modules));
+        asn->modules_hash = genhash_new(cmpf_string, hashf_string, NULL, NULL);
+        asn->modules_oid_hash = genhash_new(cmpf_oid, hashf_oid, NULL, NULL);
+        assert(asn->modules_hash && asn->modules_oid_hash);
 	}
 	return asn;
 }
@@ -70,10 +99,39 @@ asn1p_delete(asn1p_t *asn) {
 		asn1p_module_t *mod;
 		while((mod = TQ_REMOVE(&(asn->modules), mod_next)))
 			asn1p_module_free(mod);
+        genhash_destroy(asn->modules_hash);
+        genhash_destroy(asn->modules_oid_hash);
 		free(asn);
 	}
 }
 
+void
+asn1p_add_module(asn1p_t *asn, asn1p_module_t *mod) {
+    TQ_ADD(&asn->modules, mod, mod_next);
+    mod->asn1p = asn;
+
+    /* The first module with a given name or OID wins the lookup. */
+    if(mod->ModuleName)
+        (void)genhash_addunique(asn->modules_hash, mod->ModuleName, mod);
+    if(mod->module_oid)
+        (void)genhash_addunique(asn->modules_oid_hash, mod->module_oid, mod);
+}
+
+/*
+ * Index the values of the ENUMERATED type, so the fixer could resolve
+ * the bare value identifiers without scanning all the module members.
+ */
+static void
+asn1p_module_index_enumerators(asn1p_module_t *mod, asn1p_expr_t *expr) {
+    asn1p_expr_t *v;
+
+    if(expr->expr_type != ASN_BASIC_ENUMERATED) return;
+
+    TQ_FOR(v, &(expr->members), next) {
+        if(v->Identifier)
+            (void)genhash_addunique(mod->enumerators_hash, v->Identifier, v);
+    }
+}
 
 void
 asn1p_module_move_members(asn1p_module_t *to, asn1p_module_t *from) {
@@ -82,10 +140,12 @@ asn1p_module_move_members(asn1p_module_t *to, asn1p_module_t *from) {
             asn1p_expr_t *expr = TQ_REMOVE(&from->members, next);
             TQ_ADD(&to->members, expr, next);
             genhash_add(to->members_hash, expr->Identifier, expr);
+            asn1p_module_index_enumerators(to, expr);
         }
         assert(TQ_FIRST(&from->members) == 0);
 
         genhash_empty(from->members_hash, 0, 0);
+        genhash_empty(from->enumerators_hash, 0, 0);
     }
 }
 
@@ -94,5 +154,6 @@ asn1p_module_member_add(asn1p_module_t *mod, asn1p_expr_t *expr) {
     if(expr) {
         TQ_ADD(&mod->members, expr, next);
         genhash_add(mod->members_hash, expr->Identifier, expr);
+        asn1p_module_index_enumerators(mod, expr);
     }
 }
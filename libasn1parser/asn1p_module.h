@@ -5,18 +5,24 @@
 #define	ASN1_PARSER_MODULE_H
 
 struct asn1p_module_s;
+struct genhash_s;   /* Forward declaration */
 
 /*
  * A simple container for several modules.
  */
 typedef struct asn1p_s {
-	TQ_HEAD(struct asn1p_module_s)	modules;
+	TQ_HEAD(struct asn1p_module_s)	modules;	/* Do not add directly */
+    struct genhash_s *modules_hash;     /* ModuleName -> first module */
+    struct genhash_s *modules_oid_hash; /* module_oid -> first module */
 } asn1p_t;
 
 asn1p_t *asn1p_new(void);
 void asn1p_delete(asn1p_t *asn);
 
-struct genhash_s;   /* Forward declaration */
+/*
+ * Append the module to the list and index it by name and OID.
+ */
+void asn1p_add_module(asn1p_t *asn, struct asn1p_module_s *mod);
 
 /*
  * Flags specific to a module.
@@ -79,6 +85,12 @@ typedef struct asn1p_module_s {
 	 */
 	TQ_HEAD(struct asn1p_expr_s)	members;   /* Do not access directly */
     struct genhash_s *members_hash;
+    struct genhash_s *enumerators_hash; /* Values of ENUMERATED members */
+
+	/*
+	 * Imported symbol -> IMPORTS clause, built by the fixer on demand.
+	 */
+    struct genhash_s *imports_hash;
 
 	/*
 	 * Next module in the list.
@@ -2359,7 +2359,7 @@ yyreduce:
     {
 		(yyval.a_grammar) = asn1p_new();
 		checkmem((yyval.a_grammar));
-		TQ_ADD(&((yyval.a_grammar)->modules), (yyvsp[(1) - (1)].a_module), mod_next);
+		asn1p_add_module((yyval.a_grammar), (yyvsp[(1) - (1)].a_module));
 	}
     break;
 
@@ -2367,7 +2367,7 @@ yyreduce:
 #line 428 "asn1p_y.y"
     {
 		(yyval.a_grammar) = (yyvsp[(1) - (2)].a_grammar);
-		TQ_ADD(&((yyval.a_grammar)->modules), (yyvsp[(2) - (2)].a_module), mod_next);
+		asn1p_add_module((yyval.a_grammar), (yyvsp[(2) - (2)].a_module));
 	}
     break;
 
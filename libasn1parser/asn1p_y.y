@@ -423,11 +423,11 @@ ModuleList:
 	ModuleDefinition {
 		$$ = asn1p_new();
 		checkmem($$);
-		TQ_ADD(&($$->modules), $1, mod_next);
+		asn1p_add_module($$, $1);
 	}
 	| ModuleList ModuleDefinition {
 		$$ = $1;
-		TQ_ADD(&($$->modules), $2, mod_next);
+		asn1p_add_module($$, $2);
 	}
 	;
 
@@ -15,10 +15,18 @@ asn_TYPE_operation_t asn_OP_ANY = {
 	OCTET_STRING_free,
 	OCTET_STRING_print,
 	OCTET_STRING_compare,
+	OCTET_STRING_copy,
 	OCTET_STRING_decode_ber,
 	OCTET_STRING_encode_der,
 	OCTET_STRING_decode_xer_hex,
 	ANY_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	OCTET_STRING_decode_jer_hex,
+	OCTET_STRING_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef	ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
@@ -37,6 +37,8 @@ per_type_encoder_f ANY_encode_uper;
 #define ANY_decode_ber   OCTET_STRING_decode_ber
 #define ANY_encode_der   OCTET_STRING_encode_der
 #define ANY_decode_xer   OCTET_STRING_decode_xer_hex
+#define ANY_decode_jer   OCTET_STRING_decode_jer_hex
+#define ANY_encode_jer   OCTET_STRING_encode_jer
 
 /******************************
  * Handy conversion routines. *
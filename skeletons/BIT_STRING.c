@@ -21,10 +21,18 @@ asn_TYPE_operation_t asn_OP_BIT_STRING = {
 	OCTET_STRING_free,         /* Implemented in terms of OCTET STRING */
 	BIT_STRING_print,
 	BIT_STRING_compare,
+	OCTET_STRING_copy,
 	OCTET_STRING_decode_ber,   /* Implemented in terms of OCTET STRING */
 	OCTET_STRING_encode_der,   /* Implemented in terms of OCTET STRING */
 	OCTET_STRING_decode_xer_binary,
 	BIT_STRING_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	BIT_STRING_decode_jer,
+	BIT_STRING_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef	ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
@@ -163,7 +171,7 @@ BIT_STRING_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
 	(void)td;	/* Unused argument */
 
 	if(!st || !st->buf)
-		return (cb("<absent>", 8, app_key) < 0) ? -1 : 0;
+		return ASN__E_cbc("<absent>", 8) ? -1 : 0;
 
 	ilevel++;
 	buf = st->buf;
@@ -177,7 +185,7 @@ BIT_STRING_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
 				&& buf != st->buf) {
 			_i_INDENT(1);
 			/* Dump the string */
-			if(cb(scratch, p - scratch, app_key) < 0) return -1;
+			if(ASN__E_cbc(scratch, p - scratch)) return -1;
 			p = scratch;
 		}
 		*p++ = h2c[*buf >> 4];
@@ -193,7 +201,7 @@ BIT_STRING_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
 		}
 
 		/* Dump the incomplete 16-bytes row */
-		if(cb(scratch, p - scratch, app_key) < 0)
+		if(ASN__E_cbc(scratch, p - scratch))
 			return -1;
 	}
 
@@ -202,7 +210,7 @@ BIT_STRING_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
                            st->bits_unused, st->bits_unused == 1 ? "" : "s");
         assert(ret > 0 && ret < (ssize_t)sizeof(scratch));
         if(ret > 0 && ret < (ssize_t)sizeof(scratch)
-           && cb(scratch, ret, app_key) < 0)
+           && ASN__E_cbc(scratch, ret))
             return -1;
     }
 
@@ -271,7 +279,9 @@ BIT_STRING_compare(const asn_TYPE_descriptor_t *td, const void *aptr,
 
     if(a && b) {
         size_t common_prefix_size = a->size <= b->size ? a->size : b->size;
-        int ret = memcmp(a->buf, b->buf, common_prefix_size);
+        int ret = common_prefix_size
+                      ? memcmp(a->buf, b->buf, common_prefix_size)
+                      : 0;
         if(ret == 0) {
             /* Figure out which string with equal prefixes is longer. */
             if(a->size < b->size) {
@@ -0,0 +1,191 @@
+/*
+ * Redistribution and modifications are permitted subject to BSD license.
+ */
+#ifndef ASN_DISABLE_JER_SUPPORT
+
+#include <asn_internal.h>
+#include <BIT_STRING.h>
+#include <errno.h>
+
+static int
+BIT_STRING__jer_from_hex(BIT_STRING_t *st, const char *chunk_buf,
+                         size_t chunk_size) {
+    const char *contents;
+    void *to_free;
+    ssize_t len;
+    int ret;
+
+    len = jer_string_contents(chunk_buf, chunk_size, &contents, &to_free);
+    if(len < 0) return -1;
+    ret = OCTET_STRING__jer_from_hex((OCTET_STRING_t *)st, contents, len);
+    if(to_free) FREEMEM(to_free);
+    return ret;
+}
+
+/*
+ * X.697 #22: {"value": "hex", "length": bits}, or just the "hex"
+ * string for the BIT STRING of the fixed size.
+ * The object is small, so it is parsed again from the very beginning
+ * when more data is needed.
+ */
+asn_dec_rval_t
+BIT_STRING_decode_jer(const asn_codec_ctx_t *opt_codec_ctx,
+                      const asn_TYPE_descriptor_t *td, void **sptr,
+                      const void *buf_ptr, size_t size) {
+    const asn_OCTET_STRING_specifics_t *specs =
+        td->specifics ? (const asn_OCTET_STRING_specifics_t *)td->specifics
+                      : &asn_SPC_BIT_STRING_specs;
+    const char *ptr = (const char *)buf_ptr;
+    const char *end = ptr + size;
+    BIT_STRING_t *st;
+    enum {
+        ST_START,   /* The hex string or '{' */
+        ST_KEY,     /* "value" or "length" */
+        ST_COLON,
+        ST_VALUE,
+        ST_NEXT     /* ',' or '}' */
+    } state = ST_START;
+    int key_is_length = 0;
+    int have_value = 0;
+    int have_length = 0;
+    size_t length = 0;
+    asn_dec_rval_t rval;
+
+    (void)opt_codec_ctx;
+
+    if(!*sptr) {
+        *sptr = CALLOC(1, specs->struct_size);
+        if(!*sptr) ASN__DECODE_FAILED;
+    }
+    st = (BIT_STRING_t *)*sptr;
+
+    for(;;) {
+        const char *chunk = ptr;
+        pjer_chunk_type_e ch_type;
+        ssize_t ch_size;
+
+        ch_size = jer_next_token(ptr, end - ptr, &ch_type);
+        if(ch_size < 0) ASN__DECODE_FAILED;
+        if(ch_type == PJER_WMORE) ASN__DECODE_STARVED;
+        ptr += ch_size;
+        if(ch_type == PJER_WHITESPACE) continue;
+
+        switch(state) {
+        case ST_START:
+            if(ch_type == PJER_STRING) {
+                if(BIT_STRING__jer_from_hex(st, chunk, ch_size))
+                    ASN__DECODE_FAILED;
+                st->bits_unused = 0;
+                rval.code = RC_OK;
+                rval.consumed = ptr - (const char *)buf_ptr;
+                return rval;
+            }
+            if(ch_type != PJER_DLM || *chunk != 0x7b) /* '{' */
+                ASN__DECODE_FAILED;
+            state = ST_KEY;
+            continue;
+        case ST_KEY:
+            if(ch_type != PJER_STRING) ASN__DECODE_FAILED;
+            if(ch_size == 7 && memcmp(chunk, "\"value\"", 7) == 0)
+                key_is_length = 0;
+            else if(ch_size == 8 && memcmp(chunk, "\"length\"", 8) == 0)
+                key_is_length = 1;
+            else
+                ASN__DECODE_FAILED;
+            state = ST_COLON;
+            continue;
+        case ST_COLON:
+            if(ch_type != PJER_DLM || *chunk != 0x3a) /* ':' */
+                ASN__DECODE_FAILED;
+            state = ST_VALUE;
+            continue;
+        case ST_VALUE:
+            if(key_is_length) {
+                const char *p;
+                if(ch_type != PJER_LITERAL || have_length)
+                    ASN__DECODE_FAILED;
+                for(p = chunk; p < ptr; p++) {
+                    if(*p < 0x30 || *p > 0x39
+                       || length > ((size_t)-1 - 9) / 10)
+                        ASN__DECODE_FAILED;
+                    length = length * 10 + (*p - 0x30);
+                }
+                have_length = 1;
+            } else {
+                if(ch_type != PJER_STRING || have_value
+                   || BIT_STRING__jer_from_hex(st, chunk, ch_size))
+                    ASN__DECODE_FAILED;
+                have_value = 1;
+            }
+            state = ST_NEXT;
+            continue;
+        case ST_NEXT:
+            if(ch_type == PJER_DLM && *chunk == 0x2c) { /* ',' */
+                state = ST_KEY;
+                continue;
+            }
+            if(ch_type != PJER_DLM || *chunk != 0x7d) /* '}' */
+                ASN__DECODE_FAILED;
+            break;
+        }
+        break;
+    }
+
+    /* The value shall have just enough octets for the length */
+    if(!have_value || !have_length || length > 8 * st->size
+       || length + 8 <= 8 * st->size) {
+        ASN_DEBUG("%s: %" ASN_PRI_SIZE " bits in %" ASN_PRI_SIZE " octets",
+                  td->name, length, st->size);
+        ASN__DECODE_FAILED;
+    }
+    st->bits_unused = 8 * st->size - length;
+    if(st->bits_unused)
+        st->buf[st->size - 1] &= 0xff << st->bits_unused;
+
+    rval.code = RC_OK;
+    rval.consumed = ptr - (const char *)buf_ptr;
+    return rval;
+}
+
+asn_enc_rval_t
+BIT_STRING_encode_jer(const asn_TYPE_descriptor_t *td, const void *sptr,
+                      int ilevel, enum jer_encoder_flags_e flags,
+                      asn_app_consume_bytes_f *cb, void *app_key) {
+    const BIT_STRING_t *st = (const BIT_STRING_t *)sptr;
+    asn_enc_rval_t er = {0, 0, 0};
+    int pretty = !(flags & JER_F_MINIFIED);
+    ssize_t ret;
+
+    (void)td;
+
+    if(!st || (!st->buf && st->size) || st->bits_unused < 0
+       || st->bits_unused > 7)
+        ASN__ENCODE_FAILED;
+
+    ASN__CALLBACK("{", 1);
+    if(pretty) {
+        ASN__TEXT_INDENT(1, ilevel + 1);
+        ASN__CALLBACK("\"value\": \"", 10);
+    } else {
+        ASN__CALLBACK("\"value\":\"", 9);
+    }
+    ret = OCTET_STRING__jer_dump_hex(st->buf, st->size, cb, app_key);
+    if(ret < 0) ASN__ENCODE_FAILED;
+    er.encoded += ret;
+    ASN__CALLBACK("\",", 2);
+    if(pretty) ASN__TEXT_INDENT(1, ilevel + 1);
+    ret = asn__format_to_callback(
+        cb, app_key,
+        pretty ? "\"length\": %" ASN_PRI_SIZE : "\"length\":%" ASN_PRI_SIZE,
+        st->size * 8 - (st->size ? st->bits_unused : 0));
+    if(ret < 0) ASN__ENCODE_FAILED;
+    er.encoded += ret;
+    if(pretty) ASN__TEXT_INDENT(1, ilevel);
+    ASN__CALLBACK("}", 1);
+
+    ASN__ENCODED_OK(er);
+cb_failed:
+    ASN__ENCODE_FAILED;
+}
+
+#endif  /* ASN_DISABLE_JER_SUPPORT */
@@ -127,7 +127,7 @@ BIT_STRING_encode_oer(const asn_TYPE_descriptor_t *td,
         uint8_t ub = st->bits_unused & 7;
         ssize_t len_len = oer_serialize_length(1 + st->size, cb, app_key);
         if(len_len < 0) ASN__ENCODE_FAILED;
-        if(cb(&ub, 1, app_key) < 0) {
+        if(ASN__E_cbc(&ub, 1)) {
             ASN__ENCODE_FAILED;
         }
         erval.encoded += len_len + 1;
@@ -139,13 +139,13 @@ BIT_STRING_encode_oer(const asn_TYPE_descriptor_t *td,
         }
     }
 
-    if(cb(st->buf, st->size - fix_last_byte, app_key) < 0) {
+    if(ASN__E_cbc(st->buf, st->size - fix_last_byte)) {
         ASN__ENCODE_FAILED;
     }
 
     if(fix_last_byte) {
         uint8_t b = st->buf[st->size - 1] & (0xff << st->bits_unused);
-        if(cb(&b, 1, app_key) < 0) {
+        if(ASN__E_cbc(&b, 1)) {
             ASN__ENCODE_FAILED;
         }
     }
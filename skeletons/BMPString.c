@@ -27,10 +27,18 @@ asn_TYPE_operation_t asn_OP_BMPString = {
 	OCTET_STRING_free,          /* Implemented in terms of OCTET STRING */
 	BMPString_print,
 	OCTET_STRING_compare,
+	OCTET_STRING_copy,
 	OCTET_STRING_decode_ber,
 	OCTET_STRING_encode_der,
 	BMPString_decode_xer,		/* Convert from UTF-8 */
 	BMPString_encode_xer,		/* Convert to UTF-8 */
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	BMPString_decode_jer,
+	BMPString_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef	ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
@@ -102,7 +110,7 @@ BMPString__dump(const BMPString_t *st,
 		uint16_t wc = (ch[0] << 8) | ch[1];	/* 2 bytes */
 		if(sizeof(scratch) - (p - scratch) < 3) {
 			wrote += p - scratch;
-			if(cb(scratch, p - scratch, app_key) < 0)
+			if(ASN__E_cbc(scratch, p - scratch))
 				return -1;
 			p = scratch;
 		}
@@ -119,12 +127,61 @@ BMPString__dump(const BMPString_t *st,
 	}
 
 	wrote += p - scratch;
-	if(cb(scratch, p - scratch, app_key) < 0)
+	if(ASN__E_cbc(scratch, p - scratch))
 		return -1;
 
 	return wrote;
 }
 
+/*
+ * Convert the decoded UTF-8 string into UCS-2, in place.
+ */
+static int
+BMPString__from_utf8(BMPString_t *st) {
+	uint32_t *wcs;
+	size_t wcs_len;
+
+	assert(st->buf);
+	wcs_len = UTF8String_to_wcs(st, 0, 0);
+
+	wcs = (uint32_t *)MALLOC(4 * (wcs_len + 1));
+	if(wcs == 0 || UTF8String_to_wcs(st, wcs, wcs_len) != wcs_len) {
+		if(wcs) FREEMEM(wcs);
+		return -1;
+	} else {
+		wcs[wcs_len] = 0;	/* nul-terminate */
+	}
+
+	if(1) {
+		/* Swap byte order and trim encoding to 2 bytes */
+		uint32_t *wc = wcs;
+		uint32_t *wc_end = wcs + wcs_len;
+		uint16_t *dstwc = (uint16_t *)wcs;
+		for(; wc < wc_end; wc++, dstwc++) {
+			uint32_t wch = *wc;
+			if(wch > 0xffff) {
+				FREEMEM(wcs);
+				return -1;
+			}
+			*((uint8_t *)dstwc + 0) = wch >> 8;
+			*((uint8_t *)dstwc + 1) = wch;
+		}
+		dstwc = (uint16_t *)REALLOC(wcs, 2 * (wcs_len + 1));
+		if(!dstwc) {
+			FREEMEM(wcs);
+			return -1;
+		} else {
+			dstwc[wcs_len] = 0;	/* nul-terminate */
+			wcs = (uint32_t *)(void *)dstwc; /* Alignment OK */
+		}
+	}
+
+	FREEMEM(st->buf);
+	st->buf = (uint8_t *)wcs;
+	st->size = 2 * wcs_len;
+	return 0;
+}
+
 asn_dec_rval_t
 BMPString_decode_xer(const asn_codec_ctx_t *opt_codec_ctx,
                      const asn_TYPE_descriptor_t *td, void **sptr,
@@ -133,60 +190,10 @@ BMPString_decode_xer(const asn_codec_ctx_t *opt_codec_ctx,
 
 	rc = OCTET_STRING_decode_xer_utf8(opt_codec_ctx, td, sptr, opt_mname,
 		buf_ptr, size);
-	if(rc.code == RC_OK) {
-		/*
-		 * Now we have a whole string in UTF-8 format.
-		 * Convert it into UCS-2.
-		 */
-		uint32_t *wcs;
-		size_t wcs_len;
-		UTF8String_t *st;
-
-		assert(*sptr);
-		st = (UTF8String_t *)*sptr;
-		assert(st->buf);
-		wcs_len = UTF8String_to_wcs(st, 0, 0);
-
-		wcs = (uint32_t *)MALLOC(4 * (wcs_len + 1));
-		if(wcs == 0 || UTF8String_to_wcs(st, wcs, wcs_len) != wcs_len) {
-			rc.code = RC_FAIL;
-			rc.consumed = 0;
-			return rc;
-		} else {
-			wcs[wcs_len] = 0;	/* nul-terminate */
-		}
-
-		if(1) {
-			/* Swap byte order and trim encoding to 2 bytes */
-			uint32_t *wc = wcs;
-			uint32_t *wc_end = wcs + wcs_len;
-			uint16_t *dstwc = (uint16_t *)wcs;
-			for(; wc < wc_end; wc++, dstwc++) {
-				uint32_t wch = *wc;
-				if(wch > 0xffff) {
-					FREEMEM(wcs);
-					rc.code = RC_FAIL;
-					rc.consumed = 0;
-					return rc;
-				}
-				*((uint8_t *)dstwc + 0) = wch >> 8;
-				*((uint8_t *)dstwc + 1) = wch;
-			}
-			dstwc = (uint16_t *)REALLOC(wcs, 2 * (wcs_len + 1));
-			if(!dstwc) {
-				FREEMEM(wcs);
-				rc.code = RC_FAIL;
-				rc.consumed = 0;
-				return rc;
-			} else {
-				dstwc[wcs_len] = 0;	/* nul-terminate */
-				wcs = (uint32_t *)(void *)dstwc; /* Alignment OK */
-			}
-		}
-
-		FREEMEM(st->buf);
-		st->buf = (uint8_t *)wcs;
-		st->size = 2 * wcs_len;
+	/* Now we have a whole string in UTF-8 format */
+	if(rc.code == RC_OK && BMPString__from_utf8((BMPString_t *)*sptr)) {
+		rc.code = RC_FAIL;
+		rc.consumed = 0;
 	}
 	return rc;
 }
@@ -210,6 +217,53 @@ BMPString_encode_xer(const asn_TYPE_descriptor_t *td, const void *sptr,
 	ASN__ENCODED_OK(er);
 }
 
+#ifndef ASN_DISABLE_JER_SUPPORT
+
+asn_dec_rval_t
+BMPString_decode_jer(const asn_codec_ctx_t *opt_codec_ctx,
+                      const asn_TYPE_descriptor_t *td, void **sptr,
+                      const void *buf_ptr, size_t size) {
+    asn_dec_rval_t rc;
+
+	rc = OCTET_STRING_decode_jer_utf8(opt_codec_ctx, td, sptr, buf_ptr, size);
+	if(rc.code == RC_OK && BMPString__from_utf8((BMPString_t *)*sptr)) {
+		rc.code = RC_FAIL;
+		rc.consumed = 0;
+	}
+	return rc;
+}
+
+asn_enc_rval_t
+BMPString_encode_jer(const asn_TYPE_descriptor_t *td, const void *sptr,
+                      int ilevel, enum jer_encoder_flags_e flags,
+                      asn_app_consume_bytes_f *cb, void *app_key) {
+    const BMPString_t *st = (const BMPString_t *)sptr;
+	struct jer_escape_key_s key;
+	asn_enc_rval_t er = {0, 0, 0};
+
+	(void)ilevel;
+	(void)flags;
+
+	if(!st || !st->buf)
+		ASN__ENCODE_FAILED;
+
+	key.cb = cb;
+	key.app_key = app_key;
+	key.wrote = 0;
+
+	ASN__CALLBACK("\"", 1);
+	if(BMPString__dump(st, jer_escape_cb, &key) < 0)
+		ASN__ENCODE_FAILED;
+	er.encoded += key.wrote;
+	ASN__CALLBACK("\"", 1);
+
+	ASN__ENCODED_OK(er);
+cb_failed:
+	ASN__ENCODE_FAILED;
+}
+
+#endif  /* ASN_DISABLE_JER_SUPPORT */
+
 int
 BMPString_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
                 asn_app_consume_bytes_f *cb, void *app_key) {
@@ -219,7 +273,7 @@ BMPString_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
 	(void)ilevel;	/* Unused argument */
 
 	if(!st || !st->buf)
-		return (cb("<absent>", 8, app_key) < 0) ? -1 : 0;
+		return ASN__E_cbc("<absent>", 8) ? -1 : 0;
 
 	if(BMPString__dump(st, cb, app_key) < 0)
 		return -1;
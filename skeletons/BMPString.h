@@ -21,6 +21,8 @@ asn_struct_print_f BMPString_print;	/* Human-readable output */
 asn_constr_check_f BMPString_constraint;
 xer_type_decoder_f BMPString_decode_xer;
 xer_type_encoder_f BMPString_encode_xer;
+jer_type_decoder_f BMPString_decode_jer;
+jer_type_encoder_f BMPString_encode_jer;
 
 #define BMPString_free          OCTET_STRING_free
 #define BMPString_print         BMPString_print
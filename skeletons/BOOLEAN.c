@@ -16,10 +16,18 @@ asn_TYPE_operation_t asn_OP_BOOLEAN = {
 	BOOLEAN_free,
 	BOOLEAN_print,
 	BOOLEAN_compare,
+	BOOLEAN_copy,
 	BOOLEAN_decode_ber,
 	BOOLEAN_encode_der,
 	BOOLEAN_decode_xer,
 	BOOLEAN_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	BOOLEAN_decode_jer,
+	BOOLEAN_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef	ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
@@ -134,7 +142,7 @@ BOOLEAN_encode_der(const asn_TYPE_descriptor_t *td, const void *sptr,
 
 		bool_value = *st ? 0xff : 0; /* 0xff mandated by DER */
 
-		if(cb(&bool_value, 1, app_key) < 0) {
+		if(ASN__E_cbc(&bool_value, 1)) {
 			erval.encoded = -1;
 			erval.failed_type = td;
 			erval.structure_ptr = sptr;
@@ -214,6 +222,63 @@ cb_failed:
 	ASN__ENCODE_FAILED;
 }
 
+#ifndef ASN_DISABLE_JER_SUPPORT
+
+static enum jer_pbd_rval
+BOOLEAN__jer_body_decode(const asn_TYPE_descriptor_t *td, void *sptr,
+                         pjer_chunk_type_e chunk_type, const void *chunk_buf,
+                         size_t chunk_size) {
+    BOOLEAN_t *st = (BOOLEAN_t *)sptr;
+
+	(void)td;
+
+	if(chunk_type != PJER_LITERAL)
+		return JPBD_BROKEN_ENCODING;
+
+	if(chunk_size == 4 && memcmp(chunk_buf, "true", 4) == 0)
+		*st = 1;
+	else if(chunk_size == 5 && memcmp(chunk_buf, "false", 5) == 0)
+		*st = 0;
+	else
+		return JPBD_BROKEN_ENCODING;
+
+	return JPBD_BODY_CONSUMED;
+}
+
+asn_dec_rval_t
+BOOLEAN_decode_jer(const asn_codec_ctx_t *opt_codec_ctx,
+                   const asn_TYPE_descriptor_t *td, void **sptr,
+                   const void *buf_ptr, size_t size) {
+    return jer_decode_primitive(opt_codec_ctx, td,
+		sptr, sizeof(BOOLEAN_t), buf_ptr, size,
+		BOOLEAN__jer_body_decode);
+}
+
+asn_enc_rval_t
+BOOLEAN_encode_jer(const asn_TYPE_descriptor_t *td, const void *sptr,
+	int ilevel, enum jer_encoder_flags_e flags,
+		asn_app_consume_bytes_f *cb, void *app_key) {
+	const BOOLEAN_t *st = (const BOOLEAN_t *)sptr;
+	asn_enc_rval_t er = {0, 0, 0};
+
+	(void)ilevel;
+	(void)flags;
+
+	if(!st) ASN__ENCODE_FAILED;
+
+	if(*st) {
+		ASN__CALLBACK("true", 4);
+	} else {
+		ASN__CALLBACK("false", 5);
+	}
+
+	ASN__ENCODED_OK(er);
+cb_failed:
+	ASN__ENCODE_FAILED;
+}
+
+#endif  /* ASN_DISABLE_JER_SUPPORT */
+
 int
 BOOLEAN_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
               asn_app_consume_bytes_f *cb, void *app_key) {
@@ -237,7 +302,7 @@ BOOLEAN_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
 		buflen = 8;
 	}
 
-	return (cb(buf, buflen, app_key) < 0) ? -1 : 0;
+	return ASN__E_cbc(buf, buflen) ? -1 : 0;
 }
 
 void
@@ -257,6 +322,19 @@ BOOLEAN_free(const asn_TYPE_descriptor_t *td, void *ptr,
     }
 }
 
+int
+BOOLEAN_copy(const asn_TYPE_descriptor_t *td, void **dptr,
+             const void *sptr) {
+    if(!td || !sptr) return -1;
+
+    if(!*dptr) {
+        *dptr = MALLOC(sizeof(BOOLEAN_t));
+        if(!*dptr) return -1;
+    }
+    *(BOOLEAN_t *)*dptr = *(const BOOLEAN_t *)sptr;
+    return 0;
+}
+
 #ifndef ASN_DISABLE_PER_SUPPORT
 
 asn_dec_rval_t
@@ -328,7 +406,7 @@ BOOLEAN_encode_oer(const asn_TYPE_descriptor_t *td,
     (void)td;
     (void)constraints;  /* Constraints are unused in OER */
 
-    if(cb(&bool_value, 1, app_key) < 0) {
+    if(ASN__E_cbc(&bool_value, 1)) {
         ASN__ENCODE_FAILED;
     } else {
         ASN__ENCODED_OK(er);
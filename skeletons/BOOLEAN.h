@@ -24,6 +24,7 @@ extern asn_TYPE_operation_t asn_OP_BOOLEAN;
 asn_struct_free_f BOOLEAN_free;
 asn_struct_print_f BOOLEAN_print;
 asn_struct_compare_f BOOLEAN_compare;
+asn_struct_copy_f BOOLEAN_copy;
 ber_type_decoder_f BOOLEAN_decode_ber;
 der_type_encoder_f BOOLEAN_encode_der;
 oer_type_decoder_f BOOLEAN_decode_oer;
@@ -32,6 +33,8 @@ per_type_decoder_f BOOLEAN_decode_uper;
 per_type_encoder_f BOOLEAN_encode_uper;
 xer_type_decoder_f BOOLEAN_decode_xer;
 xer_type_encoder_f BOOLEAN_encode_xer;
+jer_type_decoder_f BOOLEAN_decode_jer;
+jer_type_encoder_f BOOLEAN_encode_jer;
 asn_random_fill_f  BOOLEAN_random_fill;
 
 #define BOOLEAN_constraint     asn_generic_no_constraint
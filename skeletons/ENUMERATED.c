@@ -18,10 +18,18 @@ asn_TYPE_operation_t asn_OP_ENUMERATED = {
 	ASN__PRIMITIVE_TYPE_free,
 	INTEGER_print,			/* Implemented in terms of INTEGER */
 	INTEGER_compare,		/* Implemented in terms of INTEGER */
+	ASN__PRIMITIVE_TYPE_copy,
 	ber_decode_primitive,
 	INTEGER_encode_der,		/* Implemented in terms of INTEGER */
 	INTEGER_decode_xer,	/* This is temporary! */
 	INTEGER_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	INTEGER_decode_jer,
+	INTEGER_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef	ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
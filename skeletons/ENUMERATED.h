@@ -24,11 +24,14 @@ per_type_encoder_f ENUMERATED_encode_uper;
 #define ENUMERATED_free       ASN__PRIMITIVE_TYPE_free
 #define ENUMERATED_print      INTEGER_print
 #define ENUMERATED_compare    INTEGER_compare
+#define ENUMERATED_copy       ASN__PRIMITIVE_TYPE_copy
 #define ENUMERATED_constraint asn_generic_no_constraint
 #define ENUMERATED_decode_ber ber_decode_primitive
 #define ENUMERATED_encode_der INTEGER_encode_der
 #define ENUMERATED_decode_xer INTEGER_decode_xer
 #define ENUMERATED_encode_xer INTEGER_encode_xer
+#define ENUMERATED_decode_jer INTEGER_decode_jer
+#define ENUMERATED_encode_jer INTEGER_encode_jer
 #define ENUMERATED_random_fill INTEGER_random_fill
 
 #ifdef __cplusplus
@@ -177,10 +177,18 @@ asn_TYPE_operation_t asn_OP_GeneralizedTime = {
 	OCTET_STRING_free,
 	GeneralizedTime_print,
 	GeneralizedTime_compare,
+	OCTET_STRING_copy,
 	OCTET_STRING_decode_ber,    /* Implemented in terms of OCTET STRING */
 	GeneralizedTime_encode_der,
 	OCTET_STRING_decode_xer_utf8,
 	GeneralizedTime_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	OCTET_STRING_decode_jer_utf8,
+	OCTET_STRING_encode_jer_utf8,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef	ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
@@ -316,16 +324,16 @@ GeneralizedTime_print(const asn_TYPE_descriptor_t *td, const void *sptr,
 
 		errno = EPERM;
 		if(asn_GT2time(st, &tm, 1) == -1 && errno != EPERM)
-			return (cb("<bad-value>", 11, app_key) < 0) ? -1 : 0;
+			return ASN__E_cbc("<bad-value>", 11) ? -1 : 0;
 
 		ret = snprintf(buf, sizeof(buf),
 			"%04d-%02d-%02d %02d:%02d:%02d (GMT)",
 			tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday,
 			tm.tm_hour, tm.tm_min, tm.tm_sec);
 		assert(ret > 0 && ret < (int)sizeof(buf));
-		return (cb(buf, ret, app_key) < 0) ? -1 : 0;
+		return ASN__E_cbc(buf, ret) ? -1 : 0;
 	} else {
-		return (cb("<absent>", 8, app_key) < 0) ? -1 : 0;
+		return ASN__E_cbc("<absent>", 8) ? -1 : 0;
 	}
 }
 
@@ -16,10 +16,18 @@ asn_TYPE_operation_t asn_OP_GraphicString = {
 	OCTET_STRING_free,
 	OCTET_STRING_print,         /* non-ascii string */
 	OCTET_STRING_compare,
+	OCTET_STRING_copy,
 	OCTET_STRING_decode_ber,    /* Implemented in terms of OCTET STRING */
 	OCTET_STRING_encode_der,
 	OCTET_STRING_decode_xer_hex,
 	OCTET_STRING_encode_xer,	/* Can't expect it to be ASCII/UTF8 */
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	OCTET_STRING_decode_jer_hex,
+	OCTET_STRING_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef	ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
@@ -24,6 +24,8 @@ extern asn_TYPE_operation_t asn_OP_GraphicString;
 #define GraphicString_encode_der    OCTET_STRING_encode_der
 #define GraphicString_decode_xer    OCTET_STRING_decode_xer_hex
 #define GraphicString_encode_xer    OCTET_STRING_encode_xer
+#define GraphicString_decode_jer    OCTET_STRING_decode_jer_hex
+#define GraphicString_encode_jer    OCTET_STRING_encode_jer
 #define GraphicString_decode_uper   OCTET_STRING_decode_uper
 #define GraphicString_encode_uper   OCTET_STRING_encode_uper
 
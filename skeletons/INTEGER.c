@@ -18,10 +18,18 @@ asn_TYPE_operation_t asn_OP_INTEGER = {
 	INTEGER_free,
 	INTEGER_print,
 	INTEGER_compare,
+	INTEGER_copy,
 	ber_decode_primitive,
 	INTEGER_encode_der,
 	INTEGER_decode_xer,
 	INTEGER_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	INTEGER_decode_jer,
+	INTEGER_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef  ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
@@ -182,7 +190,7 @@ INTEGER__dump(const asn_TYPE_descriptor_t *td, const INTEGER_t *st, asn_app_cons
 		const char * const h2c = "0123456789ABCDEF";
 		if((p - scratch) >= (ssize_t)(sizeof(scratch) - 4)) {
 			/* Flush buffer */
-			if(cb(scratch, p - scratch, app_key) < 0)
+			if(ASN__E_cbc(scratch, p - scratch))
 				return -1;
 			wrote += p - scratch;
 			p = scratch;
@@ -195,7 +203,7 @@ INTEGER__dump(const asn_TYPE_descriptor_t *td, const INTEGER_t *st, asn_app_cons
 		p--;	/* Remove the last ":" */
 
 	wrote += p - scratch;
-	return (cb(scratch, p - scratch, app_key) < 0) ? -1 : wrote;
+	return ASN__E_cbc(scratch, p - scratch) ? -1 : wrote;
 }
 
 /*
@@ -929,23 +937,15 @@ asn_umax2INTEGER(INTEGER_t *st, uintmax_t value) {
 	return 0;
 }
 
-int
-asn_imax2INTEGER(INTEGER_t *st, intmax_t value) {
-	uint8_t *buf, *bp;
+size_t
+INTEGER__imax2buf(intmax_t value, uint8_t *buf) {
+	uint8_t *bp;
 	uint8_t *p;
 	uint8_t *pstart;
 	uint8_t *pend1;
 	int littleEndian = 1;	/* Run-time detection */
 	int add;
 
-	if(!st) {
-		errno = EINVAL;
-		return -1;
-	}
-
-	buf = (uint8_t *)(long *)MALLOC(sizeof(value));
-	if(!buf) return -1;
-
 	if(*(char *)&littleEndian) {
 		pstart = (uint8_t *)&value + sizeof(value) - 1;
 		pend1 = (uint8_t *)&value;
@@ -973,13 +973,33 @@ asn_imax2INTEGER(INTEGER_t *st, intmax_t value) {
 		}
 		break;
 	}
-	/* Copy the integer body */
-	for(bp = buf, pend1 += add; p != pend1; p += add)
+	/* Copy the integer body, up to and including the *pend1 */
+	for(bp = buf;; p += add) {
 		*bp++ = *p;
+		if(p == pend1) break;
+	}
+
+	return bp - buf;
+}
+
+int
+asn_imax2INTEGER(INTEGER_t *st, intmax_t value) {
+	uint8_t *buf;
+	size_t size;
+
+	if(!st) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	buf = (uint8_t *)(long *)MALLOC(sizeof(value));
+	if(!buf) return -1;
+
+	size = INTEGER__imax2buf(value, buf);
 
 	if(st->buf) FREEMEM(st->buf);
 	st->buf = buf;
-	st->size = bp - buf;
+	st->size = size;
 
 	return 0;
 }
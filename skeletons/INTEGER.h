@@ -36,6 +36,7 @@ typedef struct asn_INTEGER_specifics_s {
 } asn_INTEGER_specifics_t;
 
 #define INTEGER_free    ASN__PRIMITIVE_TYPE_free
+#define INTEGER_copy    ASN__PRIMITIVE_TYPE_copy
 #define INTEGER_decode_ber	ber_decode_primitive
 #define INTEGER_constraint	asn_generic_no_constraint
 asn_struct_print_f INTEGER_print;
@@ -43,6 +44,8 @@ asn_struct_compare_f INTEGER_compare;
 der_type_encoder_f INTEGER_encode_der;
 xer_type_decoder_f INTEGER_decode_xer;
 xer_type_encoder_f INTEGER_encode_xer;
+jer_type_decoder_f INTEGER_decode_jer;
+jer_type_encoder_f INTEGER_encode_jer;
 oer_type_decoder_f INTEGER_decode_oer;
 oer_type_encoder_f INTEGER_encode_oer;
 per_type_decoder_f INTEGER_decode_uper;
@@ -66,6 +69,12 @@ int asn_INTEGER2umax(const INTEGER_t *i, uintmax_t *l);
 int asn_imax2INTEGER(INTEGER_t *i, intmax_t l);
 int asn_umax2INTEGER(INTEGER_t *i, uintmax_t l);
 
+/*
+ * The minimal contents of asn_imax2INTEGER() written into the (buf) of
+ * sizeof(intmax_t) bytes rather than allocated. Returns the size written.
+ */
+size_t INTEGER__imax2buf(intmax_t l, uint8_t *buf);
+
 /*
  * Size-specific conversion helpers.
  */
@@ -0,0 +1,177 @@
+/*
+ * Redistribution and modifications are permitted subject to BSD license.
+ */
+#ifndef ASN_DISABLE_JER_SUPPORT
+
+#include <asn_internal.h>
+#include <INTEGER.h>
+#include <errno.h>
+
+/*
+ * Find the enumeration map entry by its identifier.
+ * The identifier may contain anything, including the NUL characters.
+ */
+static const asn_INTEGER_enum_map_t *
+INTEGER__jer_map_enum2value(const asn_INTEGER_specifics_t *specs,
+                            const char *name, size_t name_len) {
+    int lo = 0;
+    int hi = specs ? specs->map_count : 0;
+
+    while(lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        const asn_INTEGER_enum_map_t *el =
+            &specs->value2enum[specs->enum2value[mid]];
+        size_t min_len = name_len < el->enum_len ? name_len : el->enum_len;
+        int cmp = memcmp(name, el->enum_name, min_len);
+        if(cmp == 0)
+            cmp = (name_len > el->enum_len) - (name_len < el->enum_len);
+        if(cmp == 0)
+            return el;
+        else if(cmp < 0)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+
+    return NULL;
+}
+
+/*
+ * Decode the JSON number (without the fraction and the exponent)
+ * or the enumeration identifier.
+ */
+static enum jer_pbd_rval
+INTEGER__jer_body_decode(const asn_TYPE_descriptor_t *td, void *sptr,
+                         pjer_chunk_type_e chunk_type, const void *chunk_buf,
+                         size_t chunk_size) {
+    const asn_INTEGER_specifics_t *specs =
+        (const asn_INTEGER_specifics_t *)td->specifics;
+    INTEGER_t *st = (INTEGER_t *)sptr;
+    const char *lstart = (const char *)chunk_buf;
+    const char *lstop = lstart + chunk_size;
+    const char *lp;
+
+    if(specs && specs->strict_enumeration) {
+        const asn_INTEGER_enum_map_t *el;
+        const char *name;
+        void *to_free;
+        ssize_t name_len;
+
+        if(chunk_type != PJER_STRING) return JPBD_BROKEN_ENCODING;
+        name_len = jer_string_contents(chunk_buf, chunk_size, &name, &to_free);
+        if(name_len < 0) return JPBD_BROKEN_ENCODING;
+        el = INTEGER__jer_map_enum2value(specs, name, name_len);
+        if(to_free) FREEMEM(to_free);
+        if(!el) {
+            ASN_DEBUG("Unknown identifier for ENUMERATED %s", td->name);
+            return JPBD_BROKEN_ENCODING;
+        }
+        if(asn_imax2INTEGER(st, el->nat_value))
+            return JPBD_SYSTEM_FAILURE;
+        return JPBD_BODY_CONSUMED;
+    }
+
+    if(chunk_type != PJER_LITERAL) return JPBD_BROKEN_ENCODING;
+
+    /* RFC 8259: int = zero / ( digit1-9 *DIGIT ) */
+    lp = lstart + (*lstart == 0x2d);    /* '-' */
+    if(lp == lstop || (*lp == 0x30 && lstop - lp > 1))
+        return JPBD_BROKEN_ENCODING;
+    for(; lp < lstop; lp++) {
+        if(*lp < 0x30 || *lp > 0x39) return JPBD_BROKEN_ENCODING;
+    }
+
+    if(specs && specs->field_unsigned) {
+        uintmax_t value;
+        switch(asn_strtoumax_lim(lstart, &lstop, &value)) {
+        case ASN_STRTOX_OK:
+            break;
+        case ASN_STRTOX_ERROR_RANGE:
+            return JPBD_DECODER_LIMIT;
+        default:
+            return JPBD_BROKEN_ENCODING;
+        }
+        if(asn_umax2INTEGER(st, value))
+            return JPBD_SYSTEM_FAILURE;
+    } else {
+        intmax_t value;
+        switch(asn_strtoimax_lim(lstart, &lstop, &value)) {
+        case ASN_STRTOX_OK:
+            break;
+        case ASN_STRTOX_ERROR_RANGE:
+            return JPBD_DECODER_LIMIT;
+        default:
+            return JPBD_BROKEN_ENCODING;
+        }
+        if(asn_imax2INTEGER(st, value))
+            return JPBD_SYSTEM_FAILURE;
+    }
+
+    return JPBD_BODY_CONSUMED;
+}
+
+asn_dec_rval_t
+INTEGER_decode_jer(const asn_codec_ctx_t *opt_codec_ctx,
+                   const asn_TYPE_descriptor_t *td, void **sptr,
+                   const void *buf_ptr, size_t size) {
+    return jer_decode_primitive(opt_codec_ctx, td, sptr, sizeof(INTEGER_t),
+                                buf_ptr, size, INTEGER__jer_body_decode);
+}
+
+/*
+ * The values outside of the native intmax_t/uintmax_t range
+ * can not be represented by the JSON numbers portably, and are not encoded.
+ */
+asn_enc_rval_t
+INTEGER_encode_jer(const asn_TYPE_descriptor_t *td, const void *sptr,
+                   int ilevel, enum jer_encoder_flags_e flags,
+                   asn_app_consume_bytes_f *cb, void *app_key) {
+    const asn_INTEGER_specifics_t *specs =
+        (const asn_INTEGER_specifics_t *)td->specifics;
+    const INTEGER_t *st = (const INTEGER_t *)sptr;
+    asn_enc_rval_t er = {0, 0, 0};
+    intmax_t value = 0;
+    uintmax_t uvalue = 0;
+    int is_unsigned = specs && specs->field_unsigned;
+
+    (void)ilevel;
+    (void)flags;
+
+    if(!st || !st->buf) ASN__ENCODE_FAILED;
+
+    if(is_unsigned ? asn_INTEGER2umax(st, &uvalue)
+                   : asn_INTEGER2imax(st, &value)) {
+        ASN_DEBUG("%s value does not fit the JER encoder range", td->name);
+        ASN__ENCODE_FAILED;
+    }
+
+    if(specs && specs->strict_enumeration) {
+        const asn_INTEGER_enum_map_t *el;
+        if(is_unsigned) {
+            if(uvalue > (uintmax_t)LONG_MAX) ASN__ENCODE_FAILED;
+            value = uvalue;
+        }
+        if(value < LONG_MIN || value > LONG_MAX) ASN__ENCODE_FAILED;
+        el = INTEGER_map_value2enum(specs, value);
+        if(!el) {
+            ASN_DEBUG("%s value %" ASN_PRIdMAX " is not enumerated", td->name,
+                      value);
+            ASN__ENCODE_FAILED;
+        }
+        ASN__CALLBACK3("\"", 1, el->enum_name, el->enum_len, "\"", 1);
+    } else if(is_unsigned) {
+        er.encoded =
+            asn__format_to_callback(cb, app_key, "%" ASN_PRIuMAX, uvalue);
+        if(er.encoded < 0) ASN__ENCODE_FAILED;
+    } else {
+        er.encoded =
+            asn__format_to_callback(cb, app_key, "%" ASN_PRIdMAX, value);
+        if(er.encoded < 0) ASN__ENCODE_FAILED;
+    }
+
+    ASN__ENCODED_OK(er);
+cb_failed:
+    ASN__ENCODE_FAILED;
+}
+
+#endif  /* ASN_DISABLE_JER_SUPPORT */
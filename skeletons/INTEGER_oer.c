@@ -164,12 +164,12 @@ INTEGER_encode_oer(const asn_TYPE_descriptor_t *td,
     er.encoded += req_bytes;
 
     for(; req_bytes > useful_bytes; req_bytes--) {
-        if(cb(sign?"\xff":"\0", 1, app_key) < 0) {
+        if(ASN__E_cbc(sign?"\xff":"\0", 1)) {
             ASN__ENCODE_FAILED;
         }
     }
 
-    if(cb(buf, useful_bytes, app_key) < 0) {
+    if(ASN__E_cbc(buf, useful_bytes)) {
         ASN__ENCODE_FAILED;
     }
 
@@ -25,6 +25,8 @@ extern asn_TYPE_operation_t asn_OP_ISO646String;
 #define ISO646String_encode_der     OCTET_STRING_encode_der
 #define ISO646String_decode_xer     OCTET_STRING_decode_xer_utf8
 #define ISO646String_encode_xer     OCTET_STRING_encode_xer_utf8
+#define ISO646String_decode_jer     OCTET_STRING_decode_jer_utf8
+#define ISO646String_encode_jer     OCTET_STRING_encode_jer_utf8
 #define ISO646String_decode_uper    OCTET_STRING_decode_uper
 #define ISO646String_encode_uper    OCTET_STRING_encode_uper
 
@@ -16,10 +16,18 @@ asn_TYPE_operation_t asn_OP_NULL = {
 	NULL_free,
 	NULL_print,
 	NULL_compare,
+	NULL_copy,
 	NULL_decode_ber,
 	NULL_encode_der,	/* Special handling of DER encoding */
 	NULL_decode_xer,
 	NULL_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	NULL_decode_jer,
+	NULL_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef	ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
@@ -67,6 +75,18 @@ NULL_free(const asn_TYPE_descriptor_t *td, void *ptr,
     }
 }
 
+int
+NULL_copy(const asn_TYPE_descriptor_t *td, void **dptr, const void *sptr) {
+    if(!td || !sptr) return -1;
+
+    if(!*dptr) {
+        *dptr = MALLOC(sizeof(NULL_t));
+        if(!*dptr) return -1;
+    }
+    *(NULL_t *)*dptr = *(const NULL_t *)sptr;
+    return 0;
+}
+
 /*
  * Decode NULL type.
  */
@@ -141,6 +161,51 @@ NULL_encode_xer(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
 	ASN__ENCODED_OK(er);
 }
 
+#ifndef ASN_DISABLE_JER_SUPPORT
+
+static enum jer_pbd_rval
+NULL__jer_body_decode(const asn_TYPE_descriptor_t *td, void *sptr,
+                      pjer_chunk_type_e chunk_type, const void *chunk_buf,
+                      size_t chunk_size) {
+    (void)td;
+	(void)sptr;
+
+	if(chunk_type == PJER_LITERAL && chunk_size == 4
+	&& memcmp(chunk_buf, "null", 4) == 0)
+		return JPBD_BODY_CONSUMED;
+	else
+		return JPBD_BROKEN_ENCODING;
+}
+
+asn_dec_rval_t
+NULL_decode_jer(const asn_codec_ctx_t *opt_codec_ctx,
+                const asn_TYPE_descriptor_t *td, void **sptr,
+                const void *buf_ptr, size_t size) {
+    return jer_decode_primitive(opt_codec_ctx, td,
+		sptr, sizeof(NULL_t), buf_ptr, size,
+		NULL__jer_body_decode);
+}
+
+asn_enc_rval_t
+NULL_encode_jer(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
+                enum jer_encoder_flags_e flags, asn_app_consume_bytes_f *cb,
+                void *app_key) {
+    asn_enc_rval_t er = {0, 0, 0};
+
+	(void)ilevel;
+	(void)flags;
+
+	if(!sptr) ASN__ENCODE_FAILED;
+
+	ASN__CALLBACK("null", 4);
+
+	ASN__ENCODED_OK(er);
+cb_failed:
+	ASN__ENCODE_FAILED;
+}
+
+#endif  /* ASN_DISABLE_JER_SUPPORT */
+
 
 static enum xer_pbd_rval
 NULL__xer_body_decode(const asn_TYPE_descriptor_t *td, void *sptr,
@@ -182,9 +247,9 @@ NULL_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
 	(void)ilevel;	/* Unused argument */
 
 	if(sptr) {
-		return (cb("<present>", 9, app_key) < 0) ? -1 : 0;
+		return ASN__E_cbc("<present>", 9) ? -1 : 0;
 	} else {
-		return (cb("<absent>", 8, app_key) < 0) ? -1 : 0;
+		return ASN__E_cbc("<absent>", 8) ? -1 : 0;
 	}
 }
 
@@ -23,10 +23,13 @@ extern asn_TYPE_operation_t asn_OP_NULL;
 asn_struct_free_f NULL_free;
 asn_struct_print_f NULL_print;
 asn_struct_compare_f NULL_compare;
+asn_struct_copy_f NULL_copy;
 ber_type_decoder_f NULL_decode_ber;
 der_type_encoder_f NULL_encode_der;
 xer_type_decoder_f NULL_decode_xer;
 xer_type_encoder_f NULL_encode_xer;
+jer_type_decoder_f NULL_decode_jer;
+jer_type_encoder_f NULL_encode_jer;
 oer_type_decoder_f NULL_decode_oer;
 oer_type_encoder_f NULL_encode_oer;
 per_type_decoder_f NULL_decode_uper;
@@ -22,6 +22,7 @@ extern asn_TYPE_descriptor_t asn_DEF_NativeEnumerated;
 extern asn_TYPE_operation_t asn_OP_NativeEnumerated;
 
 xer_type_encoder_f NativeEnumerated_encode_xer;
+jer_type_encoder_f NativeEnumerated_encode_jer;
 oer_type_decoder_f NativeEnumerated_decode_oer;
 oer_type_encoder_f NativeEnumerated_encode_oer;
 per_type_decoder_f NativeEnumerated_decode_uper;
@@ -30,11 +31,13 @@ per_type_encoder_f NativeEnumerated_encode_uper;
 #define NativeEnumerated_free       NativeInteger_free
 #define NativeEnumerated_print      NativeInteger_print
 #define NativeEnumerated_compare    NativeInteger_compare
+#define NativeEnumerated_copy       NativeInteger_copy
 #define NativeEnumerated_random_fill NativeInteger_random_fill
 #define NativeEnumerated_constraint asn_generic_no_constraint
 #define NativeEnumerated_decode_ber NativeInteger_decode_ber
 #define NativeEnumerated_encode_der NativeInteger_encode_der
 #define NativeEnumerated_decode_xer NativeInteger_decode_xer
+#define NativeEnumerated_decode_jer NativeInteger_decode_jer
 
 #ifdef __cplusplus
 }
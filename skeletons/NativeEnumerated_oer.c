@@ -116,7 +116,7 @@ NativeEnumerated_encode_oer(const asn_TYPE_descriptor_t *td,
         /* #11.2 Short form */
         uint8_t b = native;
         er.encoded = 1;
-        if(cb(&b, er.encoded, app_key) < 0) {
+        if(ASN__E_cbc(&b, er.encoded)) {
             ASN__ENCODE_FAILED;
         }
         ASN__ENCODED_OK(er);
@@ -139,7 +139,7 @@ NativeEnumerated_encode_oer(const asn_TYPE_descriptor_t *td,
         }
         *b = 0x80 | (&buf[sizeof(native)] - b);
         er.encoded = 1 + (&buf[sizeof(native)] - b);
-        if(cb(b, er.encoded, app_key) < 0) {
+        if(ASN__E_cbc(b, er.encoded)) {
             ASN__ENCODE_FAILED;
         }
         ASN__ENCODED_OK(er);
@@ -23,10 +23,18 @@ asn_TYPE_operation_t asn_OP_NativeInteger = {
 	NativeInteger_free,
 	NativeInteger_print,
 	NativeInteger_compare,
+	NativeInteger_copy,
 	NativeInteger_decode_ber,
 	NativeInteger_encode_der,
 	NativeInteger_decode_xer,
 	NativeInteger_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	NativeInteger_decode_jer,
+	NativeInteger_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef	ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
@@ -244,7 +252,7 @@ NativeInteger_encode_xer(const asn_TYPE_descriptor_t *td, const void *sptr,
 			(specs && specs->field_unsigned)
 			? "%lu" : "%ld", *native);
 	if(er.encoded <= 0 || (size_t)er.encoded >= sizeof(scratch)
-		|| cb(scratch, er.encoded, app_key) < 0)
+		|| ASN__E_cbc(scratch, er.encoded))
 		ASN__ENCODE_FAILED;
 
 	ASN__ENCODED_OK(er);
@@ -298,6 +306,7 @@ NativeInteger_encode_uper(const asn_TYPE_descriptor_t *td,
     asn_enc_rval_t er;
 	long native;
 	INTEGER_t tmpint;
+	uint8_t tmpbuf[sizeof(intmax_t)];
 
 	if(!sptr) ASN__ENCODE_FAILED;
 
@@ -305,13 +314,14 @@ NativeInteger_encode_uper(const asn_TYPE_descriptor_t *td,
 
     ASN_DEBUG("Encoding NativeInteger %s %ld (UPER)", td->name, native);
 
+	/* Converted on the stack, as asn_(u)long2INTEGER() would do */
 	memset(&tmpint, 0, sizeof(tmpint));
-	if((specs&&specs->field_unsigned)
-		? asn_ulong2INTEGER(&tmpint, native)
-		: asn_long2INTEGER(&tmpint, native))
-		ASN__ENCODE_FAILED;
+	tmpint.buf = tmpbuf;
+	tmpint.size = INTEGER__imax2buf((specs && specs->field_unsigned)
+	                                    ? (intmax_t)(unsigned long)native
+	                                    : (intmax_t)native,
+	                                tmpbuf);
 	er = INTEGER_encode_uper(td, constraints, &tmpint, po);
-	ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_INTEGER, &tmpint);
 	return er;
 }
 
@@ -337,19 +347,19 @@ NativeInteger_print(const asn_TYPE_descriptor_t *td, const void *sptr,
         ret = snprintf(scratch, sizeof(scratch),
                        (specs && specs->field_unsigned) ? "%lu" : "%ld", value);
         assert(ret > 0 && (size_t)ret < sizeof(scratch));
-        if(cb(scratch, ret, app_key) < 0) return -1;
+        if(ASN__E_cbc(scratch, ret)) return -1;
         if(specs && (value >= 0 || !specs->field_unsigned)) {
             const asn_INTEGER_enum_map_t *el =
                 INTEGER_map_value2enum(specs, value);
             if(el) {
-                if(cb(" (", 2, app_key) < 0) return -1;
-                if(cb(el->enum_name, el->enum_len, app_key) < 0) return -1;
-                if(cb(")", 1, app_key) < 0) return -1;
+                if(ASN__E_cbc(" (", 2)) return -1;
+                if(ASN__E_cbc(el->enum_name, el->enum_len)) return -1;
+                if(ASN__E_cbc(")", 1)) return -1;
             }
         }
         return 0;
 	} else {
-		return (cb("<absent>", 8, app_key) < 0) ? -1 : 0;
+		return ASN__E_cbc("<absent>", 8) ? -1 : 0;
 	}
 }
 
@@ -374,6 +384,19 @@ NativeInteger_free(const asn_TYPE_descriptor_t *td, void *ptr,
     }
 }
 
+int
+NativeInteger_copy(const asn_TYPE_descriptor_t *td, void **dptr,
+                   const void *sptr) {
+    if(!td || !sptr) return -1;
+
+    if(!*dptr) {
+        *dptr = MALLOC(sizeof(long));
+        if(!*dptr) return -1;
+    }
+    memcpy(*dptr, sptr, sizeof(long));
+    return 0;
+}
+
 int
 NativeInteger_compare(const asn_TYPE_descriptor_t *td, const void *aptr, const void *bptr) {
     (void)td;
@@ -25,10 +25,13 @@ extern asn_TYPE_operation_t asn_OP_NativeInteger;
 asn_struct_free_f  NativeInteger_free;
 asn_struct_print_f NativeInteger_print;
 asn_struct_compare_f NativeInteger_compare;
+asn_struct_copy_f NativeInteger_copy;
 ber_type_decoder_f NativeInteger_decode_ber;
 der_type_encoder_f NativeInteger_encode_der;
 xer_type_decoder_f NativeInteger_decode_xer;
 xer_type_encoder_f NativeInteger_encode_xer;
+jer_type_decoder_f NativeInteger_decode_jer;
+jer_type_encoder_f NativeInteger_encode_jer;
 oer_type_decoder_f NativeInteger_decode_oer;
 oer_type_encoder_f NativeInteger_encode_oer;
 per_type_decoder_f NativeInteger_decode_uper;
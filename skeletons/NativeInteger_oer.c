@@ -75,25 +75,24 @@ NativeInteger_encode_oer(const asn_TYPE_descriptor_t *td,
     const asn_INTEGER_specifics_t *specs =
         (const asn_INTEGER_specifics_t *)td->specifics;
     INTEGER_t tmpint;
+    uint8_t tmpbuf[sizeof(intmax_t)];
     long native;
 
     if(!sptr) ASN__ENCODE_FAILED;
 
     native = *(const long *)sptr;
-    memset(&tmpint, 0, sizeof(tmpint));
 
     ASN_DEBUG("Encoding %s %ld as NativeInteger", td ? td->name : "", native);
 
-    if((specs && specs->field_unsigned) ? asn_ulong2INTEGER(&tmpint, native)
-                                        : asn_long2INTEGER(&tmpint, native)) {
-        ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_INTEGER, &tmpint);
-        ASN__ENCODE_FAILED;
-    } else {
-        asn_enc_rval_t er =
-            INTEGER_encode_oer(td, constraints, &tmpint, cb, app_key);
-        ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_INTEGER, &tmpint);
-        return er;
-    }
+    /* Converted on the stack, as asn_(u)long2INTEGER() would do */
+    memset(&tmpint, 0, sizeof(tmpint));
+    tmpint.buf = tmpbuf;
+    tmpint.size = INTEGER__imax2buf((specs && specs->field_unsigned)
+                                        ? (intmax_t)(unsigned long)native
+                                        : (intmax_t)native,
+                                    tmpbuf);
+
+    return INTEGER_encode_oer(td, constraints, &tmpint, cb, app_key);
 }
 
 #endif  /* ASN_DISABLE_OER_SUPPORT */
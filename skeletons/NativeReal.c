@@ -44,10 +44,18 @@ asn_TYPE_operation_t asn_OP_NativeReal = {
 	NativeReal_free,
 	NativeReal_print,
 	NativeReal_compare,
+	NativeReal_copy,
 	NativeReal_decode_ber,
 	NativeReal_encode_der,
 	NativeReal_decode_xer,
 	NativeReal_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	NativeReal_decode_jer,
+	NativeReal_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef	ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
@@ -357,7 +365,7 @@ NativeReal_encode_oer(const asn_TYPE_descriptor_t *td,
          * So we assume the network format is big endian.
          */
         NativeReal__network_swap(wire_size, sptr, scratch);
-        if(cb(scratch, wire_size, app_key) < 0) {
+        if(ASN__E_cbc(scratch, wire_size)) {
             ASN__ENCODE_FAILED;
         } else {
             er.encoded = wire_size;
@@ -377,7 +385,7 @@ NativeReal_encode_oer(const asn_TYPE_descriptor_t *td,
 
         /* Encode a fake REAL */
         len_len = oer_serialize_length(tmp.size, cb, app_key);
-        if(len_len < 0 || cb(tmp.buf, tmp.size, app_key) < 0) {
+        if(len_len < 0 || ASN__E_cbc(tmp.buf, tmp.size)) {
             ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_REAL, &tmp);
             ASN__ENCODE_FAILED;
         } else {
@@ -530,6 +538,49 @@ NativeReal_encode_xer(const asn_TYPE_descriptor_t *td, const void *sptr,
 	ASN__ENCODED_OK(er);
 }
 
+#ifndef ASN_DISABLE_JER_SUPPORT
+
+asn_dec_rval_t
+NativeReal_decode_jer(const asn_codec_ctx_t *opt_codec_ctx,
+                      const asn_TYPE_descriptor_t *td, void **sptr,
+                      const void *buf_ptr, size_t size) {
+    asn_dec_rval_t rval;
+	REAL_t st = { 0, 0 };
+	REAL_t *stp = &st;
+
+	rval = REAL_decode_jer(opt_codec_ctx, td, (void **)&stp, buf_ptr, size);
+	if(rval.code == RC_OK) {
+        double d;
+        if(asn_REAL2double(&st, &d) || NativeReal__set(td, sptr, d) < 0) {
+            rval.code = RC_FAIL;
+            rval.consumed = 0;
+        }
+	} else {
+        /* Convert all errors into RC_FAIL */
+        rval.consumed = 0;
+	}
+	ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_REAL, &st);
+	return rval;
+}
+
+asn_enc_rval_t
+NativeReal_encode_jer(const asn_TYPE_descriptor_t *td, const void *sptr,
+                      int ilevel, enum jer_encoder_flags_e flags,
+                      asn_app_consume_bytes_f *cb, void *app_key) {
+    double d = NativeReal__get_double(td, sptr);
+	asn_enc_rval_t er;
+
+	(void)ilevel;
+	(void)flags;
+
+    er.encoded = REAL__jer_dump(d, cb, app_key);
+    if(er.encoded < 0) ASN__ENCODE_FAILED;
+
+	ASN__ENCODED_OK(er);
+}
+
+#endif  /* ASN_DISABLE_JER_SUPPORT */
+
 /*
  * REAL specific human-readable output.
  */
@@ -542,7 +593,7 @@ NativeReal_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
         double d = NativeReal__get_double(td, sptr);
         return (REAL__dump(d, 0, cb, app_key) < 0) ? -1 : 0;
     } else {
-        return (cb("<absent>", 8, app_key) < 0) ? -1 : 0;
+        return ASN__E_cbc("<absent>", 8) ? -1 : 0;
     }
 }
 
@@ -604,6 +655,22 @@ NativeReal_free(const asn_TYPE_descriptor_t *td, void *ptr,
     }
 }
 
+int
+NativeReal_copy(const asn_TYPE_descriptor_t *td, void **dptr,
+                const void *sptr) {
+    size_t float_size;
+
+    if(!td || !sptr) return -1;
+
+    float_size = NativeReal__float_size(td);
+    if(!*dptr) {
+        *dptr = MALLOC(float_size);
+        if(!*dptr) return -1;
+    }
+    memcpy(*dptr, sptr, float_size);
+    return 0;
+}
+
 asn_random_fill_result_t
 NativeReal_random_fill(const asn_TYPE_descriptor_t *td, void **sptr,
                        const asn_encoding_constraints_t *constraints,
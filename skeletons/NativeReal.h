@@ -27,6 +27,7 @@ extern asn_TYPE_operation_t asn_OP_NativeReal;
 asn_struct_free_f  NativeReal_free;
 asn_struct_print_f NativeReal_print;
 asn_struct_compare_f NativeReal_compare;
+asn_struct_copy_f NativeReal_copy;
 ber_type_decoder_f NativeReal_decode_ber;
 der_type_encoder_f NativeReal_encode_der;
 per_type_decoder_f NativeReal_decode_uper;
@@ -35,6 +36,8 @@ oer_type_decoder_f NativeReal_decode_oer;
 oer_type_encoder_f NativeReal_encode_oer;
 xer_type_decoder_f NativeReal_decode_xer;
 xer_type_encoder_f NativeReal_encode_xer;
+jer_type_decoder_f NativeReal_decode_jer;
+jer_type_encoder_f NativeReal_encode_jer;
 asn_random_fill_f  NativeReal_random_fill;
 
 #define NativeReal_constraint  asn_generic_no_constraint
@@ -19,10 +19,18 @@ asn_TYPE_operation_t asn_OP_OBJECT_IDENTIFIER = {
 	ASN__PRIMITIVE_TYPE_free,
 	OBJECT_IDENTIFIER_print,
 	OCTET_STRING_compare,   /* Implemented in terms of a string comparison */
+	ASN__PRIMITIVE_TYPE_copy,
 	ber_decode_primitive,
 	der_encode_primitive,
 	OBJECT_IDENTIFIER_decode_xer,
 	OBJECT_IDENTIFIER_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	OBJECT_IDENTIFIER_decode_jer,
+	OBJECT_IDENTIFIER_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef	ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
@@ -150,7 +158,7 @@ OBJECT_IDENTIFIER__dump_body(const OBJECT_IDENTIFIER_t *st,
         return -1;
     }
     produced += ret;
-    if(cb(scratch, ret, app_key) < 0)
+    if(ASN__E_cbc(scratch, ret))
         return -1;
 
     for(off = rd; ; ) {
@@ -170,7 +178,7 @@ OBJECT_IDENTIFIER__dump_body(const OBJECT_IDENTIFIER_t *st,
                 return -1;
             }
             produced += ret;
-            if(cb(scratch, ret, app_key) < 0) return -1;
+            if(ASN__E_cbc(scratch, ret)) return -1;
         }
     }
 
@@ -254,6 +262,71 @@ OBJECT_IDENTIFIER_encode_xer(const asn_TYPE_descriptor_t *td, const void *sptr,
     ASN__ENCODED_OK(er);
 }
 
+#ifndef ASN_DISABLE_JER_SUPPORT
+
+/*
+ * The JER string contains the same dotted text as the XER body.
+ */
+static enum jer_pbd_rval
+OBJECT_IDENTIFIER__jer_body_decode(const asn_TYPE_descriptor_t *td, void *sptr,
+                                    pjer_chunk_type_e chunk_type, const void *chunk_buf,
+                                    size_t chunk_size) {
+	const char *contents;
+	void *to_free;
+	ssize_t len;
+	enum xer_pbd_rval ret;
+
+	if(chunk_type != PJER_STRING) return JPBD_BROKEN_ENCODING;
+
+	len = jer_string_contents(chunk_buf, chunk_size, &contents, &to_free);
+	if(len < 0) return JPBD_BROKEN_ENCODING;
+	ret = OBJECT_IDENTIFIER__xer_body_decode(td, sptr, contents, len);
+	if(to_free) FREEMEM(to_free);
+
+	switch(ret) {
+	case XPBD_SYSTEM_FAILURE:	return JPBD_SYSTEM_FAILURE;
+	case XPBD_DECODER_LIMIT:	return JPBD_DECODER_LIMIT;
+	case XPBD_BODY_CONSUMED:	return JPBD_BODY_CONSUMED;
+	default:			return JPBD_BROKEN_ENCODING;
+	}
+}
+
+asn_dec_rval_t
+OBJECT_IDENTIFIER_decode_jer(const asn_codec_ctx_t *opt_codec_ctx,
+                              const asn_TYPE_descriptor_t *td, void **sptr,
+                              const void *buf_ptr, size_t size) {
+    return jer_decode_primitive(opt_codec_ctx, td,
+		sptr, sizeof(OBJECT_IDENTIFIER_t),
+			buf_ptr, size, OBJECT_IDENTIFIER__jer_body_decode);
+}
+
+asn_enc_rval_t
+OBJECT_IDENTIFIER_encode_jer(const asn_TYPE_descriptor_t *td, const void *sptr,
+                              int ilevel, enum jer_encoder_flags_e flags,
+                              asn_app_consume_bytes_f *cb, void *app_key) {
+    const OBJECT_IDENTIFIER_t *st = (const OBJECT_IDENTIFIER_t *)sptr;
+	asn_enc_rval_t er = {0, 0, 0};
+	ssize_t ret;
+
+	(void)ilevel;	/* Unused argument */
+	(void)flags;	/* Unused argument */
+
+	if(!st || !st->buf)
+		ASN__ENCODE_FAILED;
+
+	ASN__CALLBACK("\"", 1);
+	ret = OBJECT_IDENTIFIER__dump_body(st, cb, app_key);
+	if(ret < 0) ASN__ENCODE_FAILED;
+	er.encoded += ret;
+	ASN__CALLBACK("\"", 1);
+
+	ASN__ENCODED_OK(er);
+cb_failed:
+	ASN__ENCODE_FAILED;
+}
+
+#endif  /* ASN_DISABLE_JER_SUPPORT */
+
 int
 OBJECT_IDENTIFIER_print(const asn_TYPE_descriptor_t *td, const void *sptr,
                         int ilevel, asn_app_consume_bytes_f *cb,
@@ -264,17 +337,17 @@ OBJECT_IDENTIFIER_print(const asn_TYPE_descriptor_t *td, const void *sptr,
 	(void)ilevel;	/* Unused argument */
 
 	if(!st || !st->buf)
-		return (cb("<absent>", 8, app_key) < 0) ? -1 : 0;
+		return ASN__E_cbc("<absent>", 8) ? -1 : 0;
 
 	/* Dump preamble */
-	if(cb("{ ", 2, app_key) < 0)
+	if(ASN__E_cbc("{ ", 2))
 		return -1;
 
     if(OBJECT_IDENTIFIER__dump_body(st, cb, app_key) < 0) {
         return -1;
     }
 
-    return (cb(" }", 2, app_key) < 0) ? -1 : 0;
+    return ASN__E_cbc(" }", 2) ? -1 : 0;
 }
 
 ssize_t
@@ -24,10 +24,18 @@ asn_TYPE_operation_t asn_OP_OCTET_STRING = {
 	OCTET_STRING_free,
 	OCTET_STRING_print,	/* OCTET STRING generally means a non-ascii sequence */
 	OCTET_STRING_compare,
+	OCTET_STRING_copy,
 	OCTET_STRING_decode_ber,
 	OCTET_STRING_encode_der,
 	OCTET_STRING_decode_xer_hex,
 	OCTET_STRING_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	OCTET_STRING_decode_jer_hex,
+	OCTET_STRING_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef	ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
@@ -173,6 +181,182 @@ _new_stack(void) {
 	return (struct _stack *)CALLOC(1, sizeof(struct _stack));
 }
 
+/*
+ * The depth of the constructed encodings handled without the stack
+ * of expectations.
+ */
+#define	OS_BER_WALK_DEPTH	8
+
+/*
+ * Walk over the constructed encoding of the string found complete in the
+ * buffer: validate it and compute the size of the contents (dst == NULL),
+ * or copy the contents into (dst) sized up by the previous walk.
+ * The expectations are the same as in OCTET_STRING_decode_ber().
+ * RETURN VALUES:
+ * >0: The number of bytes consumed, (*contents_size) is set.
+ * -1: The encoding is broken.
+ * -2: The encoding is not complete in the buffer or is too deep,
+ *     the stack of expectations is necessary to handle it.
+ */
+static ssize_t
+OS__ber_walk_constructed(const asn_TYPE_descriptor_t *td,
+                         enum asn_OS_Subvariant type_variant, int tag_mode,
+                         const void *buf_ptr, size_t size, uint8_t *dst,
+                         size_t *contents_size, int *bits_unused) {
+	const uint8_t *ptr = (const uint8_t *)buf_ptr;
+	const uint8_t *buf_end = ptr + size;
+	const uint8_t *end[OS_BER_WALK_DEPTH];	/* Ends of the frames */
+	int want_nulls[OS_BER_WALK_DEPTH];	/* Indefinite length frames */
+	size_t copied = 0;
+	int depth = 0;
+
+	do {
+		const uint8_t *limit = depth ? end[depth - 1] : buf_end;
+		ber_tlv_tag_t tlv_tag;
+		ber_tlv_tag_t expected_tag;
+		ber_tlv_len_t tlv_len;
+		ssize_t tl, ll, tlvl;
+		int tlv_constr;
+
+		if(depth && !want_nulls[depth - 1] && ptr == limit) {
+			depth--;	/* Move to the next expectation */
+			continue;
+		}
+
+		if(depth && want_nulls[depth - 1] && limit - ptr >= 2
+		&& ptr[0] == 0 && ptr[1] == 0) {
+			/* Eat EOC */
+			if(type_variant == ASN_OSUBV_ANY
+			&& (tag_mode != 1 || depth > 1)) {
+				if(dst) memcpy(dst + copied, ptr, 2);
+				copied += 2;
+			}
+			ptr += 2;
+			depth--;
+			continue;
+		}
+
+		tl = ber_fetch_tag(ptr, limit - ptr, &tlv_tag);
+		switch(tl) {
+		case -1: return -1;
+		case 0: return -2;
+		}
+
+		tlv_constr = BER_TLV_CONSTRUCTED(ptr);
+
+		ll = ber_fetch_length(tlv_constr, ptr + tl, (limit - ptr) - tl,
+			&tlv_len);
+		switch(ll) {
+		case -1: return -1;
+		case 0: return -2;
+		}
+
+		expected_tag = tlv_tag;
+		if(depth && type_variant != ASN_OSUBV_ANY && td->all_tags_count) {
+			unsigned level = depth - 1;
+			if(level >= td->all_tags_count)
+				level = td->all_tags_count - 1;
+			expected_tag = td->all_tags[level];
+		}
+		if(tlv_tag != expected_tag)
+			return -1;
+
+		tlvl = tl + ll;	/* Combined length of T and L encoding */
+		if((tlv_len + tlvl) < 0)
+			return -1;	/* tlv_len value is too big */
+		if(tlv_len > (limit - ptr) - tlvl)
+			return -2;	/* Let the stack of expectations judge */
+
+		if(type_variant == ASN_OSUBV_ANY
+		&& (tag_mode != 1 || depth > 0)) {
+			if(dst) memcpy(dst + copied, ptr, tlvl);
+			copied += tlvl;
+		}
+		ptr += tlvl;
+
+		if(tlv_constr) {
+			if(depth == OS_BER_WALK_DEPTH)
+				return -2;
+			want_nulls[depth] = (tlv_len == -1);
+			end[depth] = (tlv_len == -1) ? limit : ptr + tlv_len;
+			depth++;
+		} else if(type_variant == ASN_OSUBV_BIT && tlv_len > 0) {
+			/* Put the unused-bits-octet away */
+			if(bits_unused) *bits_unused = *ptr;
+			if(dst) memcpy(dst + copied, ptr + 1, tlv_len - 1);
+			copied += tlv_len - 1;
+			ptr += tlv_len;
+		} else {
+			if(dst) memcpy(dst + copied, ptr, tlv_len);
+			copied += tlv_len;
+			ptr += tlv_len;
+		}
+	} while(depth);
+
+	*contents_size = copied;
+	return ptr - (const uint8_t *)buf_ptr;
+}
+
+/*
+ * Decode the constructed encoding of the string found complete in the
+ * buffer, allocating the contents at once instead of growing them
+ * segment by segment. The definite length of the encoding bounds
+ * the contents, which are then copied in a single pass; the indefinite
+ * length encoding is walked twice, to size the contents up and to copy.
+ * Returns the number of bytes consumed, -1 or -2 as above.
+ */
+static ssize_t
+OS__ber_decode_constructed(const asn_TYPE_descriptor_t *td,
+                           enum asn_OS_Subvariant type_variant, int tag_mode,
+                           BIT_STRING_t *st, const void *buf_ptr,
+                           size_t size) {
+	ber_tlv_tag_t tlv_tag;
+	ber_tlv_len_t tlv_len;
+	ssize_t tl, ll;
+	size_t contents_size;
+	size_t new_size;
+	ssize_t consumed;
+	uint8_t *buf;
+
+	tl = ber_fetch_tag(buf_ptr, size, &tlv_tag);
+	if(tl <= 0)
+		return -2;
+	ll = ber_fetch_length(1, (const char *)buf_ptr + tl, size - tl,
+		&tlv_len);
+	if(ll <= 0)
+		return -2;
+
+	if(tlv_len >= 0) {
+		if((size_t)tlv_len > size - tl - ll)
+			return -2;
+		contents_size = tl + ll + tlv_len;
+	} else {
+		consumed = OS__ber_walk_constructed(td, type_variant, tag_mode,
+			buf_ptr, size, 0, &contents_size, 0);
+		if(consumed < 0)
+			return consumed;
+	}
+
+	new_size = st->size + contents_size;
+	/* The same limit as in APPEND() */
+	if((int)new_size < 0 || (int)(new_size + 1) < 0)
+		return -1;
+	buf = (uint8_t *)REALLOC(st->buf, new_size + 1);
+	if(!buf)
+		return -1;
+	st->buf = buf;
+
+	consumed = OS__ber_walk_constructed(td, type_variant, tag_mode, buf_ptr,
+		size, st->buf + st->size, &contents_size,
+		type_variant == ASN_OSUBV_BIT ? &st->bits_unused : 0);
+	if(consumed < 0)
+		return consumed;
+	st->size += contents_size;
+	st->buf[st->size] = '\0';	/* Convenient nul-termination */
+
+	return consumed;
+}
+
 /*
  * Decode OCTET STRING type.
  */
@@ -221,6 +405,20 @@ OCTET_STRING_decode_ber(const asn_codec_ctx_t *opt_codec_ctx,
 			return rval;
 
 		if(tlv_constr) {
+			/*
+			 * If the whole encoding is in the buffer, size
+			 * the contents up and copy them in a single pass.
+			 */
+			ssize_t ret = OS__ber_decode_constructed(td, type_variant,
+				tag_mode, st, buf_ptr, size);
+			if(ret > 0) {
+				ADVANCE(ret);
+				_CH_PHASE(ctx, 4);	/* Phase out */
+				break;
+			} else if(ret == -1) {
+				RETURN(RC_FAIL);
+			}
+
 			/*
 			 * Complex operation, requires stack of expectations.
 			 */
@@ -773,9 +971,9 @@ OCTET_STRING_encode_xer_utf8(const asn_TYPE_descriptor_t *td, const void *sptr,
 		if(ch < sizeof(OCTET_STRING__xer_escape_table)
 			/sizeof(OCTET_STRING__xer_escape_table[0])
 		&& (s_len = OCTET_STRING__xer_escape_table[ch].size)) {
-			if(((buf - ss) && cb(ss, buf - ss, app_key) < 0)
-			|| cb(OCTET_STRING__xer_escape_table[ch].string, s_len,
-					app_key) < 0)
+			if(((buf - ss) && ASN__E_cbc(ss, buf - ss))
+			|| ASN__E_cbc(OCTET_STRING__xer_escape_table[ch].string,
+					s_len))
 				ASN__ENCODE_FAILED;
 			encoded_len += (buf - ss) + s_len;
 			ss = buf + 1;
@@ -783,7 +981,7 @@ OCTET_STRING_encode_xer_utf8(const asn_TYPE_descriptor_t *td, const void *sptr,
 	}
 
 	encoded_len += (buf - ss);
-	if((buf - ss) && cb(ss, buf - ss, app_key) < 0)
+	if((buf - ss) && ASN__E_cbc(ss, buf - ss))
 		ASN__ENCODE_FAILED;
 
 	er.encoded = encoded_len;
@@ -1659,7 +1857,7 @@ OCTET_STRING_print(const asn_TYPE_descriptor_t *td, const void *sptr,
 	(void)td;	/* Unused argument */
 
 	if(!st || (!st->buf && st->size))
-		return (cb("<absent>", 8, app_key) < 0) ? -1 : 0;
+		return ASN__E_cbc("<absent>", 8) ? -1 : 0;
 
 	/*
 	 * Dump the contents of the buffer in hexadecimal.
@@ -1668,7 +1866,7 @@ OCTET_STRING_print(const asn_TYPE_descriptor_t *td, const void *sptr,
 	end = buf + st->size;
 	for(i = 0; buf < end; buf++, i++) {
 		if(!(i % 16) && (i || st->size > 16)) {
-			if(cb(scratch, p - scratch, app_key) < 0)
+			if(ASN__E_cbc(scratch, p - scratch))
 				return -1;
 			_i_INDENT(1);
 			p = scratch;
@@ -1680,7 +1878,7 @@ OCTET_STRING_print(const asn_TYPE_descriptor_t *td, const void *sptr,
 
 	if(p > scratch) {
 		p--;	/* Remove the tail space */
-		if(cb(scratch, p - scratch, app_key) < 0)
+		if(ASN__E_cbc(scratch, p - scratch))
 			return -1;
 	}
 
@@ -1697,9 +1895,9 @@ OCTET_STRING_print_utf8(const asn_TYPE_descriptor_t *td, const void *sptr,
 	(void)ilevel;	/* Unused argument */
 
 	if(st && (st->buf || !st->size)) {
-		return (cb(st->buf, st->size, app_key) < 0) ? -1 : 0;
+		return ASN__E_cbc(st->buf, st->size) ? -1 : 0;
 	} else {
-		return (cb("<absent>", 8, app_key) < 0) ? -1 : 0;
+		return ASN__E_cbc("<absent>", 8) ? -1 : 0;
 	}
 }
 
@@ -1755,6 +1953,44 @@ OCTET_STRING_free(const asn_TYPE_descriptor_t *td, void *sptr,
     }
 }
 
+int
+OCTET_STRING_copy(const asn_TYPE_descriptor_t *td, void **dptr,
+                  const void *sptr) {
+	const OCTET_STRING_t *src = (const OCTET_STRING_t *)sptr;
+	const asn_OCTET_STRING_specifics_t *specs;
+	uint8_t *buf = 0;
+
+	if(!td || !src)
+		return -1;
+
+	specs = td->specifics
+		    ? (const asn_OCTET_STRING_specifics_t *)td->specifics
+		    : &asn_SPC_OCTET_STRING_specs;
+
+	if(src->buf) {
+		/* Keep the terminating zero the decoders always put there */
+		buf = (uint8_t *)MALLOC(src->size + 1);
+		if(!buf) return -1;
+		if(src->size) memcpy(buf, src->buf, src->size);
+		buf[src->size] = '\0';
+	}
+
+	if(!*dptr) {
+		*dptr = MALLOC(specs->struct_size);
+		if(!*dptr) {
+			FREEMEM(buf);
+			return -1;
+		}
+	}
+
+	/* Also takes the BIT STRING's bits_unused along */
+	memcpy(*dptr, src, specs->struct_size);
+	((OCTET_STRING_t *)*dptr)->buf = buf;
+	memset((char *)*dptr + specs->ctx_offset, 0, sizeof(asn_struct_ctx_t));
+
+	return 0;
+}
+
 /*
  * Conversion routines.
  */
@@ -1827,7 +2063,9 @@ OCTET_STRING_compare(const asn_TYPE_descriptor_t *td, const void *aptr,
 
     if(a && b) {
         size_t common_prefix_size = a->size <= b->size ? a->size : b->size;
-        int ret = memcmp(a->buf, b->buf, common_prefix_size);
+        int ret = common_prefix_size
+                      ? memcmp(a->buf, b->buf, common_prefix_size)
+                      : 0;
         if(ret == 0) {
             /* Figure out which string with equal prefixes is longer. */
             if(a->size < b->size) {
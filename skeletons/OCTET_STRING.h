@@ -25,6 +25,7 @@ asn_struct_free_f OCTET_STRING_free;
 asn_struct_print_f OCTET_STRING_print;
 asn_struct_print_f OCTET_STRING_print_utf8;
 asn_struct_compare_f OCTET_STRING_compare;
+asn_struct_copy_f OCTET_STRING_copy;
 ber_type_decoder_f OCTET_STRING_decode_ber;
 der_type_encoder_f OCTET_STRING_encode_der;
 xer_type_decoder_f OCTET_STRING_decode_xer_hex;		/* Hexadecimal */
@@ -32,6 +33,10 @@ xer_type_decoder_f OCTET_STRING_decode_xer_binary;	/* 01010111010 */
 xer_type_decoder_f OCTET_STRING_decode_xer_utf8;	/* ASCII/UTF-8 */
 xer_type_encoder_f OCTET_STRING_encode_xer;
 xer_type_encoder_f OCTET_STRING_encode_xer_utf8;
+jer_type_decoder_f OCTET_STRING_decode_jer_hex;		/* Hexadecimal */
+jer_type_decoder_f OCTET_STRING_decode_jer_utf8;	/* ASCII/UTF-8 */
+jer_type_encoder_f OCTET_STRING_encode_jer;
+jer_type_encoder_f OCTET_STRING_encode_jer_utf8;
 oer_type_decoder_f OCTET_STRING_decode_oer;
 oer_type_encoder_f OCTET_STRING_encode_oer;
 per_type_decoder_f OCTET_STRING_decode_uper;
@@ -40,6 +45,7 @@ asn_random_fill_f  OCTET_STRING_random_fill;
 
 #define OCTET_STRING_constraint  asn_generic_no_constraint
 #define OCTET_STRING_decode_xer  OCTET_STRING_decode_xer_hex
+#define OCTET_STRING_decode_jer  OCTET_STRING_decode_jer_hex
 
 /******************************
  * Handy conversion routines. *
@@ -89,6 +95,16 @@ typedef struct asn_OCTET_STRING_specifics_s {
 
 extern asn_OCTET_STRING_specifics_t asn_SPC_OCTET_STRING_specs;
 
+/*
+ * The JER hexadecimal form of the contents, shared with BIT STRING.
+ * OCTET_STRING__jer_from_hex() replaces the contents of the (st) with
+ * the decoded digits, returning -1 on broken digits or memory shortage.
+ */
+int OCTET_STRING__jer_from_hex(OCTET_STRING_t *st, const char *hex,
+                               size_t size);
+ssize_t OCTET_STRING__jer_dump_hex(const uint8_t *buf, size_t size,
+                                   asn_app_consume_bytes_f *cb, void *app_key);
+
 size_t OCTET_STRING_random_length_constrained(
     const asn_TYPE_descriptor_t *, const asn_encoding_constraints_t *,
     size_t max_length);
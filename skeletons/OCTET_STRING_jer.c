@@ -0,0 +1,208 @@
+/*
+ * Redistribution and modifications are permitted subject to BSD license.
+ */
+#ifndef ASN_DISABLE_JER_SUPPORT
+
+#include <asn_internal.h>
+#include <OCTET_STRING.h>
+#include <errno.h>
+
+int
+OCTET_STRING__jer_from_hex(OCTET_STRING_t *st, const char *hex, size_t size) {
+    const char *end = hex + size;
+    uint8_t *buf;
+    uint8_t *b;
+
+    if(size & 1) return -1; /* Two digits per octet */
+
+    buf = (uint8_t *)MALLOC(size / 2 + 1);
+    if(!buf) return -1;
+
+    for(b = buf; hex < end; hex += 2) {
+        int i;
+        int v = 0;
+        for(i = 0; i < 2; i++) {
+            int ch = hex[i];
+            v <<= 4;
+            switch(ch) {
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34:
+            case 0x35: case 0x36: case 0x37: case 0x38: case 0x39:
+                v |= ch - 0x30;
+                break;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46:
+                v |= ch - 0x41 + 10;
+                break;
+            case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+                v |= ch - 0x61 + 10;
+                break;
+            default:
+                FREEMEM(buf);
+                return -1;
+            }
+        }
+        *b++ = v;
+    }
+    *b = 0; /* Zero-terminate the string, just in case */
+
+    if(st->buf) FREEMEM(st->buf);
+    st->buf = buf;
+    st->size = b - buf;
+    return 0;
+}
+
+ssize_t
+OCTET_STRING__jer_dump_hex(const uint8_t *buf, size_t size,
+                           asn_app_consume_bytes_f *cb, void *app_key) {
+    const char * const h2c = "0123456789ABCDEF";
+    const uint8_t *end = buf + size;
+    char scratch[128];
+    char *p = scratch;
+    char *scend = scratch + sizeof(scratch);
+
+    for(; buf < end; buf++) {
+        if(p == scend) {
+            if(ASN__E_cbc(scratch, p - scratch)) return -1;
+            p = scratch;
+        }
+        *p++ = h2c[(*buf >> 4) & 0x0F];
+        *p++ = h2c[*buf & 0x0F];
+    }
+    if(p > scratch && ASN__E_cbc(scratch, p - scratch)) return -1;
+
+    return 2 * size;
+}
+
+/*
+ * The hexadecimal JSON string encoding the OCTET STRING.
+ */
+static enum jer_pbd_rval
+OCTET_STRING__jer_body_decode_hex(const asn_TYPE_descriptor_t *td, void *sptr,
+                                  pjer_chunk_type_e chunk_type,
+                                  const void *chunk_buf, size_t chunk_size) {
+    OCTET_STRING_t *st = (OCTET_STRING_t *)sptr;
+    const char *contents;
+    void *to_free;
+    ssize_t len;
+    int ret;
+
+    (void)td;
+
+    if(chunk_type != PJER_STRING) return JPBD_BROKEN_ENCODING;
+
+    len = jer_string_contents(chunk_buf, chunk_size, &contents, &to_free);
+    if(len < 0) return JPBD_BROKEN_ENCODING;
+    ret = OCTET_STRING__jer_from_hex(st, contents, len);
+    if(to_free) FREEMEM(to_free);
+
+    return ret ? JPBD_BROKEN_ENCODING : JPBD_BODY_CONSUMED;
+}
+
+/*
+ * The JSON string encoding the text: the escapes are replaced in place.
+ */
+static enum jer_pbd_rval
+OCTET_STRING__jer_body_decode_utf8(const asn_TYPE_descriptor_t *td, void *sptr,
+                                   pjer_chunk_type_e chunk_type,
+                                   const void *chunk_buf, size_t chunk_size) {
+    OCTET_STRING_t *st = (OCTET_STRING_t *)sptr;
+    uint8_t *buf;
+    ssize_t len;
+
+    (void)td;
+
+    if(chunk_type != PJER_STRING) return JPBD_BROKEN_ENCODING;
+
+    buf = (uint8_t *)MALLOC(chunk_size - 1);
+    if(!buf) return JPBD_SYSTEM_FAILURE;
+    len = jer_string_unescape((const char *)chunk_buf + 1, chunk_size - 2,
+                              buf);
+    if(len < 0) {
+        FREEMEM(buf);
+        return JPBD_BROKEN_ENCODING;
+    }
+    buf[len] = 0; /* Zero-terminate the string, just in case */
+
+    if(st->buf) FREEMEM(st->buf);
+    st->buf = buf;
+    st->size = len;
+
+    return JPBD_BODY_CONSUMED;
+}
+
+asn_dec_rval_t
+OCTET_STRING_decode_jer_hex(const asn_codec_ctx_t *opt_codec_ctx,
+                            const asn_TYPE_descriptor_t *td, void **sptr,
+                            const void *buf_ptr, size_t size) {
+    const asn_OCTET_STRING_specifics_t *specs =
+        td->specifics ? (const asn_OCTET_STRING_specifics_t *)td->specifics
+                      : &asn_SPC_OCTET_STRING_specs;
+    return jer_decode_primitive(opt_codec_ctx, td, sptr, specs->struct_size,
+                                buf_ptr, size,
+                                OCTET_STRING__jer_body_decode_hex);
+}
+
+asn_dec_rval_t
+OCTET_STRING_decode_jer_utf8(const asn_codec_ctx_t *opt_codec_ctx,
+                             const asn_TYPE_descriptor_t *td, void **sptr,
+                             const void *buf_ptr, size_t size) {
+    const asn_OCTET_STRING_specifics_t *specs =
+        td->specifics ? (const asn_OCTET_STRING_specifics_t *)td->specifics
+                      : &asn_SPC_OCTET_STRING_specs;
+    return jer_decode_primitive(opt_codec_ctx, td, sptr, specs->struct_size,
+                                buf_ptr, size,
+                                OCTET_STRING__jer_body_decode_utf8);
+}
+
+asn_enc_rval_t
+OCTET_STRING_encode_jer(const asn_TYPE_descriptor_t *td, const void *sptr,
+                        int ilevel, enum jer_encoder_flags_e flags,
+                        asn_app_consume_bytes_f *cb, void *app_key) {
+    const OCTET_STRING_t *st = (const OCTET_STRING_t *)sptr;
+    asn_enc_rval_t er = {0, 0, 0};
+    ssize_t ret;
+
+    (void)td;
+    (void)ilevel;
+    (void)flags;
+
+    if(!st || (!st->buf && st->size))
+        ASN__ENCODE_FAILED;
+
+    ASN__CALLBACK("\"", 1);
+    ret = OCTET_STRING__jer_dump_hex(st->buf, st->size, cb, app_key);
+    if(ret < 0) ASN__ENCODE_FAILED;
+    er.encoded += ret;
+    ASN__CALLBACK("\"", 1);
+
+    ASN__ENCODED_OK(er);
+cb_failed:
+    ASN__ENCODE_FAILED;
+}
+
+asn_enc_rval_t
+OCTET_STRING_encode_jer_utf8(const asn_TYPE_descriptor_t *td, const void *sptr,
+                             int ilevel, enum jer_encoder_flags_e flags,
+                             asn_app_consume_bytes_f *cb, void *app_key) {
+    const OCTET_STRING_t *st = (const OCTET_STRING_t *)sptr;
+    asn_enc_rval_t er = {0, 0, 0};
+    ssize_t ret;
+
+    (void)td;
+    (void)ilevel;
+    (void)flags;
+
+    if(!st || (!st->buf && st->size))
+        ASN__ENCODE_FAILED;
+
+    ASN__CALLBACK("\"", 1);
+    ret = jer_escape_string(st->buf, st->size, cb, app_key);
+    if(ret < 0) ASN__ENCODE_FAILED;
+    er.encoded += ret;
+    ASN__CALLBACK("\"", 1);
+
+    ASN__ENCODED_OK(er);
+cb_failed:
+    ASN__ENCODE_FAILED;
+}
+
+#endif  /* ASN_DISABLE_JER_SUPPORT */
@@ -161,7 +161,7 @@ OCTET_STRING_encode_oer(const asn_TYPE_descriptor_t *td,
     }
 
     er.encoded += st->size;
-    if(cb(st->buf, st->size, app_key) < 0) {
+    if(ASN__E_cbc(st->buf, st->size)) {
         ASN__ENCODE_FAILED;
     } else {
         ASN__ENCODED_OK(er);
@@ -12,10 +12,18 @@ asn_TYPE_operation_t asn_OP_OPEN_TYPE = {
 	OPEN_TYPE_free,
 	OPEN_TYPE_print,
 	OPEN_TYPE_compare,
+	OPEN_TYPE_copy,
 	OPEN_TYPE_decode_ber,
 	OPEN_TYPE_encode_der,
 	OPEN_TYPE_decode_xer,
 	OPEN_TYPE_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	OPEN_TYPE_decode_jer,
+	OPEN_TYPE_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 	0, 0,	/* No OER support, use "-gen-OER" to enable */
 #ifdef ASN_DISABLE_PER_SUPPORT
 	0, 0,
@@ -390,6 +398,8 @@ OPEN_TYPE_encode_uper(const asn_TYPE_descriptor_t *td,
         memb_ptr = (const char *)sptr + elm->memb_offset;
     }
 
+    if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, &er)) return er;
+
     if(uper_open_type_put(elm->type, NULL, memb_ptr, po) < 0) {
         ASN__ENCODE_FAILED;
     }
@@ -16,10 +16,18 @@ asn_TYPE_operation_t asn_OP_ObjectDescriptor = {
 	OCTET_STRING_free,
 	OCTET_STRING_print_utf8,   /* Treat as ASCII subset (it's not) */
 	OCTET_STRING_compare,
+	OCTET_STRING_copy,
 	OCTET_STRING_decode_ber,    /* Implemented in terms of OCTET STRING */
 	OCTET_STRING_encode_der,
 	OCTET_STRING_decode_xer_utf8,
 	OCTET_STRING_encode_xer_utf8,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	OCTET_STRING_decode_jer_utf8,
+	OCTET_STRING_encode_jer_utf8,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef	ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
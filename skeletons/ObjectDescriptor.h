@@ -23,6 +23,8 @@ extern asn_TYPE_operation_t asn_OP_ObjectDescriptor;
 #define ObjectDescriptor_encode_der   OCTET_STRING_encode_der
 #define ObjectDescriptor_decode_xer   OCTET_STRING_decode_xer_utf8
 #define ObjectDescriptor_encode_xer   OCTET_STRING_encode_xer_utf8
+#define ObjectDescriptor_decode_jer   OCTET_STRING_decode_jer_utf8
+#define ObjectDescriptor_encode_jer   OCTET_STRING_encode_jer_utf8
 #define ObjectDescriptor_decode_uper  OCTET_STRING_decode_uper
 #define ObjectDescriptor_encode_uper  OCTET_STRING_encode_uper
 
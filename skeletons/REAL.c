@@ -70,10 +70,18 @@ asn_TYPE_operation_t asn_OP_REAL = {
 	ASN__PRIMITIVE_TYPE_free,
 	REAL_print,
 	REAL_compare,
+	ASN__PRIMITIVE_TYPE_copy,
 	ber_decode_primitive,
 	der_encode_primitive,
 	REAL_decode_xer,
 	REAL_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	REAL_decode_jer,
+	REAL_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef	ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
@@ -137,7 +145,7 @@ REAL__dump(double d, int canonical, asn_app_consume_bytes_f *cb, void *app_key)
 	if(asn_isnan(d)) {
 		buf = specialRealValue[SRV__NOT_A_NUMBER].string;
 		buflen = specialRealValue[SRV__NOT_A_NUMBER].length;
-		return (cb(buf, buflen, app_key) < 0) ? -1 : buflen;
+		return ASN__E_cbc(buf, buflen) ? -1 : buflen;
 	} else if(!asn_isfinite(d)) {
 		if(copysign(1.0, d) < 0.0) {
 			buf = specialRealValue[SRV__MINUS_INFINITY].string;
@@ -146,7 +154,7 @@ REAL__dump(double d, int canonical, asn_app_consume_bytes_f *cb, void *app_key)
 			buf = specialRealValue[SRV__PLUS_INFINITY].string;
 			buflen = specialRealValue[SRV__PLUS_INFINITY].length;
 		}
-		return (cb(buf, buflen, app_key) < 0) ? -1 : buflen;
+		return ASN__E_cbc(buf, buflen) ? -1 : buflen;
 	} else if(ilogb(d) <= -INT_MAX) {
 		if(copysign(1.0, d) < 0.0) {
 			buf = "-0";
@@ -155,7 +163,7 @@ REAL__dump(double d, int canonical, asn_app_consume_bytes_f *cb, void *app_key)
 			buf = "0";
 			buflen = 1;
 		}
-		return (cb(buf, buflen, app_key) < 0) ? -1 : buflen;
+		return ASN__E_cbc(buf, buflen) ? -1 : buflen;
 	}
 
 	/*
@@ -300,7 +308,7 @@ REAL__dump(double d, int canonical, asn_app_consume_bytes_f *cb, void *app_key)
 		}
 	}
 
-	ret = cb(buf, buflen, app_key);
+	ret = ASN__E_cbc(buf, buflen) ? -1 : 0;
 	if(buf != local_buf) FREEMEM(buf);
 	return (ret < 0) ? -1 : buflen;
 }
@@ -466,6 +474,148 @@ REAL_decode_xer(const asn_codec_ctx_t *opt_codec_ctx,
 		buf_ptr, size, REAL__xer_body_decode);
 }
 
+#ifndef ASN_DISABLE_JER_SUPPORT
+
+/* X.697 #20.2: the special values are represented by the JSON strings */
+static struct specialRealValue_s specialJERRealValue[] = {
+#define	SRV_SET(foo, val)	{ foo, sizeof(foo) - 1, val }
+	SRV_SET("\"NaN\"", 0),
+	SRV_SET("\"-INF\"", -1),
+	SRV_SET("\"INF\"", 1),
+	SRV_SET("\"-0\"", 2),
+#undef	SRV_SET
+};
+
+ssize_t
+REAL__jer_dump(double d, asn_app_consume_bytes_f *cb, void *app_key) {
+	const struct specialRealValue_s *srv;
+
+	if(asn_isnan(d)) {
+		srv = &specialJERRealValue[SRV__NOT_A_NUMBER];
+	} else if(!asn_isfinite(d)) {
+		srv = &specialJERRealValue[copysign(1.0, d) < 0.0
+			? SRV__MINUS_INFINITY : SRV__PLUS_INFINITY];
+	} else if(ilogb(d) <= -INT_MAX && copysign(1.0, d) < 0.0) {
+		srv = &specialJERRealValue[3];
+	} else {
+		/* The canonical form is the valid JSON number */
+		return REAL__dump(d, 1, cb, app_key);
+	}
+
+	return ASN__E_cbc(srv->string, srv->length) ? -1 : (ssize_t)srv->length;
+}
+
+asn_enc_rval_t
+REAL_encode_jer(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
+                enum jer_encoder_flags_e flags, asn_app_consume_bytes_f *cb,
+                void *app_key) {
+    const REAL_t *st = (const REAL_t *)sptr;
+	asn_enc_rval_t er;
+	double d;
+
+	(void)ilevel;
+	(void)flags;
+
+	if(!st || !st->buf || asn_REAL2double(st, &d))
+		ASN__ENCODE_FAILED;
+
+	er.encoded = REAL__jer_dump(d, cb, app_key);
+	if(er.encoded < 0) ASN__ENCODE_FAILED;
+
+	ASN__ENCODED_OK(er);
+}
+
+/*
+ * Decode the JSON number or the special value string encoding REAL.
+ */
+static enum jer_pbd_rval
+REAL__jer_body_decode(const asn_TYPE_descriptor_t *td, void *sptr,
+                      pjer_chunk_type_e chunk_type, const void *chunk_buf,
+                      size_t chunk_size) {
+    REAL_t *st = (REAL_t *)sptr;
+	const char *p = (const char *)chunk_buf;
+	const char *end = p + chunk_size;
+	double value;
+	char *endptr = 0;
+	char *b;
+
+	(void)td;
+
+	if(chunk_type == PJER_STRING) {
+		size_t i;
+		for(i = 0; i < sizeof(specialJERRealValue)
+				/ sizeof(specialJERRealValue[0]); i++) {
+			struct specialRealValue_s *srv = &specialJERRealValue[i];
+			double dv;
+
+			if(srv->length != chunk_size
+			|| memcmp(srv->string, chunk_buf, chunk_size))
+				continue;
+
+			switch(srv->dv) {
+			case -1: dv = - INFINITY; break;
+			case 0: dv = NAN;	break;
+			case 1: dv = INFINITY;	break;
+			case 2: dv = copysign(0.0, -1.0);	break;
+			default: return JPBD_SYSTEM_FAILURE;
+			}
+
+			if(asn_double2REAL(st, dv))
+				return JPBD_SYSTEM_FAILURE;
+
+			return JPBD_BODY_CONSUMED;
+		}
+		ASN_DEBUG("Unknown special REAL value");
+		return JPBD_BROKEN_ENCODING;
+	}
+
+	/*
+	 * The strtod(3) understands more than the JSON number,
+	 * such as "inf" or the hexadecimal notation.
+	 */
+	for(; p < end; p++) {
+		switch(*p) {
+		case 0x2b: case 0x2d: case 0x2e: case 0x45: case 0x65: /* +-.Ee */
+		case 0x30: case 0x31: case 0x32: case 0x33: case 0x34:
+		case 0x35: case 0x36: case 0x37: case 0x38: case 0x39:
+			continue;
+		default:
+			return JPBD_BROKEN_ENCODING;
+		}
+	}
+
+	/*
+	 * Copy chunk into the nul-terminated string, and run strtod.
+	 */
+	b = (char *)MALLOC(chunk_size + 1);
+	if(!b) return JPBD_SYSTEM_FAILURE;
+	memcpy(b, chunk_buf, chunk_size);
+	b[chunk_size] = 0;	/* nul-terminate */
+
+	value = strtod(b, &endptr);
+	if(endptr != b + chunk_size) {
+		FREEMEM(b);
+		return JPBD_BROKEN_ENCODING;
+	}
+	FREEMEM(b);
+
+	if(asn_double2REAL(st, value))
+		return JPBD_SYSTEM_FAILURE;
+
+	return JPBD_BODY_CONSUMED;
+}
+
+asn_dec_rval_t
+REAL_decode_jer(const asn_codec_ctx_t *opt_codec_ctx,
+                const asn_TYPE_descriptor_t *td, void **sptr,
+                const void *buf_ptr, size_t size) {
+    return jer_decode_primitive(opt_codec_ctx, td,
+		sptr, sizeof(REAL_t),
+		buf_ptr, size, REAL__jer_body_decode);
+}
+
+#endif  /* ASN_DISABLE_JER_SUPPORT */
+
 int
 asn_REAL2double(const REAL_t *st, double *dbl_value) {
 	unsigned int octv;
@@ -865,7 +1015,7 @@ REAL_encode_oer(const asn_TYPE_descriptor_t *td,
 
     /* Encode a fake REAL */
     len_len = oer_serialize_length(st->size, cb, app_key);
-    if(len_len < 0 || cb(st->buf, st->size, app_key) < 0) {
+    if(len_len < 0 || ASN__E_cbc(st->buf, st->size)) {
         ASN__ENCODE_FAILED;
     } else {
         er.encoded = len_len + st->size;
@@ -25,6 +25,8 @@ per_type_decoder_f REAL_decode_uper;
 per_type_encoder_f REAL_encode_uper;
 xer_type_decoder_f REAL_decode_xer;
 xer_type_encoder_f REAL_encode_xer;
+jer_type_decoder_f REAL_decode_jer;
+jer_type_encoder_f REAL_encode_jer;
 asn_random_fill_f  REAL_random_fill;
 
 #define REAL_free          ASN__PRIMITIVE_TYPE_free,
@@ -37,6 +39,8 @@ asn_random_fill_f  REAL_random_fill;
  ***********************************/
 
 ssize_t REAL__dump(double d, int canonical, asn_app_consume_bytes_f *cb, void *app_key);
+/* The JER variant: a number, or one of "NaN", "INF", "-INF", "-0" */
+ssize_t REAL__jer_dump(double d, asn_app_consume_bytes_f *cb, void *app_key);
 
 /*
  * Convert between native double type and REAL representation (DER).
@@ -20,10 +20,18 @@ asn_TYPE_operation_t asn_OP_RELATIVE_OID = {
 	ASN__PRIMITIVE_TYPE_free,
 	RELATIVE_OID_print,
 	OCTET_STRING_compare,   /* Implemented in terms of opaque comparison */
+	ASN__PRIMITIVE_TYPE_copy,
 	ber_decode_primitive,
 	der_encode_primitive,
 	RELATIVE_OID_decode_xer,
 	RELATIVE_OID_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	RELATIVE_OID_decode_jer,
+	RELATIVE_OID_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef	ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
@@ -80,7 +88,7 @@ RELATIVE_OID__dump_body(const RELATIVE_OID_t *st, asn_app_consume_bytes_f *cb, v
             produced += ret;
             off += rd;
             assert(off <= st->size);
-            if(cb(scratch, ret, app_key) < 0) return -1;
+            if(ASN__E_cbc(scratch, ret)) return -1;
         }
     }
 
@@ -101,16 +109,16 @@ RELATIVE_OID_print(const asn_TYPE_descriptor_t *td, const void *sptr,
 	(void)ilevel;	/* Unused argument */
 
 	if(!st || !st->buf)
-		return (cb("<absent>", 8, app_key) < 0) ? -1 : 0;
+		return ASN__E_cbc("<absent>", 8) ? -1 : 0;
 
 	/* Dump preamble */
-	if(cb("{ ", 2, app_key) < 0)
+	if(ASN__E_cbc("{ ", 2))
 		return -1;
 
 	if(RELATIVE_OID__dump_body(st, cb, app_key) < 0)
 		return -1;
 
-	return (cb(" }", 2, app_key) < 0) ? -1 : 0;
+	return ASN__E_cbc(" }", 2) ? -1 : 0;
 }
 
 static enum xer_pbd_rval
@@ -185,6 +193,71 @@ RELATIVE_OID_encode_xer(const asn_TYPE_descriptor_t *td, const void *sptr,
 	ASN__ENCODED_OK(er);
 }
 
+#ifndef ASN_DISABLE_JER_SUPPORT
+
+/*
+ * The JER string contains the same dotted text as the XER body.
+ */
+static enum jer_pbd_rval
+RELATIVE_OID__jer_body_decode(const asn_TYPE_descriptor_t *td, void *sptr,
+                               pjer_chunk_type_e chunk_type, const void *chunk_buf,
+                               size_t chunk_size) {
+	const char *contents;
+	void *to_free;
+	ssize_t len;
+	enum xer_pbd_rval ret;
+
+	if(chunk_type != PJER_STRING) return JPBD_BROKEN_ENCODING;
+
+	len = jer_string_contents(chunk_buf, chunk_size, &contents, &to_free);
+	if(len < 0) return JPBD_BROKEN_ENCODING;
+	ret = RELATIVE_OID__xer_body_decode(td, sptr, contents, len);
+	if(to_free) FREEMEM(to_free);
+
+	switch(ret) {
+	case XPBD_SYSTEM_FAILURE:	return JPBD_SYSTEM_FAILURE;
+	case XPBD_DECODER_LIMIT:	return JPBD_DECODER_LIMIT;
+	case XPBD_BODY_CONSUMED:	return JPBD_BODY_CONSUMED;
+	default:			return JPBD_BROKEN_ENCODING;
+	}
+}
+
+asn_dec_rval_t
+RELATIVE_OID_decode_jer(const asn_codec_ctx_t *opt_codec_ctx,
+                         const asn_TYPE_descriptor_t *td, void **sptr,
+                         const void *buf_ptr, size_t size) {
+    return jer_decode_primitive(opt_codec_ctx, td,
+		sptr, sizeof(RELATIVE_OID_t),
+			buf_ptr, size, RELATIVE_OID__jer_body_decode);
+}
+
+asn_enc_rval_t
+RELATIVE_OID_encode_jer(const asn_TYPE_descriptor_t *td, const void *sptr,
+                         int ilevel, enum jer_encoder_flags_e flags,
+                         asn_app_consume_bytes_f *cb, void *app_key) {
+    const RELATIVE_OID_t *st = (const RELATIVE_OID_t *)sptr;
+	asn_enc_rval_t er = {0, 0, 0};
+	ssize_t ret;
+
+	(void)ilevel;	/* Unused argument */
+	(void)flags;	/* Unused argument */
+
+	if(!st || !st->buf)
+		ASN__ENCODE_FAILED;
+
+	ASN__CALLBACK("\"", 1);
+	ret = RELATIVE_OID__dump_body(st, cb, app_key);
+	if(ret < 0) ASN__ENCODE_FAILED;
+	er.encoded += ret;
+	ASN__CALLBACK("\"", 1);
+
+	ASN__ENCODED_OK(er);
+cb_failed:
+	ASN__ENCODE_FAILED;
+}
+
+#endif  /* ASN_DISABLE_JER_SUPPORT */
+
 ssize_t
 RELATIVE_OID_get_arcs(const RELATIVE_OID_t *st, asn_oid_arc_t *arcs,
                       size_t arcs_count) {
@@ -20,6 +20,8 @@ extern asn_TYPE_operation_t asn_OP_RELATIVE_OID;
 asn_struct_print_f RELATIVE_OID_print;
 xer_type_decoder_f RELATIVE_OID_decode_xer;
 xer_type_encoder_f RELATIVE_OID_encode_xer;
+jer_type_decoder_f RELATIVE_OID_decode_jer;
+jer_type_encoder_f RELATIVE_OID_encode_jer;
 asn_random_fill_f  RELATIVE_OID_random_fill;
 
 #define RELATIVE_OID_free         ASN__PRIMITIVE_TYPE_free
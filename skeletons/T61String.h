@@ -24,6 +24,8 @@ extern asn_TYPE_operation_t asn_OP_T61String;
 #define T61String_encode_der    OCTET_STRING_encode_der
 #define T61String_decode_xer    OCTET_STRING_decode_xer_hex
 #define T61String_encode_xer    OCTET_STRING_encode_xer
+#define T61String_decode_jer    OCTET_STRING_decode_jer_hex
+#define T61String_encode_jer    OCTET_STRING_encode_jer
 #define T61String_decode_uper   OCTET_STRING_decode_uper
 #define T61String_encode_uper   OCTET_STRING_encode_uper
 
@@ -24,6 +24,8 @@ extern asn_TYPE_operation_t asn_OP_TeletexString;
 #define TeletexString_encode_der    OCTET_STRING_encode_der
 #define TeletexString_decode_xer    OCTET_STRING_decode_xer_hex
 #define TeletexString_encode_xer    OCTET_STRING_encode_xer
+#define TeletexString_decode_jer    OCTET_STRING_decode_jer_hex
+#define TeletexString_encode_jer    OCTET_STRING_encode_jer
 #define TeletexString_decode_uper   OCTET_STRING_decode_uper
 #define TeletexString_encode_uper   OCTET_STRING_encode_uper
 
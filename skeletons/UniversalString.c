@@ -27,10 +27,18 @@ asn_TYPE_operation_t asn_OP_UniversalString = {
 	OCTET_STRING_free,
 	UniversalString_print,      /* Convert into UTF8 and print */
 	OCTET_STRING_compare,
+	OCTET_STRING_copy,
 	OCTET_STRING_decode_ber,
 	OCTET_STRING_encode_der,
 	UniversalString_decode_xer,	/* Convert from UTF-8 */
 	UniversalString_encode_xer,	/* Convert into UTF-8 */
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	UniversalString_decode_jer,
+	UniversalString_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef	ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
@@ -103,7 +111,7 @@ UniversalString__dump(const UniversalString_t *st,
 				|  ch[3];	/* 4 bytes */
 		if(sizeof(scratch) - (p - scratch) < 6) {
 			wrote += p - scratch;
-			if(cb(scratch, p - scratch, app_key) < 0)
+			if(ASN__E_cbc(scratch, p - scratch))
 				return -1;
 			p = scratch;
 		}
@@ -138,66 +146,70 @@ UniversalString__dump(const UniversalString_t *st,
 	}
 
 	wrote += p - scratch;
-	if(cb(scratch, p - scratch, app_key) < 0)
+	if(ASN__E_cbc(scratch, p - scratch))
 		return -1;
 
 	return wrote;
 }
 
-asn_dec_rval_t
-UniversalString_decode_xer(const asn_codec_ctx_t *opt_codec_ctx,
-                           const asn_TYPE_descriptor_t *td, void **sptr,
-                           const char *opt_mname, const void *buf_ptr,
-                           size_t size) {
-    asn_dec_rval_t rc;
-
-	rc = OCTET_STRING_decode_xer_utf8(opt_codec_ctx, td, sptr, opt_mname,
-		buf_ptr, size);
-	if(rc.code == RC_OK) {
-		/*
-		 * Now we have a whole string in UTF-8 format.
-		 * Convert it into UCS-4.
-		 */
-		uint32_t *wcs;
-		size_t wcs_len;
-		UTF8String_t *st;
+/*
+ * Convert the decoded UTF-8 string into UCS-4, in place.
+ */
+static int
+UniversalString__from_utf8(UniversalString_t *st) {
+	uint32_t *wcs;
+	size_t wcs_len;
 #ifndef	WORDS_BIGENDIAN
-		int little_endian = 1;
+	int little_endian = 1;
 #endif
 
-		assert(*sptr);
-		st = (UTF8String_t *)*sptr;
-		assert(st->buf);
-		wcs_len = UTF8String_to_wcs(st, 0, 0);
+	assert(st->buf);
+	wcs_len = UTF8String_to_wcs(st, 0, 0);
 
-		wcs = (uint32_t *)MALLOC(4 * (wcs_len + 1));
-		if(wcs == 0 || UTF8String_to_wcs(st, wcs, wcs_len) != wcs_len) {
-			rc.code = RC_FAIL;
-			rc.consumed = 0;
-			return rc;
-		} else {
-			wcs[wcs_len] = 0;	/* nul-terminate */
-		}
+	wcs = (uint32_t *)MALLOC(4 * (wcs_len + 1));
+	if(wcs == 0 || UTF8String_to_wcs(st, wcs, wcs_len) != wcs_len) {
+		if(wcs) FREEMEM(wcs);
+		return -1;
+	} else {
+		wcs[wcs_len] = 0;	/* nul-terminate */
+	}
 
 #ifndef	WORDS_BIGENDIAN
-		if(*(char *)&little_endian) {
-			/* Swap byte order in encoding */
-			uint32_t *wc = wcs;
-			uint32_t *wc_end = wcs + wcs_len;
-			for(; wc < wc_end; wc++) {
-				/* *wc = htonl(*wc); */
-				uint32_t wch = *wc;
-				*((uint8_t *)wc + 0) = wch >> 24;
-				*((uint8_t *)wc + 1) = wch >> 16;
-				*((uint8_t *)wc + 2) = wch >> 8;
-				*((uint8_t *)wc + 3) = wch;
-			}
+	if(*(char *)&little_endian) {
+		/* Swap byte order in encoding */
+		uint32_t *wc = wcs;
+		uint32_t *wc_end = wcs + wcs_len;
+		for(; wc < wc_end; wc++) {
+			/* *wc = htonl(*wc); */
+			uint32_t wch = *wc;
+			*((uint8_t *)wc + 0) = wch >> 24;
+			*((uint8_t *)wc + 1) = wch >> 16;
+			*((uint8_t *)wc + 2) = wch >> 8;
+			*((uint8_t *)wc + 3) = wch;
 		}
+	}
 #endif	/* WORDS_BIGENDIAN */
 
-		FREEMEM(st->buf);
-		st->buf = (uint8_t *)wcs;
-		st->size = 4 * wcs_len;
+	FREEMEM(st->buf);
+	st->buf = (uint8_t *)wcs;
+	st->size = 4 * wcs_len;
+	return 0;
+}
+
+asn_dec_rval_t
+UniversalString_decode_xer(const asn_codec_ctx_t *opt_codec_ctx,
+                           const asn_TYPE_descriptor_t *td, void **sptr,
+                           const char *opt_mname, const void *buf_ptr,
+                           size_t size) {
+    asn_dec_rval_t rc;
+
+	rc = OCTET_STRING_decode_xer_utf8(opt_codec_ctx, td, sptr, opt_mname,
+		buf_ptr, size);
+	/* Now we have a whole string in UTF-8 format */
+	if(rc.code == RC_OK
+	&& UniversalString__from_utf8((UniversalString_t *)*sptr)) {
+		rc.code = RC_FAIL;
+		rc.consumed = 0;
 	}
 	return rc;
 }
@@ -221,6 +233,53 @@ UniversalString_encode_xer(const asn_TYPE_descriptor_t *td, const void *sptr,
 	ASN__ENCODED_OK(er);
 }
 
+#ifndef ASN_DISABLE_JER_SUPPORT
+
+asn_dec_rval_t
+UniversalString_decode_jer(const asn_codec_ctx_t *opt_codec_ctx,
+                            const asn_TYPE_descriptor_t *td, void **sptr,
+                            const void *buf_ptr, size_t size) {
+    asn_dec_rval_t rc;
+
+	rc = OCTET_STRING_decode_jer_utf8(opt_codec_ctx, td, sptr, buf_ptr, size);
+	if(rc.code == RC_OK && UniversalString__from_utf8((UniversalString_t *)*sptr)) {
+		rc.code = RC_FAIL;
+		rc.consumed = 0;
+	}
+	return rc;
+}
+
+asn_enc_rval_t
+UniversalString_encode_jer(const asn_TYPE_descriptor_t *td, const void *sptr,
+                            int ilevel, enum jer_encoder_flags_e flags,
+                            asn_app_consume_bytes_f *cb, void *app_key) {
+    const UniversalString_t *st = (const UniversalString_t *)sptr;
+	struct jer_escape_key_s key;
+	asn_enc_rval_t er = {0, 0, 0};
+
+	(void)ilevel;
+	(void)flags;
+
+	if(!st || !st->buf)
+		ASN__ENCODE_FAILED;
+
+	key.cb = cb;
+	key.app_key = app_key;
+	key.wrote = 0;
+
+	ASN__CALLBACK("\"", 1);
+	if(UniversalString__dump(st, jer_escape_cb, &key) < 0)
+		ASN__ENCODE_FAILED;
+	er.encoded += key.wrote;
+	ASN__CALLBACK("\"", 1);
+
+	ASN__ENCODED_OK(er);
+cb_failed:
+	ASN__ENCODE_FAILED;
+}
+
+#endif  /* ASN_DISABLE_JER_SUPPORT */
+
 int
 UniversalString_print(const asn_TYPE_descriptor_t *td, const void *sptr,
                       int ilevel, asn_app_consume_bytes_f *cb, void *app_key) {
@@ -229,7 +288,7 @@ UniversalString_print(const asn_TYPE_descriptor_t *td, const void *sptr,
 	(void)td;	/* Unused argument */
 	(void)ilevel;	/* Unused argument */
 
-	if(!st || !st->buf) return (cb("<absent>", 8, app_key) < 0) ? -1 : 0;
+	if(!st || !st->buf) return ASN__E_cbc("<absent>", 8) ? -1 : 0;
 
 	if(UniversalString__dump(st, cb, app_key) < 0)
 		return -1;
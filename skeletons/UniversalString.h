@@ -21,6 +21,8 @@ asn_struct_print_f UniversalString_print;	/* Human-readable output */
 asn_constr_check_f UniversalString_constraint;
 xer_type_decoder_f UniversalString_decode_xer;
 xer_type_encoder_f UniversalString_encode_xer;
+jer_type_decoder_f UniversalString_decode_jer;
+jer_type_encoder_f UniversalString_encode_jer;
 
 #define UniversalString_free            OCTET_STRING_free
 #define UniversalString_compare         OCTET_STRING_compare
@@ -26,6 +26,8 @@ asn_constr_check_f VisibleString_constraint;
 #define VisibleString_encode_der    OCTET_STRING_encode_der
 #define VisibleString_decode_xer    OCTET_STRING_decode_xer_hex
 #define VisibleString_encode_xer    OCTET_STRING_encode_xer
+#define VisibleString_decode_jer    OCTET_STRING_decode_jer_utf8
+#define VisibleString_encode_jer    OCTET_STRING_encode_jer_utf8
 #define VisibleString_decode_uper   OCTET_STRING_decode_uper
 #define VisibleString_encode_uper   OCTET_STRING_encode_uper
 
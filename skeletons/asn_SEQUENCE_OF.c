@@ -4,6 +4,7 @@
  */
 #include <asn_internal.h>
 #include <asn_SEQUENCE_OF.h>
+#include <errno.h>
 
 typedef A_SEQUENCE_OF(void) asn_sequence;
 
@@ -39,3 +40,58 @@ asn_sequence_del(void *asn_sequence_of_x, int number, int _do_free) {
 	}
 }
 
+int
+asn_sequence_values_reserve(void *list, size_t value_size, int size) {
+	asn_anonymous_sequence_values_ *as = _A_SEQUENCE_VALUES_FROM_VOID(list);
+
+	if(as == 0 || size < 0 || value_size == 0) {
+		errno = EINVAL;		/* Invalid arguments */
+		return -1;
+	}
+
+	if(size > as->size) {
+		void *_new_arr;
+		if((size_t)size > SIZE_MAX / value_size) {
+			errno = ENOMEM;
+			return -1;
+		}
+		_new_arr = REALLOC(as->array, (size_t)size * value_size);
+		if(_new_arr) {
+			as->array = _new_arr;
+			as->size = size;
+		} else {
+			/* ENOMEM */
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+int
+asn_sequence_values_grow(void *list, size_t value_size) {
+	asn_anonymous_sequence_values_ *as = _A_SEQUENCE_VALUES_FROM_VOID(list);
+
+	if(as && as->count == as->size) {
+		if(as->size > INT_MAX / 2) {
+			errno = ENOMEM;
+			return -1;
+		}
+		return asn_sequence_values_reserve(as, value_size,
+			as->size ? (as->size << 1) : 4);
+	}
+
+	return as ? 0 : -1;
+}
+
+void
+asn_sequence_values_empty(void *list) {
+	asn_anonymous_sequence_values_ *as = _A_SEQUENCE_VALUES_FROM_VOID(list);
+
+	if(as) {
+		FREEMEM(as->array);
+		as->array = 0;
+		as->count = 0;
+		as->size = 0;
+	}
+}
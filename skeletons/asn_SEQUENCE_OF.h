@@ -26,6 +26,7 @@ extern "C" {
  */
 
 #define	asn_sequence_add	asn_set_add
+#define	asn_sequence_reserve	asn_set_reserve
 #define	asn_sequence_empty	asn_set_empty
 
 /*
@@ -45,6 +46,48 @@ typedef A_SEQUENCE_OF(void) asn_anonymous_sequence_;
 #define _A_SEQUENCE_FROM_VOID(ptr)	((asn_anonymous_sequence_ *)(ptr))
 #define _A_CSEQUENCE_FROM_VOID(ptr) 	((const asn_anonymous_sequence_ *)(ptr))
 
+/*
+ * SEQUENCE OF the simple values kept in place rather than by pointer
+ * (-fpacked-sequence-of), see constr_SEQUENCE_OF_packed.h.
+ * The (count) is where it is in A_SEQUENCE_OF().
+ */
+#define A_SEQUENCE_OF_VALUES(type)       \
+    struct {                             \
+        type *array;                     \
+        int count; /* Meaningful size */ \
+        int size;  /* Allocated size */  \
+    }
+
+#define	ASN_SEQUENCE_VALUES_ADD(headptr, value)				\
+	(asn_sequence_values_grow((headptr), sizeof((headptr)->array[0]))	\
+		? -1 : ((headptr)->array[(headptr)->count++] = (value), 0))
+
+/*
+ * Make room for at least (size) values of (value_size) bytes each,
+ * allocating no more than that.
+ * RETURN VALUES:
+ * 0 for success and -1/errno for failure.
+ */
+int asn_sequence_values_reserve(void *list, size_t value_size, int size);
+
+/*
+ * Make room for one more value, growing the array geometrically.
+ * RETURN VALUES:
+ * 0 for success and -1/errno for failure.
+ */
+int asn_sequence_values_grow(void *list, size_t value_size);
+
+/*
+ * Release the array of values and make the list empty.
+ */
+void asn_sequence_values_empty(void *list);
+
+typedef A_SEQUENCE_OF_VALUES(void) asn_anonymous_sequence_values_;
+#define _A_SEQUENCE_VALUES_FROM_VOID(ptr)	\
+	((asn_anonymous_sequence_values_ *)(ptr))
+#define _A_CSEQUENCE_VALUES_FROM_VOID(ptr)	\
+	((const asn_anonymous_sequence_values_ *)(ptr))
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,20 +22,40 @@ asn_set_add(void *asn_set_of_x, void *ptr) {
 	 * Make sure there's enough space to insert an element.
 	 */
 	if(as->count == as->size) {
-		int _newsize = as->size ? (as->size << 1) : 4;
+		if(as->size > INT_MAX / 2) {
+			errno = ENOMEM;
+			return -1;
+		}
+		if(asn_set_reserve(as, as->size ? (as->size << 1) : 4))
+			return -1;
+	}
+
+	as->array[as->count++] = ptr;
+
+	return 0;
+}
+
+int
+asn_set_reserve(void *asn_set_of_x, int size) {
+	asn_anonymous_set_ *as = _A_SET_FROM_VOID(asn_set_of_x);
+
+	if(as == 0 || size < 0) {
+		errno = EINVAL;		/* Invalid arguments */
+		return -1;
+	}
+
+	if(size > as->size) {
 		void *_new_arr;
-		_new_arr = REALLOC(as->array, _newsize * sizeof(as->array[0]));
+		_new_arr = REALLOC(as->array, size * sizeof(as->array[0]));
 		if(_new_arr) {
 			as->array = (void **)_new_arr;
-			as->size = _newsize;
+			as->size = size;
 		} else {
 			/* ENOMEM */
 			return -1;
 		}
 	}
 
-	as->array[as->count++] = ptr;
-
 	return 0;
 }
 
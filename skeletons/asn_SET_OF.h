@@ -41,6 +41,14 @@ extern "C" {
  */
 int  asn_set_add(void *asn_set_of_x, void *ptr);
 
+/*
+ * Make room for at least (size) elements, so that adding up to that many
+ * will not reallocate the array of pointers.
+ * RETURN VALUES:
+ * 0 for success and -1/errno for failure.
+ */
+int  asn_set_reserve(void *asn_set_of_x, int size);
+
 /*
  * Delete the element from the set by its number (base 0).
  * This is a constant-time operation. The order of elements before the
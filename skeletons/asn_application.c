@@ -10,109 +10,134 @@ static asn_enc_rval_t asn_encode_internal(const asn_codec_ctx_t *opt_codec_ctx,
                                           enum asn_transfer_syntax syntax,
                                           const asn_TYPE_descriptor_t *td,
                                           const void *sptr,
-                                          asn_app_consume_bytes_f *callback,
-                                          void *callback_key);
+                                          asn_output_buffer_t *ob);
+static asn_enc_rval_t asn_encode_syntax(enum asn_transfer_syntax syntax,
+                                        const asn_TYPE_descriptor_t *td,
+                                        const void *sptr,
+                                        asn_output_buffer_t *ob);
+static asn_dec_rval_t asn_decode_syntax(const asn_codec_ctx_t *opt_codec_ctx,
+                                        enum asn_transfer_syntax syntax,
+                                        const asn_TYPE_descriptor_t *td,
+                                        void **sptr, const void *buffer,
+                                        size_t size);
 
 
-struct callback_count_bytes_key {
-    asn_app_consume_bytes_f *callback;
-    void *callback_key;
-    size_t computed_size;
-};
+/*
+ * The room of the asn_encode() output buffer, taken from the stack.
+ */
+#define ASN_ENCODE_OUTPUT_BUFFER_SIZE 1024
 
 /*
- * Encoder which just counts bytes that come through it.
+ * Hand the buffered bytes over to the callback, and pass the bytes
+ * which do not fit into the emptied buffer along.
  */
 static int
-callback_count_bytes_cb(const void *data, size_t size, void *keyp) {
-    struct callback_count_bytes_key *key = keyp;
-    int ret;
+callback_overflow(asn_output_buffer_t *ob, const void *data, size_t size) {
+    if(asn_output_buffer_flush(ob) < 0) return -1;
 
-    ret = key->callback(data, size, key->callback_key);
-    if(ret >= 0) {
-        key->computed_size += size;
+    if(size < ob->size) {
+        memcpy(ob->buffer, data, size);
+        ob->length = size;
+    } else {
+        if(ob->callback(data, size, ob->callback_key) < 0) return -1;
+        ob->offset += size;
     }
 
-    return ret;
+    return 0;
 }
 
-struct overrun_encoder_key {
-    void *buffer;
-    size_t buffer_size;
-    size_t computed_size;
-};
-
-struct dynamic_encoder_key {
-    void *buffer;
-    size_t buffer_size;
-    size_t computed_size;
-};
-
-struct callback_failure_catch_key {
-    asn_app_consume_bytes_f *callback;
-    void *callback_key;
-    int callback_failed;
-};
-
 /*
- * Encoder which doesn't stop counting bytes
- * even if it reaches the end of the buffer.
+ * The buffer is the destination which doesn't stop counting bytes
+ * even if it reaches its end.
  */
 static int
-overrun_encoder_cb(const void *data, size_t size, void *keyp) {
-    struct overrun_encoder_key *key = keyp;
-
-    if(key->computed_size + size > key->buffer_size) {
+overrun_overflow(asn_output_buffer_t *ob, const void *data, size_t size) {
+    if(ob->length + size > ob->size) {
         /*
          * Avoid accident on the next call:
          * stop adding bytes to the buffer.
          */
-        key->buffer_size = 0;
-    } else {
-        memcpy((char *)key->buffer + key->computed_size, data, size);
+        ob->size = ob->length;
+        ob->offset += size;
+    } else if(size) {
+        memcpy(ob->buffer + ob->length, data, size);
+        ob->length += size;
     }
-    key->computed_size += size;
 
     return 0;
 }
 
 /*
- * Encoder which dynamically allocates output, and continues
- * to count even if allocation failed.
+ * The buffer is the dynamically allocated destination, which continues
+ * to count even if allocation failed. There is always a room
+ * for the terminating 0.
  */
 static int
-dynamic_encoder_cb(const void *data, size_t size, void *keyp) {
-    struct dynamic_encoder_key *key = keyp;
-
-    if(key->buffer) {
-        if(key->computed_size + size >= key->buffer_size) {
-            void *p;
-            size_t new_size = key->buffer_size;
-
-            do {
-                new_size *= 2;
-            } while(new_size <= key->computed_size + size);
-
-            p = REALLOC(key->buffer, new_size);
-            if(p) {
-                key->buffer = p;
-                key->buffer_size = new_size;
-            } else {
-                FREEMEM(key->buffer);
-                key->buffer = 0;
-                key->buffer_size = 0;
-                key->computed_size += size;
-                return 0;
-            }
+dynamic_overflow(asn_output_buffer_t *ob, const void *data, size_t size) {
+    if(ob->buffer) {
+        void *p;
+        size_t new_size = ob->size;
+
+        do {
+            new_size *= 2;
+        } while(new_size <= ob->length + size);
+
+        p = REALLOC(ob->buffer, new_size);
+        if(p) {
+            ob->buffer = p;
+            ob->size = new_size;
+            memcpy(ob->buffer + ob->length, data, size);
+            ob->length += size;
+            return 0;
         }
-        memcpy((char *)key->buffer + key->computed_size, data, size);
+        FREEMEM(ob->buffer);
+        ob->buffer = 0;
+        ob->size = 0;
+        ob->offset += ob->length;
+        ob->length = 0;
     }
 
-    key->computed_size += size;
+    ob->offset += size;
+
+    return 0;
+}
+
+void
+asn_output_buffer_init(asn_output_buffer_t *ob, void *buffer,
+                       size_t buffer_size, asn_app_consume_bytes_f *callback,
+                       void *callback_key) {
+    ob->buffer = buffer;
+    ob->size = buffer_size;
+    ob->length = 0;
+    ob->offset = 0;
+    ob->overflow = callback ? callback_overflow : overrun_overflow;
+    ob->callback = callback;
+    ob->callback_key = callback_key;
+}
+
+int
+asn_output_buffer_consume_bytes(const void *data, size_t size, void *key) {
+    asn_output_buffer_t *ob = key;
+    return ASN__OUTPUT_BUFFER_PUT(ob, data, size);
+}
 
+int
+asn_output_buffer_flush(asn_output_buffer_t *ob) {
+    if(ob->length && ob->callback) {
+        if(ob->callback(ob->buffer, ob->length, ob->callback_key) < 0)
+            return -1;
+        ob->offset += ob->length;
+        ob->length = 0;
+    }
     return 0;
 }
 
+struct callback_failure_catch_key {
+    asn_app_consume_bytes_f *callback;
+    void *callback_key;
+    int callback_failed;
+};
+
 /*
  * Encoder which help convert the application level encoder failure into EIO.
  */
@@ -134,6 +159,9 @@ asn_encode(const asn_codec_ctx_t *opt_codec_ctx,
            enum asn_transfer_syntax syntax, const asn_TYPE_descriptor_t *td,
            const void *sptr, asn_app_consume_bytes_f *callback, void *callback_key) {
     struct callback_failure_catch_key cb_key;
+    uint8_t scratch[ASN_ENCODE_OUTPUT_BUFFER_SIZE];
+    asn_output_buffer_t ob;
+    const asn_allocator_t *saved_allocator;
     asn_enc_rval_t er;
 
     if(!callback) {
@@ -144,12 +172,19 @@ asn_encode(const asn_codec_ctx_t *opt_codec_ctx,
     cb_key.callback = callback;
     cb_key.callback_key = callback_key;
     cb_key.callback_failed = 0;
-
-    er = asn_encode_internal(opt_codec_ctx, syntax, td, sptr,
-                             callback_failure_catch_cb, &cb_key);
+    asn_output_buffer_init(&ob, scratch, sizeof(scratch),
+                           callback_failure_catch_cb, &cb_key);
+
+    saved_allocator = asn__allocator_enter(opt_codec_ctx);
+    er = asn_encode_internal(opt_codec_ctx, syntax, td, sptr, &ob);
+    asn__allocator_leave(saved_allocator);
+    if(er.encoded >= 0 && asn_output_buffer_flush(&ob) < 0) {
+        er.encoded = -1;
+        er.failed_type = td;
+        er.structure_ptr = sptr;
+    }
     if(cb_key.callback_failed) {
         assert(er.encoded == -1);
-        assert(errno == EBADF);
         errno = EIO;
     }
 
@@ -161,7 +196,8 @@ asn_encode_to_buffer(const asn_codec_ctx_t *opt_codec_ctx,
                      enum asn_transfer_syntax syntax,
                      const asn_TYPE_descriptor_t *td, const void *sptr,
                      void *buffer, size_t buffer_size) {
-    struct overrun_encoder_key buf_key;
+    asn_output_buffer_t ob;
+    const asn_allocator_t *saved_allocator;
     asn_enc_rval_t er;
 
     if(buffer_size > 0 && !buffer) {
@@ -169,18 +205,20 @@ asn_encode_to_buffer(const asn_codec_ctx_t *opt_codec_ctx,
         ASN__ENCODE_FAILED;
     }
 
-    buf_key.buffer = buffer;
-    buf_key.buffer_size = buffer_size;
-    buf_key.computed_size = 0;
+    /* Encode straight into the buffer */
+    asn_output_buffer_init(&ob, buffer, buffer_size, 0, 0);
 
-    er = asn_encode_internal(opt_codec_ctx, syntax, td, sptr,
-                             overrun_encoder_cb, &buf_key);
+    saved_allocator = asn__allocator_enter(opt_codec_ctx);
+    er = asn_encode_internal(opt_codec_ctx, syntax, td, sptr, &ob);
+    asn__allocator_leave(saved_allocator);
 
-    if(er.encoded >= 0 && (size_t)er.encoded != buf_key.computed_size) {
+    if(er.encoded >= 0
+       && (size_t)er.encoded != ASN_OUTPUT_BUFFER_WRITTEN(&ob)) {
         ASN_DEBUG("asn_encode() returned %" ASN_PRI_SSIZE
                   " yet produced %" ASN_PRI_SIZE " bytes",
-                  er.encoded, buf_key.computed_size);
-        assert(er.encoded < 0 || (size_t)er.encoded == buf_key.computed_size);
+                  er.encoded, ASN_OUTPUT_BUFFER_WRITTEN(&ob));
+        assert(er.encoded < 0
+               || (size_t)er.encoded == ASN_OUTPUT_BUFFER_WRITTEN(&ob));
     }
 
     return er;
@@ -190,45 +228,173 @@ asn_encode_to_new_buffer_result_t
 asn_encode_to_new_buffer(const asn_codec_ctx_t *opt_codec_ctx,
                          enum asn_transfer_syntax syntax,
                          const asn_TYPE_descriptor_t *td, const void *sptr) {
-    struct dynamic_encoder_key buf_key;
+    asn_output_buffer_t ob;
     asn_encode_to_new_buffer_result_t res;
+    const asn_allocator_t *saved_allocator;
+    size_t buffer_size = 16;
 
-    buf_key.buffer_size = 16;
-    buf_key.buffer = MALLOC(buf_key.buffer_size);
-    buf_key.computed_size = 0;
+    /* The buffer is allocated using the context's allocator, too */
+    saved_allocator = asn__allocator_enter(opt_codec_ctx);
+    asn_output_buffer_init(&ob, MALLOC(buffer_size), buffer_size, 0, 0);
+    if(!ob.buffer) ob.size = 0;
+    ob.overflow = dynamic_overflow;
 
-    res.result = asn_encode_internal(opt_codec_ctx, syntax, td, sptr,
-                                     dynamic_encoder_cb, &buf_key);
+    res.result = asn_encode_internal(opt_codec_ctx, syntax, td, sptr, &ob);
+    asn__allocator_leave(saved_allocator);
 
     if(res.result.encoded >= 0
-       && (size_t)res.result.encoded != buf_key.computed_size) {
+       && (size_t)res.result.encoded != ASN_OUTPUT_BUFFER_WRITTEN(&ob)) {
         ASN_DEBUG("asn_encode() returned %" ASN_PRI_SSIZE
                   " yet produced %" ASN_PRI_SIZE " bytes",
-                  res.result.encoded, buf_key.computed_size);
+                  res.result.encoded, ASN_OUTPUT_BUFFER_WRITTEN(&ob));
         assert(res.result.encoded < 0
-               || (size_t)res.result.encoded == buf_key.computed_size);
+               || (size_t)res.result.encoded
+                      == ASN_OUTPUT_BUFFER_WRITTEN(&ob));
     }
 
-    res.buffer = buf_key.buffer;
+    res.buffer = ob.buffer;
 
     /* 0-terminate just in case. */
     if(res.buffer) {
-        assert(buf_key.computed_size < buf_key.buffer_size);
-        ((char *)res.buffer)[buf_key.computed_size] = '\0';
+        assert(ob.length < ob.size);
+        ((char *)res.buffer)[ob.length] = '\0';
     }
 
     return res;
 }
 
+static ssize_t
+asn_encoded_size_internal(enum asn_transfer_syntax syntax,
+                          const asn_TYPE_descriptor_t *td, const void *sptr,
+                          int cache_sizes) {
+    int saved_cache_sizes;
+    size_t counted = 0;
+    asn_enc_rval_t er;
+
+    if(!td || !sptr) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    saved_cache_sizes = asn__encode_cache_sizes;
+    asn__encode_cache_sizes = cache_sizes;
+
+    switch(syntax) {
+    case ATS_BER:
+    case ATS_DER:
+        if(!td->op->der_encoder) {
+            errno = ENOENT; /* Transfer syntax is not defined for this type. */
+            er.encoded = -1;
+            break;
+        }
+        /* Sized without the output */
+        er = der_encode(td, sptr, 0, 0);
+        if(er.encoded == -1) {
+            if(er.failed_type && er.failed_type->op->der_encoder) {
+                errno = EBADF;  /* Structure has incorrect form. */
+            } else {
+                errno = ENOENT; /* DER is not defined for this type. */
+            }
+        }
+        break;
+#ifndef ASN_DISABLE_OER_SUPPORT
+    case ATS_BASIC_OER:
+    case ATS_CANONICAL_OER:
+        if(!td->op->oer_encoder) {
+            errno = ENOENT; /* Transfer syntax is not defined for this type. */
+            er.encoded = -1;
+            break;
+        }
+        er = oer_encode(td, sptr, asn__count_bytes, &counted);
+        if(er.encoded == -1) {
+            if(er.failed_type && er.failed_type->op->oer_encoder) {
+                errno = EBADF;  /* Structure has incorrect form. */
+            } else {
+                errno = ENOENT; /* OER is not defined for this type. */
+            }
+        }
+        break;
+#endif /* ASN_DISABLE_OER_SUPPORT */
+#ifndef ASN_DISABLE_PER_SUPPORT
+    case ATS_UNALIGNED_BASIC_PER:
+    case ATS_UNALIGNED_CANONICAL_PER:
+        if(!td->op->uper_encoder) {
+            errno = ENOENT; /* Transfer syntax is not defined for this type. */
+            er.encoded = -1;
+            break;
+        }
+        /* Sized without the output */
+        er = uper_encode(td, 0, sptr, 0, 0);
+        if(er.encoded == -1) {
+            if(er.failed_type && er.failed_type->op->uper_encoder) {
+                errno = EBADF;  /* Structure has incorrect form. */
+            } else {
+                errno = ENOENT; /* UPER is not defined for this type. */
+            }
+        } else if(er.encoded == 0) {
+            er.encoded = 1; /* "Complete Encoding" of X.691 #11.1 */
+        } else {
+            er.encoded = (er.encoded + 7) >> 3;
+        }
+        break;
+#endif  /* ASN_DISABLE_PER_SUPPORT */
+    default:
+        /* Nothing to skip over: count the output of the encoder */
+        er = asn_encode(0, syntax, td, sptr, asn__count_bytes, &counted);
+        break;
+    }
+
+    asn__encode_cache_sizes = saved_cache_sizes;
+
+    return er.encoded;
+}
+
+ssize_t
+asn_encoded_size(enum asn_transfer_syntax syntax,
+                 const asn_TYPE_descriptor_t *td, const void *sptr) {
+    return asn_encoded_size_internal(syntax, td, sptr, 0);
+}
+
+ssize_t
+asn_encoded_size_cached(enum asn_transfer_syntax syntax,
+                        const asn_TYPE_descriptor_t *td, void *sptr) {
+    return asn_encoded_size_internal(syntax, td, sptr, 1);
+}
+
 static asn_enc_rval_t
 asn_encode_internal(const asn_codec_ctx_t *opt_codec_ctx,
                     enum asn_transfer_syntax syntax,
                     const asn_TYPE_descriptor_t *td, const void *sptr,
-                    asn_app_consume_bytes_f *callback, void *callback_key) {
+                    asn_output_buffer_t *ob) {
     asn_enc_rval_t er;
-    enum xer_encoder_flags_e xer_flags = XER_F_CANONICAL;
+    int saved_encode_constraints;
 
-    (void)opt_codec_ctx; /* Parameters are not checked on encode yet. */
+    if(!opt_codec_ctx || !opt_codec_ctx->check_constraints || !td || !sptr
+       || syntax == ATS_NONSTANDARD_PLAINTEXT) {
+        return asn_encode_syntax(syntax, td, sptr, ob);
+    }
+
+    /*
+     * Check the outermost value here, and its members
+     * as the encoders get to them.
+     */
+    saved_encode_constraints = asn__encode_constraints_enter(opt_codec_ctx);
+    if(asn__encode_check_type(td, sptr, &er) == 0) {
+        er = asn_encode_syntax(syntax, td, sptr, ob);
+    } else {
+        errno = EBADF; /* Content constraint failed. */
+    }
+    asn__encode_constraints_leave(saved_encode_constraints);
+
+    return er;
+}
+
+static asn_enc_rval_t
+asn_encode_syntax(enum asn_transfer_syntax syntax,
+                  const asn_TYPE_descriptor_t *td, const void *sptr,
+                  asn_output_buffer_t *ob) {
+    asn_enc_rval_t er;
+    enum xer_encoder_flags_e xer_flags = XER_F_CANONICAL;
 
     if(!td || !sptr) {
         errno = EINVAL;
@@ -238,20 +404,17 @@ asn_encode_internal(const asn_codec_ctx_t *opt_codec_ctx,
     switch(syntax) {
     case ATS_NONSTANDARD_PLAINTEXT:
         if(td->op->print_struct) {
-            struct callback_count_bytes_key cb_key;
-            cb_key.callback = callback;
-            cb_key.callback_key = callback_key;
-            cb_key.computed_size = 0;
-            if(td->op->print_struct(td, sptr, 1, callback_count_bytes_cb,
-                                    &cb_key)
+            size_t written = ASN_OUTPUT_BUFFER_WRITTEN(ob);
+            if(td->op->print_struct(td, sptr, 1,
+                                    asn_output_buffer_consume_bytes, ob)
                    < 0
-               || callback_count_bytes_cb("\n", 1, &cb_key) < 0) {
+               || ASN__OUTPUT_BUFFER_PUT(ob, "\n", 1) < 0) {
                 errno = EBADF; /* Structure has incorrect form. */
                 er.encoded = -1;
                 er.failed_type = td;
                 er.structure_ptr = sptr;
             } else {
-                er.encoded = cb_key.computed_size;
+                er.encoded = ASN_OUTPUT_BUFFER_WRITTEN(ob) - written;
                 er.failed_type = 0;
                 er.structure_ptr = 0;
             }
@@ -270,7 +433,7 @@ asn_encode_internal(const asn_codec_ctx_t *opt_codec_ctx,
         /* Fall through. */
     case ATS_DER:
         if(td->op->der_encoder) {
-            er = der_encode(td, sptr, callback, callback_key);
+            er = der_encode(td, sptr, asn_output_buffer_consume_bytes, ob);
             if(er.encoded == -1) {
                 if(er.failed_type && er.failed_type->op->der_encoder) {
                     errno = EBADF;  /* Structure has incorrect form. */
@@ -299,7 +462,7 @@ asn_encode_internal(const asn_codec_ctx_t *opt_codec_ctx,
         /* Fall through. */
     case ATS_CANONICAL_OER:
         if(td->op->oer_encoder) {
-            er = oer_encode(td, sptr, callback, callback_key);
+            er = oer_encode(td, sptr, asn_output_buffer_consume_bytes, ob);
             if(er.encoded == -1) {
                 if(er.failed_type && er.failed_type->op->oer_encoder) {
                     errno = EBADF;  /* Structure has incorrect form. */
@@ -326,7 +489,7 @@ asn_encode_internal(const asn_codec_ctx_t *opt_codec_ctx,
         /* Fall through. */
     case ATS_UNALIGNED_CANONICAL_PER:
         if(td->op->uper_encoder) {
-            er = uper_encode(td, 0, sptr, callback, callback_key);
+            er = uper_encode(td, 0, sptr, asn_output_buffer_consume_bytes, ob);
             if(er.encoded == -1) {
                 if(er.failed_type && er.failed_type->op->uper_encoder) {
                     errno = EBADF;  /* Structure has incorrect form. */
@@ -337,7 +500,7 @@ asn_encode_internal(const asn_codec_ctx_t *opt_codec_ctx,
                 ASN_DEBUG("Complete encoded in %ld bits", (long)er.encoded);
                 if(er.encoded == 0) {
                     /* Enforce "Complete Encoding" of X.691 #11.1 */
-                    if(callback("\0", 1, callback_key) < 0) {
+                    if(ASN__OUTPUT_BUFFER_PUT(ob, "\0", 1) < 0) {
                         errno = EBADF;
                         ASN__ENCODE_FAILED;
                     }
@@ -360,7 +523,7 @@ asn_encode_internal(const asn_codec_ctx_t *opt_codec_ctx,
         /* Fall through. */
     case ATS_CANONICAL_XER:
         if(td->op->xer_encoder) {
-            er = xer_encode(td, sptr, xer_flags, callback, callback_key);
+            er = xer_encode(td, sptr, xer_flags, asn_output_buffer_consume_bytes, ob);
             if(er.encoded == -1) {
                 if(er.failed_type && er.failed_type->op->xer_encoder) {
                     errno = EBADF;  /* Structure has incorrect form. */
@@ -374,6 +537,33 @@ asn_encode_internal(const asn_codec_ctx_t *opt_codec_ctx,
         }
         break;
 
+#ifdef  ASN_DISABLE_JER_SUPPORT
+    case ATS_JER:
+    case ATS_JER_MINIFIED:
+        errno = ENOENT; /* JER is not defined. */
+        ASN__ENCODE_FAILED;
+        break;
+#else /* ASN_DISABLE_JER_SUPPORT */
+    case ATS_JER:
+    case ATS_JER_MINIFIED:
+        if(td->op->jer_encoder) {
+            er = jer_encode(td, sptr,
+                            syntax == ATS_JER ? JER_F_BASIC : JER_F_MINIFIED,
+                            asn_output_buffer_consume_bytes, ob);
+            if(er.encoded == -1) {
+                if(er.failed_type && er.failed_type->op->jer_encoder) {
+                    errno = EBADF;  /* Structure has incorrect form. */
+                } else {
+                    errno = ENOENT; /* JER is not defined for this type. */
+                }
+            }
+        } else {
+            errno = ENOENT; /* Transfer syntax is not defined for this type. */
+            ASN__ENCODE_FAILED;
+        }
+        break;
+#endif /* ASN_DISABLE_JER_SUPPORT */
+
     default:
         errno = ENOENT;
         ASN__ENCODE_FAILED;
@@ -386,6 +576,35 @@ asn_dec_rval_t
 asn_decode(const asn_codec_ctx_t *opt_codec_ctx,
            enum asn_transfer_syntax syntax, const asn_TYPE_descriptor_t *td,
            void **sptr, const void *buffer, size_t size) {
+    asn_dec_rval_t rval;
+    int saved_decode_constraints;
+
+    rval = asn_decode_syntax(opt_codec_ctx, syntax, td, sptr, buffer, size);
+    if(rval.code != RC_OK || !opt_codec_ctx
+       || !opt_codec_ctx->check_constraints || syntax == ATS_RANDOM) {
+        return rval;
+    }
+
+    /*
+     * Check the freshly decoded structure, marking the SEQUENCE structures
+     * which pass so asn_check_constraints() does not walk them again.
+     */
+    saved_decode_constraints = asn__decode_constraints;
+    asn__decode_constraints = 1;
+    if(asn_check_constraints(td, *sptr, 0, 0)) {
+        errno = EBADF; /* Content constraint failed. */
+        rval.code = RC_FAIL;
+    }
+    asn__decode_constraints = saved_decode_constraints;
+
+    return rval;
+}
+
+static asn_dec_rval_t
+asn_decode_syntax(const asn_codec_ctx_t *opt_codec_ctx,
+                  enum asn_transfer_syntax syntax,
+                  const asn_TYPE_descriptor_t *td, void **sptr,
+                  const void *buffer, size_t size) {
     if(!td || !td->op || !sptr || (size && !buffer)) {
         ASN__DECODE_FAILED;
     }
@@ -435,6 +654,15 @@ asn_decode(const asn_codec_ctx_t *opt_codec_ctx,
     case ATS_BASIC_XER:
     case ATS_CANONICAL_XER:
         return xer_decode(opt_codec_ctx, td, sptr, buffer, size);
+
+    case ATS_JER:
+    case ATS_JER_MINIFIED:
+#ifdef  ASN_DISABLE_JER_SUPPORT
+        errno = ENOENT;
+        ASN__DECODE_FAILED;
+#else
+        return jer_decode(opt_codec_ctx, td, sptr, buffer, size);
+#endif
     }
 }
 
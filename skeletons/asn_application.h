@@ -57,7 +57,14 @@ enum asn_transfer_syntax {
      * CANONICAL-XER is a more strict variant of BASIC-XER.
      */
     ATS_BASIC_XER,
-    ATS_CANONICAL_XER
+    ATS_CANONICAL_XER,
+    /*
+     * X.697:
+     * JER: JSON Encoding Rules.
+     * JER-MINIFIED is the same JSON without any insignificant whitespace.
+     */
+    ATS_JER,
+    ATS_JER_MINIFIED
 };
 
 /*
@@ -91,7 +98,8 @@ asn_enc_rval_t asn_encode_to_buffer(
  *  (.result.encoded) as in asn_encode_to_buffer(),
  *  The errno codes as in asn_encode_to_buffer(), plus the following:
  *      ENOMEM: Memory allocation failed due to system or internal limits.
- * The user is responsible for freeing the (.buffer).
+ * The user is responsible for freeing the (.buffer), using the allocator
+ * which was in effect for the call (free(3) unless changed, see asn_codecs.h).
  */
 typedef struct asn_encode_to_new_buffer_result_s {
     void *buffer;   /* NULL if failed to encode. */
@@ -103,6 +111,32 @@ asn_encode_to_new_buffer_result_t asn_encode_to_new_buffer(
     const struct asn_TYPE_descriptor_s *type_to_encode,
     const void *structure_to_encode);
 
+/*
+ * The size of the encoding asn_encode_to_buffer() would produce, computed
+ * without producing it: the DER, OER and UPER encoders skip over the bytes,
+ * allocating neither the output nor (but for REAL) the temporary buffers.
+ * The structure is not written to.
+ * RETURN VALUES:
+ * >=0: The size of the encoded data, in bytes.
+ *  -1: Error sizing the structure, with the (errno) codes of
+ *      asn_encode_to_buffer().
+ */
+ssize_t asn_encoded_size(enum asn_transfer_syntax,
+                         const struct asn_TYPE_descriptor_s *type_to_encode,
+                         const void *structure_to_encode);
+
+/*
+ * The same, but the sizes of the SEQUENCE structures are cached in them
+ * and reused by the next call of asn_encoded_size_cached(), see
+ * ASN_SEQUENCE_ENCODED_SIZE_UNKNOWN() in constr_SEQUENCE.h.
+ * As it writes to the structure, it may not be called on the structure
+ * shared between the threads or placed in the read-only memory.
+ */
+ssize_t asn_encoded_size_cached(
+    enum asn_transfer_syntax,
+    const struct asn_TYPE_descriptor_s *type_to_encode,
+    void *structure_to_encode);
+
 
 /*
  * Generic type of an application-defined callback to return various
@@ -114,6 +148,51 @@ asn_encode_to_new_buffer_result_t asn_encode_to_new_buffer(
 typedef int(asn_app_consume_bytes_f)(const void *buffer, size_t size,
                                      void *application_specific_key);
 
+/*
+ * The buffered output of the callback-based encoders (DER, OER, XER and
+ * print_struct). Pass asn_output_buffer_consume_bytes() as the callback and
+ * the asn_output_buffer_t as its key: the encoders then append the bytes
+ * to the (buffer) directly, and the application's (callback) receives them
+ * only when the buffer fills up and on asn_output_buffer_flush().
+ * asn_encode() does this for its callback.
+ */
+typedef struct asn_output_buffer_s {
+    uint8_t *buffer;
+    size_t size;    /* Room in the (buffer) */
+    size_t length;  /* Bytes in the (buffer) */
+    size_t offset;  /* Bytes written before the (buffer) contents */
+    /* Takes the bytes which do not fit into the rest of the (buffer) */
+    int (*overflow)(struct asn_output_buffer_s *, const void *, size_t);
+    asn_app_consume_bytes_f *callback;
+    void *callback_key;
+} asn_output_buffer_t;
+
+/*
+ * Without the (callback), the (buffer) is the destination itself: the bytes
+ * past its end are only counted, as in asn_encode_to_buffer().
+ */
+void asn_output_buffer_init(asn_output_buffer_t *,
+                            void *buffer, size_t buffer_size,
+                            asn_app_consume_bytes_f *callback,
+                            void *callback_key);
+
+/*
+ * The asn_app_consume_bytes_f of the asn_output_buffer_t (key).
+ */
+int asn_output_buffer_consume_bytes(const void *buffer, size_t size,
+                                    void *output_buffer);
+
+/*
+ * Hand the buffered bytes over to the (callback).
+ * RETURN VALUES:
+ *  -1: The callback has failed.
+ *   0: The buffer is empty.
+ */
+int asn_output_buffer_flush(asn_output_buffer_t *);
+
+/* The number of bytes written so far */
+#define ASN_OUTPUT_BUFFER_WRITTEN(ob) ((ob)->offset + (ob)->length)
+
 
 /*
  * A generic encoder for any supported transfer syntax.
@@ -141,6 +141,80 @@ asn_get_few_bits(asn_bit_data_t *pd, int nbits) {
 	return accum;
 }
 
+/*
+ * The whole bytes moved at once by asn_get_many_bits() and
+ * asn_put_many_bits() rather than 24 bits at a time.
+ */
+#define	ASN_BIT_DATA_BULK_BYTES	16
+
+/*
+ * Big-endian 64-bit words at any alignment. The compilers recognize
+ * these as the single (byte-swapping) loads and stores.
+ */
+static uint64_t
+bits_load_be64(const uint8_t *p) {
+	return ((uint64_t)p[0] << 56) | ((uint64_t)p[1] << 48)
+		| ((uint64_t)p[2] << 40) | ((uint64_t)p[3] << 32)
+		| ((uint64_t)p[4] << 24) | ((uint64_t)p[5] << 16)
+		| ((uint64_t)p[6] << 8) | (uint64_t)p[7];
+}
+
+static void
+bits_store_be64(uint8_t *p, uint64_t v) {
+	p[0] = (uint8_t)(v >> 56);
+	p[1] = (uint8_t)(v >> 48);
+	p[2] = (uint8_t)(v >> 40);
+	p[3] = (uint8_t)(v >> 32);
+	p[4] = (uint8_t)(v >> 24);
+	p[5] = (uint8_t)(v >> 16);
+	p[6] = (uint8_t)(v >> 8);
+	p[7] = (uint8_t)v;
+}
+
+/*
+ * Extract (nbytes) whole bytes starting (shift) bits into the (src).
+ * With non-zero (shift), the byte past the last one is read, too.
+ */
+static void
+bits_copy_from(uint8_t *dst, const uint8_t *src, unsigned shift,
+		size_t nbytes) {
+	size_t i = 0;
+
+	if(shift == 0) {
+		memcpy(dst, src, nbytes);
+		return;
+	}
+
+	for(; i + 8 <= nbytes; i += 8) {
+		bits_store_be64(dst + i, (bits_load_be64(src + i) << shift)
+			| (src[i + 8] >> (8 - shift)));
+	}
+	for(; i < nbytes; i++)
+		dst[i] = (uint8_t)((src[i] << shift) | (src[i + 1] >> (8 - shift)));
+}
+
+/*
+ * Append (nbytes) whole bytes to the (carry) byte holding (shift) bits
+ * already. Returns the byte holding the last (shift) bits of (src).
+ */
+static uint8_t
+bits_copy_to(uint8_t *dst, uint8_t carry, const uint8_t *src,
+		unsigned shift, size_t nbytes) {
+	size_t i = 0;
+
+	for(; i + 8 <= nbytes; i += 8) {
+		uint64_t w = bits_load_be64(src + i);
+		bits_store_be64(dst + i, ((uint64_t)carry << 56) | (w >> shift));
+		carry = (uint8_t)(w << (8 - shift));
+	}
+	for(; i < nbytes; i++) {
+		dst[i] = (uint8_t)(carry | (src[i] >> shift));
+		carry = (uint8_t)(src[i] << (8 - shift));
+	}
+
+	return carry;
+}
+
 /*
  * Extract a large number of bits from the specified PER data pointer.
  */
@@ -156,6 +230,26 @@ asn_get_many_bits(asn_bit_data_t *pd, uint8_t *dst, int alright, int nbits) {
 		nbits &= ~7;
 	}
 
+	/*
+	 * Copy the whole bytes available in this buffer at once,
+	 * leaving the rest, if any, to the refill-aware code below.
+	 */
+	if(nbits >= 8 * ASN_BIT_DATA_BULK_BYTES
+	&& (ssize_t)(pd->nbits - pd->nboff) >= 8 * ASN_BIT_DATA_BULK_BYTES) {
+		size_t nleft = pd->nbits - pd->nboff;
+		size_t nbytes = ((size_t)nbits < nleft ? (size_t)nbits : nleft) >> 3;
+
+		pd->buffer += (pd->nboff >> 3);
+		pd->nbits  -= (pd->nboff & ~0x07);
+		pd->nboff  &= 0x07;
+
+		bits_copy_from(dst, pd->buffer, pd->nboff, nbytes);
+		pd->nboff += nbytes << 3;
+		pd->moved += nbytes << 3;
+		dst += nbytes;
+		nbits -= nbytes << 3;
+	}
+
 	while(nbits) {
 		if(nbits >= 24) {
 			value = asn_get_few_bits(pd, 24);
@@ -277,12 +371,75 @@ asn_put_few_bits(asn_bit_outp_t *po, uint32_t bits, int obits) {
 }
 
 
+/*
+ * Output a number of whole bytes past the (tmpspace): directly if the
+ * output is byte-aligned, through the shifting buffer otherwise.
+ */
+static int
+asn_put_whole_bytes(asn_bit_outp_t *po, const uint8_t *src, size_t nbytes) {
+	uint8_t chunk[256];
+	size_t complete_bytes;
+	unsigned shift;
+	uint8_t carry;
+
+	/*
+	 * Normalize position indicator.
+	 */
+	if(!po->buffer) po->buffer = po->tmpspace;
+	if(po->nboff >= 8) {
+		po->buffer += (po->nboff >> 3);
+		po->nbits  -= (po->nboff & ~0x07);
+		po->nboff  &= 0x07;
+	}
+
+	/*
+	 * Flush the complete bytes, keeping the last partial one.
+	 */
+	complete_bytes = (po->buffer - po->tmpspace);
+	if(complete_bytes) {
+		if(po->output(po->tmpspace, complete_bytes, po->op_key) < 0)
+			return -1;
+		po->flushed_bytes += complete_bytes;
+	}
+	shift = po->nboff;
+	carry = shift ? (po->buffer[0] & (0xff << (8 - shift))) : 0;
+
+	if(shift == 0) {
+		if(po->output(src, nbytes, po->op_key) < 0)
+			return -1;
+		po->flushed_bytes += nbytes;
+	} else {
+		while(nbytes) {
+			size_t n = nbytes < sizeof(chunk) ? nbytes : sizeof(chunk);
+			carry = bits_copy_to(chunk, carry, src, shift, n);
+			if(po->output(chunk, n, po->op_key) < 0)
+				return -1;
+			po->flushed_bytes += n;
+			src += n;
+			nbytes -= n;
+		}
+	}
+
+	po->tmpspace[0] = carry;
+	po->buffer = po->tmpspace;
+	po->nbits = 8 * sizeof(po->tmpspace);
+
+	return 0;
+}
+
 /*
  * Output a large number of bits.
  */
 int
 asn_put_many_bits(asn_bit_outp_t *po, const uint8_t *src, int nbits) {
 
+	if(nbits >= 8 * ASN_BIT_DATA_BULK_BYTES) {
+		if(asn_put_whole_bytes(po, src, nbits >> 3))
+			return -1;
+		src += nbits >> 3;
+		nbits &= 0x07;
+	}
+
 	while(nbits) {
 		uint32_t value;
 
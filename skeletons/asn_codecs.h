@@ -11,6 +11,38 @@ extern "C" {
 
 struct asn_TYPE_descriptor_s;	/* Forward declaration */
 
+/*
+ * A memory allocator for the ASN.1 support code.
+ * All function pointers must be set; the (opaque) pointer is passed
+ * to each of them as the last argument.
+ */
+typedef struct asn_allocator_s {
+	void *(*calloc_fn)(size_t nmemb, size_t size, void *opaque);
+	void *(*malloc_fn)(size_t size, void *opaque);
+	void *(*realloc_fn)(void *ptr, size_t size, void *opaque);
+	void (*free_fn)(void *ptr, void *opaque);
+	void *opaque;
+} asn_allocator_t;
+
+/*
+ * Set the process-wide allocator, used unless overridden by the calling
+ * thread or by the codec context. NULL restores the C library allocator.
+ * Must not be changed while any structures allocated by the previous
+ * allocator are still alive.
+ */
+void asn_set_default_allocator(const asn_allocator_t *allocator);
+
+/*
+ * Set the allocator for the calling thread, overriding the process-wide
+ * default. NULL removes the override.
+ * RETURN VALUES:
+ * The previous per-thread allocator (or NULL), to be restored later.
+ * NOTE: Structures decoded with a per-thread or per-context allocator must
+ * be freed (ASN_STRUCT_FREE() etc.) with the same allocator in effect.
+ */
+const asn_allocator_t *asn_set_thread_allocator(
+    const asn_allocator_t *allocator);
+
 /*
  * This structure defines a set of parameters that may be passed
  * to every ASN.1 encoder or decoder function.
@@ -33,6 +65,27 @@ typedef struct asn_codec_ctx_s {
 	 * stack size is rather limited.
 	 */
 	size_t  max_stack_size; /* 0 disables stack bounds checking */
+
+	/*
+	 * The memory allocator to be used by the encoder or decoder,
+	 * overriding the per-thread and process-wide allocators for the
+	 * duration of the call. NULL keeps the current one.
+	 */
+	const asn_allocator_t *allocator;
+
+	/*
+	 * Validate the ASN.1 constraints while encoding with asn_encode*(),
+	 * each value just before it is emitted, instead of a separate
+	 * asn_check_constraints() pass over the structure. On failure,
+	 * (.failed_type) and (.structure_ptr) of the result point to the
+	 * offending value, and errno is set to EBADF.
+	 * With asn_decode(), validate the decoded structure, failing with
+	 * RC_FAIL and errno set to EBADF if it violates the constraints.
+	 * The SEQUENCE structures passing this check are marked with
+	 * ASN_SEQUENCE_CONSTRAINTS_OK() and are not checked again,
+	 * see constr_SEQUENCE.h.
+	 */
+	int check_constraints;
 } asn_codec_ctx_t;
 
 /*
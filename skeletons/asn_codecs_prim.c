@@ -100,7 +100,7 @@ der_encode_primitive(const asn_TYPE_descriptor_t *td, const void *sptr,
 	}
 
 	if(cb && st->buf) {
-		if(cb(st->buf, st->size, app_key) < 0) {
+		if(ASN__E_cbc(st->buf, st->size)) {
 			erval.encoded = -1;
 			erval.failed_type = td;
 			erval.structure_ptr = sptr;
@@ -139,6 +139,37 @@ ASN__PRIMITIVE_TYPE_free(const asn_TYPE_descriptor_t *td, void *sptr,
     }
 }
 
+int
+ASN__PRIMITIVE_TYPE_copy(const asn_TYPE_descriptor_t *td, void **dptr,
+                         const void *sptr) {
+    const ASN__PRIMITIVE_TYPE_t *src = (const ASN__PRIMITIVE_TYPE_t *)sptr;
+    ASN__PRIMITIVE_TYPE_t *dst = (ASN__PRIMITIVE_TYPE_t *)*dptr;
+    int allocated = 0;
+
+    if(!td || !src) return -1;
+
+    if(!dst) {
+        dst = (ASN__PRIMITIVE_TYPE_t *)CALLOC(1, sizeof(*dst));
+        if(!dst) return -1;
+        allocated = 1;
+    }
+
+    if(src->buf) {
+        /* The decoders terminate the buffer, keep it that way */
+        dst->buf = (uint8_t *)MALLOC(src->size + 1);
+        if(!dst->buf) {
+            if(allocated) FREEMEM(dst);
+            return -1;
+        }
+        if(src->size) memcpy(dst->buf, src->buf, src->size);
+        dst->buf[src->size] = '\0';
+    }
+    dst->size = src->size;
+
+    *dptr = dst;
+    return 0;
+}
+
 
 /*
  * Local internal type passed around as an argument.
@@ -17,6 +17,7 @@ typedef struct ASN__PRIMITIVE_TYPE_s {
 } ASN__PRIMITIVE_TYPE_t;	/* Do not use this type directly! */
 
 asn_struct_free_f ASN__PRIMITIVE_TYPE_free;
+asn_struct_copy_f ASN__PRIMITIVE_TYPE_copy;
 ber_type_decoder_f ber_decode_primitive;
 der_type_encoder_f der_encode_primitive;
 
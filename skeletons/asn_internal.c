@@ -1,5 +1,88 @@
 #include <asn_internal.h>
 
+static void *
+asn__libc_calloc(size_t nmemb, size_t size, void *opaque) {
+    (void)opaque;
+    return calloc(nmemb, size);
+}
+
+static void *
+asn__libc_malloc(size_t size, void *opaque) {
+    (void)opaque;
+    return malloc(size);
+}
+
+static void *
+asn__libc_realloc(void *ptr, size_t size, void *opaque) {
+    (void)opaque;
+    return realloc(ptr, size);
+}
+
+static void
+asn__libc_free(void *ptr, void *opaque) {
+    (void)opaque;
+    free(ptr);
+}
+
+static const asn_allocator_t asn__libc_allocator = {
+    asn__libc_calloc, asn__libc_malloc, asn__libc_realloc, asn__libc_free, 0};
+
+static const asn_allocator_t *asn__default_allocator = &asn__libc_allocator;
+static ASN__THREAD_LOCAL const asn_allocator_t *asn__thread_allocator;
+
+#define ASN__CURRENT_ALLOCATOR()                                   \
+    (asn__thread_allocator ? asn__thread_allocator : asn__default_allocator)
+
+void
+asn_set_default_allocator(const asn_allocator_t *allocator) {
+    asn__default_allocator = allocator ? allocator : &asn__libc_allocator;
+}
+
+const asn_allocator_t *
+asn_set_thread_allocator(const asn_allocator_t *allocator) {
+    const asn_allocator_t *previous = asn__thread_allocator;
+    asn__thread_allocator = allocator;
+    return previous;
+}
+
+const asn_allocator_t *
+asn__allocator_enter(const asn_codec_ctx_t *opt_ctx) {
+    const asn_allocator_t *saved = asn__thread_allocator;
+    if(opt_ctx && opt_ctx->allocator) {
+        asn__thread_allocator = opt_ctx->allocator;
+    }
+    return saved;
+}
+
+void
+asn__allocator_leave(const asn_allocator_t *saved) {
+    asn__thread_allocator = saved;
+}
+
+void *
+asn__calloc(size_t nmemb, size_t size) {
+    const asn_allocator_t *a = ASN__CURRENT_ALLOCATOR();
+    return a->calloc_fn(nmemb, size, a->opaque);
+}
+
+void *
+asn__malloc(size_t size) {
+    const asn_allocator_t *a = ASN__CURRENT_ALLOCATOR();
+    return a->malloc_fn(size, a->opaque);
+}
+
+void *
+asn__realloc(void *ptr, size_t size) {
+    const asn_allocator_t *a = ASN__CURRENT_ALLOCATOR();
+    return a->realloc_fn(ptr, size, a->opaque);
+}
+
+void
+asn__free(void *ptr) {
+    const asn_allocator_t *a = ASN__CURRENT_ALLOCATOR();
+    a->free_fn(ptr, a->opaque);
+}
+
 ssize_t
 asn__format_to_callback(int (*cb)(const void *, size_t, void *key), void *key,
                         const char *fmt, ...) {
@@ -45,3 +128,11 @@ asn__format_to_callback(int (*cb)(const void *, size_t, void *key), void *key,
     return wrote;
 }
 
+ASN__THREAD_LOCAL int asn__encode_cache_sizes;
+
+int
+asn__count_bytes(const void *buffer, size_t size, void *key) {
+    (void)buffer;
+    *(size_t *)key += size;
+    return 0;
+}
@@ -24,10 +24,26 @@ extern "C" {
 #define	ASN1C_ENVIRONMENT_VERSION	923	/* Compile-time version */
 int get_asn1c_environment_version(void);	/* Run-time version */
 
-#define	CALLOC(nmemb, size)	calloc(nmemb, size)
-#define	MALLOC(size)		malloc(size)
-#define	REALLOC(oldptr, size)	realloc(oldptr, size)
-#define	FREEMEM(ptr)		free(ptr)
+/*
+ * Memory management goes through the allocator selected by the codec
+ * context, the calling thread or the process (asn_set_*_allocator()).
+ */
+void *asn__calloc(size_t nmemb, size_t size);
+void *asn__malloc(size_t size);
+void *asn__realloc(void *ptr, size_t size);
+void asn__free(void *ptr);
+#define	CALLOC(nmemb, size)	asn__calloc(nmemb, size)
+#define	MALLOC(size)		asn__malloc(size)
+#define	REALLOC(oldptr, size)	asn__realloc(oldptr, size)
+#define	FREEMEM(ptr)		asn__free(ptr)
+
+/*
+ * Make the allocator of the codec context (if given) current for
+ * the calling thread. Returns the value to be passed to
+ * asn__allocator_leave() upon return from the codec.
+ */
+const asn_allocator_t *asn__allocator_enter(const asn_codec_ctx_t *opt_ctx);
+void asn__allocator_leave(const asn_allocator_t *saved);
 
 #define	asn_debug_indent	0
 #define ASN_DEBUG_INDENT_ADD(i) do{}while(0)
@@ -86,10 +102,39 @@ asn__format_to_callback(
     int (*callback)(const void *, size_t, void *key), void *key,
     const char *fmt, ...);
 
+/*
+ * Append the bytes to the asn_output_buffer_t, or overflow it.
+ * Evaluates to a negative value on failure.
+ */
+#define ASN__OUTPUT_BUFFER_PUT(ob, data, len)                       \
+    ((ob)->size - (ob)->length > (size_t)(len)                      \
+         ? (memcpy((ob)->buffer + (ob)->length, (data), (len)),     \
+            (ob)->length += (len), 0)                               \
+         : (ob)->overflow((ob), (data), (len)))
+
+/*
+ * The output callback counting the bytes into the (size_t *)key.
+ * The encoders which find it in place of the output may account for
+ * the bytes without producing them: the (buffer) may be NULL.
+ */
+int asn__count_bytes(const void *buffer, size_t size, void *key);
+
+/*
+ * Set by asn_encoded_size_cached() while sizing the value: the encoders
+ * may reuse and update the sizes cached in the structures.
+ */
+extern ASN__THREAD_LOCAL int asn__encode_cache_sizes;
+
 /*
  * Invoke the application-supplied callback and fail, if something is wrong.
+ * The asn_output_buffer_t is written into without the call.
  */
-#define ASN__E_cbc(buf, size) (cb((buf), (size), app_key) < 0)
+#define ASN__E_cbc(buf, size)                                       \
+    ((cb == asn_output_buffer_consume_bytes                         \
+          ? ASN__OUTPUT_BUFFER_PUT((asn_output_buffer_t *)app_key,  \
+                                   (buf), (size))                   \
+          : cb((buf), (size), app_key))                             \
+     < 0)
 #define ASN__E_CALLBACK(size, foo) \
     do {                           \
         if(foo) goto cb_failed;    \
@@ -116,10 +161,10 @@ asn__format_to_callback(
 
 #define	_i_INDENT(nl)	do {                        \
         int tmp_i;                                  \
-        if((nl) && cb("\n", 1, app_key) < 0)        \
+        if((nl) && ASN__E_cbc("\n", 1))             \
             return -1;                              \
         for(tmp_i = 0; tmp_i < ilevel; tmp_i++)     \
-            if(cb("    ", 4, app_key) < 0)          \
+            if(ASN__E_cbc("    ", 4))               \
                 return -1;                          \
     } while(0)
 
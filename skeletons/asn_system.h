@@ -97,6 +97,20 @@ typedef	unsigned int	uint32_t;
 #define	ASN_THREAD_SAFE
 #endif	/* Thread safety */
 
+/* Thread-local storage, if the compiler supports it */
+#ifndef	ASN__THREAD_LOCAL
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L \
+	&& !defined(__STDC_NO_THREADS__)
+#define	ASN__THREAD_LOCAL	_Thread_local
+#elif	defined(__GNUC__) || defined(__clang__)
+#define	ASN__THREAD_LOCAL	__thread
+#elif	defined(_MSC_VER)
+#define	ASN__THREAD_LOCAL	__declspec(thread)
+#else
+#define	ASN__THREAD_LOCAL	/* Shared by all threads */
+#endif
+#endif	/* ASN__THREAD_LOCAL */
+
 #ifndef	offsetof	/* If not defined by <stddef.h> */
 #define	offsetof(s, m)	((ptrdiff_t)&(((s *)0)->m) - (ptrdiff_t)((s *)0))
 #endif	/* offsetof */
@@ -31,6 +31,8 @@ ber_decode(const asn_codec_ctx_t *opt_codec_ctx,
            const asn_TYPE_descriptor_t *type_descriptor, void **struct_ptr,
            const void *ptr, size_t size) {
     asn_codec_ctx_t s_codec_ctx;
+    const asn_allocator_t *saved_allocator;
+    asn_dec_rval_t rval;
 
 	/*
 	 * Stack checker requires that the codec context
@@ -51,11 +53,15 @@ ber_decode(const asn_codec_ctx_t *opt_codec_ctx,
 	/*
 	 * Invoke type-specific decoder.
 	 */
-	return type_descriptor->op->ber_decoder(opt_codec_ctx, type_descriptor,
+	saved_allocator = asn__allocator_enter(opt_codec_ctx);
+	rval = type_descriptor->op->ber_decoder(opt_codec_ctx, type_descriptor,
 		struct_ptr,	/* Pointer to the destination structure */
 		ptr, size,	/* Buffer and its size */
 		0		/* Default tag mode is 0 */
 		);
+	asn__allocator_leave(saved_allocator);
+
+	return rval;
 }
 
 /*
@@ -83,6 +89,28 @@ ber_check_tags(const asn_codec_ctx_t *opt_codec_ctx,
 	if(ASN__STACK_OVERFLOW_CHECK(opt_codec_ctx))
 		RETURN(RC_FAIL);
 
+	/*
+	 * The short cut for the most common case: the single tag
+	 * encoded in one octet, followed by the short form of length.
+	 */
+	if(step == 0 && tag_mode != 1 && td->tags_count == 1 && size >= 2) {
+		const uint8_t *tl = (const uint8_t *)ptr;
+		if((tl[0] & 0x1F) != 0x1F && tl[1] < 0x80) {
+			tlv_tag = ((ber_tlv_tag_t)(tl[0] & 0x1F) << 2) | (tl[0] >> 6);
+			tlv_constr = BER_TLV_CONSTRUCTED(tl);
+			if((tag_mode == 0 && tlv_tag != td->tags[0])
+			|| (last_tag_form != tlv_constr && last_tag_form != -1)) {
+				RETURN(RC_FAIL);
+			}
+			if(opt_tlv_form)
+				*opt_tlv_form = tlv_constr;
+			*last_length = tl[1];
+			ADVANCE(2);
+			step = 1;
+			RETURN(RC_OK);
+		}
+	}
+
 	/*
 	 * So what does all this implicit skip stuff mean?
 	 * Imagine two types,
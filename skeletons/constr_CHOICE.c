@@ -437,7 +437,10 @@ CHOICE_encode_der(const asn_TYPE_descriptor_t *td, const void *sptr,
 
 	/*
 	 * Encode the single underlying member.
+	 * Its constraints are checked when it's being written out.
 	 */
+	if(cb && ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, &erval))
+		return erval;
 	erval = elm->type->op->der_encoder(elm->type, memb_ptr,
 		elm->tag_mode, elm->tag, cb, app_key);
 	if(erval.encoded == -1)
@@ -497,6 +500,9 @@ CHOICE_constraint(const asn_TYPE_descriptor_t *td, const void *sptr,
 		return -1;
 	}
 
+	/* The members are checked by the encoder as it gets to them */
+	if(asn__encode_constraints) return 0;
+
 	/*
 	 * Figure out which CHOICE element is encoded.
 	 */
@@ -593,6 +599,9 @@ CHOICE_decode_xer(const asn_codec_ctx_t *opt_codec_ctx,
 		pxer_chunk_type_e ch_type;	/* XER chunk type */
 		ssize_t ch_size;		/* Chunk size */
 		xer_check_tag_e tcv;		/* Tag check value */
+		const char *name;		/* Tag name */
+		size_t name_len;
+		ssize_t n;
 		asn_TYPE_member_t *elm;
 
 		/*
@@ -659,7 +668,8 @@ CHOICE_decode_xer(const asn_codec_ctx_t *opt_codec_ctx,
 			}
 		}
 
-		tcv = xer_check_tag(buf_ptr, ch_size, xml_tag);
+		tcv = xer_check_tag_name(buf_ptr, ch_size, xml_tag,
+			&name, &name_len);
 		ASN_DEBUG("XER/CHOICE checked [%c%c%c%c] vs [%s], tcv=%d",
 			ch_size>0?((const uint8_t *)buf_ptr)[0]:'?',
 			ch_size>1?((const uint8_t *)buf_ptr)[1]:'?',
@@ -712,29 +722,16 @@ CHOICE_decode_xer(const asn_codec_ctx_t *opt_codec_ctx,
 			/*
 			 * Search which inner member corresponds to this tag.
 			 */
-			for(edx = 0; edx < td->elements_count; edx++) {
-				elm = &td->elements[edx];
-				tcv = xer_check_tag(buf_ptr,ch_size,elm->name);
-				switch(tcv) {
-				case XCT_BOTH:
-				case XCT_OPENING:
-					/*
-					 * Process this member.
-					 */
-					ctx->step = edx;
-					ctx->phase = 2;
-					break;
-				case XCT_UNKNOWN_OP:
-				case XCT_UNKNOWN_BO:
-					continue;
-				default:
-					edx = td->elements_count;
-					break;	/* Phase out */
-				}
-				break;
-			}
-			if(edx != td->elements_count)
+			n = xer_find_member(td->elements, 0, td->elements_count,
+				specs->name2el, name, name_len);
+			if(n >= 0) {
+				/*
+				 * Process this member.
+				 */
+				ctx->step = edx = n;
+				ctx->phase = 2;
 				continue;
+			}
 
 			/* It is expected extension */
 			if(specs->ext_start != -1) {
@@ -809,6 +806,8 @@ CHOICE_encode_xer(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
             memb_ptr = (const void *)((const char *)sptr + elm->memb_offset);
         }
 
+        if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, &tmper)) return tmper;
+
         er.encoded = 0;
 
 		if(!(flags & XER_F_CANONICAL)) ASN__TEXT_INDENT(1, ilevel);
@@ -926,6 +925,7 @@ CHOICE_encode_uper(const asn_TYPE_descriptor_t *td,
 	const void *memb_ptr;
 	unsigned present;
 	int present_enc;
+	asn_enc_rval_t er;
 
 	if(!sptr) ASN__ENCODE_FAILED;
 
@@ -990,6 +990,8 @@ CHOICE_encode_uper(const asn_TYPE_descriptor_t *td,
         memb_ptr = (const char *)sptr + elm->memb_offset;
     }
 
+    if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, &er)) return er;
+
     if(ct && ct->range_bits >= 0) {
         if(per_put_few_bits(po, present_enc, ct->range_bits))
             ASN__ENCODE_FAILED;
@@ -1017,7 +1019,7 @@ CHOICE_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
     const asn_CHOICE_specifics_t *specs = (const asn_CHOICE_specifics_t *)td->specifics;
 	unsigned present;
 
-	if(!sptr) return (cb("<absent>", 8, app_key) < 0) ? -1 : 0;
+	if(!sptr) return ASN__E_cbc("<absent>", 8) ? -1 : 0;
 
 	/*
 	 * Figure out which CHOICE element is encoded.
@@ -1033,22 +1035,22 @@ CHOICE_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
 
 		if(elm->flags & ATF_POINTER) {
 			memb_ptr = *(const void * const *)((const char *)sptr + elm->memb_offset);
-			if(!memb_ptr) return (cb("<absent>", 8, app_key) < 0) ? -1 : 0;
+			if(!memb_ptr) return ASN__E_cbc("<absent>", 8) ? -1 : 0;
 		} else {
 			memb_ptr = (const void *)((const char *)sptr + elm->memb_offset);
 		}
 
 		/* Print member's name and stuff */
 		if(0) {
-			if(cb(elm->name, strlen(elm->name), app_key) < 0
-			|| cb(": ", 2, app_key) < 0)
+			if(ASN__E_cbc(elm->name, strlen(elm->name))
+			|| ASN__E_cbc(": ", 2))
 				return -1;
 		}
 
 		return elm->type->op->print_struct(elm->type, memb_ptr, ilevel,
 			cb, app_key);
 	} else {
-		return (cb("<absent>", 8, app_key) < 0) ? -1 : 0;
+		return ASN__E_cbc("<absent>", 8) ? -1 : 0;
 	}
 }
 
@@ -1212,6 +1214,47 @@ CHOICE_compare(const asn_TYPE_descriptor_t *td, const void *aptr, const void *bp
     }
 }
 
+int
+CHOICE_copy(const asn_TYPE_descriptor_t *td, void **dptr, const void *sptr) {
+    const asn_CHOICE_specifics_t *specs =
+        (const asn_CHOICE_specifics_t *)td->specifics;
+    asn_TYPE_member_t *elm;
+    unsigned present;
+    const void *smemb;
+    void *dst = *dptr;
+    void *dmemb;
+    int allocated = 0;
+    int ret;
+
+    if(!sptr) return -1;
+
+    smemb = _get_member_ptr(td, sptr, &elm, &present);
+
+    if(!dst) {
+        dst = CALLOC(1, specs->struct_size);
+        if(!dst) return -1;
+        allocated = 1;
+    }
+
+    if(smemb) {
+        if(elm->flags & ATF_POINTER) {
+            ret = elm->type->op->copy_struct(
+                elm->type, (void **)((char *)dst + elm->memb_offset), smemb);
+        } else {
+            dmemb = (char *)dst + elm->memb_offset;
+            ret = elm->type->op->copy_struct(elm->type, &dmemb, smemb);
+        }
+        if(ret) {
+            if(allocated) FREEMEM(dst);
+            return -1;
+        }
+        _set_present_idx(dst, specs->pres_offset, specs->pres_size, present);
+    }
+
+    *dptr = dst;
+    return 0;
+}
+
 /*
  * Return the 1-based choice variant presence index.
  * Returns 0 in case of error.
@@ -1317,10 +1360,18 @@ asn_TYPE_operation_t asn_OP_CHOICE = {
 	CHOICE_free,
 	CHOICE_print,
 	CHOICE_compare,
+	CHOICE_copy,
 	CHOICE_decode_ber,
 	CHOICE_encode_der,
 	CHOICE_decode_xer,
 	CHOICE_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	CHOICE_decode_jer,
+	CHOICE_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef	ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
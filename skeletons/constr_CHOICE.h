@@ -34,6 +34,11 @@ typedef struct asn_CHOICE_specifics_s {
 	 * Extensions-related stuff.
 	 */
 	signed ext_start; /* First member of extensions, or -1 */
+
+	/*
+	 * Member names to members mapping, for XER (optional).
+	 */
+	const asn_TYPE_name2member_t *name2el;
 } asn_CHOICE_specifics_t;
 
 /*
@@ -42,11 +47,14 @@ typedef struct asn_CHOICE_specifics_s {
 asn_struct_free_f CHOICE_free;
 asn_struct_print_f CHOICE_print;
 asn_struct_compare_f CHOICE_compare;
+asn_struct_copy_f CHOICE_copy;
 asn_constr_check_f CHOICE_constraint;
 ber_type_decoder_f CHOICE_decode_ber;
 der_type_encoder_f CHOICE_encode_der;
 xer_type_decoder_f CHOICE_decode_xer;
 xer_type_encoder_f CHOICE_encode_xer;
+jer_type_decoder_f CHOICE_decode_jer;
+jer_type_encoder_f CHOICE_encode_jer;
 oer_type_decoder_f CHOICE_decode_oer;
 oer_type_encoder_f CHOICE_encode_oer;
 per_type_decoder_f CHOICE_decode_uper;
@@ -0,0 +1,256 @@
+/*
+ * Redistribution and modifications are permitted subject to BSD license.
+ */
+#ifndef ASN_DISABLE_JER_SUPPORT
+
+#include <asn_internal.h>
+#include <constr_CHOICE.h>
+#include <errno.h>
+
+/*
+ * This macro "eats" the part of the buffer which is definitely "consumed",
+ * i.e. was correctly converted into local representation or rightfully skipped.
+ */
+#undef  JER_ADVANCE
+#define JER_ADVANCE(num_bytes)           \
+    do {                                 \
+        size_t num = (num_bytes);        \
+        ptr = ((const char *)ptr) + num; \
+        size -= num;                     \
+        consumed_myself += num;          \
+    } while(0)
+
+/*
+ * Return a standardized complex structure.
+ */
+#undef  RETURN
+#define RETURN(_code)   do {                    \
+                rval.code = _code;              \
+                rval.consumed = consumed_myself;\
+                return rval;                    \
+        } while(0)
+
+/*
+ * Decode the JER (JSON) object with the single member,
+ * named after the chosen alternative.
+ */
+asn_dec_rval_t
+CHOICE_decode_jer(const asn_codec_ctx_t *opt_codec_ctx,
+                  const asn_TYPE_descriptor_t *td, void **struct_ptr,
+                  const void *ptr, size_t size) {
+    /*
+     * Bring closer parts of structure description.
+     */
+    const asn_CHOICE_specifics_t *specs =
+        (const asn_CHOICE_specifics_t *)td->specifics;
+
+    /*
+     * Parts of the structure being constructed.
+     */
+    void *st = *struct_ptr; /* Target structure. */
+    asn_struct_ctx_t *ctx;  /* Decoder context */
+
+    asn_dec_rval_t rval;         /* Return value of a decoder */
+    ssize_t consumed_myself = 0; /* Consumed bytes from ptr */
+    size_t edx;                  /* Element index */
+
+    /*
+     * Create the target structure if it is not present already.
+     */
+    if(st == 0) {
+        st = *struct_ptr = CALLOC(1, specs->struct_size);
+        if(st == 0) RETURN(RC_FAIL);
+    }
+
+    /*
+     * Restore parsing context.
+     */
+    ctx = (asn_struct_ctx_t *)((char *)st + specs->ctx_offset);
+
+    /*
+     * Phases of JER/JSON processing:
+     * Phase 0: Expecting '{'.
+     * Phase 1: Expecting the alternative name.
+     * Phase 2: Expecting ':' before the alternative value.
+     * Phase 3: Processing inner type.
+     * Phase 4: Expecting '}'.
+     * Phase 5: Expecting ':' before the unknown extension.
+     * Phase 6: Skipping unknown extension.
+     * Phase 7: PHASED OUT
+     */
+    for(edx = ctx->step; ctx->phase <= 6;) {
+        pjer_chunk_type_e ch_type; /* JER chunk type */
+        ssize_t ch_size;           /* Chunk size */
+        int dlm;                   /* Delimiter character, if any */
+        int ret;
+
+        /*
+         * Go inside the member.
+         */
+        if(ctx->phase == 3) {
+            asn_dec_rval_t tmprval;
+            void *memb_ptr;   /* Pointer to the member */
+            void **memb_ptr2; /* Pointer to that pointer */
+            asn_TYPE_member_t *elm = &td->elements[edx];
+
+            if(elm->flags & ATF_POINTER) {
+                /* Member is a pointer to another structure */
+                memb_ptr2 = (void **)((char *)st + elm->memb_offset);
+            } else {
+                memb_ptr = (char *)st + elm->memb_offset;
+                memb_ptr2 = &memb_ptr;
+            }
+
+            /* Start/Continue decoding the inner member */
+            tmprval = elm->type->op->jer_decoder(opt_codec_ctx, elm->type,
+                                                 memb_ptr2, ptr, size);
+            JER_ADVANCE(tmprval.consumed);
+            ASN_DEBUG("JER/CHOICE: itdf: [%s] code=%d", elm->type->name,
+                      tmprval.code);
+            if(tmprval.code != RC_OK) RETURN(tmprval.code);
+            ctx->phase = 4;
+        }
+
+        /*
+         * Get the next part of the JSON stream.
+         */
+        ch_size = jer_next_token(ptr, size, &ch_type);
+        if(ch_size == -1) {
+            RETURN(RC_FAIL);
+        } else {
+            switch(ch_type) {
+            case PJER_WMORE:
+                RETURN(RC_WMORE);
+            case PJER_WHITESPACE:
+                JER_ADVANCE(ch_size); /* Skip silently */
+                continue;
+            default:
+                break; /* Check the rest down there */
+            }
+        }
+
+        dlm = (ch_type == PJER_DLM) ? *(const char *)ptr : 0;
+
+        switch(ctx->phase) {
+        case 0:
+            if(dlm != 0x7b) break; /* '{' */
+            JER_ADVANCE(ch_size);
+            ctx->phase = 1;
+            continue;
+        case 1:
+            if(ch_type == PJER_STRING) {
+                /*
+                 * Search which inner member corresponds to this name.
+                 */
+                const char *name;
+                void *to_free;
+                ssize_t name_len;
+                ssize_t n;
+                name_len = jer_string_contents(ptr, ch_size, &name, &to_free);
+                if(name_len < 0) RETURN(RC_FAIL);
+                n = xer_find_member(td->elements, 0, td->elements_count,
+                                    specs->name2el, name, name_len);
+                if(to_free) FREEMEM(to_free);
+                if(n >= 0) {
+                    /* Set presence to be able to free it properly */
+                    (void)CHOICE_variant_set_presence(td, st, n + 1);
+                    ctx->step = edx = n;
+                    ctx->phase = 2;
+                    JER_ADVANCE(ch_size);
+                    continue;
+                }
+
+                /* It is expected extension */
+                if(specs->ext_start != -1) {
+                    ASN_DEBUG("Got anticipated extension");
+                    ctx->phase = 5;
+                    JER_ADVANCE(ch_size);
+                    continue;
+                }
+            }
+            break;
+        case 2:
+        case 5:
+            if(dlm != 0x3a) break; /* ':' */
+            JER_ADVANCE(ch_size);
+            ctx->phase = (ctx->phase == 2) ? 3 : 6;
+            ctx->left = 0;
+            continue;
+        case 4:
+            if(dlm != 0x7d) break; /* '}' */
+            JER_ADVANCE(ch_size);
+            ctx->phase = 7; /* Phase out */
+            RETURN(RC_OK);
+        case 6:
+            ret = jer_skip_unknown(ch_type, ptr, &ctx->left);
+            if(ret < 0) break;
+            JER_ADVANCE(ch_size);
+            if(ret) ctx->phase = 4; /* The extension is skipped */
+            continue;
+        }
+
+        ASN_DEBUG("Unexpected JER token in CHOICE %s [%c]", td->name,
+                  size > 0 ? ((const char *)ptr)[0] : '.');
+        break;
+    }
+
+    ctx->phase = 7; /* Phase out, just in case */
+    RETURN(RC_FAIL);
+}
+
+asn_enc_rval_t
+CHOICE_encode_jer(const asn_TYPE_descriptor_t *td, const void *sptr,
+                  int ilevel, enum jer_encoder_flags_e flags,
+                  asn_app_consume_bytes_f *cb, void *app_key) {
+    asn_enc_rval_t er = {0, 0, 0};
+    asn_enc_rval_t tmper;
+    int pretty = !(flags & JER_F_MINIFIED);
+    asn_TYPE_member_t *elm;
+    const void *memb_ptr;
+    unsigned present;
+    size_t mlen;
+
+    if(!sptr) ASN__ENCODE_FAILED;
+
+    /*
+     * Figure out which CHOICE element is encoded.
+     */
+    present = CHOICE_variant_get_presence(td, sptr);
+    if(present == 0 || present > td->elements_count) {
+        ASN__ENCODE_FAILED;
+    }
+
+    elm = &td->elements[present - 1];
+    mlen = strlen(elm->name);
+    if(elm->flags & ATF_POINTER) {
+        memb_ptr =
+            *(const void *const *)((const char *)sptr + elm->memb_offset);
+        if(!memb_ptr) ASN__ENCODE_FAILED;
+    } else {
+        memb_ptr = (const void *)((const char *)sptr + elm->memb_offset);
+    }
+
+    if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, &tmper)) return tmper;
+
+    ASN__CALLBACK("{", 1);
+    if(pretty) {
+        ASN__TEXT_INDENT(1, ilevel + 1);
+        ASN__CALLBACK3("\"", 1, elm->name, mlen, "\": ", 3);
+    } else {
+        ASN__CALLBACK3("\"", 1, elm->name, mlen, "\":", 2);
+    }
+
+    tmper = elm->type->op->jer_encoder(elm->type, memb_ptr, ilevel + 1, flags,
+                                       cb, app_key);
+    if(tmper.encoded == -1) return tmper;
+    er.encoded += tmper.encoded;
+
+    if(pretty) ASN__TEXT_INDENT(1, ilevel);
+    ASN__CALLBACK("}", 1);
+
+    ASN__ENCODED_OK(er);
+cb_failed:
+    ASN__ENCODE_FAILED;
+}
+
+#endif  /* ASN_DISABLE_JER_SUPPORT */
@@ -285,7 +285,7 @@ oer_put_tag(ber_tlv_tag_t tag, asn_app_consume_bytes_f *cb, void *app_key) {
 
     if(tval < 0x3F) {
         uint8_t b = (uint8_t)((tclass << 6) | tval);
-        if(cb(&b, 1, app_key) < 0) {
+        if(ASN__E_cbc(&b, 1)) {
             return -1;
         }
         return 1;
@@ -303,7 +303,7 @@ oer_put_tag(ber_tlv_tag_t tag, asn_app_consume_bytes_f *cb, void *app_key) {
         }
         *b = (uint8_t)((tclass << 6) | 0x3F);
         encoded = sizeof(buf) - (b - buf);
-        if(cb(b, encoded, app_key) < 0) {
+        if(ASN__E_cbc(b, encoded)) {
             return -1;
         }
         return encoded;
@@ -351,6 +351,8 @@ CHOICE_encode_oer(const asn_TYPE_descriptor_t *td,
         memb_ptr = (const void *)((const char *)sptr + elm->memb_offset);
     }
 
+    if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, &er)) return er;
+
     tag = asn_TYPE_outmost_tag(elm->type, memb_ptr, elm->tag_mode, elm->tag);
     if(tag == 0) {
         ASN__ENCODE_FAILED;
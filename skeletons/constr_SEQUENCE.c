@@ -398,6 +398,7 @@ SEQUENCE_decode_ber(const asn_codec_ctx_t *opt_codec_ctx,
 			 */
 			memb_ptr = (char *)st + elements[edx].memb_offset;
 			memb_ptr2 = &memb_ptr;
+			ASN_SEQUENCE_INLINE_MKPRESENT(td, st, edx);
 		}
 		/*
 		 * Invoke the member fetch routine according to member's type
@@ -519,6 +520,15 @@ SEQUENCE_encode_der(const asn_TYPE_descriptor_t *td, const void *sptr,
 	ASN_DEBUG("%s %s as SEQUENCE",
 		cb?"Encoding":"Estimating", td->name);
 
+	/* Sized by asn_encoded_size_cached() already */
+	if(!cb && SEQUENCE__cached_size(td, sptr, ATS_DER, &computed_size)) {
+		ret = der_write_tags(td, computed_size, tag_mode, 1, tag, 0, 0);
+		if(ret == -1)
+			ASN__ENCODE_FAILED;
+		erval.encoded = computed_size + ret;
+		ASN__ENCODED_OK(erval);
+	}
+
 	/*
 	 * Gather the length of the underlying members sequence.
 	 */
@@ -540,6 +550,7 @@ SEQUENCE_encode_der(const asn_TYPE_descriptor_t *td, const void *sptr,
 				ASN__ENCODE_FAILED;
 			}
 		} else {
+            if(ASN_SEQUENCE_INLINE_ABSENT(td, sptr, edx)) continue;
             memb_ptr = (const void *)((const char *)sptr + elm->memb_offset);
             memb_ptr2 = &memb_ptr;
 		}
@@ -557,6 +568,7 @@ SEQUENCE_encode_der(const asn_TYPE_descriptor_t *td, const void *sptr,
 		ASN_DEBUG("Member %" ASN_PRI_SIZE " %s estimated %ld bytes",
 			edx, elm->name, (long)erval.encoded);
 	}
+	if(!cb) SEQUENCE__cache_size(td, sptr, ATS_DER, computed_size);
 
 	/*
 	 * Encode the TLV for the sequence itself.
@@ -583,6 +595,7 @@ SEQUENCE_encode_der(const asn_TYPE_descriptor_t *td, const void *sptr,
                 (const void *const *)((const char *)sptr + elm->memb_offset);
             if(!*memb_ptr2) continue;
 		} else {
+            if(ASN_SEQUENCE_INLINE_ABSENT(td, sptr, edx)) continue;
             memb_ptr = (const void *)((const char *)sptr + elm->memb_offset);
             memb_ptr2 = &memb_ptr;
 		}
@@ -591,6 +604,8 @@ SEQUENCE_encode_der(const asn_TYPE_descriptor_t *td, const void *sptr,
         if(elm->default_value_cmp && elm->default_value_cmp(*memb_ptr2) == 0)
             continue;
 
+		if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, *memb_ptr2, &tmperval))
+			return tmperval;
 		tmperval = elm->type->op->der_encoder(elm->type, *memb_ptr2,
 			elm->tag_mode, elm->tag, cb, app_key);
 		if(tmperval.encoded == -1)
@@ -670,6 +685,8 @@ SEQUENCE_decode_xer(const asn_codec_ctx_t *opt_codec_ctx,
 		pxer_chunk_type_e ch_type;	/* XER chunk type */
 		ssize_t ch_size;		/* Chunk size */
 		xer_check_tag_e tcv;		/* Tag check value */
+		const char *name;		/* Tag name */
+		size_t name_len;
 		asn_TYPE_member_t *elm;
 
 		/*
@@ -688,6 +705,7 @@ SEQUENCE_decode_xer(const asn_codec_ctx_t *opt_codec_ctx,
 			} else {
 				memb_ptr_dontuse = (char *)st + elm->memb_offset;
 				memb_ptr2 = &memb_ptr_dontuse;  /* Only use of memb_ptr_dontuse */
+				ASN_SEQUENCE_INLINE_MKPRESENT(td, st, edx);
 			}
 
 			if(elm->flags & ATF_OPEN_TYPE) {
@@ -728,7 +746,7 @@ SEQUENCE_decode_xer(const asn_codec_ctx_t *opt_codec_ctx,
 			}
 		}
 
-		tcv = xer_check_tag(ptr, ch_size, xml_tag);
+		tcv = xer_check_tag_name(ptr, ch_size, xml_tag, &name, &name_len);
 		ASN_DEBUG("XER/SEQUENCE: tcv = %d, ph=%d [%s]",
 			tcv, ctx->phase, xml_tag);
 
@@ -792,33 +810,20 @@ SEQUENCE_decode_xer(const asn_codec_ctx_t *opt_codec_ctx,
 				/*
 				 * Search which member corresponds to this tag.
 				 */
-				size_t n;
+				ssize_t n;
 				size_t edx_end = edx + elements[edx].optional + 1;
 				if(edx_end > td->elements_count)
 					edx_end = td->elements_count;
-				for(n = edx; n < edx_end; n++) {
-					elm = &td->elements[n];
-					tcv = xer_check_tag(ptr, ch_size, elm->name);
-					switch(tcv) {
-					case XCT_BOTH:
-					case XCT_OPENING:
-						/*
-						 * Process this member.
-						 */
-						ctx->step = edx = n;
-						ctx->phase = 2;
-						break;
-					case XCT_UNKNOWN_OP:
-					case XCT_UNKNOWN_BO:
-						continue;
-					default:
-						n = edx_end;
-						break;	/* Phase out */
-					}
-					break;
-				}
-				if(n != edx_end)
+				n = xer_find_member(td->elements, edx, edx_end,
+					specs->name2el, name, name_len);
+				if(n >= 0) {
+					/*
+					 * Process this member.
+					 */
+					ctx->step = edx = n;
+					ctx->phase = 2;
 					continue;
+				}
 			} else {
 				ASN_DEBUG("Out of defined members: %" ASN_PRI_SIZE "/%u",
 					edx, td->elements_count);
@@ -905,9 +910,14 @@ SEQUENCE_encode_xer(const asn_TYPE_descriptor_t *td, const void *sptr,
                 }
             }
         } else {
+            if(ASN_SEQUENCE_INLINE_ABSENT(td, sptr, edx)) continue;
             memb_ptr = (const void *)((const char *)sptr + elm->memb_offset);
         }
 
+        if(!tmp_def_val
+           && ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, &tmper))
+            return tmper;
+
         if(!xcan) ASN__TEXT_INDENT(1, ilevel);
         ASN__CALLBACK3("<", 1, mname, mlen, ">", 1);
 
@@ -938,11 +948,11 @@ SEQUENCE_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
     size_t edx;
 	int ret;
 
-	if(!sptr) return (cb("<absent>", 8, app_key) < 0) ? -1 : 0;
+	if(!sptr) return ASN__E_cbc("<absent>", 8) ? -1 : 0;
 
 	/* Dump preamble */
-	if(cb(td->name, strlen(td->name), app_key) < 0
-	|| cb(" ::= {", 6, app_key) < 0)
+	if(ASN__E_cbc(td->name, strlen(td->name))
+	|| ASN__E_cbc(" ::= {", 6))
 		return -1;
 
 	for(edx = 0; edx < td->elements_count; edx++) {
@@ -957,6 +967,7 @@ SEQUENCE_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
 				/* Fall through */
 			}
 		} else {
+			if(ASN_SEQUENCE_INLINE_ABSENT(td, sptr, edx)) continue;
 			memb_ptr = (const void *)((const char *)sptr + elm->memb_offset);
 		}
 
@@ -964,8 +975,8 @@ SEQUENCE_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
 		_i_INDENT(1);
 
 		/* Print the member's name and stuff */
-		if(cb(elm->name, strlen(elm->name), app_key) < 0
-		|| cb(": ", 2, app_key) < 0)
+		if(ASN__E_cbc(elm->name, strlen(elm->name))
+		|| ASN__E_cbc(": ", 2))
 			return -1;
 
 		/* Print the member itself */
@@ -977,7 +988,7 @@ SEQUENCE_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
 	ilevel--;
 	_i_INDENT(1);
 
-	return (cb("}", 1, app_key) < 0) ? -1 : 0;
+	return ASN__E_cbc("}", 1) ? -1 : 0;
 }
 
 void
@@ -1027,6 +1038,9 @@ SEQUENCE_free(const asn_TYPE_descriptor_t *td, void *sptr,
 int
 SEQUENCE_constraint(const asn_TYPE_descriptor_t *td, const void *sptr,
                     asn_app_constraint_failed_f *ctfailcb, void *app_key) {
+    const asn_SEQUENCE_specifics_t *specs =
+        (const asn_SEQUENCE_specifics_t *)td->specifics;
+    const asn_struct_ctx_t *ctx;
     size_t edx;
 
 	if(!sptr) {
@@ -1036,6 +1050,13 @@ SEQUENCE_constraint(const asn_TYPE_descriptor_t *td, const void *sptr,
 		return -1;
 	}
 
+	/* The members are checked by the encoder as it gets to them */
+	if(asn__encode_constraints) return 0;
+
+	/* Checked by asn_decode() already */
+	ctx = (const asn_struct_ctx_t *)((const char *)sptr + specs->ctx_offset);
+	if(ctx->constraints_ok) return 0;
+
 	/*
 	 * Iterate over structure members and check their validity.
 	 */
@@ -1054,6 +1075,7 @@ SEQUENCE_constraint(const asn_TYPE_descriptor_t *td, const void *sptr,
 				return -1;
 			}
 		} else {
+			if(ASN_SEQUENCE_INLINE_ABSENT(td, sptr, edx)) continue;
 			memb_ptr = (const void *)((const char *)sptr + elm->memb_offset);
 		}
 
@@ -1062,14 +1084,58 @@ SEQUENCE_constraint(const asn_TYPE_descriptor_t *td, const void *sptr,
 				ctfailcb, app_key);
 			if(ret) return ret;
 		} else {
-			return elm->type->encoding_constraints.general_constraints(elm->type,
-				memb_ptr, ctfailcb, app_key);
+			int ret = elm->type->encoding_constraints.general_constraints(
+				elm->type, memb_ptr, ctfailcb, app_key);
+			if(ret) return ret;
 		}
 	}
 
+	if(asn__decode_constraints) SEQUENCE_mark_constraints_ok(td, sptr);
+
 	return 0;
 }
 
+void
+SEQUENCE_mark_constraints_ok(const asn_TYPE_descriptor_t *td,
+                             const void *sptr) {
+    const asn_SEQUENCE_specifics_t *specs =
+        (const asn_SEQUENCE_specifics_t *)td->specifics;
+    /* Writable: asn_decode() has just produced it */
+    asn_struct_ctx_t *ctx =
+        (asn_struct_ctx_t *)((uintptr_t)sptr + specs->ctx_offset);
+    ctx->constraints_ok = 1;
+}
+
+int
+SEQUENCE__cached_size(const asn_TYPE_descriptor_t *td, const void *sptr,
+                      int syntax, size_t *size) {
+    const asn_SEQUENCE_specifics_t *specs =
+        (const asn_SEQUENCE_specifics_t *)td->specifics;
+    const asn_struct_ctx_t *ctx =
+        (const asn_struct_ctx_t *)((const char *)sptr + specs->ctx_offset);
+
+    if(!asn__encode_cache_sizes || ctx->encoded_syntax != syntax) return 0;
+
+    *size = ctx->encoded_size;
+    return 1;
+}
+
+void
+SEQUENCE__cache_size(const asn_TYPE_descriptor_t *td, const void *sptr,
+                     int syntax, size_t size) {
+    const asn_SEQUENCE_specifics_t *specs =
+        (const asn_SEQUENCE_specifics_t *)td->specifics;
+    /* Writable: asn_encoded_size_cached() takes it as such */
+    asn_struct_ctx_t *ctx =
+        (asn_struct_ctx_t *)((uintptr_t)sptr + specs->ctx_offset);
+
+    if(!asn__encode_cache_sizes) return;
+
+    /* The size first: the syntax tells it is there */
+    ctx->encoded_size = size;
+    ctx->encoded_syntax = syntax;
+}
+
 #ifndef ASN_DISABLE_PER_SUPPORT
 
 asn_dec_rval_t
@@ -1181,6 +1247,7 @@ SEQUENCE_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
 			FREEMEM(opres);
 			return rv;
 		}
+		ASN_SEQUENCE_INLINE_MKPRESENT(td, st, edx);
 	}
 
 	/* Optionality map is not needed anymore */
@@ -1244,6 +1311,7 @@ SEQUENCE_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
                 FREEMEM(epres);
                 return rv;
             }
+            ASN_SEQUENCE_INLINE_MKPRESENT(td, st, edx);
 	    }
 
 		/* Skip over overflow extensions which aren't present
@@ -1302,7 +1370,8 @@ SEQUENCE_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
 
 static int
 SEQUENCE__handle_extensions(const asn_TYPE_descriptor_t *td, const void *sptr,
-                            asn_per_outp_t *po1, asn_per_outp_t *po2) {
+                            asn_per_outp_t *po1, asn_per_outp_t *po2,
+                            asn_enc_rval_t *er) {
     const asn_SEQUENCE_specifics_t *specs =
         (const asn_SEQUENCE_specifics_t *)td->specifics;
     int exts_present = 0;
@@ -1328,7 +1397,7 @@ SEQUENCE__handle_extensions(const asn_TYPE_descriptor_t *td, const void *sptr,
         } else {
             memb_ptr = (const void *)((const char *)sptr + elm->memb_offset);
             memb_ptr2 = &memb_ptr;
-			present = 1;
+			present = !ASN_SEQUENCE_INLINE_ABSENT(td, sptr, edx);
 		}
 
         ASN_DEBUG("checking %s:%s (@%" ASN_PRI_SIZE ") present => %d", elm->name,
@@ -1342,19 +1411,20 @@ SEQUENCE__handle_extensions(const asn_TYPE_descriptor_t *td, const void *sptr,
         }
         /* Encode as open type field */
         if(po2 && present
-           && uper_open_type_put(elm->type,
-                                 elm->encoding_constraints.per_constraints,
-                                 *memb_ptr2, po2))
+           && (ASN__ENCODE_CONSTRAINTS_FAILED(elm, *memb_ptr2, er)
+               || uper_open_type_put(elm->type,
+                                     elm->encoding_constraints.per_constraints,
+                                     *memb_ptr2, po2)))
             return -1;
     }
 
     return exts_present ? exts_count : 0;
 }
 
-asn_enc_rval_t
-SEQUENCE_encode_uper(const asn_TYPE_descriptor_t *td,
-                     const asn_per_constraints_t *constraints, const void *sptr,
-                     asn_per_outp_t *po) {
+static asn_enc_rval_t
+SEQUENCE__encode_uper(const asn_TYPE_descriptor_t *td,
+                      const asn_per_constraints_t *constraints,
+                      const void *sptr, asn_per_outp_t *po) {
     const asn_SEQUENCE_specifics_t *specs
 		= (const asn_SEQUENCE_specifics_t *)td->specifics;
 	asn_enc_rval_t er;
@@ -1378,7 +1448,7 @@ SEQUENCE_encode_uper(const asn_TYPE_descriptor_t *td,
     if(specs->first_extension < 0) {
         n_extensions = 0; /* There are no extensions to encode */
     } else {
-        n_extensions = SEQUENCE__handle_extensions(td, sptr, 0, 0);
+        n_extensions = SEQUENCE__handle_extensions(td, sptr, 0, 0, 0);
         if(n_extensions < 0) ASN__ENCODE_FAILED;
         if(per_put_few_bits(po, n_extensions ? 1 : 0, 1)) {
             ASN__ENCODE_FAILED;
@@ -1403,7 +1473,7 @@ SEQUENCE_encode_uper(const asn_TYPE_descriptor_t *td,
 		} else {
             memb_ptr = (const void *)((const char *)sptr + elm->memb_offset);
             memb_ptr2 = &memb_ptr;
-			present = 1;
+			present = !ASN_SEQUENCE_INLINE_ABSENT(td, sptr, edx);
 		}
 
 		/* Eliminate default values */
@@ -1447,6 +1517,7 @@ SEQUENCE_encode_uper(const asn_TYPE_descriptor_t *td,
 				ASN__ENCODE_FAILED;
 			}
 		} else {
+            if(ASN_SEQUENCE_INLINE_ABSENT(td, sptr, edx)) continue;
             memb_ptr = (const void *)((const char *)sptr + elm->memb_offset);
             memb_ptr2 = &memb_ptr;
 		}
@@ -1455,6 +1526,8 @@ SEQUENCE_encode_uper(const asn_TYPE_descriptor_t *td,
 		if(elm->default_value_cmp && elm->default_value_cmp(*memb_ptr2) == 0)
 			continue;
 
+        if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, *memb_ptr2, &er)) return er;
+
         ASN_DEBUG("Encoding %s->%s:%s", td->name, elm->name, elm->type->name);
         er = elm->type->op->uper_encoder(
             elm->type, elm->encoding_constraints.per_constraints, *memb_ptr2,
@@ -1473,17 +1546,53 @@ SEQUENCE_encode_uper(const asn_TYPE_descriptor_t *td,
 	ASN_DEBUG("Bit-map of %d elements", n_extensions);
 	/* #18.7. Encoding the extensions presence bit-map. */
 	/* TODO: act upon NOTE in #18.7 for canonical PER */
-	if(SEQUENCE__handle_extensions(td, sptr, po, 0) != n_extensions)
+	if(SEQUENCE__handle_extensions(td, sptr, po, 0, 0) != n_extensions)
 		ASN__ENCODE_FAILED;
 
 	ASN_DEBUG("Writing %d extensions", n_extensions);
 	/* #18.9. Encode extensions as open type fields. */
-	if(SEQUENCE__handle_extensions(td, sptr, 0, po) != n_extensions)
+	if(SEQUENCE__handle_extensions(td, sptr, 0, po, &er) != n_extensions) {
+		if(er.encoded == -1) return er; /* Constraint check failed */
 		ASN__ENCODE_FAILED;
+	}
 
 	ASN__ENCODED_OK(er);
 }
 
+asn_enc_rval_t
+SEQUENCE_encode_uper(const asn_TYPE_descriptor_t *td,
+                     const asn_per_constraints_t *constraints, const void *sptr,
+                     asn_per_outp_t *po) {
+    asn_enc_rval_t er;
+    size_t start;
+    size_t bits;
+
+    if(!sptr || po->output != asn__count_bytes)
+        return SEQUENCE__encode_uper(td, constraints, sptr, po);
+
+    /*
+     * The output is only counted: account for the bits sized
+     * by asn_encoded_size_cached() already without producing them.
+     */
+    if(SEQUENCE__cached_size(td, sptr, ATS_UNALIGNED_BASIC_PER, &bits)) {
+        po->flushed_bytes += bits >> 3;
+        if(per_put_few_bits(po, 0, bits & 0x07)) ASN__ENCODE_FAILED;
+        er.encoded = 0;
+        ASN__ENCODED_OK(er);
+    }
+
+    start = ((po->flushed_bytes + (po->buffer - po->tmpspace)) << 3)
+            + po->nboff;
+    er = SEQUENCE__encode_uper(td, constraints, sptr, po);
+    if(er.encoded != -1) {
+        bits = ((po->flushed_bytes + (po->buffer - po->tmpspace)) << 3)
+               + po->nboff - start;
+        SEQUENCE__cache_size(td, sptr, ATS_UNALIGNED_BASIC_PER, bits);
+    }
+
+    return er;
+}
+
 #endif  /* ASN_DISABLE_PER_SUPPORT */
 
 int
@@ -1519,6 +1628,10 @@ SEQUENCE_compare(const asn_TYPE_descriptor_t *td, const void *aptr,
                 return 1;
             }
 		} else {
+            int apresent = !ASN_SEQUENCE_INLINE_ABSENT(td, aptr, edx);
+            int bpresent = !ASN_SEQUENCE_INLINE_ABSENT(td, bptr, edx);
+            if(apresent != bpresent) return apresent ? 1 : -1;
+            if(!apresent) continue;
             amemb = (const void *)((const char *)aptr + elm->memb_offset);
             bmemb = (const void *)((const char *)bptr + elm->memb_offset);
 		}
@@ -1530,14 +1643,73 @@ SEQUENCE_compare(const asn_TYPE_descriptor_t *td, const void *aptr,
     return 0;
 }
 
+int
+SEQUENCE_copy(const asn_TYPE_descriptor_t *td, void **dptr,
+              const void *sptr) {
+    const asn_SEQUENCE_specifics_t *specs =
+        (const asn_SEQUENCE_specifics_t *)td->specifics;
+    void *dst = *dptr;
+    int allocated = 0;
+    size_t edx;
+
+	if(!sptr) return -1;
+
+	if(!dst) {
+		dst = CALLOC(1, specs->struct_size);
+		if(!dst) return -1;
+		allocated = 1;
+	}
+
+	/*
+	 * The context, along with the constraints check mark and the size
+	 * of the encoding cached in it, is left zeroed in the copy.
+	 */
+	for(edx = 0; edx < td->elements_count; edx++) {
+		asn_TYPE_member_t *elm = &td->elements[edx];
+		const void *smemb;
+		void *dmemb;
+		int ret;
+
+		if(elm->flags & ATF_POINTER) {
+			smemb = *(const void *const *)((const char *)sptr
+				+ elm->memb_offset);
+			if(!smemb) continue;
+			ret = elm->type->op->copy_struct(elm->type,
+				(void **)((char *)dst + elm->memb_offset), smemb);
+		} else {
+			if(ASN_SEQUENCE_INLINE_ABSENT(td, sptr, edx)) continue;
+			smemb = (const void *)((const char *)sptr + elm->memb_offset);
+			dmemb = (void *)((char *)dst + elm->memb_offset);
+			ret = elm->type->op->copy_struct(elm->type, &dmemb, smemb);
+		}
+		if(ret) {
+			SEQUENCE_free(td, dst, allocated
+				? ASFM_FREE_EVERYTHING : ASFM_FREE_UNDERLYING_AND_RESET);
+			return -1;
+		}
+		ASN_SEQUENCE_INLINE_MKPRESENT(td, dst, edx);
+	}
+
+	*dptr = dst;
+	return 0;
+}
+
 asn_TYPE_operation_t asn_OP_SEQUENCE = {
 	SEQUENCE_free,
 	SEQUENCE_print,
 	SEQUENCE_compare,
+	SEQUENCE_copy,
 	SEQUENCE_decode_ber,
 	SEQUENCE_encode_der,
 	SEQUENCE_decode_xer,
 	SEQUENCE_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	SEQUENCE_decode_jer,
+	SEQUENCE_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef	ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
@@ -1604,6 +1776,7 @@ SEQUENCE_random_fill(const asn_TYPE_descriptor_t *td, void **sptr,
             max_length > result_ok.length ? max_length - result_ok.length : 0);
         switch(tmpres.code) {
         case ARFILL_OK:
+            ASN_SEQUENCE_INLINE_MKPRESENT(td, st, edx);
             result_ok.length += tmpres.length;
             continue;
         case ARFILL_SKIPPED:
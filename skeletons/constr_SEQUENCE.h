@@ -38,6 +38,11 @@ typedef struct asn_SEQUENCE_specifics_s {
 	 * whereas extensions are clustered at the end. -1 means not extensible.
 	 */
 	signed first_extension;       /* First extension addition */
+
+	/*
+	 * Member names to members mapping, for XER (optional).
+	 */
+	const asn_TYPE_name2member_t *name2el;
 } asn_SEQUENCE_specifics_t;
 
 
@@ -47,11 +52,14 @@ typedef struct asn_SEQUENCE_specifics_s {
 asn_struct_free_f SEQUENCE_free;
 asn_struct_print_f SEQUENCE_print;
 asn_struct_compare_f SEQUENCE_compare;
+asn_struct_copy_f SEQUENCE_copy;
 asn_constr_check_f SEQUENCE_constraint;
 ber_type_decoder_f SEQUENCE_decode_ber;
 der_type_encoder_f SEQUENCE_encode_der;
 xer_type_decoder_f SEQUENCE_decode_xer;
 xer_type_encoder_f SEQUENCE_encode_xer;
+jer_type_decoder_f SEQUENCE_decode_jer;
+jer_type_encoder_f SEQUENCE_encode_jer;
 oer_type_decoder_f SEQUENCE_decode_oer;
 oer_type_encoder_f SEQUENCE_encode_oer;
 per_type_decoder_f SEQUENCE_decode_uper;
@@ -59,6 +67,91 @@ per_type_encoder_f SEQUENCE_encode_uper;
 asn_random_fill_f  SEQUENCE_random_fill;
 extern asn_TYPE_operation_t asn_OP_SEQUENCE;
 
+/***********************
+ * Some handy helpers. *
+ ***********************/
+
+/*
+ * The OPTIONAL members stored inline (ATF_PRESENCE_MAP, asn1c
+ * -finline-optionals) are accompanied by the _presence_map bitmap,
+ * which immediately follows the _asn_ctx member of the structure.
+ * The bits are indexed by the member's position in the elements table.
+ */
+#define	ASN_SEQUENCE_PRESENCE_MAP(specs, seq_ptr)			\
+	((const char *)(seq_ptr) + (specs)->ctx_offset			\
+		+ sizeof(asn_struct_ctx_t))
+
+/*
+ * Figure out whether the inline OPTIONAL member is present.
+ */
+#define	ASN_SEQUENCE_ISPRESENT(seq_ptr, idx)				\
+	ASN_SEQUENCE_ISPRESENT2(&((seq_ptr)->_presence_map), idx)
+#define	ASN_SEQUENCE_ISPRESENT2(map_ptr, idx)				\
+	(((const unsigned int *)(map_ptr))				\
+		[(idx) / (8 * sizeof(unsigned int))]			\
+		& (1u << ((8 * sizeof(unsigned int)) - 1			\
+		- ((idx) % (8 * sizeof(unsigned int))))))
+
+#define	ASN_SEQUENCE_MKPRESENT(map_ptr, idx)				\
+	(((unsigned int *)(map_ptr))					\
+		[(idx) / (8 * sizeof(unsigned int))]			\
+		|= (1u << ((8 * sizeof(unsigned int)) - 1		\
+		- ((idx) % (8 * sizeof(unsigned int))))))
+
+#define	ASN_SEQUENCE_MKABSENT(map_ptr, idx)				\
+	(((unsigned int *)(map_ptr))					\
+		[(idx) / (8 * sizeof(unsigned int))]			\
+		&= ~(1u << ((8 * sizeof(unsigned int)) - 1		\
+		- ((idx) % (8 * sizeof(unsigned int))))))
+
+/*
+ * Tell whether the td's member at index idx is an inline OPTIONAL member
+ * which is not present in the given structure (shall be skipped).
+ */
+#define	ASN_SEQUENCE_INLINE_ABSENT(td, seq_ptr, idx)			\
+	(((td)->elements[idx].flags & ATF_PRESENCE_MAP)			\
+	&& !ASN_SEQUENCE_ISPRESENT2(ASN_SEQUENCE_PRESENCE_MAP(		\
+		(const asn_SEQUENCE_specifics_t *)(td)->specifics,	\
+		(seq_ptr)), (idx)))
+
+/*
+ * Record the presence of the td's member at index idx after decoding it,
+ * if that member is an inline OPTIONAL one.
+ */
+#define	ASN_SEQUENCE_INLINE_MKPRESENT(td, seq_ptr, idx)	do {		\
+	if((td)->elements[idx].flags & ATF_PRESENCE_MAP)		\
+		ASN_SEQUENCE_MKPRESENT((char *)(seq_ptr)		\
+			+ ((const asn_SEQUENCE_specifics_t *)		\
+				(td)->specifics)->ctx_offset		\
+			+ sizeof(asn_struct_ctx_t), (idx));		\
+	} while(0)
+
+/*
+ * The structure has passed the constraints check made by asn_decode()
+ * (asn_codec_ctx_t.check_constraints) and is not going to be checked again.
+ * Clear the mark after modifying the structure, and the enclosing
+ * SEQUENCE structures as well.
+ */
+#define	ASN_SEQUENCE_CONSTRAINTS_OK(seq_ptr)				\
+	((seq_ptr)->_asn_ctx.constraints_ok)
+#define	ASN_SEQUENCE_CONSTRAINTS_UNKNOWN(seq_ptr)			\
+	((seq_ptr)->_asn_ctx.constraints_ok = 0)
+void SEQUENCE_mark_constraints_ok(const asn_TYPE_descriptor_t *td,
+                                  const void *sptr);
+
+/*
+ * The size of the encoding cached by asn_encoded_size_cached() and reused
+ * by it.
+ * Clear it after modifying the structure, and in the enclosing SEQUENCE
+ * structures as well.
+ */
+#define	ASN_SEQUENCE_ENCODED_SIZE_UNKNOWN(seq_ptr)			\
+	((seq_ptr)->_asn_ctx.encoded_syntax = 0)
+int SEQUENCE__cached_size(const asn_TYPE_descriptor_t *td, const void *sptr,
+                          int syntax, size_t *size);
+void SEQUENCE__cache_size(const asn_TYPE_descriptor_t *td, const void *sptr,
+                          int syntax, size_t size);
+
 #ifdef __cplusplus
 }
 #endif
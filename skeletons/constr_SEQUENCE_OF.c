@@ -63,6 +63,8 @@ SEQUENCE_OF_encode_der(const asn_TYPE_descriptor_t *td, const void *ptr,
 	for(edx = 0; edx < list->count; edx++) {
 		void *memb_ptr = list->array[edx];
 		if(!memb_ptr) continue;
+		if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, &erval))
+			return erval;
 		erval = elm->type->op->der_encoder(elm->type, memb_ptr,
 			0, elm->tag,
 			cb, app_key);
@@ -111,6 +113,8 @@ SEQUENCE_OF_encode_xer(const asn_TYPE_descriptor_t *td, const void *sptr,
         void *memb_ptr = list->array[i];
         if(!memb_ptr) continue;
 
+        if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, &tmper)) return tmper;
+
         if(mname) {
             if(!xcan) ASN__TEXT_INDENT(1, ilevel);
             ASN__CALLBACK3("<", 1, mname, mlen, ">", 1);
@@ -210,6 +214,7 @@ SEQUENCE_OF_encode_uper(const asn_TYPE_descriptor_t *td,
         for(edx = encoded_edx; edx < encoded_edx + may_encode; edx++) {
             void *memb_ptr = list->array[edx];
             if(!memb_ptr) ASN__ENCODE_FAILED;
+            if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, &er)) return er;
             er = elm->type->op->uper_encoder(
                 elm->type, elm->encoding_constraints.per_constraints, memb_ptr,
                 po);
@@ -260,10 +265,18 @@ asn_TYPE_operation_t asn_OP_SEQUENCE_OF = {
 	SEQUENCE_OF_free,
 	SEQUENCE_OF_print,
 	SEQUENCE_OF_compare,
+	SEQUENCE_OF_copy,
 	SEQUENCE_OF_decode_ber,
 	SEQUENCE_OF_encode_der,
 	SEQUENCE_OF_decode_xer,
 	SEQUENCE_OF_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	SEQUENCE_OF_decode_jer,
+	SEQUENCE_OF_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef	ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
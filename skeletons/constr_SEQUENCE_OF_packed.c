@@ -0,0 +1,1025 @@
+/*
+ * Redistribution and modifications are permitted subject to BSD license.
+ */
+#include <asn_internal.h>
+#include <constr_SEQUENCE_OF_packed.h>
+#include <asn_SEQUENCE_OF.h>
+#include <NativeInteger.h>
+
+/*
+ * Number of bytes left for this structure.
+ * (ctx->left) indicates the number of bytes _transferred_ for the structure.
+ * (size) contains the number of bytes in the buffer passed.
+ */
+#define	LEFT	((size<(size_t)ctx->left)?size:(size_t)ctx->left)
+
+/*
+ * The value of the element wants more data than the <TLV>'s L allows,
+ * see constr_SET_OF.c.
+ */
+#define	SIZE_VIOLATION	(ctx->left >= 0 && (size_t)ctx->left <= size)
+
+/*
+ * This macro "eats" the part of the buffer which is definitely "consumed",
+ * i.e. was correctly converted into local representation or rightfully skipped.
+ */
+#undef	ADVANCE
+#define	ADVANCE(num_bytes)	do {		\
+		size_t num = num_bytes;		\
+		ptr = ((const char *)ptr) + num;\
+		size -= num;			\
+		if(ctx->left >= 0)		\
+			ctx->left -= num;	\
+		consumed_myself += num;		\
+	} while(0)
+
+/*
+ * Switch to the next phase of parsing.
+ */
+#undef	NEXT_PHASE
+#undef	PHASE_OUT
+#define	NEXT_PHASE(ctx)	do {			\
+		ctx->phase++;			\
+		ctx->step = 0;			\
+	} while(0)
+#define	PHASE_OUT(ctx)	do { ctx->phase = 10; } while(0)
+
+/*
+ * Return a standardized complex structure.
+ */
+#undef	RETURN
+#define	RETURN(_code)	do {			\
+		rval.code = _code;		\
+		rval.consumed = consumed_myself;\
+		return rval;			\
+	} while(0)
+
+/*
+ * Make room for one more value and clear it for the element decoder.
+ */
+static void *
+SEQUENCE_OF_packed__next(const asn_SET_OF_specifics_t *specs,
+                         asn_anonymous_sequence_values_ *list) {
+	void *memb_ptr;
+
+	if(asn_sequence_values_grow(list, specs->element_size))
+		return 0;
+
+	memb_ptr = SEQUENCE_OF_packed__value(specs, list, list->count);
+	memset(memb_ptr, 0, specs->element_size);
+	return memb_ptr;
+}
+
+/*
+ * The decoder of the SEQUENCE OF values.
+ */
+asn_dec_rval_t
+SEQUENCE_OF_packed_decode_ber(const asn_codec_ctx_t *opt_codec_ctx,
+                              const asn_TYPE_descriptor_t *td,
+                              void **struct_ptr, const void *ptr, size_t size,
+                              int tag_mode) {
+	const asn_SET_OF_specifics_t *specs = (const asn_SET_OF_specifics_t *)td->specifics;
+	const asn_TYPE_member_t *elm = td->elements; /* Single one */
+	void *st = *struct_ptr;	/* Target structure. */
+	asn_anonymous_sequence_values_ *list;
+	asn_struct_ctx_t *ctx;	/* Decoder context */
+	ber_tlv_tag_t tlv_tag;	/* T from TLV */
+	asn_dec_rval_t rval;	/* Return code from subparsers */
+	ssize_t consumed_myself = 0;	/* Consumed bytes from ptr */
+
+	ASN_DEBUG("Decoding %s as SEQUENCE OF values", td->name);
+
+	/*
+	 * Create the target structure if it is not present already.
+	 */
+	if(st == 0) {
+		st = *struct_ptr = CALLOC(1, specs->struct_size);
+		if(st == 0) {
+			RETURN(RC_FAIL);
+		}
+	}
+	list = _A_SEQUENCE_VALUES_FROM_VOID(st);
+
+	/*
+	 * Restore parsing context.
+	 */
+	ctx = (asn_struct_ctx_t *)((char *)st + specs->ctx_offset);
+
+	/*
+	 * Start to parse where left previously
+	 */
+	switch(ctx->phase) {
+	case 0:
+		/*
+		 * PHASE 0.
+		 * Check that the set of tags associated with given structure
+		 * perfectly fits our expectations.
+		 */
+		rval = ber_check_tags(opt_codec_ctx, td, ctx, ptr, size,
+			tag_mode, 1, &ctx->left, 0);
+		if(rval.code != RC_OK) {
+			ASN_DEBUG("%s tagging check failed: %d",
+				td->name, rval.code);
+			return rval;
+		}
+
+		if(ctx->left >= 0)
+			ctx->left += rval.consumed; /* ?Substracted below! */
+		ADVANCE(rval.consumed);
+
+		NEXT_PHASE(ctx);
+		/* Fall through */
+	case 1:
+		/*
+		 * PHASE 1.
+		 * Decode the values one by one, right into the array.
+		 * The element decoders either decode the whole value,
+		 * or consume nothing.
+		 */
+	  for(;;) {
+		ssize_t tag_len;	/* Length of TLV's T */
+		void *memb_ptr;
+
+		if(ctx->left == 0) {
+			ASN_DEBUG("End of SEQUENCE OF %s", td->name);
+			PHASE_OUT(ctx);
+			RETURN(RC_OK);
+		}
+
+		tag_len = ber_fetch_tag(ptr, LEFT, &tlv_tag);
+		switch(tag_len) {
+		case 0: if(!SIZE_VIOLATION) RETURN(RC_WMORE);
+			/* Fall through */
+		case -1: RETURN(RC_FAIL);
+		}
+
+		if(ctx->left < 0 && ((const uint8_t *)ptr)[0] == 0) {
+			if(LEFT < 2) {
+				if(SIZE_VIOLATION)
+					RETURN(RC_FAIL);
+				else
+					RETURN(RC_WMORE);
+			} else if(((const uint8_t *)ptr)[1] == 0) {
+				/*
+				 * Found the terminator of the
+				 * indefinite length structure.
+				 */
+				break;
+			}
+		}
+
+		if(!BER_TAGS_EQUAL(tlv_tag, elm->tag)) {
+			ASN_DEBUG("Unexpected tag %s in SEQUENCE OF %s",
+				ber_tlv_tag_string(tlv_tag), td->name);
+			RETURN(RC_FAIL);
+		}
+
+		memb_ptr = SEQUENCE_OF_packed__next(specs, list);
+		if(!memb_ptr) RETURN(RC_FAIL);
+
+		rval = elm->type->op->ber_decoder(opt_codec_ctx,
+				elm->type, &memb_ptr, ptr, LEFT, 0);
+		switch(rval.code) {
+		case RC_OK:
+			list->count++;
+			break;
+		case RC_WMORE: /* More data expected */
+			if(!SIZE_VIOLATION) {
+				ADVANCE(rval.consumed);
+				RETURN(RC_WMORE);
+			}
+			/* Fall through */
+		case RC_FAIL: /* Fatal error */
+			RETURN(RC_FAIL);
+		} /* switch(rval) */
+
+		ADVANCE(rval.consumed);
+	  }	/* for(all list members) */
+
+		NEXT_PHASE(ctx);
+		/* Fall through */
+	case 2:
+		/*
+		 * Read in all "end of content" TLVs.
+		 */
+		while(ctx->left < 0) {
+			if(LEFT < 2) {
+				if(LEFT > 0 && ((const char *)ptr)[0] != 0) {
+					/* Unexpected tag */
+					RETURN(RC_FAIL);
+				} else {
+					RETURN(RC_WMORE);
+				}
+			}
+			if(((const char *)ptr)[0] == 0
+			&& ((const char *)ptr)[1] == 0) {
+				ADVANCE(2);
+				ctx->left++;
+			} else {
+				RETURN(RC_FAIL);
+			}
+		}
+
+		PHASE_OUT(ctx);
+	}
+
+	RETURN(RC_OK);
+}
+
+int
+SEQUENCE_OF_packed__encode_check(const asn_TYPE_descriptor_t *td,
+                                 const void *sptr, asn_enc_rval_t *rval) {
+	const asn_SET_OF_specifics_t *specs = (const asn_SET_OF_specifics_t *)td->specifics;
+	const asn_anonymous_sequence_values_ *list = _A_CSEQUENCE_VALUES_FROM_VOID(sptr);
+	const asn_TYPE_member_t *elm = td->elements;
+	asn_constr_check_f *constr;
+	int i;
+
+	if(specs->values_constraint && specs->values_constraint(sptr) == 0)
+		return 0;
+
+	constr = elm->encoding_constraints.general_constraints;
+	if(!constr) constr = elm->type->encoding_constraints.general_constraints;
+	if(constr == asn_generic_no_constraint)
+		return 0;
+
+	/* Find the offending value */
+	for(i = 0; i < list->count; i++) {
+		if(asn__encode_check_member(elm,
+			SEQUENCE_OF_packed__value(specs, list, i), rval))
+			return -1;
+	}
+
+	return 0;
+}
+
+/*
+ * The DER encoder of the SEQUENCE OF values.
+ */
+asn_enc_rval_t
+SEQUENCE_OF_packed_encode_der(const asn_TYPE_descriptor_t *td,
+                              const void *sptr, int tag_mode,
+                              ber_tlv_tag_t tag, asn_app_consume_bytes_f *cb,
+                              void *app_key) {
+	const asn_SET_OF_specifics_t *specs = (const asn_SET_OF_specifics_t *)td->specifics;
+	const asn_TYPE_member_t *elm = td->elements;
+	const asn_anonymous_sequence_values_ *list = _A_CSEQUENCE_VALUES_FROM_VOID(sptr);
+	size_t computed_size = 0;
+	ssize_t encoding_size = 0;
+	asn_enc_rval_t erval;
+	int edx;
+
+	if(!sptr) ASN__ENCODE_FAILED;
+
+	/*
+	 * Gather the length of the underlying members sequence.
+	 */
+	for(edx = 0; edx < list->count; edx++) {
+		erval = elm->type->op->der_encoder(elm->type,
+			SEQUENCE_OF_packed__value(specs, list, edx), 0, elm->tag,
+			0, 0);
+		if(erval.encoded == -1)
+			return erval;
+		computed_size += erval.encoded;
+	}
+
+	/*
+	 * Encode the TLV for the sequence itself.
+	 */
+	encoding_size = der_write_tags(td, computed_size, tag_mode, 1, tag,
+		cb, app_key);
+	if(encoding_size == -1) {
+		erval.encoded = -1;
+		erval.failed_type = td;
+		erval.structure_ptr = sptr;
+		return erval;
+	}
+
+	computed_size += encoding_size;
+	if(!cb) {
+		erval.encoded = computed_size;
+		ASN__ENCODED_OK(erval);
+	}
+
+	if(asn__encode_constraints
+	&& SEQUENCE_OF_packed__encode_check(td, sptr, &erval))
+		return erval;
+
+	/*
+	 * Encode all members.
+	 */
+	for(edx = 0; edx < list->count; edx++) {
+		erval = elm->type->op->der_encoder(elm->type,
+			SEQUENCE_OF_packed__value(specs, list, edx), 0, elm->tag,
+			cb, app_key);
+		if(erval.encoded == -1)
+			return erval;
+		encoding_size += erval.encoded;
+	}
+
+	if(computed_size != (size_t)encoding_size) {
+		/*
+		 * Encoded size is not equal to the computed size.
+		 */
+		erval.encoded = -1;
+		erval.failed_type = td;
+		erval.structure_ptr = sptr;
+	} else {
+		erval.encoded = computed_size;
+		erval.structure_ptr = 0;
+		erval.failed_type = 0;
+	}
+
+	return erval;
+}
+
+#undef	XER_ADVANCE
+#define	XER_ADVANCE(num_bytes)	do {			\
+		size_t num = num_bytes;			\
+		buf_ptr = ((const char *)buf_ptr) + num;\
+		size -= num;				\
+		consumed_myself += num;			\
+	} while(0)
+
+/*
+ * Decode the XER (XML) data.
+ */
+asn_dec_rval_t
+SEQUENCE_OF_packed_decode_xer(const asn_codec_ctx_t *opt_codec_ctx,
+                              const asn_TYPE_descriptor_t *td,
+                              void **struct_ptr, const char *opt_mname,
+                              const void *buf_ptr, size_t size) {
+	const asn_SET_OF_specifics_t *specs = (const asn_SET_OF_specifics_t *)td->specifics;
+	const asn_TYPE_member_t *element = td->elements;
+	const char *elm_tag;
+	const char *xml_tag = opt_mname ? opt_mname : td->xml_tag;
+	void *st = *struct_ptr;	/* Target structure. */
+	asn_anonymous_sequence_values_ *list;
+	asn_struct_ctx_t *ctx;	/* Decoder context */
+	asn_dec_rval_t rval;		/* Return value from a decoder */
+	ssize_t consumed_myself = 0;	/* Consumed bytes from ptr */
+
+	/*
+	 * Create the target structure if it is not present already.
+	 */
+	if(st == 0) {
+		st = *struct_ptr = CALLOC(1, specs->struct_size);
+		if(st == 0) RETURN(RC_FAIL);
+	}
+	list = _A_SEQUENCE_VALUES_FROM_VOID(st);
+
+	/* Which tag is expected for the downstream */
+	if(specs->as_XMLValueList) {
+		elm_tag = (specs->as_XMLValueList == 1) ? 0 : "";
+	} else {
+		elm_tag = (*element->name)
+				? element->name : element->type->xml_tag;
+	}
+
+	/*
+	 * Restore parsing context.
+	 */
+	ctx = (asn_struct_ctx_t *)((char *)st + specs->ctx_offset);
+
+	/*
+	 * Phases of XER/XML processing:
+	 * Phase 0: Check that the opening tag matches our expectations.
+	 * Phase 1: Processing body and reacting on closing tag.
+	 * Phase 2: Processing inner type, the value past the (count) ones.
+	 */
+	for(; ctx->phase <= 2;) {
+		pxer_chunk_type_e ch_type;	/* XER chunk type */
+		ssize_t ch_size;		/* Chunk size */
+		xer_check_tag_e tcv;		/* Tag check value */
+
+		/*
+		 * Go inside the inner member of a set.
+		 */
+		if(ctx->phase == 2) {
+			asn_dec_rval_t tmprval;
+			void *memb_ptr = SEQUENCE_OF_packed__value(specs, list,
+				list->count);
+
+			/* Invoke the inner type decoder, m.b. multiple times */
+			ASN_DEBUG("XER/SEQUENCE OF element [%s]", elm_tag);
+			tmprval = element->type->op->xer_decoder(opt_codec_ctx,
+					element->type, &memb_ptr, elm_tag,
+					buf_ptr, size);
+			XER_ADVANCE(tmprval.consumed);
+			if(tmprval.code != RC_OK)
+				RETURN(tmprval.code);
+			list->count++;
+			ctx->phase = 1;	/* Back to body processing */
+			/* Fall through */
+		}
+
+		/*
+		 * Get the next part of the XML stream.
+		 */
+		ch_size = xer_next_token(&ctx->context,
+			buf_ptr, size, &ch_type);
+		if(ch_size == -1) {
+			RETURN(RC_FAIL);
+		} else {
+			switch(ch_type) {
+			case PXER_WMORE:
+				RETURN(RC_WMORE);
+			case PXER_COMMENT:	/* Got XML comment */
+			case PXER_TEXT:		/* Ignore free-standing text */
+				XER_ADVANCE(ch_size);	/* Skip silently */
+				continue;
+			case PXER_TAG:
+				break;	/* Check the rest down there */
+			}
+		}
+
+		tcv = xer_check_tag(buf_ptr, ch_size, xml_tag);
+		switch(tcv) {
+		case XCT_CLOSING:
+			if(ctx->phase == 0) break;
+			ctx->phase = 0;
+			/* Fall through */
+		case XCT_BOTH:
+			if(ctx->phase == 0) {
+				/* No more things to decode */
+				XER_ADVANCE(ch_size);
+				ctx->phase = 3;	/* Phase out */
+				RETURN(RC_OK);
+			}
+			/* Fall through */
+		case XCT_OPENING:
+			if(ctx->phase == 0) {
+				XER_ADVANCE(ch_size);
+				ctx->phase = 1;	/* Processing body phase */
+				continue;
+			}
+			/* Fall through */
+		case XCT_UNKNOWN_OP:
+		case XCT_UNKNOWN_BO:
+			if(ctx->phase == 1) {
+				/*
+				 * Process a single possible member.
+				 */
+				if(!SEQUENCE_OF_packed__next(specs, list))
+					break;
+				ctx->phase = 2;
+				continue;
+			}
+			/* Fall through */
+		default:
+			break;
+		}
+
+		ASN_DEBUG("Unexpected XML tag in SEQUENCE OF");
+		break;
+	}
+
+	ctx->phase = 3;	/* "Phase out" on hard failure */
+	RETURN(RC_FAIL);
+}
+
+asn_enc_rval_t
+SEQUENCE_OF_packed_encode_xer(const asn_TYPE_descriptor_t *td,
+                              const void *sptr, int ilevel,
+                              enum xer_encoder_flags_e flags,
+                              asn_app_consume_bytes_f *cb, void *app_key) {
+    asn_enc_rval_t er;
+    const asn_SET_OF_specifics_t *specs = (const asn_SET_OF_specifics_t *)td->specifics;
+    const asn_TYPE_member_t *elm = td->elements;
+    const asn_anonymous_sequence_values_ *list = _A_CSEQUENCE_VALUES_FROM_VOID(sptr);
+    const char *mname = specs->as_XMLValueList
+                            ? 0
+                            : ((*elm->name) ? elm->name : elm->type->xml_tag);
+    size_t mlen = mname ? strlen(mname) : 0;
+    int xcan = (flags & XER_F_CANONICAL);
+    int i;
+
+    if(!sptr) ASN__ENCODE_FAILED;
+
+    if(asn__encode_constraints
+       && SEQUENCE_OF_packed__encode_check(td, sptr, &er))
+        return er;
+
+    er.encoded = 0;
+
+    for(i = 0; i < list->count; i++) {
+        asn_enc_rval_t tmper;
+
+        if(mname) {
+            if(!xcan) ASN__TEXT_INDENT(1, ilevel);
+            ASN__CALLBACK3("<", 1, mname, mlen, ">", 1);
+        }
+
+        tmper = elm->type->op->xer_encoder(
+            elm->type, SEQUENCE_OF_packed__value(specs, list, i), ilevel + 1,
+            flags, cb, app_key);
+        if(tmper.encoded == -1) return tmper;
+        er.encoded += tmper.encoded;
+        if(tmper.encoded == 0 && specs->as_XMLValueList) {
+            const char *name = elm->type->xml_tag;
+            size_t len = strlen(name);
+            if(!xcan) ASN__TEXT_INDENT(1, ilevel + 1);
+            ASN__CALLBACK3("<", 1, name, len, "/>", 2);
+        }
+
+        if(mname) {
+            ASN__CALLBACK3("</", 2, mname, mlen, ">", 1);
+        }
+    }
+
+    if(!xcan) ASN__TEXT_INDENT(1, ilevel - 1);
+
+    ASN__ENCODED_OK(er);
+cb_failed:
+    ASN__ENCODE_FAILED;
+}
+
+int
+SEQUENCE_OF_packed_print(const asn_TYPE_descriptor_t *td, const void *sptr,
+                         int ilevel, asn_app_consume_bytes_f *cb,
+                         void *app_key) {
+	const asn_SET_OF_specifics_t *specs = (const asn_SET_OF_specifics_t *)td->specifics;
+	const asn_TYPE_member_t *elm = td->elements;
+	const asn_anonymous_sequence_values_ *list = _A_CSEQUENCE_VALUES_FROM_VOID(sptr);
+	int ret;
+	int i;
+
+	if(!sptr) return ASN__E_cbc("<absent>", 8) ? -1 : 0;
+
+	/* Dump preamble */
+	if(ASN__E_cbc(td->name, strlen(td->name))
+	|| ASN__E_cbc(" ::= {", 6))
+		return -1;
+
+	for(i = 0; i < list->count; i++) {
+		_i_INDENT(1);
+
+		ret = elm->type->op->print_struct(elm->type,
+			SEQUENCE_OF_packed__value(specs, list, i),
+			ilevel + 1, cb, app_key);
+		if(ret) return ret;
+	}
+
+	ilevel--;
+	_i_INDENT(1);
+
+	return ASN__E_cbc("}", 1) ? -1 : 0;
+}
+
+void
+SEQUENCE_OF_packed_free(const asn_TYPE_descriptor_t *td, void *ptr,
+                        enum asn_struct_free_method method) {
+    if(td && ptr) {
+		const asn_SET_OF_specifics_t *specs =
+			(const asn_SET_OF_specifics_t *)td->specifics;
+
+		/* The values own no memory of their own */
+		asn_sequence_values_empty(ptr);
+
+        switch(method) {
+        case ASFM_FREE_EVERYTHING:
+            FREEMEM(ptr);
+            break;
+        case ASFM_FREE_UNDERLYING:
+            break;
+        case ASFM_FREE_UNDERLYING_AND_RESET:
+            memset(ptr, 0, specs->struct_size);
+            break;
+        }
+    }
+}
+
+int
+SEQUENCE_OF_packed_constraint(const asn_TYPE_descriptor_t *td,
+                              const void *sptr,
+                              asn_app_constraint_failed_f *ctfailcb,
+                              void *app_key) {
+	const asn_SET_OF_specifics_t *specs = (const asn_SET_OF_specifics_t *)td->specifics;
+	const asn_TYPE_member_t *elm = td->elements;
+	const asn_anonymous_sequence_values_ *list = _A_CSEQUENCE_VALUES_FROM_VOID(sptr);
+	asn_constr_check_f *constr;
+	int i;
+
+	if(!sptr) {
+		ASN__CTFAIL(app_key, td, sptr,
+			"%s: value not given (%s:%d)",
+			td->name, __FILE__, __LINE__);
+		return -1;
+	}
+
+	/* The values are checked by the encoder before it gets to them */
+	if(asn__encode_constraints) return 0;
+
+	/* All good, most likely */
+	if(specs->values_constraint && specs->values_constraint(sptr) == 0)
+		return 0;
+
+	constr = elm->encoding_constraints.general_constraints;
+	if(!constr) constr = elm->type->encoding_constraints.general_constraints;
+	if(constr == asn_generic_no_constraint)
+		return 0;
+
+	/*
+	 * Validate each value in turn, until one fails.
+	 */
+	for(i = 0; i < list->count; i++) {
+		int ret = constr(elm->type,
+			SEQUENCE_OF_packed__value(specs, list, i), ctfailcb,
+			app_key);
+		if(ret) return ret;
+	}
+
+	return 0;
+}
+
+#ifndef ASN_DISABLE_PER_SUPPORT
+
+/*
+ * The constraint of the native signed INTEGER values which are the
+ * constrained whole numbers in PER, transferred right here bypassing
+ * the INTEGER_t conversions of NativeInteger_decode_uper() and
+ * NativeInteger_encode_uper(). NULL for the other elements.
+ */
+static const asn_per_constraint_t *
+SEQUENCE_OF_packed__whole_number(const asn_TYPE_member_t *elm) {
+	const asn_INTEGER_specifics_t *specs =
+		(const asn_INTEGER_specifics_t *)elm->type->specifics;
+	const asn_per_constraints_t *pc = elm->encoding_constraints.per_constraints;
+
+	if(elm->type->op != &asn_OP_NativeInteger
+	|| (specs && specs->field_unsigned))
+		return 0;
+
+	if(!pc) pc = elm->type->encoding_constraints.per_constraints;
+	if(!pc || pc->value.flags != APC_CONSTRAINED
+	|| pc->value.range_bits < 0
+	|| (size_t)pc->value.range_bits > 8 * sizeof(unsigned long))
+		return 0;
+
+	return &pc->value;
+}
+
+asn_dec_rval_t
+SEQUENCE_OF_packed_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
+                               const asn_TYPE_descriptor_t *td,
+                               const asn_per_constraints_t *constraints,
+                               void **sptr, asn_per_data_t *pd) {
+	const asn_SET_OF_specifics_t *specs = (const asn_SET_OF_specifics_t *)td->specifics;
+	const asn_TYPE_member_t *elm = td->elements; /* Single one */
+	const asn_per_constraint_t *vct = SEQUENCE_OF_packed__whole_number(elm);
+	asn_anonymous_sequence_values_ *list;
+	const asn_per_constraint_t *ct;
+	asn_dec_rval_t rv;
+	void *st = *sptr;
+	int repeat = 0;
+	ssize_t nelems;
+
+	if(ASN__STACK_OVERFLOW_CHECK(opt_codec_ctx))
+		ASN__DECODE_FAILED;
+
+	/*
+	 * Create the target structure if it is not present already.
+	 */
+	if(!st) {
+		st = *sptr = CALLOC(1, specs->struct_size);
+		if(!st) ASN__DECODE_FAILED;
+	}
+	list = _A_SEQUENCE_VALUES_FROM_VOID(st);
+
+	/* Figure out which constraints to use */
+	if(constraints) ct = &constraints->size;
+	else if(td->encoding_constraints.per_constraints)
+		ct = &td->encoding_constraints.per_constraints->size;
+	else ct = 0;
+
+	if(ct && ct->flags & APC_EXTENSIBLE) {
+		int value = per_get_few_bits(pd, 1);
+		if(value < 0) ASN__DECODE_STARVED;
+		if(value) ct = 0;	/* Not restricted! */
+	}
+
+	if(ct && ct->effective_bits >= 0) {
+		/* X.691, #19.5: No length determinant */
+		nelems = per_get_few_bits(pd, ct->effective_bits);
+		if(nelems < 0)  ASN__DECODE_STARVED;
+		nelems += ct->lower_bound;
+	} else {
+		nelems = -1;
+	}
+
+	do {
+		size_t avail;
+		int i;
+		if(nelems < 0) {
+			nelems = uper_get_length(pd, -1, 0, &repeat);
+			if(nelems < 0) ASN__DECODE_STARVED;
+		}
+
+		/*
+		 * Size the array for all these values at once, but not
+		 * for more of them than the remaining bits could encode.
+		 */
+		avail = pd->nbits - pd->nboff;
+		if((size_t)nelems < avail) avail = nelems;
+		if(avail > (size_t)(INT_MAX - list->count))
+			avail = INT_MAX - list->count;
+		if(asn_sequence_values_reserve(list, specs->element_size,
+				list->count + (int)avail))
+			ASN__DECODE_FAILED;
+
+		if(vct) {
+			/* Protect from the compression bombs of the zero-bit values */
+			if(vct->range_bits == 0 && nelems > 200)
+				ASN__DECODE_FAILED;
+
+			/* The constrained whole numbers, in a tight loop */
+			for(i = 0; i < nelems; i++) {
+				unsigned long uvalue;
+				if(asn_sequence_values_grow(list, specs->element_size))
+					ASN__DECODE_FAILED;
+				if(uper_get_constrained_whole_number(pd, &uvalue,
+						vct->range_bits))
+					ASN__DECODE_STARVED;
+				if(per_long_range_unrebase(uvalue, vct->lower_bound,
+						vct->upper_bound,
+						(long *)list->array + list->count))
+					ASN__DECODE_FAILED;
+				list->count++;
+			}
+		} else {
+			for(i = 0; i < nelems; i++) {
+				void *memb_ptr = SEQUENCE_OF_packed__next(specs, list);
+				size_t moved = pd->moved;
+				if(!memb_ptr) ASN__DECODE_FAILED;
+				rv = elm->type->op->uper_decoder(opt_codec_ctx,
+					elm->type,
+					elm->encoding_constraints.per_constraints,
+					&memb_ptr, pd);
+				if(rv.code != RC_OK) {
+					ASN_DEBUG("Failed decoding %s of %s (SEQUENCE OF)",
+						elm->type->name, td->name);
+					return rv;
+				}
+				list->count++;
+				if(pd->moved == moved && nelems > 200) {
+					/* Protect from the compression bombs */
+					ASN__DECODE_FAILED;
+				}
+			}
+		}
+
+		nelems = -1;	/* Allow uper_get_length() */
+	} while(repeat);
+
+	ASN_DEBUG("Decoded %s as SEQUENCE OF values", td->name);
+
+	rv.code = RC_OK;
+	rv.consumed = 0;
+	return rv;
+}
+
+asn_enc_rval_t
+SEQUENCE_OF_packed_encode_uper(const asn_TYPE_descriptor_t *td,
+                               const asn_per_constraints_t *constraints,
+                               const void *sptr, asn_per_outp_t *po) {
+	const asn_SET_OF_specifics_t *specs = (const asn_SET_OF_specifics_t *)td->specifics;
+	const asn_TYPE_member_t *elm = td->elements;
+	const asn_per_constraint_t *vct = SEQUENCE_OF_packed__whole_number(elm);
+	const asn_anonymous_sequence_values_ *list;
+	const asn_per_constraint_t *ct;
+	asn_enc_rval_t er;
+	int encoded_edx;
+
+	if(!sptr) ASN__ENCODE_FAILED;
+	list = _A_CSEQUENCE_VALUES_FROM_VOID(sptr);
+
+	if(asn__encode_constraints
+	&& SEQUENCE_OF_packed__encode_check(td, sptr, &er))
+		return er;
+
+	er.encoded = 0;
+
+	if(constraints) ct = &constraints->size;
+	else if(td->encoding_constraints.per_constraints)
+		ct = &td->encoding_constraints.per_constraints->size;
+	else ct = 0;
+
+	/* If extensible constraint, check if size is in root */
+	if(ct) {
+		int not_in_root =
+			(list->count < ct->lower_bound || list->count > ct->upper_bound);
+		if(ct->flags & APC_EXTENSIBLE) {
+			/* Declare whether size is in extension root */
+			if(per_put_few_bits(po, not_in_root, 1)) ASN__ENCODE_FAILED;
+			if(not_in_root) ct = 0;
+		} else if(not_in_root && ct->effective_bits >= 0) {
+			ASN__ENCODE_FAILED;
+		}
+	}
+
+	if(ct && ct->effective_bits >= 0) {
+		/* X.691, #19.5: No length determinant */
+		if(per_put_few_bits(po, list->count - ct->lower_bound,
+				ct->effective_bits))
+			ASN__ENCODE_FAILED;
+	} else if(list->count == 0) {
+		/* When the list is empty add only the length determinant
+		 * X.691, #20.6 and #11.9.4.1
+		 */
+		if(uper_put_length(po, 0, 0)) ASN__ENCODE_FAILED;
+		ASN__ENCODED_OK(er);
+	}
+
+	for(encoded_edx = 0; encoded_edx < list->count;) {
+		ssize_t may_encode;
+		int edx;
+		int need_eom = 0;
+
+		if(ct && ct->effective_bits >= 0) {
+			may_encode = list->count;
+		} else {
+			may_encode =
+				uper_put_length(po, list->count - encoded_edx, &need_eom);
+			if(may_encode < 0) ASN__ENCODE_FAILED;
+		}
+
+		if(vct) {
+			/* The constrained whole numbers, in a tight loop */
+			const long *values = (const long *)list->array;
+			for(edx = encoded_edx; edx < encoded_edx + may_encode; edx++) {
+				unsigned long v;
+				if(per_long_range_rebase(values[edx], vct->lower_bound,
+						vct->upper_bound, &v)
+				|| uper_put_constrained_whole_number_u(po, v,
+						vct->range_bits))
+					ASN__ENCODE_FAILED;
+			}
+		} else {
+			for(edx = encoded_edx; edx < encoded_edx + may_encode; edx++) {
+				er = elm->type->op->uper_encoder(elm->type,
+					elm->encoding_constraints.per_constraints,
+					SEQUENCE_OF_packed__value(specs, list, edx), po);
+				if(er.encoded == -1) ASN__ENCODE_FAILED;
+			}
+		}
+
+		if(need_eom && uper_put_length(po, 0, 0))
+			ASN__ENCODE_FAILED; /* End of Message length */
+
+		encoded_edx += may_encode;
+	}
+
+	ASN__ENCODED_OK(er);
+}
+
+#endif  /* ASN_DISABLE_PER_SUPPORT */
+
+int
+SEQUENCE_OF_packed_compare(const asn_TYPE_descriptor_t *td, const void *aptr,
+                           const void *bptr) {
+    const asn_SET_OF_specifics_t *specs =
+        (const asn_SET_OF_specifics_t *)td->specifics;
+    const asn_TYPE_descriptor_t *elm_td = td->elements->type;
+    const asn_anonymous_sequence_values_ *a = _A_CSEQUENCE_VALUES_FROM_VOID(aptr);
+    const asn_anonymous_sequence_values_ *b = _A_CSEQUENCE_VALUES_FROM_VOID(bptr);
+    int idx;
+
+    if(a && b) {
+        int common_length = (a->count < b->count ? a->count : b->count);
+        for(idx = 0; idx < common_length; idx++) {
+            int ret = elm_td->op->compare_struct(
+                elm_td, SEQUENCE_OF_packed__value(specs, a, idx),
+                SEQUENCE_OF_packed__value(specs, b, idx));
+            if(ret) return ret;
+        }
+
+        if(idx < b->count) /* more elements in b */
+            return -1;    /* a is shorter, so put it first */
+        if(idx < a->count) return 1;
+
+    } else if(!a) {
+        return -1;
+    } else if(!b) {
+        return 1;
+    }
+
+    return 0;
+}
+
+int
+SEQUENCE_OF_packed_copy(const asn_TYPE_descriptor_t *td, void **dptr,
+                        const void *sptr) {
+    const asn_SET_OF_specifics_t *specs =
+        (const asn_SET_OF_specifics_t *)td->specifics;
+    const asn_anonymous_sequence_values_ *src =
+        _A_CSEQUENCE_VALUES_FROM_VOID(sptr);
+    asn_anonymous_sequence_values_ *list;
+    void *dst = *dptr;
+    int allocated = 0;
+
+    if(!sptr) return -1;
+
+    if(!dst) {
+        dst = CALLOC(1, specs->struct_size);
+        if(!dst) return -1;
+        allocated = 1;
+    }
+    list = _A_SEQUENCE_VALUES_FROM_VOID(dst);
+
+    /* The values own no memory of their own, copied all at once */
+    if(src->count) {
+        if(asn_sequence_values_reserve(list, specs->element_size,
+                                       src->count)) {
+            if(allocated) FREEMEM(dst);
+            return -1;
+        }
+        memcpy(list->array, src->array,
+               (size_t)src->count * specs->element_size);
+        list->count = src->count;
+    }
+
+    *dptr = dst;
+    return 0;
+}
+
+asn_random_fill_result_t
+SEQUENCE_OF_packed_random_fill(const asn_TYPE_descriptor_t *td, void **sptr,
+                               const asn_encoding_constraints_t *constraints,
+                               size_t max_length) {
+    const asn_SET_OF_specifics_t *specs =
+        (const asn_SET_OF_specifics_t *)td->specifics;
+    asn_random_fill_result_t res_ok = {ARFILL_OK, 0};
+    asn_random_fill_result_t result_failed = {ARFILL_FAILED, 0};
+    asn_random_fill_result_t result_skipped = {ARFILL_SKIPPED, 0};
+    const asn_TYPE_member_t *elm = td->elements;
+    asn_anonymous_sequence_values_ *list;
+    void *st = *sptr;
+    size_t rnd_len;
+
+    if(max_length == 0) return result_skipped;
+
+    if(st == NULL) {
+        st = (*sptr = CALLOC(1, specs->struct_size));
+        if(st == NULL) {
+            return result_failed;
+        }
+    }
+    list = _A_SEQUENCE_VALUES_FROM_VOID(st);
+
+    for(rnd_len = SET_OF__random_length(td, constraints, max_length);
+        rnd_len > 0; rnd_len--) {
+        void *memb_ptr = SEQUENCE_OF_packed__next(specs, list);
+        asn_random_fill_result_t tmpres;
+        if(!memb_ptr) return result_failed;
+        tmpres = elm->type->op->random_fill(
+            elm->type, &memb_ptr, &elm->encoding_constraints,
+            (max_length > res_ok.length ? max_length - res_ok.length : 0)
+                / rnd_len);
+        switch(tmpres.code) {
+        case ARFILL_OK:
+            list->count++;
+            res_ok.length += tmpres.length;
+            break;
+        case ARFILL_SKIPPED:
+            break;
+        case ARFILL_FAILED:
+            return tmpres;
+        }
+    }
+
+    return res_ok;
+}
+
+asn_TYPE_operation_t asn_OP_SEQUENCE_OF_packed = {
+	SEQUENCE_OF_packed_free,
+	SEQUENCE_OF_packed_print,
+	SEQUENCE_OF_packed_compare,
+	SEQUENCE_OF_packed_copy,
+	SEQUENCE_OF_packed_decode_ber,
+	SEQUENCE_OF_packed_encode_der,
+	SEQUENCE_OF_packed_decode_xer,
+	SEQUENCE_OF_packed_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	SEQUENCE_OF_packed_decode_jer,
+	SEQUENCE_OF_packed_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
+#ifdef	ASN_DISABLE_OER_SUPPORT
+	0,
+	0,
+#else
+	SEQUENCE_OF_packed_decode_oer,
+	SEQUENCE_OF_packed_encode_oer,
+#endif  /* ASN_DISABLE_OER_SUPPORT */
+#ifdef ASN_DISABLE_PER_SUPPORT
+	0,
+	0,
+#else
+	SEQUENCE_OF_packed_decode_uper,
+	SEQUENCE_OF_packed_encode_uper,
+#endif /* ASN_DISABLE_PER_SUPPORT */
+	SEQUENCE_OF_packed_random_fill,
+	0	/* Use generic outmost tag fetcher */
+};
@@ -0,0 +1,56 @@
+/*
+ * Redistribution and modifications are permitted subject to BSD license.
+ */
+#ifndef	CONSTR_SEQUENCE_OF_PACKED_H
+#define	CONSTR_SEQUENCE_OF_PACKED_H
+
+#include <asn_application.h>
+#include <constr_SEQUENCE_OF.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * The SEQUENCE OF type keeping the INTEGER, ENUMERATED, BOOLEAN or REAL
+ * values in place, A_SEQUENCE_OF_VALUES() (-fpacked-sequence-of).
+ * The codecs of the element type work right on the values in the array,
+ * the (.element_size) of asn_SET_OF_specifics_t apart.
+ */
+asn_struct_free_f SEQUENCE_OF_packed_free;
+asn_struct_print_f SEQUENCE_OF_packed_print;
+asn_struct_compare_f SEQUENCE_OF_packed_compare;
+asn_struct_copy_f SEQUENCE_OF_packed_copy;
+asn_constr_check_f SEQUENCE_OF_packed_constraint;
+ber_type_decoder_f SEQUENCE_OF_packed_decode_ber;
+der_type_encoder_f SEQUENCE_OF_packed_encode_der;
+xer_type_decoder_f SEQUENCE_OF_packed_decode_xer;
+xer_type_encoder_f SEQUENCE_OF_packed_encode_xer;
+jer_type_decoder_f SEQUENCE_OF_packed_decode_jer;
+jer_type_encoder_f SEQUENCE_OF_packed_encode_jer;
+oer_type_decoder_f SEQUENCE_OF_packed_decode_oer;
+oer_type_encoder_f SEQUENCE_OF_packed_encode_oer;
+per_type_decoder_f SEQUENCE_OF_packed_decode_uper;
+per_type_encoder_f SEQUENCE_OF_packed_encode_uper;
+asn_random_fill_f  SEQUENCE_OF_packed_random_fill;
+extern asn_TYPE_operation_t asn_OP_SEQUENCE_OF_packed;
+
+/*
+ * The (n)-th value of the list.
+ */
+#define	SEQUENCE_OF_packed__value(specs, list, n)	\
+	((void *)((char *)(list)->array + (size_t)(n) * (specs)->element_size))
+
+/*
+ * Check the constraints of all the values about to be encoded, at once
+ * if the compiler has provided (.values_constraint). Returns 0 if they
+ * can be encoded, or -1 with the (*rval) pointing to the offending value.
+ */
+int SEQUENCE_OF_packed__encode_check(const asn_TYPE_descriptor_t *td,
+                                     const void *sptr, asn_enc_rval_t *rval);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* CONSTR_SEQUENCE_OF_PACKED_H */
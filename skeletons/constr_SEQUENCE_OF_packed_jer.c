@@ -0,0 +1,189 @@
+/*
+ * Redistribution and modifications are permitted subject to BSD license.
+ */
+#ifndef ASN_DISABLE_JER_SUPPORT
+
+#include <asn_internal.h>
+#include <constr_SEQUENCE_OF_packed.h>
+#include <asn_SEQUENCE_OF.h>
+
+/*
+ * This macro "eats" the part of the buffer which is definitely "consumed",
+ * i.e. was correctly converted into local representation or rightfully skipped.
+ */
+#undef  JER_ADVANCE
+#define JER_ADVANCE(num_bytes)           \
+    do {                                 \
+        size_t num = (num_bytes);        \
+        ptr = ((const char *)ptr) + num; \
+        size -= num;                     \
+        consumed_myself += num;          \
+    } while(0)
+
+/*
+ * Return a standardized complex structure.
+ */
+#undef  RETURN
+#define RETURN(_code)   do {                    \
+                rval.code = _code;              \
+                rval.consumed = consumed_myself;\
+                return rval;                    \
+        } while(0)
+
+/*
+ * Decode the JER (JSON) array of values.
+ */
+asn_dec_rval_t
+SEQUENCE_OF_packed_decode_jer(const asn_codec_ctx_t *opt_codec_ctx,
+                              const asn_TYPE_descriptor_t *td,
+                              void **struct_ptr, const void *ptr,
+                              size_t size) {
+    const asn_SET_OF_specifics_t *specs =
+        (const asn_SET_OF_specifics_t *)td->specifics;
+    const asn_TYPE_member_t *element = td->elements;
+    asn_anonymous_sequence_values_ *list;
+    void *st = *struct_ptr; /* Target structure. */
+    asn_struct_ctx_t *ctx;  /* Decoder context */
+
+    asn_dec_rval_t rval;         /* Return value from a decoder */
+    ssize_t consumed_myself = 0; /* Consumed bytes from ptr */
+
+    /*
+     * Create the target structure if it is not present already.
+     */
+    if(st == 0) {
+        st = *struct_ptr = CALLOC(1, specs->struct_size);
+        if(st == 0) RETURN(RC_FAIL);
+    }
+    list = _A_SEQUENCE_VALUES_FROM_VOID(st);
+
+    /*
+     * Restore parsing context.
+     */
+    ctx = (asn_struct_ctx_t *)((char *)st + specs->ctx_offset);
+
+    /*
+     * Phases of JER/JSON processing, as of SET_OF_decode_jer():
+     * Phase 0: Expecting '['.
+     * Phase 1: Expecting ']' of the empty array, or the first element.
+     * Phase 2: Processing inner type, the value past the (count) ones.
+     * Phase 3: Expecting ',' or ']'.
+     * Phase 4: PHASED OUT
+     */
+    for(; ctx->phase <= 3;) {
+        pjer_chunk_type_e ch_type; /* JER chunk type */
+        ssize_t ch_size;           /* Chunk size */
+        int dlm;                   /* Delimiter character, if any */
+
+        if(ctx->phase == 2) {
+            void *memb_ptr = SEQUENCE_OF_packed__value(specs, list,
+                                                       list->count);
+            asn_dec_rval_t tmprval;
+
+            /* Invoke the inner type decoder, m.b. multiple times */
+            tmprval = element->type->op->jer_decoder(
+                opt_codec_ctx, element->type, &memb_ptr, ptr, size);
+            JER_ADVANCE(tmprval.consumed);
+            if(tmprval.code != RC_OK) RETURN(tmprval.code);
+            list->count++;
+            ctx->phase = 3; /* Back to body processing */
+        }
+
+        /*
+         * Get the next part of the JSON stream.
+         */
+        ch_size = jer_next_token(ptr, size, &ch_type);
+        if(ch_size == -1) {
+            RETURN(RC_FAIL);
+        } else {
+            switch(ch_type) {
+            case PJER_WMORE:
+                RETURN(RC_WMORE);
+            case PJER_WHITESPACE:
+                JER_ADVANCE(ch_size); /* Skip silently */
+                continue;
+            default:
+                break; /* Check the rest down there */
+            }
+        }
+
+        dlm = (ch_type == PJER_DLM) ? *(const char *)ptr : 0;
+
+        switch(ctx->phase) {
+        case 0:
+            if(dlm != 0x5b) break; /* '[' */
+            JER_ADVANCE(ch_size);
+            ctx->phase = 1;
+            continue;
+        case 1:
+        case 3:
+            if(dlm == 0x5d) { /* ']' */
+                /* No more things to decode */
+                JER_ADVANCE(ch_size);
+                ctx->phase = 4; /* Phase out */
+                RETURN(RC_OK);
+            }
+            if(ctx->phase == 3) {
+                if(dlm != 0x2c) break; /* ',' */
+                JER_ADVANCE(ch_size);
+            }
+            /* Make room for the value and clear it for the decoder */
+            if(asn_sequence_values_grow(list, specs->element_size)) break;
+            memset(SEQUENCE_OF_packed__value(specs, list, list->count), 0,
+                   specs->element_size);
+            ctx->phase = 2;
+            continue;
+        }
+
+        ASN_DEBUG("Unexpected JER token in SEQUENCE OF %s", td->name);
+        break;
+    }
+
+    ctx->phase = 4; /* "Phase out" on hard failure */
+    RETURN(RC_FAIL);
+}
+
+asn_enc_rval_t
+SEQUENCE_OF_packed_encode_jer(const asn_TYPE_descriptor_t *td,
+                              const void *sptr, int ilevel,
+                              enum jer_encoder_flags_e flags,
+                              asn_app_consume_bytes_f *cb, void *app_key) {
+    const asn_SET_OF_specifics_t *specs =
+        (const asn_SET_OF_specifics_t *)td->specifics;
+    asn_enc_rval_t er = {0, 0, 0};
+    const asn_TYPE_member_t *elm = td->elements;
+    const asn_anonymous_sequence_values_ *list =
+        _A_CSEQUENCE_VALUES_FROM_VOID(sptr);
+    int pretty = !(flags & JER_F_MINIFIED);
+    int i;
+
+    if(!sptr) ASN__ENCODE_FAILED;
+
+    if(asn__encode_constraints
+       && SEQUENCE_OF_packed__encode_check(td, sptr, &er))
+        return er;
+
+    ASN__CALLBACK("[", 1);
+
+    for(i = 0; i < list->count; i++) {
+        asn_enc_rval_t tmper;
+
+        if(i) ASN__CALLBACK(",", 1);
+        if(pretty) ASN__TEXT_INDENT(1, ilevel + 1);
+
+        tmper = elm->type->op->jer_encoder(
+            elm->type, SEQUENCE_OF_packed__value(specs, list, i), ilevel + 1,
+            flags, cb, app_key);
+        if(tmper.encoded == -1) return tmper;
+        er.encoded += tmper.encoded;
+    }
+
+    if(pretty && list->count) ASN__TEXT_INDENT(1, ilevel);
+    ASN__CALLBACK("]", 1);
+
+    ASN__ENCODED_OK(er);
+cb_failed:
+    ASN__ENCODE_FAILED;
+}
+
+#endif  /* ASN_DISABLE_JER_SUPPORT */
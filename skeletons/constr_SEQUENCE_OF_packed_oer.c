@@ -0,0 +1,204 @@
+/*
+ * Redistribution and modifications are permitted subject to BSD license.
+ */
+#ifndef ASN_DISABLE_OER_SUPPORT
+
+#include <asn_internal.h>
+#include <constr_SEQUENCE_OF_packed.h>
+#include <asn_SEQUENCE_OF.h>
+
+/*
+ * This macro "eats" the part of the buffer which is definitely "consumed",
+ * i.e. was correctly converted into local representation or rightfully skipped.
+ */
+#undef  ADVANCE
+#define ADVANCE(num_bytes)                   \
+    do {                                     \
+        size_t num = num_bytes;              \
+        ptr = ((const char *)ptr) + num;     \
+        size -= num;                         \
+        consumed_myself += num;              \
+    } while(0)
+
+/*
+ * Return a standardized complex structure.
+ */
+#undef  RETURN
+#define RETURN(_code)                    \
+    do {                                 \
+        asn_dec_rval_t rval;             \
+        rval.code = _code;               \
+        rval.consumed = consumed_myself; \
+        return rval;                     \
+    } while(0)
+
+asn_dec_rval_t
+SEQUENCE_OF_packed_decode_oer(const asn_codec_ctx_t *opt_codec_ctx,
+                              const asn_TYPE_descriptor_t *td,
+                              const asn_oer_constraints_t *constraints,
+                              void **struct_ptr, const void *ptr, size_t size) {
+    const asn_SET_OF_specifics_t *specs =
+        (const asn_SET_OF_specifics_t *)td->specifics;
+    const asn_TYPE_member_t *elm = td->elements;
+    asn_anonymous_sequence_values_ *list;
+    void *st = *struct_ptr;     /* Target structure */
+    asn_struct_ctx_t *ctx;      /* Decoder context */
+    size_t consumed_myself = 0; /* Consumed bytes from ptr. */
+
+    (void)constraints;
+
+    if(ASN__STACK_OVERFLOW_CHECK(opt_codec_ctx))
+        ASN__DECODE_FAILED;
+
+    /*
+     * Create the target structure if it is not present already.
+     */
+    if(st == 0) {
+        st = *struct_ptr = CALLOC(1, specs->struct_size);
+        if(st == 0) {
+            RETURN(RC_FAIL);
+        }
+    }
+    list = _A_SEQUENCE_VALUES_FROM_VOID(st);
+
+    /*
+     * Restore parsing context.
+     */
+    ctx = (asn_struct_ctx_t *)((char *)st + specs->ctx_offset);
+
+    /*
+     * Start to parse where left previously.
+     */
+    switch(ctx->phase) {
+    case 0: {
+        /*
+         * Fetch number of elements to decode.
+         */
+        size_t length = 0;
+        ssize_t len_size = oer_fetch_quantity(ptr, size, &length);
+        switch(len_size) {
+        case 0:
+            RETURN(RC_WMORE);
+        case -1:
+            RETURN(RC_FAIL);
+        default:
+            ADVANCE(len_size);
+            ctx->left = length;
+        }
+
+        /*
+         * Size the array for all the values at once, but not for more
+         * of them than the remaining bytes could encode.
+         */
+        if(length > size) length = size;
+        if(length > (size_t)(INT_MAX - list->count))
+            length = INT_MAX - list->count;
+        if(asn_sequence_values_reserve(list, specs->element_size,
+                                       list->count + (int)length)) {
+            RETURN(RC_FAIL);
+        }
+
+        ctx->phase = 1;
+    }
+        /* FALL THROUGH */
+    case 1:
+        /*
+         * Decode the values right into the array.
+         * The element decoders either decode the whole value,
+         * or consume nothing.
+         */
+        for(; ctx->left > 0; ctx->left--) {
+            void *memb_ptr;
+            asn_dec_rval_t rv;
+
+            /* No OER value is shorter than a byte; don't grow in vain */
+            if(size == 0) RETURN(RC_WMORE);
+
+            if(asn_sequence_values_grow(list, specs->element_size)) {
+                ctx->phase = 3;
+                RETURN(RC_FAIL);
+            }
+            memb_ptr = SEQUENCE_OF_packed__value(specs, list, list->count);
+            memset(memb_ptr, 0, specs->element_size);
+
+            rv = elm->type->op->oer_decoder(
+                opt_codec_ctx, elm->type,
+                elm->encoding_constraints.oer_constraints, &memb_ptr, ptr,
+                size);
+            ADVANCE(rv.consumed);
+            switch(rv.code) {
+            case RC_OK:
+                list->count++;
+                break;
+            case RC_WMORE:
+                RETURN(RC_WMORE);
+            case RC_FAIL:
+                ctx->phase = 3;
+                RETURN(RC_FAIL);
+            }
+        }
+        /* Decoded decently. */
+        ctx->phase = 2;
+        /* Fall through */
+    case 2:
+        /* Ignore fully decoded */
+        assert(ctx->left == 0);
+        RETURN(RC_OK);
+    case 3:
+        /* Failed to decode. */
+        RETURN(RC_FAIL);
+    }
+
+    RETURN(RC_FAIL);
+}
+
+/*
+ * Encode as Canonical OER.
+ */
+asn_enc_rval_t
+SEQUENCE_OF_packed_encode_oer(const asn_TYPE_descriptor_t *td,
+                              const asn_oer_constraints_t *constraints,
+                              const void *sptr, asn_app_consume_bytes_f *cb,
+                              void *app_key) {
+    const asn_SET_OF_specifics_t *specs =
+        (const asn_SET_OF_specifics_t *)td->specifics;
+    const asn_TYPE_member_t *elm;
+    const asn_anonymous_sequence_values_ *list;
+    size_t computed_size = 0;
+    asn_enc_rval_t er;
+    ssize_t qty_len;
+    int n;
+
+    (void)constraints;
+
+    if(!sptr) ASN__ENCODE_FAILED;
+
+    elm = td->elements;
+    list = _A_CSEQUENCE_VALUES_FROM_VOID(sptr);
+
+    if(asn__encode_constraints
+       && SEQUENCE_OF_packed__encode_check(td, sptr, &er))
+        return er;
+
+    qty_len = oer_put_quantity(list->count, cb, app_key);
+    if(qty_len < 0) {
+        ASN__ENCODE_FAILED;
+    }
+    computed_size += qty_len;
+
+    for(n = 0; n < list->count; n++) {
+        er = elm->type->op->oer_encoder(
+            elm->type, elm->encoding_constraints.oer_constraints,
+            SEQUENCE_OF_packed__value(specs, list, n), cb, app_key);
+        if(er.encoded < 0) {
+            return er;
+        } else {
+            computed_size += er.encoded;
+        }
+    }
+
+    er.encoded = computed_size;
+    ASN__ENCODED_OK(er);
+}
+
+#endif  /* ASN_DISABLE_OER_SUPPORT */
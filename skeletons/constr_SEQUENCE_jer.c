@@ -0,0 +1,314 @@
+/*
+ * Redistribution and modifications are permitted subject to BSD license.
+ */
+#ifndef ASN_DISABLE_JER_SUPPORT
+
+#include <asn_internal.h>
+#include <constr_SEQUENCE.h>
+#include <OPEN_TYPE.h>
+#include <errno.h>
+
+/*
+ * This macro "eats" the part of the buffer which is definitely "consumed",
+ * i.e. was correctly converted into local representation or rightfully skipped.
+ */
+#undef  JER_ADVANCE
+#define JER_ADVANCE(num_bytes)           \
+    do {                                 \
+        size_t num = (num_bytes);        \
+        ptr = ((const char *)ptr) + num; \
+        size -= num;                     \
+        consumed_myself += num;          \
+    } while(0)
+
+/*
+ * Check whether we are inside the extensions group.
+ */
+#define IN_EXTENSION_GROUP(specs, memb_idx) \
+    ((specs)->first_extension >= 0          \
+     && (unsigned)(specs)->first_extension <= (memb_idx))
+
+/*
+ * Return a standardized complex structure.
+ */
+#undef  RETURN
+#define RETURN(_code)   do {                    \
+                rval.code = _code;              \
+                rval.consumed = consumed_myself;\
+                return rval;                    \
+        } while(0)
+
+/*
+ * Decode the JER (JSON) object. The members may come in any order,
+ * as the JSON object members are unordered. The members decoded so far
+ * are marked in the bitmap kept in (ctx->ptr) until the object is closed.
+ */
+asn_dec_rval_t
+SEQUENCE_decode_jer(const asn_codec_ctx_t *opt_codec_ctx,
+                    const asn_TYPE_descriptor_t *td, void **struct_ptr,
+                    const void *ptr, size_t size) {
+    /*
+     * Bring closer parts of structure description.
+     */
+    const asn_SEQUENCE_specifics_t *specs
+        = (const asn_SEQUENCE_specifics_t *)td->specifics;
+    asn_TYPE_member_t *elements = td->elements;
+
+    /*
+     * ... and parts of the structure being constructed.
+     */
+    void *st = *struct_ptr; /* Target structure. */
+    asn_struct_ctx_t *ctx;  /* Decoder context */
+
+    asn_dec_rval_t rval;         /* Return value from a decoder */
+    ssize_t consumed_myself = 0; /* Consumed bytes from ptr */
+    size_t edx;                  /* Element index */
+
+    /*
+     * Create the target structure if it is not present already.
+     */
+    if(st == 0) {
+        st = *struct_ptr = CALLOC(1, specs->struct_size);
+        if(st == 0) RETURN(RC_FAIL);
+    }
+
+    /*
+     * Restore parsing context.
+     */
+    ctx = (asn_struct_ctx_t *)((char *)st + specs->ctx_offset);
+
+    /*
+     * Phases of JER/JSON processing:
+     * Phase 0: Expecting '{'.
+     * Phase 1: Expecting the member name or '}' of the empty object.
+     * Phase 2: Expecting the member name after ','.
+     * Phase 3: Expecting ':' before the member value.
+     * Phase 4: Processing inner type.
+     * Phase 5: Expecting ',' or '}'.
+     * Phase 6: Expecting ':' before the unknown extension.
+     * Phase 7: Skipping unknown extension.
+     * Phase 8: PHASED OUT
+     */
+    for(edx = ctx->step; ctx->phase <= 7;) {
+        pjer_chunk_type_e ch_type; /* JER chunk type */
+        ssize_t ch_size;           /* Chunk size */
+        int dlm;                   /* Delimiter character, if any */
+        int ret;
+
+        /*
+         * Go inside the inner member of a sequence.
+         */
+        if(ctx->phase == 4) {
+            asn_dec_rval_t tmprval;
+            void *memb_ptr_dontuse; /* Pointer to the member */
+            void **memb_ptr2;       /* Pointer to that pointer */
+            asn_TYPE_member_t *elm = &elements[edx];
+
+            if(elm->flags & ATF_POINTER) {
+                /* Member is a pointer to another structure */
+                memb_ptr2 = (void **)((char *)st + elm->memb_offset);
+            } else {
+                memb_ptr_dontuse = (char *)st + elm->memb_offset;
+                memb_ptr2 = &memb_ptr_dontuse; /* Only use of memb_ptr_dontuse */
+                ASN_SEQUENCE_INLINE_MKPRESENT(td, st, edx);
+            }
+
+            if(elm->flags & ATF_OPEN_TYPE) {
+                tmprval = OPEN_TYPE_jer_get(opt_codec_ctx, td, st, elm, ptr,
+                                            size);
+            } else {
+                /* Invoke the inner type decoder, m.b. multiple times */
+                tmprval = elm->type->op->jer_decoder(opt_codec_ctx, elm->type,
+                                                     memb_ptr2, ptr, size);
+            }
+            JER_ADVANCE(tmprval.consumed);
+            if(tmprval.code != RC_OK) RETURN(tmprval.code);
+            ctx->phase = 5; /* Back to body processing */
+            ASN_DEBUG("JER/SEQUENCE phase => %d, step => %d", ctx->phase,
+                      ctx->step);
+        }
+
+        /*
+         * Get the next part of the JSON stream.
+         */
+        ch_size = jer_next_token(ptr, size, &ch_type);
+        if(ch_size == -1) {
+            RETURN(RC_FAIL);
+        } else {
+            switch(ch_type) {
+            case PJER_WMORE:
+                RETURN(RC_WMORE);
+            case PJER_WHITESPACE:
+                JER_ADVANCE(ch_size); /* Skip silently */
+                continue;
+            default:
+                break; /* Check the rest down there */
+            }
+        }
+
+        dlm = (ch_type == PJER_DLM) ? *(const char *)ptr : 0;
+
+        switch(ctx->phase) {
+        case 0:
+            if(dlm != 0x7b) break; /* '{' */
+            FREEMEM(ctx->ptr);
+            ctx->ptr = CALLOC(td->elements_count / (8 * sizeof(unsigned int))
+                                  + 1,
+                              sizeof(unsigned int));
+            if(!ctx->ptr) RETURN(RC_FAIL);
+            JER_ADVANCE(ch_size);
+            ctx->phase = 1;
+            continue;
+        case 1:
+        case 5:
+            if(dlm == 0x7d) { /* '}' */
+                for(edx = 0; edx < td->elements_count; edx++) {
+                    /* All extensions are optional */
+                    if(!ASN_SEQUENCE_ISPRESENT2(ctx->ptr, edx)
+                       && !elements[edx].optional
+                       && !IN_EXTENSION_GROUP(specs, edx)) {
+                        ASN_DEBUG("Premature end of JER SEQUENCE %s: "
+                                  "no member %s",
+                                  td->name, elements[edx].name);
+                        RETURN(RC_FAIL);
+                    }
+                }
+                FREEMEM(ctx->ptr);
+                ctx->ptr = 0;
+                JER_ADVANCE(ch_size);
+                ctx->phase = 8; /* Phase out */
+                RETURN(RC_OK);
+            }
+            if(ctx->phase == 5) {
+                if(dlm != 0x2c) break; /* ',' */
+                JER_ADVANCE(ch_size);
+                ctx->phase = 2;
+                continue;
+            }
+            /* Fall through */
+        case 2:
+            if(ch_type != PJER_STRING) break;
+
+            {
+                /*
+                 * Search which member corresponds to this name.
+                 */
+                const char *name;
+                void *to_free;
+                ssize_t name_len;
+                ssize_t n;
+                name_len = jer_string_contents(ptr, ch_size, &name, &to_free);
+                if(name_len < 0) RETURN(RC_FAIL);
+                n = xer_find_member(elements, 0, td->elements_count,
+                                    specs->name2el, name, name_len);
+                if(to_free) FREEMEM(to_free);
+                if(n >= 0) {
+                    if(ASN_SEQUENCE_ISPRESENT2(ctx->ptr, n)) {
+                        ASN_DEBUG("JER SEQUENCE %s: Duplicate member %s",
+                                  td->name, elements[n].name);
+                        break;
+                    }
+                    ASN_SEQUENCE_MKPRESENT(ctx->ptr, n);
+                    /*
+                     * Process this member.
+                     */
+                    ctx->step = edx = n;
+                    ctx->phase = 3;
+                    JER_ADVANCE(ch_size);
+                    continue;
+                }
+            }
+
+            /* It is expected extension */
+            if(specs->first_extension >= 0) {
+                ASN_DEBUG("Got anticipated extension in %s", td->name);
+                ctx->phase = 6;
+                JER_ADVANCE(ch_size);
+                continue;
+            }
+            break;
+        case 3:
+        case 6:
+            if(dlm != 0x3a) break; /* ':' */
+            JER_ADVANCE(ch_size);
+            ctx->phase = (ctx->phase == 3) ? 4 : 7;
+            ctx->left = 0;
+            continue;
+        case 7:
+            ret = jer_skip_unknown(ch_type, ptr, &ctx->left);
+            if(ret < 0) break;
+            JER_ADVANCE(ch_size);
+            if(ret) ctx->phase = 5; /* The extension is skipped */
+            continue;
+        }
+
+        ASN_DEBUG("Unexpected JER token in SEQUENCE %s [%c]", td->name,
+                  size > 0 ? ((const char *)ptr)[0] : '.');
+        break;
+    }
+
+    ctx->phase = 8; /* "Phase out" on hard failure */
+    RETURN(RC_FAIL);
+}
+
+asn_enc_rval_t
+SEQUENCE_encode_jer(const asn_TYPE_descriptor_t *td, const void *sptr,
+                    int ilevel, enum jer_encoder_flags_e flags,
+                    asn_app_consume_bytes_f *cb, void *app_key) {
+    asn_enc_rval_t er = {0, 0, 0};
+    int pretty = !(flags & JER_F_MINIFIED);
+    int members = 0;
+    size_t edx;
+
+    if(!sptr) ASN__ENCODE_FAILED;
+
+    ASN__CALLBACK("{", 1);
+
+    for(edx = 0; edx < td->elements_count; edx++) {
+        asn_enc_rval_t tmper;
+        asn_TYPE_member_t *elm = &td->elements[edx];
+        const void *memb_ptr;
+        const char *mname = elm->name;
+        size_t mlen = strlen(mname);
+
+        if(elm->flags & ATF_POINTER) {
+            memb_ptr =
+                *(const void *const *)((const char *)sptr + elm->memb_offset);
+            if(!memb_ptr) {
+                /* The absent DEFAULT member is not encoded, too */
+                if(elm->optional || elm->default_value_set) continue;
+                /* Mandatory element is missing */
+                ASN__ENCODE_FAILED;
+            }
+        } else {
+            if(ASN_SEQUENCE_INLINE_ABSENT(td, sptr, edx)) continue;
+            memb_ptr = (const void *)((const char *)sptr + elm->memb_offset);
+        }
+
+        if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, &tmper))
+            return tmper;
+
+        if(members++) ASN__CALLBACK(",", 1);
+        if(pretty) {
+            ASN__TEXT_INDENT(1, ilevel + 1);
+            ASN__CALLBACK3("\"", 1, mname, mlen, "\": ", 3);
+        } else {
+            ASN__CALLBACK3("\"", 1, mname, mlen, "\":", 2);
+        }
+
+        /* Print the member itself */
+        tmper = elm->type->op->jer_encoder(elm->type, memb_ptr, ilevel + 1,
+                                           flags, cb, app_key);
+        if(tmper.encoded == -1) return tmper;
+        er.encoded += tmper.encoded;
+    }
+
+    if(pretty && members) ASN__TEXT_INDENT(1, ilevel);
+    ASN__CALLBACK("}", 1);
+
+    ASN__ENCODED_OK(er);
+cb_failed:
+    ASN__ENCODE_FAILED;
+}
+
+#endif  /* ASN_DISABLE_JER_SUPPORT */
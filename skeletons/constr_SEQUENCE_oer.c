@@ -73,11 +73,15 @@ element_ptrptr(void *struct_ptr, asn_TYPE_member_t *elm, void **tmp_save_ptr) {
 }
 
 static const void *
-element_ptr(const void *struct_ptr, const asn_TYPE_member_t *elm) {
+element_ptr(const asn_TYPE_descriptor_t *td, const void *struct_ptr,
+            const asn_TYPE_member_t *elm) {
     if(elm->flags & ATF_POINTER) {
         /* Member is a pointer to another structure */
         return *(const void *const *)((const char *)struct_ptr
                                       + elm->memb_offset);
+    } else if(ASN_SEQUENCE_INLINE_ABSENT(td, struct_ptr, elm - td->elements)) {
+        /* Inline OPTIONAL member is not present */
+        return NULL;
     } else {
         return (const void *)((const char *)struct_ptr + elm->memb_offset);
     }
@@ -210,6 +214,7 @@ SEQUENCE_decode_oer(const asn_codec_ctx_t *opt_codec_ctx,
             }
             switch(rval.code) {
             case RC_OK:
+                ASN_SEQUENCE_INLINE_MKPRESENT(td, st, edx);
                 ADVANCE(rval.consumed);
                 break;
             case RC_WMORE:
@@ -325,6 +330,7 @@ SEQUENCE_decode_oer(const asn_codec_ctx_t *opt_codec_ctx,
                                       memb_ptr2, ptr, size);
                 assert(ot_size <= (ssize_t)size);
                 if(ot_size > 0) {
+                    ASN_SEQUENCE_INLINE_MKPRESENT(td, st, edx);
                     ADVANCE(ot_size);
                 } else if(ot_size < 0) {
                     RETURN(RC_FAIL);
@@ -378,10 +384,11 @@ SEQUENCE_decode_oer(const asn_codec_ctx_t *opt_codec_ctx,
 /*
  * Encode as Canonical OER.
  */
-asn_enc_rval_t
-SEQUENCE_encode_oer(const asn_TYPE_descriptor_t *td,
-                    const asn_oer_constraints_t *constraints, const void *sptr,
-                    asn_app_consume_bytes_f *cb, void *app_key) {
+static asn_enc_rval_t
+SEQUENCE__encode_oer(const asn_TYPE_descriptor_t *td,
+                     const asn_oer_constraints_t *constraints,
+                     const void *sptr, asn_app_consume_bytes_f *cb,
+                     void *app_key) {
     const asn_SEQUENCE_specifics_t *specs = (const asn_SEQUENCE_specifics_t *)td->specifics;
     size_t computed_size = 0;
     int has_extensions_bit = (specs->first_extension >= 0);
@@ -402,7 +409,7 @@ SEQUENCE_encode_oer(const asn_TYPE_descriptor_t *td,
         if(has_extensions_bit) {
             for(edx = specs->first_extension; edx < td->elements_count; edx++) {
                 asn_TYPE_member_t *elm = &td->elements[edx];
-                const void *memb_ptr = element_ptr(sptr, elm);
+                const void *memb_ptr = element_ptr(td, sptr, elm);
                 if(memb_ptr) {
                     if(elm->default_value_cmp
                        && elm->default_value_cmp(memb_ptr) == 0) {
@@ -430,7 +437,7 @@ SEQUENCE_encode_oer(const asn_TYPE_descriptor_t *td,
                 if(IN_EXTENSION_GROUP(specs, edx)) break;
 
                 if(elm->optional) {
-                    const void *memb_ptr = element_ptr(sptr, elm);
+                    const void *memb_ptr = element_ptr(td, sptr, elm);
                     uint32_t has_component = memb_ptr != NULL;
                     if(has_component && elm->default_value_cmp
                        && elm->default_value_cmp(memb_ptr) == 0) {
@@ -458,7 +465,7 @@ SEQUENCE_encode_oer(const asn_TYPE_descriptor_t *td,
 
         if(IN_EXTENSION_GROUP(specs, edx)) break;
 
-        memb_ptr = element_ptr(sptr, elm);
+        memb_ptr = element_ptr(td, sptr, elm);
         if(memb_ptr) {
             if(elm->default_value_cmp
                && elm->default_value_cmp(memb_ptr) == 0) {
@@ -474,6 +481,7 @@ SEQUENCE_encode_oer(const asn_TYPE_descriptor_t *td,
             ASN_DEBUG("OER encoder is not defined for type %s", elm->type->name);
             ASN__ENCODE_FAILED;
         }
+        if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, &er)) return er;
         er = elm->type->op->oer_encoder(
             elm->type, elm->encoding_constraints.oer_constraints, memb_ptr, cb,
             app_key);
@@ -514,7 +522,7 @@ SEQUENCE_encode_oer(const asn_TYPE_descriptor_t *td,
         /* Encode presence bitmap #16.4.3 */
         for(edx = specs->first_extension; edx < td->elements_count; edx++) {
             asn_TYPE_member_t *elm = &td->elements[edx];
-            const void *memb_ptr = element_ptr(sptr, elm);
+            const void *memb_ptr = element_ptr(td, sptr, elm);
             if(memb_ptr && elm->default_value_cmp
                && elm->default_value_cmp(memb_ptr) == 0) {
                 memb_ptr = 0;   /* Do not encode default value. */
@@ -529,14 +537,19 @@ SEQUENCE_encode_oer(const asn_TYPE_descriptor_t *td,
         /* Now, encode extensions */
         for(edx = specs->first_extension; edx < td->elements_count; edx++) {
             asn_TYPE_member_t *elm = &td->elements[edx];
-            const void *memb_ptr = element_ptr(sptr, elm);
+            const void *memb_ptr = element_ptr(td, sptr, elm);
 
             if(memb_ptr) {
                 if(elm->default_value_cmp
                    && elm->default_value_cmp(memb_ptr) == 0) {
                     /* Do not encode default value. */
                 } else {
-                    ssize_t wrote = oer_open_type_put(
+                    asn_enc_rval_t er;
+                    ssize_t wrote;
+                    if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, &er)) {
+                        return er;
+                    }
+                    wrote = oer_open_type_put(
                         elm->type, elm->encoding_constraints.oer_constraints,
                         memb_ptr, cb, app_key);
                     if(wrote == -1) {
@@ -558,4 +571,31 @@ SEQUENCE_encode_oer(const asn_TYPE_descriptor_t *td,
     }
 }
 
+asn_enc_rval_t
+SEQUENCE_encode_oer(const asn_TYPE_descriptor_t *td,
+                    const asn_oer_constraints_t *constraints, const void *sptr,
+                    asn_app_consume_bytes_f *cb, void *app_key) {
+    asn_enc_rval_t er;
+    size_t size;
+
+    if(!sptr || cb != asn__count_bytes)
+        return SEQUENCE__encode_oer(td, constraints, sptr, cb, app_key);
+
+    /*
+     * The output is only counted: account for the bytes sized
+     * by asn_encoded_size_cached() already without producing them.
+     */
+    if(SEQUENCE__cached_size(td, sptr, ATS_BASIC_OER, &size)) {
+        if(cb(0, size, app_key) < 0) ASN__ENCODE_FAILED;
+        er.encoded = size;
+        ASN__ENCODED_OK(er);
+    }
+
+    er = SEQUENCE__encode_oer(td, constraints, sptr, cb, app_key);
+    if(er.encoded != -1)
+        SEQUENCE__cache_size(td, sptr, ATS_BASIC_OER, er.encoded);
+
+    return er;
+}
+
 #endif  /* ASN_DISABLE_OER_SUPPORT */
@@ -590,6 +590,10 @@ SET_encode_der(const asn_TYPE_descriptor_t *td, const void *sptr, int tag_mode,
         if(elm->default_value_cmp && elm->default_value_cmp(*memb_ptr2) == 0)
             continue;
 
+		if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, *memb_ptr2, &tmper)) {
+			FREEMEM(t2m_build);
+			return tmper;
+		}
 		tmper = elm->type->op->der_encoder(elm->type, *memb_ptr2,
 			elm->tag_mode, elm->tag, cb, app_key);
 		if(tmper.encoded == -1)
@@ -666,6 +670,9 @@ SET_decode_xer(const asn_codec_ctx_t *opt_codec_ctx,
 		pxer_chunk_type_e ch_type;	/* XER chunk type */
 		ssize_t ch_size;		/* Chunk size */
 		xer_check_tag_e tcv;		/* Tag check value */
+		const char *name;		/* Tag name */
+		size_t name_len;
+		ssize_t n;
 		const asn_TYPE_member_t *elm;
 
 		/*
@@ -726,7 +733,8 @@ SET_decode_xer(const asn_codec_ctx_t *opt_codec_ctx,
 			}
 		}
 
-		tcv = xer_check_tag(buf_ptr, ch_size, xml_tag);
+		tcv = xer_check_tag_name(buf_ptr, ch_size, xml_tag,
+			&name, &name_len);
 		ASN_DEBUG("XER/SET: tcv = %d, ph=%d", tcv, ctx->phase);
 
 		/* Skip the extensions section */
@@ -781,28 +789,16 @@ SET_decode_xer(const asn_codec_ctx_t *opt_codec_ctx,
 			/*
 			 * Search which member corresponds to this tag.
 			 */
-			for(edx = 0; edx < td->elements_count; edx++) {
-				switch(xer_check_tag(buf_ptr, ch_size,
-					elements[edx].name)) {
-				case XCT_BOTH:
-				case XCT_OPENING:
-					/*
-					 * Process this member.
-					 */
-					ctx->step = edx;
-					ctx->phase = 2;
-					break;
-				case XCT_UNKNOWN_OP:
-				case XCT_UNKNOWN_BO:
-					continue;
-				default:
-					edx = td->elements_count;
-					break;	/* Phase out */
-				}
-				break;
-			}
-			if(edx != td->elements_count)
+			n = xer_find_member(elements, 0, td->elements_count,
+				specs->name2el, name, name_len);
+			if(n >= 0) {
+				/*
+				 * Process this member.
+				 */
+				ctx->step = edx = n;
+				ctx->phase = 2;
 				continue;
+			}
 
 			/* It is expected extension */
 			if(specs->extensible) {
@@ -878,6 +874,8 @@ SET_encode_xer(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
             memb_ptr = (const void *)((const char *)sptr + elm->memb_offset);
         }
 
+		if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, &tmper)) return tmper;
+
 		if(!xcan)
 			ASN__TEXT_INDENT(1, ilevel);
 		ASN__CALLBACK3("<", 1, mname, mlen, ">", 1);
@@ -898,17 +896,276 @@ cb_failed:
 	ASN__ENCODE_FAILED;
 }
 
+#ifndef ASN_DISABLE_JER_SUPPORT
+
+#undef	JER_ADVANCE
+#define	JER_ADVANCE(num_bytes)	do {			\
+		size_t num = num_bytes;			\
+		buf_ptr = ((const char *)buf_ptr) + num;\
+		size -= num;				\
+		consumed_myself += num;			\
+	} while(0)
+
+/*
+ * Decode the JER (JSON) object, the members come in any order.
+ */
+asn_dec_rval_t
+SET_decode_jer(const asn_codec_ctx_t *opt_codec_ctx,
+               const asn_TYPE_descriptor_t *td, void **struct_ptr,
+               const void *buf_ptr, size_t size) {
+    /*
+	 * Bring closer parts of structure description.
+	 */
+	const asn_SET_specifics_t *specs = (const asn_SET_specifics_t *)td->specifics;
+	const asn_TYPE_member_t *elements = td->elements;
+
+	/*
+	 * ... and parts of the structure being constructed.
+	 */
+	void *st = *struct_ptr;	/* Target structure. */
+	asn_struct_ctx_t *ctx;	/* Decoder context */
+
+	asn_dec_rval_t rval;		/* Return value from a decoder */
+	ssize_t consumed_myself = 0;	/* Consumed bytes from ptr */
+	size_t edx;			/* Element index */
+
+	/*
+	 * Create the target structure if it is not present already.
+	 */
+	if(st == 0) {
+		st = *struct_ptr = CALLOC(1, specs->struct_size);
+		if(st == 0) RETURN(RC_FAIL);
+	}
+
+	/*
+	 * Restore parsing context.
+	 */
+	ctx = (asn_struct_ctx_t *)((char *)st + specs->ctx_offset);
+
+	/*
+	 * Phases of JER/JSON processing:
+	 * Phase 0: Expecting '{'.
+	 * Phase 1: Expecting the member name or '}' of the empty object.
+	 * Phase 2: Expecting the member name after ','.
+	 * Phase 3: Expecting ':' before the member value.
+	 * Phase 4: Processing inner type.
+	 * Phase 5: Expecting ',' or '}'.
+	 * Phase 6: Expecting ':' before the unknown extension.
+	 * Phase 7: Skipping unknown extension.
+	 * Phase 8: PHASED OUT
+	 */
+	for(edx = ctx->step; ctx->phase <= 7;) {
+		pjer_chunk_type_e ch_type;	/* JER chunk type */
+		ssize_t ch_size;		/* Chunk size */
+		int dlm;			/* Delimiter character, if any */
+		int ret;
+
+		/*
+		 * Go inside the inner member of a set.
+		 */
+		if(ctx->phase == 4) {
+			asn_dec_rval_t tmprval;
+			void *memb_ptr_dontuse; /* Pointer to the member */
+			void **memb_ptr2;	/* Pointer to that pointer */
+			const asn_TYPE_member_t *elm = &elements[edx];
+
+			if(elm->flags & ATF_POINTER) {
+				/* Member is a pointer to another structure */
+				memb_ptr2 = (void **)((char *)st + elm->memb_offset);
+			} else {
+				memb_ptr_dontuse = (char *)st + elm->memb_offset;
+				memb_ptr2 = &memb_ptr_dontuse; /* Only use of memb_ptr_dontuse */
+			}
+
+			/* Invoke the inner type decoder, m.b. multiple times */
+			tmprval = elm->type->op->jer_decoder(opt_codec_ctx,
+					elm->type, memb_ptr2, buf_ptr, size);
+			JER_ADVANCE(tmprval.consumed);
+			if(tmprval.code != RC_OK)
+				RETURN(tmprval.code);
+			ctx->phase = 5;	/* Back to body processing */
+			ASN_SET_MKPRESENT((char *)st + specs->pres_offset, edx);
+			ASN_DEBUG("JER/SET phase => %d", ctx->phase);
+		}
+
+		/*
+		 * Get the next part of the JSON stream.
+		 */
+		ch_size = jer_next_token(buf_ptr, size, &ch_type);
+		if(ch_size == -1) {
+			RETURN(RC_FAIL);
+		} else {
+			switch(ch_type) {
+			case PJER_WMORE:
+				RETURN(RC_WMORE);
+			case PJER_WHITESPACE:
+				JER_ADVANCE(ch_size);	/* Skip silently */
+				continue;
+			default:
+				break;	/* Check the rest down there */
+			}
+		}
+
+		dlm = (ch_type == PJER_DLM) ? *(const char *)buf_ptr : 0;
+
+		switch(ctx->phase) {
+		case 0:
+			if(dlm != 0x7b) break;	/* '{' */
+			JER_ADVANCE(ch_size);
+			ctx->phase = 1;
+			continue;
+		case 1:
+		case 5:
+			if(dlm == 0x7d) {	/* '}' */
+				if(_SET_is_populated(td, st)) {
+					JER_ADVANCE(ch_size);
+					ctx->phase = 8;	/* Phase out */
+					RETURN(RC_OK);
+				} else {
+					ASN_DEBUG("Premature end of JER SET");
+					RETURN(RC_FAIL);
+				}
+			}
+			if(ctx->phase == 5) {
+				if(dlm != 0x2c) break;	/* ',' */
+				JER_ADVANCE(ch_size);
+				ctx->phase = 2;
+				continue;
+			}
+			/* Fall through */
+		case 2:
+			if(ch_type == PJER_STRING) {
+				/*
+				 * Search which member corresponds to this name.
+				 */
+				const char *name;
+				void *to_free;
+				ssize_t name_len;
+				ssize_t n;
+				name_len = jer_string_contents(buf_ptr, ch_size,
+					&name, &to_free);
+				if(name_len < 0) RETURN(RC_FAIL);
+				n = xer_find_member(elements, 0, td->elements_count,
+					specs->name2el, name, name_len);
+				if(to_free) FREEMEM(to_free);
+				if(n >= 0) {
+					if(ASN_SET_ISPRESENT2((char *)st
+							+ specs->pres_offset, n)) {
+						ASN_DEBUG("SET %s: Duplicate element %s",
+							td->name, elements[n].name);
+						break;
+					}
+					ctx->step = edx = n;
+					ctx->phase = 3;
+					JER_ADVANCE(ch_size);
+					continue;
+				}
+
+				/* It is expected extension */
+				if(specs->extensible) {
+					ASN_DEBUG("Got anticipated extension");
+					ctx->phase = 6;
+					JER_ADVANCE(ch_size);
+					continue;
+				}
+			}
+			break;
+		case 3:
+		case 6:
+			if(dlm != 0x3a) break;	/* ':' */
+			JER_ADVANCE(ch_size);
+			ctx->phase = (ctx->phase == 3) ? 4 : 7;
+			ctx->left = 0;
+			continue;
+		case 7:
+			ret = jer_skip_unknown(ch_type, buf_ptr, &ctx->left);
+			if(ret < 0) break;
+			JER_ADVANCE(ch_size);
+			if(ret) ctx->phase = 5;	/* The extension is skipped */
+			continue;
+		}
+
+		ASN_DEBUG("Unexpected JER token in SET %s", td->name);
+		break;
+	}
+
+	ctx->phase = 8;	/* "Phase out" on hard failure */
+	RETURN(RC_FAIL);
+}
+
+asn_enc_rval_t
+SET_encode_jer(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
+               enum jer_encoder_flags_e flags, asn_app_consume_bytes_f *cb,
+               void *app_key) {
+	asn_enc_rval_t er = {0, 0, 0};
+	int pretty = !(flags & JER_F_MINIFIED);
+	int members = 0;
+	size_t edx;
+
+	if(!sptr)
+		ASN__ENCODE_FAILED;
+
+	ASN__CALLBACK("{", 1);
+
+	for(edx = 0; edx < td->elements_count; edx++) {
+		asn_enc_rval_t tmper;
+		asn_TYPE_member_t *elm = &td->elements[edx];
+		const void *memb_ptr;
+		const char *mname = elm->name;
+		size_t mlen = strlen(elm->name);
+
+		if(elm->flags & ATF_POINTER) {
+			memb_ptr = *(const void *const *)((const char *)sptr
+				+ elm->memb_offset);
+			if(!memb_ptr) {
+				if(elm->optional)
+					continue;
+				/* Mandatory element missing */
+				ASN__ENCODE_FAILED;
+			}
+		} else {
+			memb_ptr = (const void *)((const char *)sptr
+				+ elm->memb_offset);
+		}
+
+		if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, &tmper)) return tmper;
+
+		if(members++) ASN__CALLBACK(",", 1);
+		if(pretty) {
+			ASN__TEXT_INDENT(1, ilevel + 1);
+			ASN__CALLBACK3("\"", 1, mname, mlen, "\": ", 3);
+		} else {
+			ASN__CALLBACK3("\"", 1, mname, mlen, "\":", 2);
+		}
+
+		/* Print the member itself */
+		tmper = elm->type->op->jer_encoder(elm->type, memb_ptr,
+				ilevel + 1, flags, cb, app_key);
+		if(tmper.encoded == -1) return tmper;
+		er.encoded += tmper.encoded;
+	}
+
+	if(pretty && members) ASN__TEXT_INDENT(1, ilevel);
+	ASN__CALLBACK("}", 1);
+
+	ASN__ENCODED_OK(er);
+cb_failed:
+	ASN__ENCODE_FAILED;
+}
+
+#endif  /* ASN_DISABLE_JER_SUPPORT */
+
 int
 SET_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
           asn_app_consume_bytes_f *cb, void *app_key) {
     size_t edx;
 	int ret;
 
-	if(!sptr) return (cb("<absent>", 8, app_key) < 0) ? -1 : 0;
+	if(!sptr) return ASN__E_cbc("<absent>", 8) ? -1 : 0;
 
 	/* Dump preamble */
-	if(cb(td->name, strlen(td->name), app_key) < 0
-	|| cb(" ::= {", 6, app_key) < 0)
+	if(ASN__E_cbc(td->name, strlen(td->name))
+	|| ASN__E_cbc(" ::= {", 6))
 		return -1;
 
 	for(edx = 0; edx < td->elements_count; edx++) {
@@ -929,8 +1186,8 @@ SET_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
 		_i_INDENT(1);
 
 		/* Print the member's name and stuff */
-		if(cb(elm->name, strlen(elm->name), app_key) < 0
-		|| cb(": ", 2, app_key) < 0)
+		if(ASN__E_cbc(elm->name, strlen(elm->name))
+		|| ASN__E_cbc(": ", 2))
 			return -1;
 
 		/* Print the member itself */
@@ -942,7 +1199,7 @@ SET_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
 	ilevel--;
 	_i_INDENT(1);
 
-	return (cb("}", 1, app_key) < 0) ? -1 : 0;
+	return ASN__E_cbc("}", 1) ? -1 : 0;
 }
 
 void
@@ -993,6 +1250,9 @@ SET_constraint(const asn_TYPE_descriptor_t *td, const void *sptr,
 		return -1;
 	}
 
+	/* The members are checked by the encoder as it gets to them */
+	if(asn__encode_constraints) return 0;
+
 	/*
 	 * Iterate over structure members and check their validity.
 	 */
@@ -1015,14 +1275,62 @@ SET_constraint(const asn_TYPE_descriptor_t *td, const void *sptr,
 		}
 
 		if(elm->encoding_constraints.general_constraints) {
-			return elm->encoding_constraints.general_constraints(
+			int ret = elm->encoding_constraints.general_constraints(
 					elm->type, memb_ptr, ctfailcb, app_key);
+			if(ret) return ret;
 		} else {
-			return elm->type->encoding_constraints.general_constraints(
+			int ret = elm->type->encoding_constraints.general_constraints(
 					elm->type, memb_ptr, ctfailcb, app_key);
+			if(ret) return ret;
+		}
+	}
+
+	return 0;
+}
+
+int
+SET_copy(const asn_TYPE_descriptor_t *td, void **dptr, const void *sptr) {
+    const asn_SET_specifics_t *specs =
+        (const asn_SET_specifics_t *)td->specifics;
+    void *dst = *dptr;
+    int allocated = 0;
+    size_t edx;
+
+	if(!sptr) return -1;
+
+	if(!dst) {
+		dst = CALLOC(1, specs->struct_size);
+		if(!dst) return -1;
+		allocated = 1;
+	}
+
+	for(edx = 0; edx < td->elements_count; edx++) {
+		asn_TYPE_member_t *elm = &td->elements[edx];
+		const void *smemb;
+		void *dmemb;
+		int ret;
+
+		if(elm->flags & ATF_POINTER) {
+			smemb = *(const void *const *)((const char *)sptr
+				+ elm->memb_offset);
+			if(!smemb) continue;
+			ret = elm->type->op->copy_struct(elm->type,
+				(void **)((char *)dst + elm->memb_offset), smemb);
+		} else {
+			smemb = (const void *)((const char *)sptr + elm->memb_offset);
+			dmemb = (void *)((char *)dst + elm->memb_offset);
+			ret = elm->type->op->copy_struct(elm->type, &dmemb, smemb);
+		}
+		if(ret) {
+			SET_free(td, dst, allocated
+				? ASFM_FREE_EVERYTHING : ASFM_FREE_UNDERLYING_AND_RESET);
+			return -1;
 		}
+		/* Let ASN_SET_ISPRESENT() tell the copied members */
+		ASN_SET_MKPRESENT((char *)dst + specs->pres_offset, edx);
 	}
 
+	*dptr = dst;
 	return 0;
 }
 
@@ -1065,10 +1373,18 @@ asn_TYPE_operation_t asn_OP_SET = {
 	SET_free,
 	SET_print,
 	SET_compare,
+	SET_copy,
 	SET_decode_ber,
 	SET_encode_der,
 	SET_decode_xer,
 	SET_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	SET_decode_jer,
+	SET_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 	0,	/* SET_decode_oer */
 	0,	/* SET_encode_oer */
 	0,	/* SET_decode_uper */
@@ -40,6 +40,11 @@ typedef struct asn_SET_specifics_s {
 	 */
 	int extensible;                             /* Whether SET is extensible */
 	const unsigned int *_mandatory_elements;    /* Bitmask of mandatory ones */
+
+	/*
+	 * Member names to members mapping, for XER (optional).
+	 */
+	const asn_TYPE_name2member_t *name2el;
 } asn_SET_specifics_t;
 
 /*
@@ -48,11 +53,14 @@ typedef struct asn_SET_specifics_s {
 asn_struct_free_f SET_free;
 asn_struct_print_f SET_print;
 asn_struct_compare_f SET_compare;
+asn_struct_copy_f SET_copy;
 asn_constr_check_f SET_constraint;
 ber_type_decoder_f SET_decode_ber;
 der_type_encoder_f SET_encode_der;
 xer_type_decoder_f SET_decode_xer;
 xer_type_encoder_f SET_encode_xer;
+jer_type_decoder_f SET_decode_jer;
+jer_type_encoder_f SET_encode_jer;
 per_type_decoder_f SET_decode_uper;
 per_type_encoder_f SET_encode_uper;
 asn_random_fill_f  SET_random_fill;
@@ -355,7 +355,8 @@ enum SET_OF__encode_method {
 static struct _el_buffer *
 SET_OF__encode_sorted(const asn_TYPE_member_t *elm,
                       const asn_anonymous_set_ *list,
-                      enum SET_OF__encode_method method) {
+                      enum SET_OF__encode_method method,
+                      asn_enc_rval_t *erval) {
     struct _el_buffer *encoded_els;
     int edx;
 
@@ -371,25 +372,25 @@ SET_OF__encode_sorted(const asn_TYPE_member_t *elm,
     for(edx = 0; edx < list->count; edx++) {
         const void *memb_ptr = list->array[edx];
         struct _el_buffer *encoding_el = &encoded_els[edx];
-        asn_enc_rval_t erval;
 
         if(!memb_ptr) break;
+        if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, erval)) break;
 
         /*
 		 * Encode the member into the prepared space.
 		 */
         switch(method) {
         case SOES_DER:
-            erval = elm->type->op->der_encoder(elm->type, memb_ptr, 0, elm->tag,
-                                               _el_addbytes, encoding_el);
+            *erval = elm->type->op->der_encoder(elm->type, memb_ptr, 0, elm->tag,
+                                                _el_addbytes, encoding_el);
             break;
         case SOES_CUPER:
-            erval = uper_encode(elm->type,
-                                elm->encoding_constraints.per_constraints,
-                                memb_ptr, _el_addbytes, encoding_el);
-            if(erval.encoded != -1) {
-                size_t extra_bits = erval.encoded % 8;
-                assert(encoding_el->length == (size_t)(erval.encoded + 7) / 8);
+            *erval = uper_encode(elm->type,
+                                 elm->encoding_constraints.per_constraints,
+                                 memb_ptr, _el_addbytes, encoding_el);
+            if(erval->encoded != -1) {
+                size_t extra_bits = erval->encoded % 8;
+                assert(encoding_el->length == (size_t)(erval->encoded + 7) / 8);
                 encoding_el->bits_unused = (8 - extra_bits) & 0x7;
             }
             break;
@@ -397,7 +398,7 @@ SET_OF__encode_sorted(const asn_TYPE_member_t *elm,
             assert(!"Unreachable");
             break;
         }
-        if(erval.encoded < 0) break;
+        if(erval->encoded < 0) break;
 	}
 
     if(edx == list->count) {
@@ -469,7 +470,15 @@ SET_OF_encode_der(const asn_TYPE_descriptor_t *td, const void *sptr,
      * according to their encodings. Build an array of the
      * encoded elements.
      */
-    encoded_els = SET_OF__encode_sorted(elm, list, SOES_DER);
+    {
+        asn_enc_rval_t erval;
+        erval.encoded = 0;
+        encoded_els = SET_OF__encode_sorted(elm, list, SOES_DER, &erval);
+        if(!encoded_els) {
+            if(erval.encoded == -1) return erval;
+            ASN__ENCODE_FAILED;
+        }
+    }
 
     /*
      * Report encoded elements to the application.
@@ -478,7 +487,7 @@ SET_OF_encode_der(const asn_TYPE_descriptor_t *td, const void *sptr,
     for(edx = 0; edx < list->count; edx++) {
         struct _el_buffer *encoded_el = &encoded_els[edx];
         /* Report encoded chunks to the application */
-        if(cb(encoded_el->buf, encoded_el->length, app_key) < 0) {
+        if(ASN__E_cbc(encoded_el->buf, encoded_el->length)) {
             break;
         } else {
             encoding_size += encoded_el->length;
@@ -727,6 +736,8 @@ SET_OF_encode_xer(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
 		void *memb_ptr = list->array[i];
 		if(!memb_ptr) continue;
 
+		if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, &er)) goto cleanup;
+
 		if(encs) {
 			memset(&encs[encs_count], 0, sizeof(encs[0]));
 			app_key = &encs[encs_count];
@@ -789,6 +800,7 @@ cleanup:
 		}
 		FREEMEM(encs);
 	}
+	if(er.encoded == -1) return er; /* Constraint check failed */
 	ASN__ENCODED_OK(er);
 }
 
@@ -800,11 +812,11 @@ SET_OF_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
 	int ret;
 	int i;
 
-	if(!sptr) return (cb("<absent>", 8, app_key) < 0) ? -1 : 0;
+	if(!sptr) return ASN__E_cbc("<absent>", 8) ? -1 : 0;
 
 	/* Dump preamble */
-	if(cb(td->name, strlen(td->name), app_key) < 0
-	|| cb(" ::= {", 6, app_key) < 0)
+	if(ASN__E_cbc(td->name, strlen(td->name))
+	|| ASN__E_cbc(" ::= {", 6))
 		return -1;
 
 	for(i = 0; i < list->count; i++) {
@@ -821,7 +833,86 @@ SET_OF_print(const asn_TYPE_descriptor_t *td, const void *sptr, int ilevel,
 	ilevel--;
 	_i_INDENT(1);
 
-	return (cb("}", 1, app_key) < 0) ? -1 : 0;
+	return ASN__E_cbc("}", 1) ? -1 : 0;
+}
+
+/*
+ * The slab of elements (-fset-of-slab), followed by their storage.
+ */
+typedef union SET_OF__slab_u {
+    struct {
+        size_t size;    /* Size of the storage */
+        size_t used;    /* Handed out by SET_OF__new_element() */
+    } h;
+    /* Align the storage for any element */
+    intmax_t align_int;
+    double align_double;
+    void *align_ptr;
+} SET_OF__slab_t;
+
+#define SET_OF__SLAB(specs, sptr) \
+    ((SET_OF__slab_t **)((char *)(sptr) + (specs)->slab_offset))
+
+int
+SET_OF__reserve(const asn_TYPE_descriptor_t *td, void *sptr, size_t count) {
+    const asn_SET_OF_specifics_t *specs =
+        (const asn_SET_OF_specifics_t *)td->specifics;
+    asn_anonymous_set_ *list = _A_SET_FROM_VOID(sptr);
+    SET_OF__slab_t **slabp;
+    SET_OF__slab_t *slab;
+
+    if(count > (size_t)(INT_MAX - list->count)) count = INT_MAX - list->count;
+
+    if(asn_set_reserve(list, list->count + (int)count)) return -1;
+
+    if(!specs->slab_offset || !specs->element_size || !count) return 0;
+    slabp = SET_OF__SLAB(specs, sptr);
+    if(*slabp) return 0;    /* The elements past the slab come one by one */
+
+    if(count > (SIZE_MAX - sizeof(*slab)) / specs->element_size) return -1;
+    slab = (SET_OF__slab_t *)CALLOC(
+        1, sizeof(*slab) + count * specs->element_size);
+    if(!slab) return -1;    /* ENOMEM */
+    slab->h.size = count * specs->element_size;
+    slab->h.used = 0;
+    *slabp = slab;
+
+    return 0;
+}
+
+void *
+SET_OF__new_element(const asn_TYPE_descriptor_t *td, void *sptr) {
+    const asn_SET_OF_specifics_t *specs =
+        (const asn_SET_OF_specifics_t *)td->specifics;
+    SET_OF__slab_t *slab;
+    void *ptr;
+
+    if(!specs->slab_offset) return 0;
+    slab = *SET_OF__SLAB(specs, sptr);
+    if(!slab || slab->h.used == slab->h.size) return 0;
+
+    ptr = (char *)(slab + 1) + slab->h.used;
+    slab->h.used += specs->element_size;
+
+    return ptr;
+}
+
+void
+SET_OF__free_element(const asn_TYPE_descriptor_t *td, void *sptr,
+                     void *ptr) {
+    const asn_SET_OF_specifics_t *specs =
+        (const asn_SET_OF_specifics_t *)td->specifics;
+    const asn_TYPE_descriptor_t *elm_td = td->elements->type;
+    const SET_OF__slab_t *slab =
+        specs->slab_offset ? *SET_OF__SLAB(specs, sptr) : 0;
+
+    if(slab && (const char *)ptr >= (const char *)(slab + 1)
+    && (const char *)ptr < (const char *)(slab + 1) + slab->h.size) {
+        /* The slab is freed with the whole structure */
+        ASN_STRUCT_FREE_CONTENTS_ONLY(*elm_td, ptr);
+    } else {
+        ASN_STRUCT_FREE(*elm_td, ptr);
+    }
 }
 
 void
@@ -829,7 +920,6 @@ SET_OF_free(const asn_TYPE_descriptor_t *td, void *ptr,
             enum asn_struct_free_method method) {
     if(td && ptr) {
 		const asn_SET_OF_specifics_t *specs;
-		asn_TYPE_member_t *elm = td->elements;
 		asn_anonymous_set_ *list = _A_SET_FROM_VOID(ptr);
 		asn_struct_ctx_t *ctx;	/* Decoder context */
 		int i;
@@ -841,19 +931,25 @@ SET_OF_free(const asn_TYPE_descriptor_t *td, void *ptr,
 		for(i = 0; i < list->count; i++) {
 			void *memb_ptr = list->array[i];
 			if(memb_ptr)
-			ASN_STRUCT_FREE(*elm->type, memb_ptr);
+			SET_OF__free_element(td, ptr, memb_ptr);
 		}
 		list->count = 0;	/* No meaningful elements left */
 
-		asn_set_empty(list);	/* Remove (list->array) */
-
 		specs = (const asn_SET_OF_specifics_t *)td->specifics;
 		ctx = (asn_struct_ctx_t *)((char *)ptr + specs->ctx_offset);
 		if(ctx->ptr) {
-			ASN_STRUCT_FREE(*elm->type, ctx->ptr);
+			SET_OF__free_element(td, ptr, ctx->ptr);
 			ctx->ptr = 0;
 		}
 
+		asn_set_empty(list);	/* Remove (list->array) */
+
+		if(specs->slab_offset) {
+			SET_OF__slab_t **slabp = SET_OF__SLAB(specs, ptr);
+			FREEMEM(*slabp);
+			*slabp = 0;
+		}
+
         switch(method) {
         case ASFM_FREE_EVERYTHING:
             FREEMEM(ptr);
@@ -882,6 +978,9 @@ SET_OF_constraint(const asn_TYPE_descriptor_t *td, const void *sptr,
 		return -1;
 	}
 
+	/* The members are checked by the encoder as it gets to them */
+	if(asn__encode_constraints) return 0;
+
 	constr = elm->encoding_constraints.general_constraints;
 	if(!constr) constr = elm->type->encoding_constraints.general_constraints;
 
@@ -954,6 +1053,7 @@ SET_OF_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
 	}
 
 	do {
+		size_t avail;
 		int i;
 		if(nelems < 0) {
 			nelems = uper_get_length(pd, -1, 0, &repeat);
@@ -962,8 +1062,18 @@ SET_OF_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
             if(nelems < 0) ASN__DECODE_STARVED;
 		}
 
+		/*
+		 * Size the list for all these elements at once, but not
+		 * for more of them than the remaining bits could encode.
+		 */
+		avail = pd->nbits - pd->nboff;
+		if(SET_OF__reserve(td, st,
+				(size_t)nelems < avail ? (size_t)nelems : avail))
+			ASN__DECODE_FAILED;
+
 		for(i = 0; i < nelems; i++) {
-			void *ptr = 0;
+			void *ptr = SET_OF__new_element(td, st);
+			size_t moved = pd->moved;
 			ASN_DEBUG("SET OF %s decoding", elm->type->name);
 			rv = elm->type->op->uper_decoder(opt_codec_ctx, elm->type,
 				elm->encoding_constraints.per_constraints, &ptr, pd);
@@ -971,7 +1081,7 @@ SET_OF_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
 				td->name, elm->type->name, rv.code, ptr);
 			if(rv.code == RC_OK) {
 				if(ASN_SET_ADD(list, ptr) == 0) {
-                    if(rv.consumed == 0 && nelems > 200) {
+                    if(pd->moved == moved && nelems > 200) {
                         /* Protect from SET OF NULL compression bombs. */
                         ASN__DECODE_FAILED;
                     }
@@ -985,7 +1095,7 @@ SET_OF_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
 				ASN_DEBUG("Failed decoding %s of %s (SET OF)",
 					elm->type->name, td->name);
 			}
-			if(ptr) ASN_STRUCT_FREE(*elm->type, ptr);
+			if(ptr) SET_OF__free_element(td, st, ptr);
 			return rv;
 		}
 
@@ -1057,9 +1167,20 @@ SET_OF_encode_uper(const asn_TYPE_descriptor_t *td,
 
     /*
      * Canonical UPER #22.1 mandates dynamic sorting of the SET OF elements
-     * according to their encodings. Build an array of the encoded elements.
+     * according to their encodings. Build an array of the encoded elements,
+     * unless the output is only counted: the order doesn't change the size.
      */
-    encoded_els = SET_OF__encode_sorted(elm, list, SOES_CUPER);
+    if(po->output == asn__count_bytes) {
+        encoded_els = NULL;
+    } else {
+        asn_enc_rval_t erval;
+        erval.encoded = 0;
+        encoded_els = SET_OF__encode_sorted(elm, list, SOES_CUPER, &erval);
+        if(!encoded_els) {
+            if(erval.encoded == -1) return erval;
+            ASN__ENCODE_FAILED;
+        }
+    }
 
     for(encoded_edx = 0; (ssize_t)encoded_edx < list->count;) {
         ssize_t may_encode;
@@ -1075,7 +1196,19 @@ SET_OF_encode_uper(const asn_TYPE_descriptor_t *td,
         }
 
         for(edx = encoded_edx; edx < encoded_edx + may_encode; edx++) {
-            const struct _el_buffer *el = &encoded_els[edx];
+            const struct _el_buffer *el;
+            if(!encoded_els) {
+                const void *memb_ptr = list->array[edx];
+                if(!memb_ptr) ASN__ENCODE_FAILED;
+                if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, &er))
+                    return er;
+                if(elm->type->op->uper_encoder(
+                       elm->type, elm->encoding_constraints.per_constraints,
+                       memb_ptr, po).encoded == -1)
+                    ASN__ENCODE_FAILED;
+                continue;
+            }
+            el = &encoded_els[edx];
             if(asn_put_many_bits(po, el->buf,
                                  (8 * el->length) - el->bits_unused) < 0) {
                 break;
@@ -1088,7 +1221,7 @@ SET_OF_encode_uper(const asn_TYPE_descriptor_t *td,
         encoded_edx += may_encode;
     }
 
-    SET_OF__encode_sorted_free(encoded_els, list->count);
+    if(encoded_els) SET_OF__encode_sorted_free(encoded_els, list->count);
 
     if((ssize_t)encoded_edx == list->count) {
         ASN__ENCODED_OK(er);
@@ -1180,14 +1313,63 @@ SET_OF_compare(const asn_TYPE_descriptor_t *td, const void *aptr,
 }
 
 
+int
+SET_OF_copy(const asn_TYPE_descriptor_t *td, void **dptr, const void *sptr) {
+    const asn_SET_OF_specifics_t *specs =
+        (const asn_SET_OF_specifics_t *)td->specifics;
+    const asn_TYPE_descriptor_t *elm_td = td->elements->type;
+    const asn_anonymous_set_ *src = _A_CSET_FROM_VOID(sptr);
+    asn_anonymous_set_ *list;
+    void *dst = *dptr;
+    int allocated = 0;
+    int ret = 0;
+    int i;
+
+    if(!sptr) return -1;
+
+    if(!dst) {
+        dst = CALLOC(1, specs->struct_size);
+        if(!dst) return -1;
+        allocated = 1;
+    }
+    list = _A_SET_FROM_VOID(dst);
+
+    /* The array of pointers is allocated once, the elements one by one */
+    if(src->count) ret = asn_set_reserve(list, src->count);
+    for(i = 0; !ret && i < src->count; i++) {
+        void *elm = 0;
+        if(!src->array[i]) continue;
+        ret = elm_td->op->copy_struct(elm_td, &elm, src->array[i]);
+        if(!ret) (void)ASN_SET_ADD(list, elm); /* Reserved */
+    }
+
+    if(ret) {
+        SET_OF_free(td, dst,
+                    allocated ? ASFM_FREE_EVERYTHING
+                              : ASFM_FREE_UNDERLYING_AND_RESET);
+        return -1;
+    }
+
+    *dptr = dst;
+    return 0;
+}
+
 asn_TYPE_operation_t asn_OP_SET_OF = {
 	SET_OF_free,
 	SET_OF_print,
 	SET_OF_compare,
+	SET_OF_copy,
 	SET_OF_decode_ber,
 	SET_OF_encode_der,
 	SET_OF_decode_xer,
 	SET_OF_encode_xer,
+#ifdef	ASN_DISABLE_JER_SUPPORT
+	0,
+	0,
+#else
+	SET_OF_decode_jer,
+	SET_OF_encode_jer,
+#endif	/* ASN_DISABLE_JER_SUPPORT */
 #ifdef ASN_DISABLE_OER_SUPPORT
 	0,
 	0,
@@ -1207,31 +1389,15 @@ asn_TYPE_operation_t asn_OP_SET_OF = {
 };
 
 
-asn_random_fill_result_t
-SET_OF_random_fill(const asn_TYPE_descriptor_t *td, void **sptr,
-                   const asn_encoding_constraints_t *constraints,
-                   size_t max_length) {
-    const asn_SET_OF_specifics_t *specs =
-        (const asn_SET_OF_specifics_t *)td->specifics;
-    asn_random_fill_result_t res_ok = {ARFILL_OK, 0};
-    asn_random_fill_result_t result_failed = {ARFILL_FAILED, 0};
-    asn_random_fill_result_t result_skipped = {ARFILL_SKIPPED, 0};
-    const asn_TYPE_member_t *elm = td->elements;
-    void *st = *sptr;
+size_t
+SET_OF__random_length(const asn_TYPE_descriptor_t *td,
+                      const asn_encoding_constraints_t *constraints,
+                      size_t max_length) {
     long max_elements = 5;
     long slb = 0;   /* Lower size bound */
     long sub = 0;   /* Upper size bound */
     size_t rnd_len;
 
-    if(max_length == 0) return result_skipped;
-
-    if(st == NULL) {
-        st = (*sptr = CALLOC(1, specs->struct_size));
-        if(st == NULL) {
-            return result_failed;
-        }
-    }
-
     switch(asn_random_between(0, 6)) {
     case 0: max_elements = 0; break;
     case 1: max_elements = 1; break;
@@ -1323,6 +1489,33 @@ SET_OF_random_fill(const asn_TYPE_descriptor_t *td, void **sptr,
         break;
     }
 
+    return rnd_len;
+}
+
+asn_random_fill_result_t
+SET_OF_random_fill(const asn_TYPE_descriptor_t *td, void **sptr,
+                   const asn_encoding_constraints_t *constraints,
+                   size_t max_length) {
+    const asn_SET_OF_specifics_t *specs =
+        (const asn_SET_OF_specifics_t *)td->specifics;
+    asn_random_fill_result_t res_ok = {ARFILL_OK, 0};
+    asn_random_fill_result_t result_failed = {ARFILL_FAILED, 0};
+    asn_random_fill_result_t result_skipped = {ARFILL_SKIPPED, 0};
+    const asn_TYPE_member_t *elm = td->elements;
+    void *st = *sptr;
+    size_t rnd_len;
+
+    if(max_length == 0) return result_skipped;
+
+    if(st == NULL) {
+        st = (*sptr = CALLOC(1, specs->struct_size));
+        if(st == NULL) {
+            return result_failed;
+        }
+    }
+
+    rnd_len = SET_OF__random_length(td, constraints, max_length);
+
     for(; rnd_len > 0; rnd_len--) {
         asn_anonymous_set_ *list = _A_SET_FROM_VOID(st);
         void *ptr = 0;
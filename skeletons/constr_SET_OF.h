@@ -20,6 +20,26 @@ typedef struct asn_SET_OF_specifics_s {
 
     /* XER-specific stuff */
     int as_XMLValueList; /* The member type must be encoded like this */
+
+    /*
+     * Size of the element structure or of the value kept in place,
+     * 0 if not generated.
+     */
+    unsigned element_size;
+
+    /*
+     * Check all the values of A_SEQUENCE_OF_VALUES() structure against
+     * the constraints of the element at once, 0 if not generated.
+     * Returns 0 if all of them satisfy the constraints, -1 otherwise.
+     */
+    int (*values_constraint)(const void *sptr);
+
+    /*
+     * Offset of the (void *) pointer to the slab of elements, where the
+     * PER and OER decoders allocate all the elements at once
+     * (-fset-of-slab), 0 if they are allocated one by one.
+     */
+    unsigned slab_offset;
 } asn_SET_OF_specifics_t;
 
 /*
@@ -28,11 +48,14 @@ typedef struct asn_SET_OF_specifics_s {
 asn_struct_free_f SET_OF_free;
 asn_struct_print_f SET_OF_print;
 asn_struct_compare_f SET_OF_compare;
+asn_struct_copy_f SET_OF_copy;
 asn_constr_check_f SET_OF_constraint;
 ber_type_decoder_f SET_OF_decode_ber;
 der_type_encoder_f SET_OF_encode_der;
 xer_type_decoder_f SET_OF_decode_xer;
 xer_type_encoder_f SET_OF_encode_xer;
+jer_type_decoder_f SET_OF_decode_jer;
+jer_type_encoder_f SET_OF_encode_jer;
 oer_type_decoder_f SET_OF_decode_oer;
 oer_type_encoder_f SET_OF_encode_oer;
 per_type_decoder_f SET_OF_decode_uper;
@@ -40,6 +63,29 @@ per_type_encoder_f SET_OF_encode_uper;
 asn_random_fill_f  SET_OF_random_fill;
 extern asn_TYPE_operation_t asn_OP_SET_OF;
 
+/*
+ * Prepare the list of the SET OF structure (sptr) to receive up to (count)
+ * more elements from a decoder: size the array of pointers once, and
+ * allocate the slab of elements if the type has one.
+ * SET_OF__new_element() takes the next zero-filled element from the slab,
+ * or returns NULL for the decoder to allocate it.
+ * SET_OF__free_element() frees the element not yet in the list, taking
+ * care of the one taken from the slab.
+ */
+int SET_OF__reserve(const asn_TYPE_descriptor_t *td, void *sptr,
+                    size_t count);
+void *SET_OF__new_element(const asn_TYPE_descriptor_t *td, void *sptr);
+void SET_OF__free_element(const asn_TYPE_descriptor_t *td, void *sptr,
+                          void *ptr);
+
+/*
+ * Pick the random number of elements for SET_OF_random_fill() and alike,
+ * within the (SIZE) constraints or somewhat outside of them.
+ */
+size_t SET_OF__random_length(const asn_TYPE_descriptor_t *td,
+                             const asn_encoding_constraints_t *constraints,
+                             size_t max_length);
+
 #ifdef __cplusplus
 }
 #endif
@@ -51,61 +51,6 @@
         return rval;                     \
     } while(0)
 
-/*
- * The SEQUENCE OF and SET OF values utilize a "quantity field".
- * It is is a pointless combination of #8.6 (length determinant, capable
- * of encoding tiny and huge numbers in the shortest possible number of octets)
- * and the variable sized integer. What could have been encoded by #8.6 alone
- * is required to be encoded by #8.6 followed by that number of unsigned octets.
- * This doesn't make too much sense. It seems that the original version of OER
- * standard have been using the unconstrained unsigned integer as a quantity
- * field, and this legacy have gone through ISO/ITU-T standardization process.
- */
-static ssize_t
-oer_fetch_quantity(const void *ptr, size_t size, size_t *qty_r) {
-    const uint8_t *b;
-    const uint8_t *bend;
-    size_t len = 0;
-    size_t qty;
-
-    ssize_t len_len = oer_fetch_length(ptr, size, &len);
-    if(len_len <= 0) {
-        *qty_r = 0;
-        return len_len;
-    }
-
-    if((len_len + len) > size) {
-        *qty_r = 0;
-        return 0;
-    }
-
-    b = (const uint8_t *)ptr + len_len;
-    bend = b + len;
-
-    /* Skip the leading 0-bytes */
-    for(; b < bend && *b == 0; b++) {
-    }
-
-    if((bend - b) > (ssize_t)sizeof(size_t)) {
-        /* Length is not representable by the native size_t type */
-        *qty_r = 0;
-        return -1;
-    }
-
-    for(qty = 0; b < bend; b++) {
-        qty = (qty << 8) + *b;
-    }
-
-    if(qty > RSIZE_MAX) { /* A bit of C11 validation */
-        *qty_r = 0;
-        return -1;
-    }
-
-    *qty_r = qty;
-    assert((size_t)len_len + len == (size_t)(bend - (const uint8_t *)ptr));
-    return len_len + len;
-}
-
 asn_dec_rval_t
 SET_OF_decode_oer(const asn_codec_ctx_t *opt_codec_ctx,
                   const asn_TYPE_descriptor_t *td,
@@ -156,6 +101,15 @@ SET_OF_decode_oer(const asn_codec_ctx_t *opt_codec_ctx,
             ADVANCE(len_size);
             ctx->left = length;
         }
+
+        /*
+         * Size the list for all the elements at once, but not for more
+         * of them than the remaining bytes could encode.
+         */
+        if(SET_OF__reserve(td, st,
+                           length < size ? length : size)) {
+            RETURN(RC_FAIL);
+        }
     }
         NEXT_PHASE(ctx);
         /* FALL THROUGH */
@@ -171,7 +125,9 @@ SET_OF_decode_oer(const asn_codec_ctx_t *opt_codec_ctx,
         ASN_DEBUG("OER SET OF %s Decoding PHASE 1", td->name);
 
         for(; ctx->left > 0; ctx->left--) {
-            asn_dec_rval_t rv = elm->type->op->oer_decoder(
+            asn_dec_rval_t rv;
+            if(!ctx->ptr) ctx->ptr = SET_OF__new_element(td, st);
+            rv = elm->type->op->oer_decoder(
                 opt_codec_ctx, elm->type,
                 elm->encoding_constraints.oer_constraints, &ctx->ptr, ptr,
                 size);
@@ -196,7 +152,7 @@ SET_OF_decode_oer(const asn_codec_ctx_t *opt_codec_ctx,
             case RC_WMORE:
                 RETURN(RC_WMORE);
             case RC_FAIL:
-                ASN_STRUCT_FREE(*elm->type, ctx->ptr);
+                SET_OF__free_element(td, st, ctx->ptr);
                 ctx->ptr = 0;
                 SET_PHASE(ctx, 3);
                 RETURN(RC_FAIL);
@@ -218,24 +174,6 @@ SET_OF_decode_oer(const asn_codec_ctx_t *opt_codec_ctx,
     return rval;
 }
 
-static ssize_t
-oer_put_quantity(size_t qty, asn_app_consume_bytes_f *cb, void *app_key) {
-    uint8_t buf[1 + sizeof(size_t)];
-    uint8_t *b = &buf[sizeof(size_t)]; /* Last addressable */
-    size_t encoded;
-
-    do {
-        *b-- = qty;
-        qty >>= 8;
-    } while(qty);
-
-    *b = sizeof(buf) - (b-buf) - 1;
-    encoded = sizeof(buf) - (b-buf);
-    if(cb(b, encoded, app_key) < 0)
-        return -1;
-    return encoded;
-}
-
 /*
  * Encode as Canonical OER.
  */
@@ -265,6 +203,7 @@ SET_OF_encode_oer(const asn_TYPE_descriptor_t *td,
     for(n = 0; n < list->count; n++) {
         void *memb_ptr = list->array[n];
         asn_enc_rval_t er;
+        if(ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, &er)) return er;
         er = elm->type->op->oer_encoder(
             elm->type, elm->encoding_constraints.oer_constraints, memb_ptr, cb,
             app_key);
@@ -32,6 +32,9 @@ typedef struct asn_struct_ctx_s {
 	int context;		/* Other context information */
 	void *ptr;		/* Decoder-specific stuff (stack elements) */
 	ber_tlv_len_t left;	/* Number of bytes left, -1 for indefinite */
+	int constraints_ok;	/* Checked by asn_decode(), see asn_codecs.h */
+	int encoded_syntax;	/* Of the (encoded_size) cached by */
+	size_t encoded_size;	/* asn_encoded_size_cached() */
 } asn_struct_ctx_t;
 
 #include <ber_decoder.h>	/* Basic Encoding Rules decoder */
@@ -52,6 +55,14 @@ typedef void asn_oer_constraints_t;
 #include <oer_encoder.h>	/* Octet Encoding Rules encoder */
 #endif
 
+#ifdef  ASN_DISABLE_JER_SUPPORT
+typedef void (jer_type_decoder_f)(void);
+typedef void (jer_type_encoder_f)(void);
+#else
+#include <jer_decoder.h>	/* Decoder of JER (JSON, text) */
+#include <jer_encoder.h>	/* Encoder into JER (JSON, text) */
+#endif
+
 /*
  * Free the structure according to its specification.
  * Use one of ASN_STRUCT_{FREE,RESET,CONTENTS_ONLY} macros instead.
@@ -113,6 +124,26 @@ typedef int (asn_struct_compare_f)(
 		const void *struct_A,
 		const void *struct_B);
 
+/*
+ * Deep-copy the structure (struct_src) into (*struct_dst), which is either
+ * NULL, to allocate the copy, or points to the zeroed structure to fill in,
+ * such as a member of the enclosing structure.
+ * The decoder contexts and the cached checks and sizes are not copied.
+ * Returns 0 if copied, -1 on failure, with the partial copy freed
+ * or (if not allocated by the call) reset.
+ */
+typedef int (asn_struct_copy_f)(
+		const struct asn_TYPE_descriptor_s *type_descriptor,
+		void **struct_dst,
+		const void *struct_src);
+
+/*
+ * Copy the structure, see asn_struct_copy_f.
+ * Set the (*dst_ptr) to NULL to allocate the copy.
+ */
+#define ASN_STRUCT_COPY(asn_DEF, dst_ptr, src) \
+    (asn_DEF).op->copy_struct(&(asn_DEF), (void **)(dst_ptr), (src))
+
 /*
  * Return the outmost tag of the type.
  * If the type is untagged CHOICE, the dynamic operation is performed.
@@ -145,10 +176,13 @@ typedef struct asn_TYPE_operation_s {
     asn_struct_free_f *free_struct;     /* Free the structure */
     asn_struct_print_f *print_struct;   /* Human readable output */
     asn_struct_compare_f *compare_struct; /* Compare two structures */
+    asn_struct_copy_f *copy_struct;       /* Deep-copy the structure */
     ber_type_decoder_f *ber_decoder;      /* Generic BER decoder */
     der_type_encoder_f *der_encoder;      /* Canonical DER encoder */
     xer_type_decoder_f *xer_decoder;      /* Generic XER decoder */
     xer_type_encoder_f *xer_encoder;      /* [Canonical] XER encoder */
+    jer_type_decoder_f *jer_decoder;      /* Generic JER decoder */
+    jer_type_encoder_f *jer_encoder;      /* JER encoder */
     oer_type_decoder_f *oer_decoder;      /* Generic OER decoder */
     oer_type_encoder_f *oer_encoder;      /* Canonical OER encoder */
     per_type_decoder_f *uper_decoder;     /* Unaligned PER decoder */
@@ -215,7 +249,8 @@ typedef struct asn_TYPE_descriptor_s {
     ATF_NOFLAGS,
     ATF_POINTER = 0x01,   /* Represented by the pointer */
     ATF_OPEN_TYPE = 0x02, /* Open Type */
-    ATF_ANY_TYPE = 0x04   /* ANY type (deprecated!) */
+    ATF_ANY_TYPE = 0x04,  /* ANY type (deprecated!) */
+    ATF_PRESENCE_MAP = 0x08 /* Inline OPTIONAL, see SEQUENCE _presence_map */
   };
 typedef struct asn_TYPE_member_s {
     enum asn_TYPE_flags_e flags; /* Element's presentation flags */
@@ -241,6 +276,18 @@ typedef struct asn_TYPE_tag2member_s {
     int toff_last;          /* Last occurence of the el_tag, relative */
 } asn_TYPE_tag2member_t;
 
+/*
+ * XML name to element number mapping: the perfect hash of the names
+ * of the members, generated by asn1c for the types with many members.
+ * See xer_find_member() for the lookup.
+ */
+typedef struct asn_TYPE_name2member_s {
+    const unsigned *displacement;   /* Per bucket of the name hash */
+    unsigned buckets;               /* Power of 2 */
+    const int *slot2el;             /* Member number per slot, or -1 */
+    unsigned slots;                 /* Power of 2 */
+} asn_TYPE_name2member_t;
+
 /*
  * This function prints out the contents of the target language's structure
  * (struct_ptr) into the file pointer (stream) in human readable form.
@@ -77,6 +77,7 @@ int
 asn_check_constraints(const asn_TYPE_descriptor_t *type_descriptor,
                       const void *struct_ptr, char *errbuf, size_t *errlen) {
     struct errbufDesc arg;
+    int saved_encode_constraints = asn__encode_constraints;
     int ret;
 
     arg.failed_type = 0;
@@ -84,10 +85,63 @@ asn_check_constraints(const asn_TYPE_descriptor_t *type_descriptor,
     arg.errbuf = errbuf;
     arg.errlen = errlen ? *errlen : 0;
 
+    /* Walk the whole structure, even if called from within an encoder */
+    asn__encode_constraints = 0;
     ret = type_descriptor->encoding_constraints.general_constraints(
         type_descriptor, struct_ptr, _asn_i_ctfailcb, &arg);
+    asn__encode_constraints = saved_encode_constraints;
     if(ret == -1 && errlen) *errlen = arg.errlen;
 
     return ret;
 }
 
+ASN__THREAD_LOCAL int asn__encode_constraints;
+ASN__THREAD_LOCAL int asn__decode_constraints;
+
+int
+asn__encode_constraints_enter(const asn_codec_ctx_t *opt_ctx) {
+    int saved = asn__encode_constraints;
+    if(opt_ctx && opt_ctx->check_constraints) {
+        asn__encode_constraints = 1;
+    }
+    return saved;
+}
+
+void
+asn__encode_constraints_leave(int saved) {
+    asn__encode_constraints = saved;
+}
+
+static int
+asn__encode_check(const asn_TYPE_descriptor_t *td, asn_constr_check_f *constr,
+                  const void *sptr, asn_enc_rval_t *rval) {
+    /*
+     * The members are not descended into, so the failure is reported
+     * for this very value: no need for the failure callback.
+     */
+    if(constr(td, sptr, 0, 0) == 0) {
+        return 0;
+    }
+
+    ASN_DEBUG("Constraint check failed for %s while encoding", td->name);
+    rval->encoded = -1;
+    rval->failed_type = td;
+    rval->structure_ptr = sptr;
+    return -1;
+}
+
+int
+asn__encode_check_type(const asn_TYPE_descriptor_t *td, const void *sptr,
+                       asn_enc_rval_t *rval) {
+    return asn__encode_check(td, td->encoding_constraints.general_constraints,
+                             sptr, rval);
+}
+
+int
+asn__encode_check_member(const asn_TYPE_member_t *elm, const void *memb_ptr,
+                         asn_enc_rval_t *rval) {
+    asn_constr_check_f *constr = elm->encoding_constraints.general_constraints;
+    if(!constr) constr = elm->type->encoding_constraints.general_constraints;
+    return asn__encode_check(elm->type, constr, memb_ptr, rval);
+}
+
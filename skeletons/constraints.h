@@ -12,6 +12,9 @@ extern "C" {
 #endif
 
 struct asn_TYPE_descriptor_s;		/* Forward declaration */
+struct asn_TYPE_member_s;		/* Forward declaration */
+struct asn_codec_ctx_s;			/* Forward declaration */
+struct asn_enc_rval_s;			/* Forward declaration */
 
 /*
  * Validate the structure according to the ASN.1 constraints.
@@ -50,6 +53,38 @@ typedef int(asn_constr_check_f)(
 asn_constr_check_f asn_generic_no_constraint;	/* No constraint whatsoever */
 asn_constr_check_f asn_generic_unknown_constraint; /* Not fully supported */
 
+/*
+ * Constraints checking fused into the encoders
+ * (see asn_codec_ctx_t.check_constraints). While it is in effect for the
+ * calling thread, the encoders of the constructed types check each member
+ * right before encoding it, and the constraint checkers of the constructed
+ * types leave their members to the encoders instead of descending into them.
+ */
+extern ASN__THREAD_LOCAL int asn__encode_constraints;
+int asn__encode_constraints_enter(const struct asn_codec_ctx_s *opt_ctx);
+void asn__encode_constraints_leave(int saved);
+
+/*
+ * Check the constraints of the value which is about to be encoded.
+ * Returns 0 if it can be encoded, or -1 with the (.failed_type) and
+ * (.structure_ptr) of the (*rval) pointing to the offending value.
+ */
+int asn__encode_check_type(const struct asn_TYPE_descriptor_s *td,
+                           const void *sptr, struct asn_enc_rval_s *rval);
+int asn__encode_check_member(const struct asn_TYPE_member_s *elm,
+                             const void *memb_ptr,
+                             struct asn_enc_rval_s *rval);
+#define ASN__ENCODE_CONSTRAINTS_FAILED(elm, memb_ptr, rval) \
+    (asn__encode_constraints && asn__encode_check_member(elm, memb_ptr, rval))
+
+/*
+ * Set while asn_decode() checks the structure it has just decoded
+ * (see asn_codec_ctx_t.check_constraints). The constraint checkers of the
+ * SEQUENCE types mark the structures which pass, so they are not checked
+ * again later on.
+ */
+extern ASN__THREAD_LOCAL int asn__decode_constraints;
+
 /*
  * Invoke the callback with a complete error message.
  */
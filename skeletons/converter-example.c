@@ -19,9 +19,26 @@
 #include <sysexits.h>    /* for EX_* exit codes */
 #include <errno.h>    /* for errno */
 #include <unistd.h>    /* for isatty(3) */
+#include <time.h>    /* for clock_gettime(2) */
+#if defined(_POSIX_MAPPED_FILES) && (_POSIX_MAPPED_FILES > 0)
+#define ASN_CONVERTER_MMAP
+#include <sys/mman.h>    /* for mmap(2) */
+#include <sys/stat.h>    /* for fstat(2) */
+#if defined(_POSIX_THREADS) && (_POSIX_THREADS > 0)
+#define ASN_CONVERTER_THREADS
+#include <pthread.h>    /* for pthread_create(3) */
+#endif
+#endif
 #include <asn_application.h>
 #include <asn_internal.h>    /* for ASN__DEFAULT_STACK_MAX */
 
+#ifndef    ENOMSG
+#define    ENOMSG EINVAL
+#endif
+#ifndef    EBADMSG
+#define    EBADMSG EINVAL
+#endif
+
 /* Convert "Type" defined by -DPDU into "asn_DEF_Type" */
 #ifdef PDU
 #define    ASN_DEF_PDU(t)    asn_DEF_ ## t
@@ -52,6 +69,12 @@ static void *data_decode_from_file(enum asn_transfer_syntax,
                                    FILE *file, const char *name,
                                    ssize_t suggested_bufsize, int first_pdu);
 static int write_out(const void *buffer, size_t size, void *key);
+#ifdef  ASN_CONVERTER_THREADS
+static int transcode_in_parallel(enum asn_transfer_syntax isyntax,
+                                 enum asn_transfer_syntax osyntax,
+                                 asn_TYPE_descriptor_t *pduType, FILE *file,
+                                 const char *name, FILE *binary_out);
+#endif
 static FILE *argument_to_file(char *av[], int idx);
 static char *argument_to_name(char *av[], int idx);
 
@@ -60,6 +83,14 @@ static int opt_check;   /* -c (constraints checking) */
 static int opt_stack;   /* -s (maximum stack size) */
 static int opt_nopad;   /* -per-nopad (PER input is not padded between msgs) */
 static int opt_onepdu;  /* -1 (decode single PDU) */
+static int opt_mmap;    /* -m (decode PDUs in place from mapped input) */
+static ssize_t opt_obatch;  /* -w (batch output into writes of this size) */
+static int opt_jobs;    /* -j (number of transcoding threads) */
+static enum {
+    BENCHMARK_OFF,
+    BENCHMARK_TEXT,
+    BENCHMARK_JSON
+} opt_benchmark;        /* -t (measure each processing phase) */
 
 #ifdef    JUNKTEST        /* Enable -J <probability> */
 #define JUNKOPT "J:"
@@ -123,6 +154,9 @@ ats_simple_name(enum asn_transfer_syntax syntax) {
     case ATS_BASIC_XER:
     case ATS_CANONICAL_XER:
         return "XER";
+    case ATS_JER:
+    case ATS_JER_MINIFIED:
+        return "JER";
     case ATS_UNALIGNED_BASIC_PER:
     case ATS_UNALIGNED_CANONICAL_PER:
         return "PER";
@@ -148,6 +182,8 @@ static syntax_selector input_encodings[] = {
      "Input is in Unaligned PER (Packed Encoding Rules)"},
     {"xer", ATS_BASIC_XER, CODEC_OFFSET(xer_decoder),
      "Input is in XER (XML Encoding Rules)"},
+    {"jer", ATS_JER, CODEC_OFFSET(jer_decoder),
+     "Input is in JER (JSON Encoding Rules)"},
     {0, ATS_INVALID, 0, 0}};
 
 static syntax_selector output_encodings[] = {
@@ -159,6 +195,8 @@ static syntax_selector output_encodings[] = {
      "Output as Unaligned PER (Packed Encoding Rules)"},
     {"xer", ATS_BASIC_XER, CODEC_OFFSET(xer_encoder),
      "Output as XER (XML Encoding Rules)"},
+    {"jer", ATS_JER, CODEC_OFFSET(jer_encoder),
+     "Output as JER (JSON Encoding Rules)"},
     {"text", ATS_NONSTANDARD_PLAINTEXT, CODEC_OFFSET(print_struct),
      "Output as plain semi-structured text"},
     {"null", ATS_INVALID, CODEC_OFFSET(print_struct),
@@ -189,6 +227,199 @@ ats_by_name(const char *name, const asn_TYPE_descriptor_t *td,
     return NULL;
 }
 
+/*
+ * Benchmarking support (-t).
+ */
+enum benchmark_phase_e {
+    BP_DECODE,
+    BP_CHECK,
+    BP_ENCODE,
+    BP_FREE,
+    BP_MAX
+};
+
+static struct benchmark_phase {
+    const char *name;
+    uint64_t *samples;  /* Nanoseconds spent on each PDU */
+    size_t count;
+    size_t allocated;
+    size_t allocs;      /* CALLOC() and MALLOC() calls */
+    size_t reallocs;    /* REALLOC() calls */
+    size_t frees;       /* FREEMEM() calls */
+} Benchmark[BP_MAX] = {{"decode", 0, 0, 0, 0, 0, 0},
+                       {"check", 0, 0, 0, 0, 0, 0},
+                       {"encode", 0, 0, 0, 0, 0, 0},
+                       {"free", 0, 0, 0, 0, 0, 0}};
+
+/* Memory management calls made by the ASN.1 support code */
+struct allocation_counters {
+    size_t allocs;
+    size_t reallocs;
+    size_t frees;
+};
+
+struct benchmark_mark {
+    struct timespec started;
+    struct allocation_counters allocations;
+};
+
+static void *
+counting_calloc(size_t nmemb, size_t size, void *opaque) {
+    ((struct allocation_counters *)opaque)->allocs++;
+    return calloc(nmemb, size);
+}
+
+static void *
+counting_malloc(size_t size, void *opaque) {
+    ((struct allocation_counters *)opaque)->allocs++;
+    return malloc(size);
+}
+
+static void *
+counting_realloc(void *ptr, size_t size, void *opaque) {
+    ((struct allocation_counters *)opaque)->reallocs++;
+    return realloc(ptr, size);
+}
+
+static void
+counting_free(void *ptr, void *opaque) {
+    ((struct allocation_counters *)opaque)->frees++;
+    free(ptr);
+}
+
+static struct allocation_counters AllocationCounters;
+static const asn_allocator_t counting_allocator = {
+    counting_calloc, counting_malloc, counting_realloc, counting_free,
+    &AllocationCounters};
+
+static void
+benchmark_start(struct benchmark_mark *mark) {
+    if(!opt_benchmark) return;
+    mark->allocations = AllocationCounters;
+    clock_gettime(CLOCK_MONOTONIC, &mark->started);
+}
+
+static void
+benchmark_stop(enum benchmark_phase_e phase,
+               const struct benchmark_mark *mark) {
+    struct benchmark_phase *bp = &Benchmark[phase];
+    struct timespec now;
+
+    if(!opt_benchmark) return;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    if(bp->count == bp->allocated) {
+        /* Not using REALLOC() to keep it out of the allocation counters */
+        size_t newsize = bp->allocated ? 2 * bp->allocated : 1024;
+        void *p = realloc(bp->samples, newsize * sizeof(bp->samples[0]));
+        if(!p) {
+            perror("realloc()");
+            exit(EX_OSERR);
+        }
+        bp->samples = (uint64_t *)p;
+        bp->allocated = newsize;
+    }
+    bp->samples[bp->count++] =
+        (uint64_t)(now.tv_sec - mark->started.tv_sec) * 1000000000
+        + now.tv_nsec - mark->started.tv_nsec;
+
+    bp->allocs += AllocationCounters.allocs - mark->allocations.allocs;
+    bp->reallocs += AllocationCounters.reallocs - mark->allocations.reallocs;
+    bp->frees += AllocationCounters.frees - mark->allocations.frees;
+}
+
+static int
+compare_samples(const void *ap, const void *bp) {
+    uint64_t a = *(const uint64_t *)ap;
+    uint64_t b = *(const uint64_t *)bp;
+    return (a > b) - (a < b);
+}
+
+/* Nearest-rank percentile of the sorted samples */
+static uint64_t
+benchmark_percentile(const struct benchmark_phase *bp, unsigned percent) {
+    size_t rank = (bp->count * percent + 99) / 100;
+    return bp->samples[rank ? rank - 1 : 0];
+}
+
+static void
+benchmark_report(const asn_TYPE_descriptor_t *pduType,
+                 enum asn_transfer_syntax isyntax,
+                 enum asn_transfer_syntax osyntax) {
+    int json = (opt_benchmark == BENCHMARK_JSON);
+    int printed = 0;
+    int phase;
+
+    if(json) {
+        printf("{\"pdu\": \"%s\", \"input\": \"%s\", \"output\": \"%s\", "
+               "\"pdus\": %" ASN_PRI_SIZE ", \"phases\": {",
+               pduType->name, ats_simple_name(isyntax),
+               ats_simple_name(osyntax), Benchmark[BP_DECODE].count);
+    } else {
+        printf("%s: %" ASN_PRI_SIZE " PDUs, %s to %s\n", pduType->name,
+               Benchmark[BP_DECODE].count, ats_simple_name(isyntax),
+               ats_simple_name(osyntax));
+        printf("%-8s %10s %10s %10s %10s %10s %10s %8s %8s %8s\n", "phase",
+               "mean,ns", "min", "p50", "p90", "p99", "max", "allocs",
+               "reallocs", "frees");
+    }
+
+    for(phase = 0; phase < BP_MAX; phase++) {
+        struct benchmark_phase *bp = &Benchmark[phase];
+        uint64_t total = 0;
+        size_t i;
+
+        if(!bp->count) continue;
+
+        qsort(bp->samples, bp->count, sizeof(bp->samples[0]),
+              compare_samples);
+        for(i = 0; i < bp->count; i++) total += bp->samples[i];
+
+        if(json) {
+            printf("%s\"%s\": {\"mean_ns\": %.0f, \"min_ns\": %llu, "
+                   "\"p50_ns\": %llu, \"p90_ns\": %llu, \"p99_ns\": %llu, "
+                   "\"max_ns\": %llu, \"allocs\": %.2f, \"reallocs\": %.2f, "
+                   "\"frees\": %.2f}",
+                   printed ? ", " : "", bp->name,
+                   (double)total / bp->count,
+                   (unsigned long long)bp->samples[0],
+                   (unsigned long long)benchmark_percentile(bp, 50),
+                   (unsigned long long)benchmark_percentile(bp, 90),
+                   (unsigned long long)benchmark_percentile(bp, 99),
+                   (unsigned long long)bp->samples[bp->count - 1],
+                   (double)bp->allocs / bp->count,
+                   (double)bp->reallocs / bp->count,
+                   (double)bp->frees / bp->count);
+        } else {
+            printf("%-8s %10.0f %10llu %10llu %10llu %10llu %10llu"
+                   " %8.2f %8.2f %8.2f\n",
+                   bp->name,
+                   (double)total / bp->count,
+                   (unsigned long long)bp->samples[0],
+                   (unsigned long long)benchmark_percentile(bp, 50),
+                   (unsigned long long)benchmark_percentile(bp, 90),
+                   (unsigned long long)benchmark_percentile(bp, 99),
+                   (unsigned long long)bp->samples[bp->count - 1],
+                   (double)bp->allocs / bp->count,
+                   (double)bp->reallocs / bp->count,
+                   (double)bp->frees / bp->count);
+        }
+        printed = 1;
+    }
+
+    if(json) {
+        printf("}}\n");
+    }
+}
+
+static int
+discard_out(const void *buffer, size_t size, void *key) {
+    (void)buffer;
+    (void)size;
+    (void)key;
+    return 0;
+}
+
 int
 main(int ac, char *av[]) {
     FILE *binary_out;
@@ -227,7 +458,7 @@ main(int ac, char *av[]) {
     /*
      * Pocess the command-line argments.
      */
-    while((ch = getopt(ac, av, "i:o:1b:cdn:p:hs:" JUNKOPT RANDOPT)) != -1)
+    while((ch = getopt(ac, av, "i:o:1b:cdj:mn:p:hs:t:w:" JUNKOPT RANDOPT)) != -1)
     switch(ch) {
     case 'i':
         sel = ats_by_name(optarg, anyPduType, input_encodings);
@@ -268,6 +499,28 @@ main(int ac, char *av[]) {
     case 'd':
         opt_debug++;    /* Double -dd means ASN.1 debug */
         break;
+    case 'j':
+#ifdef  ASN_CONVERTER_THREADS
+        opt_jobs = atoi(optarg);
+        if(opt_jobs < 1 || opt_jobs > 1024) {
+            fprintf(stderr,
+                "-j %s: Improper number of threads (1..1024)\n",
+                optarg);
+            exit(EX_UNAVAILABLE);
+        }
+        break;
+#else
+        fprintf(stderr, "-j: Multi-threaded transcoding is not supported\n");
+        exit(EX_UNAVAILABLE);
+#endif
+    case 'm':
+#ifdef  ASN_CONVERTER_MMAP
+        opt_mmap = 1;
+        break;
+#else
+        fprintf(stderr, "-m: Memory mapped input is not supported\n");
+        exit(EX_UNAVAILABLE);
+#endif
     case 'n':
         number_of_iterations = atoi(optarg);
         if(number_of_iterations < 1) {
@@ -322,6 +575,27 @@ main(int ac, char *av[]) {
             exit(EX_UNAVAILABLE);
         }
         break;
+    case 't':
+        if(strcmp(optarg, "text") == 0) {
+            opt_benchmark = BENCHMARK_TEXT;
+        } else if(strcmp(optarg, "json") == 0) {
+            opt_benchmark = BENCHMARK_JSON;
+        } else {
+            fprintf(stderr, "-t %s: Expected \"text\" or \"json\"\n",
+                    optarg);
+            exit(EX_UNAVAILABLE);
+        }
+        break;
+    case 'w':
+        opt_obatch = atoi(optarg);
+        if(opt_obatch < 1
+            || opt_obatch > 16 * 1024 * 1024) {
+            fprintf(stderr,
+                "-w %s: Improper output batch size (1..16M)\n",
+                optarg);
+            exit(EX_UNAVAILABLE);
+        }
+        break;
 #ifdef    JUNKTEST
     case 'J':
         opt_jprob = strtod(optarg, 0);
@@ -382,8 +656,20 @@ main(int ac, char *av[]) {
         "  -b <size>    Set the i/o buffer size (default is %ld)\n"
         "  -c           Check ASN.1 constraints after decoding\n"
         "  -d           Enable debugging (-dd is even better)\n"
+#ifdef  ASN_CONVERTER_THREADS
+        "  -j <num>     Transcode PDUs of a file using <num> threads.\n"
+        "               Only BER input is split into PDUs before decoding;\n"
+        "               other input is decoded by one thread, and the rest\n"
+        "               only check, encode and free the decoded PDUs.\n"
+#endif
+#ifdef  ASN_CONVERTER_MMAP
+        "  -m           Map input files into memory and decode PDUs in place\n"
+#endif
         "  -n <num>     Process files <num> times\n"
         "  -s <size>    Set the stack usage limit (default is %d)\n"
+        "  -t text      Benchmark decode, check, encode and free of each PDU\n"
+        "  -t json      Same as -t text, but print the report in JSON\n"
+        "  -w <size>    Batch output into writes of <size> bytes\n"
 #ifdef    JUNKTEST
         "  -J <prob>    Set random junk test bit garbaging probability\n"
         "  -R <size>    Generate a random value of roughly the given size,\n"
@@ -413,10 +699,20 @@ main(int ac, char *av[]) {
         exit(EX_USAGE);
     }
 
+    if(opt_benchmark) {
+        /* Measure the codecs rather than the I/O and the thread pool */
+        asn_set_default_allocator(&counting_allocator);
+        opt_jobs = 0;
+#ifdef  ASN_CONVERTER_MMAP
+        opt_mmap = 1;
+#endif
+    }
+
     if(isatty(1)) {
         const int is_text_output = osyntax == ATS_NONSTANDARD_PLAINTEXT
                                    || osyntax == ATS_BASIC_XER
-                                   || osyntax == ATS_CANONICAL_XER;
+                                   || osyntax == ATS_CANONICAL_XER
+                                   || osyntax == ATS_JER;
         if(is_text_output) {
             binary_out = stdout;
         } else {
@@ -430,7 +726,22 @@ main(int ac, char *av[]) {
     } else {
         binary_out = stdout;
     }
-    setvbuf(stdout, 0, _IOLBF, 0);
+    if(opt_obatch) {
+        /*
+         * Accumulate the encoded PDUs, flush only when the batch is full.
+         * The buffer of our own: given none, stdio picks its own size.
+         * Used by stdout until the exit, never freed.
+         */
+        static char *obatch_buf;
+        obatch_buf = malloc(opt_obatch);
+        if(!obatch_buf) {
+            perror("malloc()");
+            exit(EX_OSERR);
+        }
+        setvbuf(stdout, obatch_buf, _IOFBF, opt_obatch);
+    } else {
+        setvbuf(stdout, 0, _IOLBF, 0);
+    }
 
     for(num = 0; num < number_of_iterations; num++) {
       int ac_i;
@@ -453,10 +764,22 @@ main(int ac, char *av[]) {
             name = argument_to_name(av, ac_i);
         }
 
+#ifdef  ASN_CONVERTER_THREADS
+        if(opt_jobs > 1 && !opt_onepdu && file
+           && transcode_in_parallel(isyntax, osyntax, pduType, file, name,
+                                    binary_out) == 0) {
+            if(file != stdin) fclose(file);
+            continue;
+        }
+#endif
+
         for(first_pdu = 1; (first_pdu || !opt_onepdu); first_pdu = 0) {
+            struct benchmark_mark mark;
+
             /*
              * Decode the encoded structure from file.
              */
+            benchmark_start(&mark);
 #ifdef  JUNKTEST
             if(isyntax == ATS_RANDOM) {
                 structure = NULL;
@@ -481,12 +804,17 @@ main(int ac, char *av[]) {
                     break;
                 }
             }
+            benchmark_stop(BP_DECODE, &mark);
 
             /* Check ASN.1 constraints */
             if(opt_check) {
                 char errbuf[128];
                 size_t errlen = sizeof(errbuf);
-                if(asn_check_constraints(pduType, structure, errbuf, &errlen)) {
+                int ret;
+                benchmark_start(&mark);
+                ret = asn_check_constraints(pduType, structure, errbuf, &errlen);
+                benchmark_stop(BP_CHECK, &mark);
+                if(ret) {
                     fprintf(stderr,
                             "%s: ASN.1 constraint "
                             "check failed: %s\n",
@@ -497,15 +825,20 @@ main(int ac, char *av[]) {
 
             if(osyntax == ATS_INVALID) {
 #ifdef JUNKTEST
-                if(opt_jprob == 0.0) {
+                if(opt_jprob == 0.0 && !opt_benchmark) {
                     fprintf(stderr, "%s: decoded successfully\n", name);
                 }
 #else
-                fprintf(stderr, "%s: decoded successfully\n", name);
+                if(!opt_benchmark) {
+                    fprintf(stderr, "%s: decoded successfully\n", name);
+                }
 #endif
             } else {
-                erv = asn_encode(NULL, osyntax, pduType, structure, write_out,
+                benchmark_start(&mark);
+                erv = asn_encode(NULL, osyntax, pduType, structure,
+                                 opt_benchmark ? discard_out : write_out,
                                  binary_out);
+                benchmark_stop(BP_ENCODE, &mark);
 
                 if(erv.encoded == -1) {
                     fprintf(stderr, "%s: Cannot convert %s into %s\n", name,
@@ -518,7 +851,9 @@ main(int ac, char *av[]) {
                       ats_simple_name(osyntax));
             }
 
+            benchmark_start(&mark);
             ASN_STRUCT_FREE(*pduType, structure);
+            benchmark_stop(BP_FREE, &mark);
         }
 
         if(file && file != stdin) {
@@ -527,6 +862,10 @@ main(int ac, char *av[]) {
       }
     }
 
+    if(opt_benchmark) {
+        benchmark_report(pduType, isyntax, osyntax);
+    }
+
 #ifdef    JUNKTEST
     if(opt_jprob > 0.0) {
         fprintf(stderr, "Junked %f OK (%d/%d)\n",
@@ -755,6 +1094,465 @@ restartability_supported(enum asn_transfer_syntax syntax) {
     return !is_syntax_PER(syntax);
 }
 
+#ifdef  ASN_CONVERTER_MMAP
+static struct mapped_input {
+    uint8_t *data;      /* Start of the mapped file */
+    size_t size;        /* Size of the mapped file */
+    size_t offset;      /* Offset of the next PDU */
+    int skip_bits;      /* Bits of the first byte consumed by previous PDU */
+} MappedInput;
+
+static void
+unmap_input_file(void) {
+    if(MappedInput.data) {
+        munmap(MappedInput.data, MappedInput.size);
+    }
+    memset(&MappedInput, 0, sizeof(MappedInput));
+}
+
+/*
+ * Map the whole file into memory, if it is a regular file.
+ * Returns 0 if the file can be decoded in place, -1 otherwise.
+ */
+static int
+map_input_file(FILE *file) {
+    struct stat st;
+    void *data;
+
+    unmap_input_file();
+
+    if(fstat(fileno(file), &st) != 0 || !S_ISREG(st.st_mode)
+       || st.st_size <= 0 || (uintmax_t)st.st_size > (size_t)-1) {
+        return -1;
+    }
+
+    /* Private writable mapping lets JUNKTEST garble the bytes in place */
+    data = mmap(0, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                fileno(file), 0);
+    if(data == MAP_FAILED) {
+        DEBUG("mmap() failed: %s", strerror(errno));
+        return -1;
+    }
+
+    MappedInput.data = (uint8_t *)data;
+    MappedInput.size = (size_t)st.st_size;
+    DEBUG("Mapped %" ASN_PRI_SIZE " bytes", MappedInput.size);
+
+#ifdef    JUNKTEST
+    junk_bytes_with_probability(MappedInput.data, MappedInput.size, opt_jprob);
+#endif
+
+    return 0;
+}
+
+/*
+ * Decode the next PDU directly from the mapped file, advancing
+ * the byte and bit position instead of copying or shifting data.
+ */
+static void *
+data_decode_from_map(enum asn_transfer_syntax isyntax,
+                     asn_TYPE_descriptor_t *pduType,
+                     const asn_codec_ctx_t *opt_codec_ctx, const char *name,
+                     int on_first_pdu) {
+    uint8_t *i_bptr = MappedInput.data + MappedInput.offset;
+    size_t i_size = MappedInput.size - MappedInput.offset;
+    size_t residue_bits = 8 * i_size - MappedInput.skip_bits;
+    size_t consumed_bits = 0;
+    size_t tolerated_bytes;
+    void *structure = 0;
+    asn_dec_rval_t rval;
+
+    if(residue_bits == 0) {
+        unmap_input_file();
+        errno = 0;
+        return 0;
+    }
+
+    if(is_syntax_PER(isyntax) && opt_nopad) {
+#ifdef  ASN_DISABLE_PER_SUPPORT
+        rval.code = RC_FAIL;
+        rval.consumed = 0;
+#else
+        /* uper_decode() returns bits! */
+        rval = uper_decode(opt_codec_ctx, pduType, (void **)&structure, i_bptr,
+                           i_size, MappedInput.skip_bits, 0);
+        consumed_bits = rval.consumed;
+#endif
+    } else {
+        rval = asn_decode(opt_codec_ctx, isyntax, pduType, (void **)&structure,
+                          i_bptr, i_size);
+        consumed_bits = 8 * rval.consumed;
+    }
+
+    DEBUG("decode(%" ASN_PRI_SIZE "+%db) consumed %" ASN_PRI_SIZE "b, code %d",
+          i_size, MappedInput.skip_bits, consumed_bits, rval.code);
+
+    if(rval.code == RC_OK) {
+        if(consumed_bits == 0) {
+            /* Nothing consumed: do not loop over the same input forever */
+            MappedInput.offset = MappedInput.size;
+            MappedInput.skip_bits = 0;
+        } else {
+            consumed_bits += MappedInput.skip_bits;
+            MappedInput.offset += consumed_bits >> 3;
+            MappedInput.skip_bits = consumed_bits % 8;
+        }
+        return structure;
+    }
+
+    ASN_STRUCT_FREE(*pduType, structure);
+
+    /*
+     * Trailing padding bits of a non-padded PER stream and the final
+     * newline of an XER or JER file are not a decoding failure.
+     */
+    tolerated_bytes = (isyntax == ATS_BASIC_XER || isyntax == ATS_JER)
+                          ? sizeof("\r\n") - 1
+                          : 0;
+    if(!on_first_pdu
+       && (residue_bits < 8 || (MappedInput.skip_bits == 0
+                                && i_size <= tolerated_bytes))) {
+        unmap_input_file();
+        errno = 0;
+        return 0;
+    }
+
+#ifdef    JUNKTEST
+    if(opt_jprob != 0.0) {
+        junk_failures++;
+        unmap_input_file();
+        errno = 0;
+        return 0;
+    }
+#endif
+
+    fprintf(stderr, "%s: Decode failed past byte %ld: %s\n", name,
+            (long)MappedInput.offset,
+            (rval.code == RC_WMORE) ? "Unexpected end of input"
+                                    : "Input processing error");
+    unmap_input_file();
+    errno = (rval.code == RC_WMORE) ? ENOMSG : EBADMSG;
+    return 0;
+}
+#endif  /* ASN_CONVERTER_MMAP */
+
+#ifdef  ASN_CONVERTER_THREADS
+/*
+ * Multi-threaded transcoding of a mapped file (-j).
+ *
+ * The main thread splits the input into PDUs and posts them into a ring
+ * of jobs. BER PDUs are self-delimiting, so they are framed by their
+ * TLV length and decoded by the workers; other syntaxes are decoded by
+ * the main thread and the workers check, encode and free the structure.
+ * The ring doubles as a reorder buffer: encoded PDUs are written out
+ * by the main thread strictly in the input order.
+ */
+#define TRANSCODE_RING_SIZE 256
+
+enum transcode_job_state {
+    TJS_FREE,       /* Slot is available to the producer */
+    TJS_POSTED,     /* Waiting to be picked by a worker */
+    TJS_DONE        /* Processed, waiting to be written out */
+};
+
+struct transcode_job {
+    enum transcode_job_state state;
+    const uint8_t *data;    /* Undecoded PDU, if structure is not given */
+    size_t size;
+    size_t input_offset;    /* Position of the PDU in the input file */
+    void *structure;        /* Already decoded PDU */
+    int exit_code;          /* Non-zero if processing failed */
+    char errbuf[192];
+    struct {
+        uint8_t *buffer;    /* Encoded PDU, reused across jobs */
+        size_t length;
+        size_t allocated;
+    } out;
+};
+
+static struct transcode_pool {
+    pthread_mutex_t lock;
+    pthread_cond_t job_posted;  /* Signalled to the workers */
+    pthread_cond_t job_done;    /* Signalled to the main thread */
+    struct transcode_job ring[TRANSCODE_RING_SIZE];
+    size_t posted;      /* Number of jobs posted by the main thread */
+    size_t taken;       /* Number of jobs picked up by the workers */
+    size_t written;     /* Number of jobs written out in order */
+    enum asn_transfer_syntax isyntax;
+    enum asn_transfer_syntax osyntax;
+    asn_TYPE_descriptor_t *pduType;
+} TranscodePool;
+
+static int
+append_to_job(const void *buffer, size_t size, void *key) {
+    struct transcode_job *job = (struct transcode_job *)key;
+
+    if(job->out.length + size > job->out.allocated) {
+        size_t newsize = 2 * job->out.allocated + size + 64;
+        void *p = REALLOC(job->out.buffer, newsize);
+        if(!p) return -1;
+        job->out.buffer = (uint8_t *)p;
+        job->out.allocated = newsize;
+    }
+    memcpy(job->out.buffer + job->out.length, buffer, size);
+    job->out.length += size;
+    return 0;
+}
+
+static void
+transcode_job(struct transcode_job *job,
+              const asn_codec_ctx_t *opt_codec_ctx) {
+    asn_TYPE_descriptor_t *pduType = TranscodePool.pduType;
+    void *structure = job->structure;
+
+    job->out.length = 0;
+
+    if(!structure) {
+        asn_dec_rval_t rval =
+            asn_decode(opt_codec_ctx, TranscodePool.isyntax, pduType,
+                       &structure, job->data, job->size);
+        if(rval.code != RC_OK) {
+            snprintf(job->errbuf, sizeof(job->errbuf),
+                     "Decode failed past byte %ld: %s",
+                     (long)(job->input_offset + rval.consumed),
+                     (rval.code == RC_WMORE) ? "Unexpected end of input"
+                                             : "Input processing error");
+            job->exit_code = EX_DATAERR;
+            ASN_STRUCT_FREE(*pduType, structure);
+            return;
+        }
+    }
+
+    if(opt_check) {
+        char errbuf[128];
+        size_t errlen = sizeof(errbuf);
+        if(asn_check_constraints(pduType, structure, errbuf, &errlen)) {
+            snprintf(job->errbuf, sizeof(job->errbuf),
+                     "ASN.1 constraint check failed: %s", errbuf);
+            job->exit_code = EX_DATAERR;
+        }
+    }
+
+    if(!job->exit_code && TranscodePool.osyntax != ATS_INVALID) {
+        asn_enc_rval_t erv = asn_encode(opt_codec_ctx, TranscodePool.osyntax,
+                                        pduType, structure, append_to_job, job);
+        if(erv.encoded == -1) {
+            snprintf(job->errbuf, sizeof(job->errbuf),
+                     "Cannot convert %s into %s", pduType->name,
+                     ats_simple_name(TranscodePool.osyntax));
+            job->exit_code = EX_UNAVAILABLE;
+        }
+    }
+
+    ASN_STRUCT_FREE(*pduType, structure);
+}
+
+static void *
+transcode_worker(void *arg) {
+    asn_codec_ctx_t s_codec_ctx;    /* Per-thread, for the stack checker */
+    asn_codec_ctx_t *opt_codec_ctx = 0;
+
+    (void)arg;
+
+    if(opt_stack) {
+        memset(&s_codec_ctx, 0, sizeof(s_codec_ctx));
+        s_codec_ctx.max_stack_size = opt_stack;
+        opt_codec_ctx = &s_codec_ctx;
+    }
+
+    pthread_mutex_lock(&TranscodePool.lock);
+    for(;;) {
+        struct transcode_job *job;
+
+        while(TranscodePool.taken == TranscodePool.posted) {
+            pthread_cond_wait(&TranscodePool.job_posted, &TranscodePool.lock);
+        }
+
+        job = &TranscodePool.ring[TranscodePool.taken++ % TRANSCODE_RING_SIZE];
+        pthread_mutex_unlock(&TranscodePool.lock);
+
+        transcode_job(job, opt_codec_ctx);
+
+        pthread_mutex_lock(&TranscodePool.lock);
+        job->state = TJS_DONE;
+        pthread_cond_signal(&TranscodePool.job_done);
+    }
+
+    /* Workers are kept for the lifetime of the process */
+    return 0;
+}
+
+/*
+ * Write out the processed jobs in the input order, waiting for at least
+ * one of them (or for all of them, if wait_all is set).
+ * Must be called with the pool lock held.
+ */
+static void
+write_out_jobs(const char *name, FILE *binary_out, int wait_all) {
+    int waited = 0;
+
+    while(TranscodePool.written < TranscodePool.posted) {
+        struct transcode_job *job =
+            &TranscodePool.ring[TranscodePool.written % TRANSCODE_RING_SIZE];
+
+        if(job->state != TJS_DONE) {
+            if(waited && !wait_all) break;
+            pthread_cond_wait(&TranscodePool.job_done, &TranscodePool.lock);
+            continue;
+        }
+
+        if(job->exit_code) {
+            fprintf(stderr, "%s: %s\n", name, job->errbuf);
+            exit(job->exit_code);
+        }
+
+        /* The slot is not reused until it is marked free */
+        pthread_mutex_unlock(&TranscodePool.lock);
+        if(TranscodePool.osyntax == ATS_INVALID) {
+            fprintf(stderr, "%s: decoded successfully\n", name);
+        } else if(write_out(job->out.buffer, job->out.length, binary_out)) {
+            fprintf(stderr, "%s: Cannot write output: %s\n", name,
+                    strerror(errno));
+            exit(EX_IOERR);
+        }
+        DEBUG("Encoded in %" ASN_PRI_SIZE " bytes of %s", job->out.length,
+              ats_simple_name(TranscodePool.osyntax));
+        pthread_mutex_lock(&TranscodePool.lock);
+
+        job->state = TJS_FREE;
+        TranscodePool.written++;
+        waited = 1;
+    }
+}
+
+static void
+post_job(const uint8_t *data, size_t size, size_t input_offset,
+         void *structure, const char *name, FILE *binary_out) {
+    struct transcode_job *job;
+
+    pthread_mutex_lock(&TranscodePool.lock);
+    if(TranscodePool.posted - TranscodePool.written == TRANSCODE_RING_SIZE) {
+        write_out_jobs(name, binary_out, 0);
+    }
+    job = &TranscodePool.ring[TranscodePool.posted % TRANSCODE_RING_SIZE];
+    assert(job->state == TJS_FREE);
+    job->state = TJS_POSTED;
+    job->data = data;
+    job->size = size;
+    job->input_offset = input_offset;
+    job->structure = structure;
+    job->exit_code = 0;
+    TranscodePool.posted++;
+    pthread_cond_signal(&TranscodePool.job_posted);
+    pthread_mutex_unlock(&TranscodePool.lock);
+}
+
+/*
+ * Determine the size of the BER TLV at the start of the buffer.
+ * If the TLV cannot be framed, the rest of the buffer is returned
+ * for the decoder to report the error.
+ */
+static size_t
+ber_pdu_size(const uint8_t *data, size_t size) {
+    ber_tlv_tag_t tlv_tag;
+    ssize_t tag_len;
+    ssize_t len_len;
+
+    tag_len = ber_fetch_tag(data, size, &tlv_tag);
+    if(tag_len <= 0) return size;
+    len_len = ber_skip_length(0, BER_TLV_CONSTRUCTED(data), data + tag_len,
+                              size - tag_len);
+    if(len_len <= 0) return size;
+    return tag_len + len_len;
+}
+
+/*
+ * Transcode all PDUs of the file using opt_jobs threads.
+ * Returns -1 if the file cannot be processed this way.
+ */
+static int
+transcode_in_parallel(enum asn_transfer_syntax isyntax,
+                      enum asn_transfer_syntax osyntax,
+                      asn_TYPE_descriptor_t *pduType, FILE *file,
+                      const char *name, FILE *binary_out) {
+    static pthread_t *workers;
+    static int nworkers;
+    asn_codec_ctx_t s_codec_ctx;
+    asn_codec_ctx_t *opt_codec_ctx = 0;
+    int first_pdu;
+    int failed = 0;
+    int i;
+
+#ifdef    JUNKTEST
+    if(opt_jprob > 0.0) return -1;
+#endif
+    if(map_input_file(file) != 0) {
+        DEBUG("%s cannot be mapped, transcoding it in a single thread", name);
+        return -1;
+    }
+
+    if(opt_stack) {
+        memset(&s_codec_ctx, 0, sizeof(s_codec_ctx));
+        s_codec_ctx.max_stack_size = opt_stack;
+        opt_codec_ctx = &s_codec_ctx;
+    }
+
+    TranscodePool.isyntax = isyntax;
+    TranscodePool.osyntax = osyntax;
+    TranscodePool.pduType = pduType;
+    if(!workers) {
+        workers = (pthread_t *)CALLOC(opt_jobs, sizeof(workers[0]));
+        if(!workers) {
+            perror("calloc()");
+            exit(EX_OSERR);
+        }
+        pthread_mutex_init(&TranscodePool.lock, 0);
+        pthread_cond_init(&TranscodePool.job_posted, 0);
+        pthread_cond_init(&TranscodePool.job_done, 0);
+        for(i = 0; i < opt_jobs; i++) {
+            int err = pthread_create(&workers[i], 0, transcode_worker, 0);
+            if(err) {
+                fprintf(stderr, "pthread_create(): %s\n", strerror(err));
+                exit(EX_OSERR);
+            }
+        }
+        nworkers = opt_jobs;
+    }
+
+    DEBUG("Transcoding %s using %d threads", name, nworkers);
+
+    for(first_pdu = 1;; first_pdu = 0) {
+        if(isyntax == ATS_BER) {
+            const uint8_t *data = MappedInput.data + MappedInput.offset;
+            size_t size = MappedInput.size - MappedInput.offset;
+            if(size == 0) break;
+            size = ber_pdu_size(data, size);
+            post_job(data, size, MappedInput.offset, 0, name, binary_out);
+            MappedInput.offset += size;
+        } else {
+            void *structure = data_decode_from_map(isyntax, pduType,
+                                                   opt_codec_ctx, name,
+                                                   first_pdu);
+            if(!structure) {
+                /* Error message, if any, is already printed */
+                failed = (errno != 0);
+                break;
+            }
+            post_job(0, 0, 0, structure, name, binary_out);
+        }
+    }
+
+    /* Flush the PDUs preceding the failure, as in the serial mode */
+    pthread_mutex_lock(&TranscodePool.lock);
+    write_out_jobs(name, binary_out, 1);
+    pthread_mutex_unlock(&TranscodePool.lock);
+    if(failed) exit(EX_DATAERR);
+
+    unmap_input_file();
+    return 0;
+}
+#endif  /* ASN_CONVERTER_THREADS */
+
 static void *
 data_decode_from_file(enum asn_transfer_syntax isyntax, asn_TYPE_descriptor_t *pduType, FILE *file, const char *name, ssize_t suggested_bufsize, int on_first_pdu) {
     static uint8_t *fbuf;
@@ -781,6 +1579,18 @@ data_decode_from_file(enum asn_transfer_syntax isyntax, asn_TYPE_descriptor_t *p
 
     DEBUG("Processing %s", name);
 
+#ifdef  ASN_CONVERTER_MMAP
+    if(opt_mmap) {
+        if(on_first_pdu && map_input_file(file) != 0) {
+            DEBUG("%s cannot be mapped, reading it as a stream", name);
+        }
+        if(MappedInput.data) {
+            return data_decode_from_map(isyntax, pduType, opt_codec_ctx, name,
+                                        on_first_pdu);
+        }
+    }
+#endif
+
     /* prepare the file buffer */
     if(fbuf_size != suggested_bufsize) {
         fbuf = (uint8_t *)REALLOC(fbuf, suggested_bufsize);
@@ -920,7 +1730,8 @@ data_decode_from_file(enum asn_transfer_syntax isyntax, asn_TYPE_descriptor_t *p
      */
     if(on_first_pdu
     || DynamicBuffer.length
-    || new_offset - old_offset > ((isyntax == ATS_BASIC_XER)?sizeof("\r\n")-1:0)
+    || new_offset - old_offset > ((isyntax == ATS_BASIC_XER
+                                   || isyntax == ATS_JER)?sizeof("\r\n")-1:0)
     ) {
 
 #ifdef    JUNKTEST
@@ -944,12 +1755,6 @@ data_decode_from_file(enum asn_transfer_syntax isyntax, asn_TYPE_descriptor_t *p
             (rval.code == RC_WMORE)
                 ? "Unexpected end of input"
                 : "Input processing error");
-#ifndef    ENOMSG
-#define    ENOMSG EINVAL
-#endif
-#ifndef    EBADMSG
-#define    EBADMSG EINVAL
-#endif
         errno = (rval.code == RC_WMORE) ? ENOMSG : EBADMSG;
     } else {
         /* Got EOF after a few successful PDUs */
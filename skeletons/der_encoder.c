@@ -186,7 +186,7 @@ der_write_TL(ber_tlv_tag_t tag, ber_tlv_len_t len,
 	 */
 	if(cb) {
 		if(constructed) *buf |= 0x20;
-		if(cb(buf, size, app_key) < 0)
+		if(ASN__E_cbc(buf, size))
 			return -1;
 	}
 
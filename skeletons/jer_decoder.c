@@ -0,0 +1,314 @@
+/*
+ * Redistribution and modifications are permitted subject to BSD license.
+ */
+#include <asn_application.h>
+#include <asn_internal.h>
+#include <jer_support.h>		/* JER/JSON parsing support */
+
+
+/*
+ * Decode the JER encoding of a given type.
+ */
+asn_dec_rval_t
+jer_decode(const asn_codec_ctx_t *opt_codec_ctx,
+           const asn_TYPE_descriptor_t *td, void **struct_ptr,
+           const void *buffer, size_t size) {
+    asn_codec_ctx_t s_codec_ctx;
+    const asn_allocator_t *saved_allocator;
+    asn_dec_rval_t rval;
+
+	/*
+	 * Stack checker requires that the codec context
+	 * must be allocated on the stack.
+	 */
+	if(opt_codec_ctx) {
+		if(opt_codec_ctx->max_stack_size) {
+			s_codec_ctx = *opt_codec_ctx;
+			opt_codec_ctx = &s_codec_ctx;
+		}
+	} else {
+		/* If context is not given, be security-conscious anyway */
+		memset(&s_codec_ctx, 0, sizeof(s_codec_ctx));
+		s_codec_ctx.max_stack_size = ASN__DEFAULT_STACK_MAX;
+		opt_codec_ctx = &s_codec_ctx;
+	}
+
+	/*
+	 * Invoke type-specific decoder.
+	 */
+	saved_allocator = asn__allocator_enter(opt_codec_ctx);
+	rval = td->op->jer_decoder(opt_codec_ctx, td, struct_ptr, buffer, size);
+	asn__allocator_leave(saved_allocator);
+
+	return rval;
+}
+
+
+
+struct jer__cb_arg {
+	pjson_chunk_type_e	chunk_type;
+	size_t			chunk_size;
+	int callback_not_invoked;
+};
+
+static int
+jer__token_cb(pjson_chunk_type_e type, const void *_chunk_data, size_t _chunk_size, void *key) {
+	struct jer__cb_arg *arg = (struct jer__cb_arg *)key;
+	(void)_chunk_data;
+	arg->chunk_type = type;
+	arg->chunk_size = _chunk_size;
+	arg->callback_not_invoked = 0;
+	return -1;	/* Terminate the JSON parsing */
+}
+
+/*
+ * Fetch the next token from the JER/JSON stream.
+ */
+ssize_t
+jer_next_token(const void *buffer, size_t size, pjer_chunk_type_e *ch_type) {
+	struct jer__cb_arg arg;
+	ssize_t ret;
+
+	arg.callback_not_invoked = 1;
+	ret = pjson_parse(buffer, size, jer__token_cb, &arg);
+	if(ret < 0) return -1;
+	if(arg.callback_not_invoked) {
+		assert(ret == 0);	/* No data was consumed */
+		*ch_type = PJER_WMORE;
+		return 0;		/* Try again with more data */
+	} else {
+		assert(arg.chunk_size);
+	}
+
+	/*
+	 * Translate the JSON chunk types into more convenient ones.
+	 */
+	switch(arg.chunk_type) {
+	case PJSON_WHITESPACE:
+		*ch_type = PJER_WHITESPACE;
+		break;
+	case PJSON_DELIMITER:
+		*ch_type = PJER_DLM;
+		break;
+	case PJSON_STRING:
+		*ch_type = PJER_STRING;
+		break;
+	case PJSON_LITERAL:
+		*ch_type = PJER_LITERAL;
+		break;
+	}
+
+	return arg.chunk_size;
+}
+
+asn_dec_rval_t
+jer_decode_primitive(const asn_codec_ctx_t *opt_codec_ctx,
+                     const asn_TYPE_descriptor_t *td, void **sptr,
+                     size_t struct_size, const void *buf_ptr, size_t size,
+                     jer_primitive_body_decoder_f *prim_body_decoder) {
+	const char *ptr = (const char *)buf_ptr;
+	asn_dec_rval_t rval;
+
+	(void)opt_codec_ctx;
+
+	/*
+	 * Create the structure if does not exist.
+	 */
+	if(!*sptr) {
+		*sptr = CALLOC(1, struct_size);
+		if(!*sptr) ASN__DECODE_FAILED;
+	}
+
+	for(;;) {
+		pjer_chunk_type_e ch_type;
+		ssize_t ch_size;
+
+		ch_size = jer_next_token(ptr, size - (ptr - (const char *)buf_ptr),
+			&ch_type);
+		if(ch_size < 0) ASN__DECODE_FAILED;
+
+		switch(ch_type) {
+		case PJER_WMORE:
+			ASN__DECODE_STARVED;
+		case PJER_WHITESPACE:
+			ptr += ch_size;
+			continue;
+		case PJER_DLM:
+			ASN_DEBUG("Unexpected JER delimiter %c in %s",
+				*ptr, td->name);
+			ASN__DECODE_FAILED;
+		case PJER_STRING:
+		case PJER_LITERAL:
+			break;
+		}
+
+		switch(prim_body_decoder(td, *sptr, ch_type, ptr, ch_size)) {
+		case JPBD_BODY_CONSUMED:
+			rval.code = RC_OK;
+			rval.consumed = (ptr - (const char *)buf_ptr) + ch_size;
+			return rval;
+		case JPBD_SYSTEM_FAILURE:
+		case JPBD_DECODER_LIMIT:
+		case JPBD_BROKEN_ENCODING:
+			break;
+		}
+		ASN__DECODE_FAILED;
+	}
+}
+
+int
+jer_skip_unknown(pjer_chunk_type_e ch_type, const void *chunk_buf,
+                 ber_tlv_len_t *depth) {
+	assert(*depth >= 0);
+	switch(ch_type) {
+	case PJER_STRING:
+	case PJER_LITERAL:
+		return *depth ? 0 : 1;
+	case PJER_DLM:
+		switch(*(const char *)chunk_buf) {
+		case 0x5b:	/* '[' */
+		case 0x7b:	/* '{' */
+			++(*depth);
+			return 0;
+		case 0x5d:	/* ']' */
+		case 0x7d:	/* '}' */
+			if(*depth == 0) return -1;
+			return --(*depth) ? 0 : 1;
+		default:	/* ':' and ',' separate the inner values */
+			return *depth ? 0 : -1;
+		}
+	default:
+		return -1;
+	}
+}
+
+static int
+jer__hex4(const uint8_t *p, const uint8_t *end, uint32_t *value) {
+	uint32_t v = 0;
+	int i;
+
+	if(end - p < 4) return -1;
+
+	for(i = 0; i < 4; i++) {
+		int ch = p[i];
+		v <<= 4;
+		switch(ch) {
+		case 0x30: case 0x31: case 0x32: case 0x33: case 0x34:
+		case 0x35: case 0x36: case 0x37: case 0x38: case 0x39:
+			v |= ch - 0x30;
+			break;
+		case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46:
+			v |= ch - 0x41 + 10;
+			break;
+		case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+			v |= ch - 0x61 + 10;
+			break;
+		default:
+			return -1;
+		}
+	}
+
+	*value = v;
+	return 0;
+}
+
+ssize_t
+jer_string_unescape(const void *str, size_t size, void *dst) {
+	const uint8_t *p = (const uint8_t *)str;
+	const uint8_t *end = p + size;
+	uint8_t *d = (uint8_t *)dst;
+
+	while(p < end) {
+		uint32_t cp;
+		int ch = *p++;
+
+		if(ch != 0x5c) {	/* '\\' */
+			if(ch < 0x20) return -1;	/* RFC 8259, #7 */
+			*d++ = ch;
+			continue;
+		}
+
+		if(p == end) return -1;
+		switch(*p++) {
+		case 0x22: *d++ = 0x22; continue;	/* \" */
+		case 0x5c: *d++ = 0x5c; continue;	/* \\ */
+		case 0x2f: *d++ = 0x2f; continue;	/* \/ */
+		case 0x62: *d++ = 0x08; continue;	/* \b */
+		case 0x66: *d++ = 0x0c; continue;	/* \f */
+		case 0x6e: *d++ = 0x0a; continue;	/* \n */
+		case 0x72: *d++ = 0x0d; continue;	/* \r */
+		case 0x74: *d++ = 0x09; continue;	/* \t */
+		case 0x75:	/* \uXXXX */
+			if(jer__hex4(p, end, &cp)) return -1;
+			p += 4;
+			break;
+		default:
+			return -1;
+		}
+
+		if(cp >= 0xd800 && cp <= 0xdbff) {
+			/* The high surrogate shall be followed by the low one */
+			uint32_t low;
+			if(end - p < 6 || p[0] != 0x5c || p[1] != 0x75
+			|| jer__hex4(p + 2, end, &low)
+			|| low < 0xdc00 || low > 0xdfff)
+				return -1;
+			p += 6;
+			cp = 0x10000 + ((cp - 0xd800) << 10) + (low - 0xdc00);
+		} else if(cp >= 0xdc00 && cp <= 0xdfff) {
+			return -1;	/* Unpaired low surrogate */
+		}
+
+		/* At most 4 bytes of UTF-8 for at least 6 bytes of input */
+		if(cp < 0x80) {
+			*d++ = cp;
+		} else if(cp < 0x800) {
+			*d++ = 0xc0 | (cp >> 6);
+			*d++ = 0x80 | (cp & 0x3f);
+		} else if(cp < 0x10000) {
+			*d++ = 0xe0 | (cp >> 12);
+			*d++ = 0x80 | ((cp >> 6) & 0x3f);
+			*d++ = 0x80 | (cp & 0x3f);
+		} else {
+			*d++ = 0xf0 | (cp >> 18);
+			*d++ = 0x80 | ((cp >> 12) & 0x3f);
+			*d++ = 0x80 | ((cp >> 6) & 0x3f);
+			*d++ = 0x80 | (cp & 0x3f);
+		}
+	}
+
+	return d - (uint8_t *)dst;
+}
+
+ssize_t
+jer_string_contents(const void *chunk_buf, size_t chunk_size,
+                    const char **contents, void **to_free) {
+	const char *str = (const char *)chunk_buf + 1;
+	size_t size = chunk_size - 2;
+	ssize_t ret;
+	size_t i;
+
+	*to_free = 0;
+
+	if(chunk_size < 2 || *(const char *)chunk_buf != 0x22)
+		return -1;
+
+	if(!memchr(str, 0x5c, size)) {
+		/* Nothing to replace, but check it is a valid string */
+		for(i = 0; i < size; i++)
+			if(((const uint8_t *)str)[i] < 0x20) return -1;
+		*contents = str;
+		return size;
+	}
+
+	*to_free = MALLOC(size);
+	if(!*to_free) return -1;
+	ret = jer_string_unescape(str, size, *to_free);
+	if(ret < 0) {
+		FREEMEM(*to_free);
+		*to_free = 0;
+		return -1;
+	}
+	*contents = (const char *)*to_free;
+	return ret;
+}
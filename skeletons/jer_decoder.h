@@ -0,0 +1,122 @@
+/*
+ * Redistribution and modifications are permitted subject to BSD license.
+ */
+#ifndef	_JER_DECODER_H_
+#define	_JER_DECODER_H_
+
+#include <asn_application.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct asn_TYPE_descriptor_s;	/* Forward declaration */
+
+/*
+ * The JER (X.697, JSON) decoder of any ASN.1 type.
+ * May be invoked by the application.
+ * A number or a literal (true, false, null) at the top level
+ * is only complete when followed by something, such as a newline.
+ */
+asn_dec_rval_t jer_decode(
+    const struct asn_codec_ctx_s *opt_codec_ctx,
+    const struct asn_TYPE_descriptor_s *type_descriptor,
+    void **struct_ptr,  /* Pointer to a target structure's pointer */
+    const void *buffer, /* Data to be decoded */
+    size_t size         /* Size of data buffer */
+);
+
+/*
+ * Type of the type-specific JER decoder function.
+ * The member names are consumed by the decoders of the constructed types,
+ * the member decoder only sees the value.
+ */
+typedef asn_dec_rval_t(jer_type_decoder_f)(
+    const asn_codec_ctx_t *opt_codec_ctx,
+    const struct asn_TYPE_descriptor_s *type_descriptor, void **struct_ptr,
+    const void *buf_ptr, size_t size);
+
+/*******************************
+ * INTERNALLY USEFUL FUNCTIONS *
+ *******************************/
+
+/*
+ * Fetch the next JER (JSON) token from the stream.
+ * The function returns the number of bytes occupied by the chunk type,
+ * returned in the _ch_type. The _ch_type is only set (and valid) when
+ * the return value is >= 0.
+ */
+  typedef enum pjer_chunk_type {
+	PJER_WMORE,     /* Chunk type is not clear, more data expected. */
+	PJER_WHITESPACE,	/* Whitespace between the tokens */
+	PJER_DLM,	    /* One of the "{}[]:," delimiters */
+	PJER_STRING,	    /* Complete "string", including the quotes */
+	PJER_LITERAL	    /* Complete number, true, false or null */
+  } pjer_chunk_type_e;
+ssize_t jer_next_token(const void *buffer, size_t size,
+	pjer_chunk_type_e *_ch_type);
+
+/*
+ * A callback specification for the jer_decode_primitive() function below.
+ * The body decoder is given the complete string (including the quotes)
+ * or the complete literal.
+ */
+enum jer_pbd_rval {
+    JPBD_SYSTEM_FAILURE,  /* System failure (memory shortage, etc) */
+    JPBD_DECODER_LIMIT,   /* Hit some decoder limitation or deficiency */
+    JPBD_BROKEN_ENCODING, /* Encoding of a primitive body is broken */
+    JPBD_BODY_CONSUMED    /* Body is recognized and consumed */
+};
+typedef enum jer_pbd_rval(jer_primitive_body_decoder_f)(
+    const struct asn_TYPE_descriptor_s *td, void *struct_ptr,
+    pjer_chunk_type_e chunk_type, const void *chunk_buf, size_t chunk_size);
+
+/*
+ * Specific function to decode the types encoded as a single JSON string,
+ * number or literal. There is no state to save in the middle of the value,
+ * so the decoding is restarted from the beginning in case of RC_WMORE.
+ */
+asn_dec_rval_t jer_decode_primitive(
+    const asn_codec_ctx_t *opt_codec_ctx,
+    const struct asn_TYPE_descriptor_s *type_descriptor, void **struct_ptr,
+    size_t struct_size, const void *buf_ptr, size_t size,
+    jer_primitive_body_decoder_f *prim_body_decoder);
+
+/*
+ * Skip the value of an anticipated extension, token by token.
+ * The (*depth) shall be 0 before the first token of the value.
+ * RETURN VALUES:
+ *  0:	The token is consumed, the value continues.
+ *  1:	The token is consumed, the value is complete.
+ * -1:	The token can not appear here.
+ */
+int jer_skip_unknown(pjer_chunk_type_e ch_type, const void *chunk_buf,
+		ber_tlv_len_t *depth);
+
+/*
+ * Convert the contents of the JSON string (without the quotes) into UTF-8,
+ * replacing the escape sequences. The (dst) shall have (size) bytes of space,
+ * which is always enough; (dst) may be the same as (str).
+ * RETURN VALUES:
+ * >=0:	The number of bytes written into (dst).
+ *  -1:	Broken escape sequence or an unescaped control character.
+ */
+ssize_t jer_string_unescape(const void *str, size_t size, void *dst);
+
+/*
+ * Get the contents of the complete JSON string (including the quotes),
+ * with the escape sequences replaced. The (*contents) points into the
+ * string itself if there are no escape sequences. Otherwise, it points to
+ * the allocated copy, also returned in (*to_free) to be FREEMEM()'ed.
+ * RETURN VALUES:
+ * >=0:	The size of the contents.
+ *  -1:	Broken string or memory shortage.
+ */
+ssize_t jer_string_contents(const void *chunk_buf, size_t chunk_size,
+		const char **contents, void **to_free);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* _JER_DECODER_H_ */
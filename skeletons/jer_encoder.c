@@ -0,0 +1,111 @@
+/*
+ * Redistribution and modifications are permitted subject to BSD license.
+ */
+#include <asn_internal.h>
+#include <stdio.h>
+#include <errno.h>
+
+/*
+ * The JER encoder of any type. May be invoked by the application.
+ */
+asn_enc_rval_t
+jer_encode(const asn_TYPE_descriptor_t *td, const void *sptr,
+           enum jer_encoder_flags_e jer_flags, asn_app_consume_bytes_f *cb,
+           void *app_key) {
+    asn_enc_rval_t er = {0, 0, 0};
+	asn_enc_rval_t tmper;
+
+	if(!td || !sptr) goto cb_failed;
+
+	tmper = td->op->jer_encoder(td, sptr, 0, jer_flags, cb, app_key);
+	if(tmper.encoded == -1) return tmper;
+	er.encoded += tmper.encoded;
+
+	ASN__CALLBACK("\n", 1);
+
+	ASN__ENCODED_OK(er);
+cb_failed:
+	ASN__ENCODE_FAILED;
+}
+
+/*
+ * This is a helper function for jer_fprint, which directs all incoming data
+ * into the provided file descriptor.
+ */
+static int
+jer__print2fp(const void *buffer, size_t size, void *app_key) {
+	FILE *stream = (FILE *)app_key;
+
+	if(fwrite(buffer, 1, size, stream) != size)
+		return -1;
+
+	return 0;
+}
+
+int
+jer_fprint(FILE *stream, const asn_TYPE_descriptor_t *td, const void *sptr) {
+    asn_enc_rval_t er;
+
+	if(!stream) stream = stdout;
+	if(!td || !sptr)
+		return -1;
+
+	er = jer_encode(td, sptr, JER_F_BASIC, jer__print2fp, stream);
+	if(er.encoded == -1)
+		return -1;
+
+	return fflush(stream);
+}
+
+ssize_t
+jer_escape_string(const void *buf, size_t size, asn_app_consume_bytes_f *cb,
+                  void *app_key) {
+	const uint8_t *p = (const uint8_t *)buf;
+	const uint8_t *end = p + size;
+	const uint8_t *run = p;	/* The characters which go as is */
+	ssize_t wrote = 0;
+
+	for(; p < end; p++) {
+		char scratch[8];
+		const char *esc;
+		size_t esc_len = 2;
+
+		switch(*p) {
+		case 0x22: esc = "\\\""; break;
+		case 0x5c: esc = "\\\\"; break;
+		case 0x08: esc = "\\b"; break;
+		case 0x09: esc = "\\t"; break;
+		case 0x0a: esc = "\\n"; break;
+		case 0x0c: esc = "\\f"; break;
+		case 0x0d: esc = "\\r"; break;
+		default:
+			if(*p >= 0x20) continue;
+			esc_len = snprintf(scratch, sizeof(scratch), "\\u%04x", *p);
+			esc = scratch;
+			break;
+		}
+
+		if((p > run && ASN__E_cbc(run, p - run))
+		|| ASN__E_cbc(esc, esc_len))
+			return -1;
+		wrote += (p - run) + esc_len;
+		run = p + 1;
+	}
+
+	if(p > run) {
+		if(ASN__E_cbc(run, p - run))
+			return -1;
+		wrote += p - run;
+	}
+
+	return wrote;
+}
+
+int
+jer_escape_cb(const void *buf, size_t size, void *escape_key) {
+	struct jer_escape_key_s *key = (struct jer_escape_key_s *)escape_key;
+	ssize_t wrote = jer_escape_string(buf, size, key->cb, key->app_key);
+	if(wrote < 0) return -1;
+	key->wrote += wrote;
+	return 0;
+}
@@ -0,0 +1,87 @@
+/*
+ * Redistribution and modifications are permitted subject to BSD license.
+ */
+#ifndef	_JER_ENCODER_H_
+#define	_JER_ENCODER_H_
+
+#include <asn_application.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct asn_TYPE_descriptor_s;	/* Forward declaration */
+
+/* Flags used by the jer_encode() and (*jer_type_encoder_f), defined below */
+enum jer_encoder_flags_e {
+	/* Mode of encoding */
+	JER_F_BASIC	= 0x01,	/* Pretty-printed, indented JSON */
+	JER_F_MINIFIED	= 0x02	/* No insignificant whitespace at all */
+};
+
+/*
+ * The JER (X.697, JSON) encoder of any type. May be invoked by the application.
+ * The encoding is terminated by a newline, so that a number at the top level
+ * could be decoded back without waiting for the end of the stream.
+ */
+asn_enc_rval_t jer_encode(const struct asn_TYPE_descriptor_s *type_descriptor,
+                          const void *struct_ptr, /* Structure to be encoded */
+                          enum jer_encoder_flags_e jer_flags,
+                          asn_app_consume_bytes_f *consume_bytes_cb,
+                          void *app_key /* Arbitrary callback argument */
+);
+
+/*
+ * The variant of the above function which dumps the pretty-printed JER
+ * (JER_F_BASIC) output into the chosen file pointer.
+ * RETURN VALUES:
+ * 	 0: The structure is printed.
+ * 	-1: Problem printing the structure.
+ * WARNING: No sensible errno value is returned.
+ */
+int jer_fprint(FILE *stream, const struct asn_TYPE_descriptor_s *td,
+               const void *struct_ptr);
+
+/*
+ * Type of the generic JER encoder.
+ */
+typedef asn_enc_rval_t(jer_type_encoder_f)(
+    const struct asn_TYPE_descriptor_s *type_descriptor,
+    const void *struct_ptr, /* Structure to be encoded */
+    int ilevel,             /* Level of indentation */
+    enum jer_encoder_flags_e jer_flags,
+    asn_app_consume_bytes_f *consume_bytes_cb, /* Callback */
+    void *app_key                              /* Arbitrary callback argument */
+);
+
+/*******************************
+ * INTERNALLY USEFUL FUNCTIONS *
+ *******************************/
+
+/*
+ * Write the UTF-8 text as the contents of a JSON string (without the quotes),
+ * escaping the quote, the backslash and the control characters.
+ * RETURN VALUES:
+ * >=0:	The number of bytes delivered to the callback.
+ *  -1:	The callback failed.
+ */
+ssize_t jer_escape_string(const void *buf, size_t size,
+                          asn_app_consume_bytes_f *cb, void *app_key);
+
+/*
+ * The (asn_app_consume_bytes_f) which escapes the UTF-8 text
+ * with jer_escape_string() on its way to the real callback.
+ * Allows to reuse the text dumpers written for XER.
+ */
+struct jer_escape_key_s {
+    asn_app_consume_bytes_f *cb;
+    void *app_key;
+    size_t wrote; /* Bytes delivered to the real callback */
+};
+int jer_escape_cb(const void *buf, size_t size, void *escape_key);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* _JER_ENCODER_H_ */
@@ -0,0 +1,129 @@
+/*
+ * Redistribution and modifications are permitted subject to BSD license.
+ */
+#include <asn_system.h>
+#include <jer_support.h>
+
+/* Parser states */
+typedef enum {
+	ST_SPACE,		/* Between the tokens */
+	ST_STRING,		/* Inside the string */
+	ST_STRING_ESCAPE,	/* Right after the backslash in the string */
+	ST_LITERAL		/* Inside the number, true, false or null */
+} pstate_e;
+
+/* Character classes */
+enum {
+	CC_LITERAL,		/* Anything else */
+	CC_WHITESPACE,		/* RFC 8259: space, \t, \n, \r */
+	CC_DELIMITER,		/* {}[]:, */
+	CC_QUOTE		/* " */
+};
+static const unsigned char
+_charclass[256] = {
+	0,0,0,0,0,0,0,0, 0,1,1,0,0,1,0,0,
+	0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+	1,0,3,0,0,0,0,0, 0,0,0,0,2,0,0,0,	/*  !"#$%&' ()*+,-./ */
+	0,0,0,0,0,0,0,0, 0,0,2,0,0,0,0,0,	/* 01234567 89:;<=>? */
+	0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0, 0,0,0,2,0,2,0,0,	/* PQRSTUVW XYZ[\]^_ */
+	0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0, 0,0,0,2,0,2,0,0	/* pqrstuvw xyz{|}~  */
+};
+#define	CHARCLASS(c)	(_charclass[(unsigned char)(c)])
+
+/* Aliases for characters, ASCII/UTF-8 */
+#define	CQUOTE	0x22	/* '"' */
+#define	CBSLASH	0x5c	/* '\\' */
+
+/* Invoke token callback */
+#define	TOKEN_CB(_type, _current_too) do {			\
+		ssize_t _sz = (p - chunk_start) + _current_too;	\
+		if(_sz) {					\
+			if(cb(_type, chunk_start, _sz, key) < _sz)	\
+				goto finish;			\
+			chunk_start = p + _current_too;		\
+		}						\
+		state = ST_SPACE;				\
+	} while(0)
+
+/*
+ * Parser itself
+ */
+ssize_t
+pjson_parse(const void *jsonbuf, size_t size, pjson_callback_f *cb,
+            void *key) {
+	pstate_e state = ST_SPACE;
+	const char *chunk_start = (const char *)jsonbuf;
+	const char *p = chunk_start;
+	const char *end = p + size;
+
+	for(; p < end; p++) {
+	  int C = *(const unsigned char *)p;
+	  switch(state) {
+	  case ST_SPACE:
+		switch(CHARCLASS(C)) {
+		case CC_WHITESPACE:
+			continue;
+		case CC_DELIMITER:
+			TOKEN_CB(PJSON_WHITESPACE, 0);
+			TOKEN_CB(PJSON_DELIMITER, 1);
+			break;
+		case CC_QUOTE:
+			TOKEN_CB(PJSON_WHITESPACE, 0);
+			state = ST_STRING;
+			break;
+		default:
+			TOKEN_CB(PJSON_WHITESPACE, 0);
+			state = ST_LITERAL;
+			break;
+		}
+		break;
+	  case ST_STRING:
+		/*
+		 * The strings are the bulk of the JER input: skip to the
+		 * closing quote at once, unless there is an escape before it.
+		 */
+		if(C != CQUOTE && C != CBSLASH) {
+			const char *quote = memchr(p, CQUOTE, end - p);
+			const char *bslash = memchr(p, CBSLASH,
+				(quote ? quote : end) - p);
+			if(bslash) {
+				p = bslash;
+			} else if(quote) {
+				p = quote;
+			} else {
+				p = end - 1;	/* Incomplete string */
+				break;
+			}
+			C = *(const unsigned char *)p;
+		}
+		if(C == CQUOTE)
+			TOKEN_CB(PJSON_STRING, 1);
+		else
+			state = ST_STRING_ESCAPE;
+		break;
+	  case ST_STRING_ESCAPE:
+		/* Whatever it is, it is escaped */
+		state = ST_STRING;
+		break;
+	  case ST_LITERAL:
+		if(CHARCLASS(C) != CC_LITERAL) {
+			/* Re-examine the terminating character */
+			TOKEN_CB(PJSON_LITERAL, 0);
+			p--;
+		}
+		break;
+	  } /* switch(*ptr) */
+	} /* for() */
+
+	/*
+	 * Flush the whitespace. The incomplete string or literal
+	 * will have to be parsed again once more data arrives.
+	 */
+	if(state == ST_SPACE)
+		TOKEN_CB(PJSON_WHITESPACE, 0);
+
+finish:
+	return chunk_start - (const char *)jsonbuf;
+}
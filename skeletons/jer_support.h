@@ -0,0 +1,52 @@
+/*
+ * Redistribution and modifications are permitted subject to BSD license.
+ */
+#ifndef	_JER_SUPPORT_H_
+#define	_JER_SUPPORT_H_
+
+#include <asn_system.h>		/* Platform-specific types */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Types of data transferred to the application.
+ */
+typedef enum {
+	PJSON_WHITESPACE,	/* Whitespace between the tokens. */
+	PJSON_DELIMITER,	/* One of the "{}[]:," characters. */
+	PJSON_STRING,		/* A complete string, including the quotes. */
+	PJSON_LITERAL		/* A number, "true", "false" or "null". */
+} pjson_chunk_type_e;
+
+/*
+ * Callback function that is called by the parser when parsed data is
+ * available. The chunk type is _type and the data is the piece of
+ * the buffer (as supplied to pjson_parse() call) starting at
+ * _chunk_data and of _chunk_size bytes size.
+ * The chunk is NOT '\0'-terminated.
+ */
+typedef int (pjson_callback_f)(pjson_chunk_type_e _type,
+	const void *_chunk_data, size_t _chunk_size, void *_key);
+
+/*
+ * Parse the given buffer as it were a chunk of JSON data.
+ * Invoke the specified callback each time the meaninful data is found.
+ * The strings and literals are only reported once they are complete:
+ * a literal is complete when followed by a character which can not be
+ * its part, so a literal at the very end of the buffer is not reported.
+ * As the parser only ever stops at the token boundaries, it needs no state
+ * to be carried over between the invocations, unlike pxml_parse().
+ * This function returns number of bytes consumed from the bufer.
+ * It will always be lesser than or equal to the specified _size.
+ * The next invocation of this function must account the difference.
+ */
+ssize_t pjson_parse(const void *_buf, size_t _size,
+	pjson_callback_f *cb, void *_key);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* _JER_SUPPORT_H_ */
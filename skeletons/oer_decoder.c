@@ -13,6 +13,8 @@ oer_decode(const asn_codec_ctx_t *opt_codec_ctx,
            const asn_TYPE_descriptor_t *type_descriptor, void **struct_ptr,
            const void *ptr, size_t size) {
     asn_codec_ctx_t s_codec_ctx;
+    const asn_allocator_t *saved_allocator;
+    asn_dec_rval_t rval;
 
 	/*
 	 * Stack checker requires that the codec context
@@ -33,10 +35,14 @@ oer_decode(const asn_codec_ctx_t *opt_codec_ctx,
 	/*
 	 * Invoke type-specific decoder.
 	 */
-	return type_descriptor->op->oer_decoder(opt_codec_ctx, type_descriptor, 0,
+	saved_allocator = asn__allocator_enter(opt_codec_ctx);
+	rval = type_descriptor->op->oer_decoder(opt_codec_ctx, type_descriptor, 0,
 		struct_ptr,	/* Pointer to the destination structure */
 		ptr, size	/* Buffer and its size */
 		);
+	asn__allocator_leave(saved_allocator);
+
+	return rval;
 }
 
 /*
@@ -101,37 +101,39 @@ oer_encode_primitive(const asn_TYPE_descriptor_t *td,
     er.encoded += ret;
 
     er.encoded += st->size;
-    if(cb(st->buf, st->size, app_key) < 0) {
+    if(ASN__E_cbc(st->buf, st->size)) {
         ASN__ENCODE_FAILED;
     } else {
         ASN__ENCODED_OK(er);
     }
 }
 
-static int
-oer__count_bytes(const void *buffer, size_t size, void *bytes_ptr) {
-    size_t *bytes = bytes_ptr;
-    (void)buffer;
-    *bytes += size;
-    return 0;
-}
-
 ssize_t
 oer_open_type_put(const asn_TYPE_descriptor_t *td,
                   const asn_oer_constraints_t *constraints, const void *sptr,
                   asn_app_consume_bytes_f *cb, void *app_key) {
     size_t serialized_byte_count = 0;
+    int saved_encode_constraints = asn__encode_constraints;
     asn_enc_rval_t er;
     ssize_t len_len;
 
-    er = td->op->oer_encoder(td, constraints, sptr, oer__count_bytes,
+    /* The constraints are checked once, while writing out the value */
+    asn__encode_constraints = 0;
+    er = td->op->oer_encoder(td, constraints, sptr, asn__count_bytes,
                              &serialized_byte_count);
+    asn__encode_constraints = saved_encode_constraints;
     if(er.encoded < 0) return -1;
     assert(serialized_byte_count == (size_t)er.encoded);
 
     len_len = oer_serialize_length(serialized_byte_count, cb, app_key);
     if(len_len == -1) return -1;
 
+    /* Counted already, no need to go over the value again */
+    if(cb == asn__count_bytes) {
+        if(cb(0, serialized_byte_count, app_key) < 0) return -1;
+        return len_len + serialized_byte_count;
+    }
+
     er = td->op->oer_encoder(td, constraints, sptr, cb, app_key);
     if(er.encoded < 0) return -1;
     assert(serialized_byte_count == (size_t)er.encoded);
@@ -39,6 +39,19 @@ ssize_t oer_fetch_length(const void *bufptr, size_t size, size_t *len_r);
  */
 ssize_t oer_serialize_length(size_t length, asn_app_consume_bytes_f *cb, void *app_key);
 
+/*
+ * Fetch the quantity field of SEQUENCE OF and SET OF (X.696 #17.4.2)
+ * into *qty_r. Return values are as of oer_fetch_length().
+ */
+ssize_t oer_fetch_quantity(const void *bufptr, size_t size, size_t *qty_r);
+
+/*
+ * Serialize the quantity field of SEQUENCE OF and SET OF.
+ * Returns the number of bytes serialized or -1 if a given callback
+ * returned with negative result.
+ */
+ssize_t oer_put_quantity(size_t qty, asn_app_consume_bytes_f *cb, void *app_key);
+
 
 #ifdef __cplusplus
 }
@@ -43,6 +43,7 @@ uper_decode(const asn_codec_ctx_t *opt_codec_ctx,
             const asn_TYPE_descriptor_t *td, void **sptr, const void *buffer,
             size_t size, int skip_bits, int unused_bits) {
     asn_codec_ctx_t s_codec_ctx;
+	const asn_allocator_t *saved_allocator;
 	asn_dec_rval_t rval;
 	asn_per_data_t pd;
 
@@ -80,7 +81,9 @@ uper_decode(const asn_codec_ctx_t *opt_codec_ctx,
 	 */
 	if(!td->op->uper_decoder)
 		ASN__DECODE_FAILED;	/* PER is not compiled in */
+	saved_allocator = asn__allocator_enter(opt_codec_ctx);
 	rval = td->op->uper_decoder(opt_codec_ctx, td, 0, sptr, &pd);
+	asn__allocator_leave(saved_allocator);
 	if(rval.code == RC_OK) {
 		/* Return the number of consumed bits */
 		rval.consumed = ((pd.buffer - (const uint8_t *)buffer) << 3)
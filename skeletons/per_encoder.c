@@ -4,20 +4,13 @@
 
 static int _uper_encode_flush_outp(asn_per_outp_t *po);
 
-static int
-ignore_output(const void *data, size_t size, void *app_key) {
-    (void)data;
-    (void)size;
-    (void)app_key;
-    return 0;
-}
-
 asn_enc_rval_t
 uper_encode(const asn_TYPE_descriptor_t *td,
             const asn_per_constraints_t *constraints, const void *sptr,
             asn_app_consume_bytes_f *cb, void *app_key) {
     asn_per_outp_t po;
     asn_enc_rval_t er;
+    size_t counted = 0;
 
     /*
      * Invoke type-specific encoder.
@@ -28,8 +21,9 @@ uper_encode(const asn_TYPE_descriptor_t *td,
     po.buffer = po.tmpspace;
     po.nboff = 0;
     po.nbits = 8 * sizeof(po.tmpspace);
-    po.output = cb ? cb : ignore_output;
-    po.op_key = app_key;
+    /* Without the callback, the output is only counted */
+    po.output = cb ? cb : asn__count_bytes;
+    po.op_key = cb ? app_key : &counted;
     po.flushed_bytes = 0;
 
     er = td->op->uper_encoder(td, constraints, sptr, &po);
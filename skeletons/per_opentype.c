@@ -35,6 +35,27 @@ uper_open_type_put(const asn_TYPE_descriptor_t *td,
 
     ASN_DEBUG("Open type put %s ...", td->name);
 
+    if(po->output == asn__count_bytes) {
+        /*
+         * The output is only counted: size the value and skip
+         * over its bytes rather than encoding it into a buffer.
+         */
+        asn_enc_rval_t er = uper_encode(td, constraints, sptr, 0, 0);
+        if(er.encoded < 0) return -1;
+        size = er.encoded ? ((er.encoded + 7) >> 3) : 1;
+
+        do {
+            int need_eom = 0;
+            ssize_t may_save = uper_put_length(po, size, &need_eom);
+            if(may_save < 0) return -1;
+            po->flushed_bytes += may_save;
+            size -= may_save;
+            if(need_eom && uper_put_length(po, 0, 0)) return -1;
+        } while(size);
+
+        return 0;
+    }
+
     size = uper_encode_to_new_buffer(td, constraints, sptr, &buf);
     if(size <= 0) return -1;
 
@@ -295,7 +316,9 @@ uper_sot_suck(const asn_codec_ctx_t *ctx, const asn_TYPE_descriptor_t *td,
 	(void)constraints;
 	(void)sptr;
 
+	/* Whatever the contents, they leave no padding behind */
 	while(per_get_few_bits(pd, 24) >= 0);
+	(void)per_get_few_bits(pd, pd->nbits - pd->nboff);
 
 	rv.code = RC_OK;
 	rv.consumed = pd->moved;
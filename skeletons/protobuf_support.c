@@ -0,0 +1,734 @@
+/*
+ * Redistribution and modifications are permitted subject to BSD license.
+ */
+#include <asn_internal.h>
+#include <protobuf_support.h>
+#include <INTEGER.h>
+#include <BIT_STRING.h>
+#include <constr_CHOICE.h>
+#include <errno.h>
+
+size_t
+pb_varint_size(uint64_t value) {
+    size_t size = 1;
+    while(value >= 0x80) {
+        value >>= 7;
+        size++;
+    }
+    return size;
+}
+
+int
+pb_put_varint(pb_output_t *po, uint64_t value) {
+    uint8_t buf[10];
+    size_t size = 0;
+
+    while(value >= 0x80) {
+        buf[size++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    buf[size++] = (uint8_t)value;
+
+    po->encoded += size;
+    if(po->cb && po->cb(buf, size, po->app_key) < 0) return -1;
+    return 0;
+}
+
+int
+pb_put_tag(pb_output_t *po, unsigned field, enum pb_wire_type wt) {
+    return pb_put_varint(po, ((uint64_t)field << 3) | wt);
+}
+
+int
+pb_put_int(pb_output_t *po, unsigned field, int64_t value) {
+    if(pb_put_tag(po, field, PB_WT_VARINT)) return -1;
+    return pb_put_varint(po, (uint64_t)value);
+}
+
+int
+pb_put_bytes(pb_output_t *po, unsigned field, const void *buf, size_t size) {
+    if(pb_put_tag(po, field, PB_WT_LEN) || pb_put_varint(po, size))
+        return -1;
+    po->encoded += size;
+    if(po->cb && size && po->cb(buf, size, po->app_key) < 0) return -1;
+    return 0;
+}
+
+int
+pb_put_bit_string(pb_output_t *po, unsigned field, const uint8_t *buf,
+                  size_t size, int bits_unused) {
+    uint64_t len;
+    size_t msg_size;
+
+    if(bits_unused < 0 || bits_unused > 7 || (bits_unused && !size))
+        return -1;
+
+    len = (uint64_t)size * 8 - bits_unused;
+    msg_size = 0;
+    if(size) msg_size += 1 + pb_varint_size(size) + size;
+    if(len) msg_size += 1 + pb_varint_size(len);
+
+    if(pb_put_tag(po, field, PB_WT_LEN) || pb_put_varint(po, msg_size))
+        return -1;
+    if(size && pb_put_bytes(po, 1, buf, size)) return -1;
+    if(len && pb_put_int(po, 2, (int64_t)len)) return -1;
+    return 0;
+}
+
+int
+pb_put_message(pb_output_t *po, unsigned field, pb_type_encoder_f *encoder,
+               const asn_TYPE_descriptor_t *td, const void *sptr) {
+    asn_enc_rval_t er;
+
+    /* The length goes first */
+    er = encoder(td, sptr, 0, 0);
+    if(er.encoded < 0) return -1;
+
+    if(pb_put_tag(po, field, PB_WT_LEN)
+       || pb_put_varint(po, (uint64_t)er.encoded))
+        return -1;
+
+    if(po->cb) {
+        asn_enc_rval_t er2 = encoder(td, sptr, po->cb, po->app_key);
+        if(er2.encoded != er.encoded) return -1;
+    }
+    po->encoded += er.encoded;
+
+    return 0;
+}
+
+/*
+ * Internally used by pb_encode_to_buffer().
+ */
+typedef struct enc_to_buf_arg {
+    void *buffer;
+    size_t left;
+} enc_to_buf_arg;
+static int
+encode_to_buffer_cb(const void *buffer, size_t size, void *key) {
+    enc_to_buf_arg *arg = (enc_to_buf_arg *)key;
+
+    if(arg->left < size) return -1; /* Data exceeds the available buffer size */
+
+    memcpy(arg->buffer, buffer, size);
+    arg->buffer = ((char *)arg->buffer) + size;
+    arg->left -= size;
+
+    return 0;
+}
+
+asn_enc_rval_t
+pb_encode_to_buffer(pb_type_encoder_f *encoder, const asn_TYPE_descriptor_t *td,
+                    const void *sptr, void *buffer, size_t buffer_size) {
+    enc_to_buf_arg arg;
+    asn_enc_rval_t ec;
+
+    arg.buffer = buffer;
+    arg.left = buffer_size;
+
+    ec = encoder(td, sptr, encode_to_buffer_cb, &arg);
+    if(ec.encoded != -1) {
+        assert(ec.encoded == (ssize_t)(buffer_size - arg.left));
+        /* Return the encoded contents size */
+    } else if(arg.left < buffer_size || !buffer) {
+        errno = ENOMEM;
+    }
+    return ec;
+}
+
+int
+pb_get_varint(pb_input_t *pi, uint64_t *value) {
+    uint64_t v = 0;
+    unsigned shift;
+
+    for(shift = 0; shift < 64; shift += 7) {
+        uint8_t b;
+        if(pi->ptr >= pi->end) return -1;
+        b = *pi->ptr++;
+        v |= (uint64_t)(b & 0x7f) << shift;
+        if(!(b & 0x80)) {
+            /* The 10th byte carries the last bit only */
+            if(shift == 63 && b > 1) return -1;
+            *value = v;
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+int
+pb_get_tag(pb_input_t *pi, unsigned *field, enum pb_wire_type *wt) {
+    uint64_t tag;
+
+    if(pb_get_varint(pi, &tag)) return -1;
+
+    /* Field numbers are 1..2^29-1 */
+    if((tag >> 3) == 0 || (tag >> 3) > 0x1fffffff) return -1;
+
+    *field = (unsigned)(tag >> 3);
+    *wt = (enum pb_wire_type)(tag & 0x07);
+    return 0;
+}
+
+int
+pb_skip(pb_input_t *pi, enum pb_wire_type wt) {
+    uint64_t value;
+    size_t size;
+
+    switch(wt) {
+    case PB_WT_VARINT:
+        return pb_get_varint(pi, &value);
+    case PB_WT_I64:
+        size = 8;
+        break;
+    case PB_WT_LEN:
+        if(pb_get_varint(pi, &value)) return -1;
+        if(value > (uint64_t)(pi->end - pi->ptr)) return -1;
+        size = (size_t)value;
+        break;
+    case PB_WT_I32:
+        size = 4;
+        break;
+    default:
+        /* Groups are not supported */
+        return -1;
+    }
+
+    if(size > (size_t)(pi->end - pi->ptr)) return -1;
+    pi->ptr += size;
+    return 0;
+}
+
+int
+pb_get_bool(pb_input_t *pi, enum pb_wire_type wt, int *value) {
+    uint64_t v;
+
+    if(wt != PB_WT_VARINT || pb_get_varint(pi, &v)) return -1;
+
+    *value = (v != 0);
+    return 0;
+}
+
+int
+pb_get_int64(pb_input_t *pi, enum pb_wire_type wt, int64_t *value) {
+    uint64_t v;
+
+    if(wt != PB_WT_VARINT || pb_get_varint(pi, &v)) return -1;
+
+    /* Two's complement, as the negative int32 and int64 are sent */
+    if(v > (uint64_t)INT64_MAX)
+        *value = -(int64_t)(~v) - 1;
+    else
+        *value = (int64_t)v;
+    return 0;
+}
+
+int
+pb_get_long(pb_input_t *pi, enum pb_wire_type wt, long *value) {
+    int64_t v;
+
+    if(pb_get_int64(pi, wt, &v)) return -1;
+    if(v < LONG_MIN || v > LONG_MAX) return -1;
+
+    *value = (long)v;
+    return 0;
+}
+
+int
+pb_get_ulong(pb_input_t *pi, enum pb_wire_type wt, unsigned long *value) {
+    uint64_t v;
+
+    if(wt != PB_WT_VARINT || pb_get_varint(pi, &v)) return -1;
+    if(v > ULONG_MAX) return -1;
+
+    *value = (unsigned long)v;
+    return 0;
+}
+
+int
+pb_get_bytes(pb_input_t *pi, enum pb_wire_type wt, const uint8_t **buf,
+             size_t *size) {
+    uint64_t len;
+
+    if(wt != PB_WT_LEN || pb_get_varint(pi, &len)) return -1;
+    if(len > (uint64_t)(pi->end - pi->ptr)) return -1;
+
+    *buf = pi->ptr;
+    *size = (size_t)len;
+    pi->ptr += len;
+    return 0;
+}
+
+/* Copy with the terminating 0, as OCTET STRING keeps it */
+static int
+pb_copy(uint8_t **dst, size_t *dst_size, const uint8_t *buf, size_t size) {
+    uint8_t *copy = (uint8_t *)MALLOC(size + 1);
+    if(!copy) return -1;
+    if(size) memcpy(copy, buf, size);
+    copy[size] = '\0';
+    if(*dst) FREEMEM(*dst);
+    *dst = copy;
+    *dst_size = size;
+    return 0;
+}
+
+int
+pb_get_octets(pb_input_t *pi, enum pb_wire_type wt, uint8_t **buf,
+              size_t *size) {
+    const uint8_t *octets;
+    size_t octets_size;
+
+    if(pb_get_bytes(pi, wt, &octets, &octets_size)) return -1;
+    return pb_copy(buf, size, octets, octets_size);
+}
+
+int
+pb_get_bit_string(pb_input_t *pi, enum pb_wire_type wt, uint8_t **buf,
+                  size_t *size, int *bits_unused) {
+    const uint8_t *bits = 0;
+    size_t bits_size = 0;
+    uint64_t len = 0;
+    pb_input_t msg;
+    size_t msg_size;
+    unsigned field;
+
+    if(pb_get_bytes(pi, wt, &msg.ptr, &msg_size)) return -1;
+    msg.end = msg.ptr + msg_size;
+
+    while(msg.ptr < msg.end) {
+        if(pb_get_tag(&msg, &field, &wt)) return -1;
+        switch(field) {
+        case 1:
+            if(pb_get_bytes(&msg, wt, &bits, &bits_size)) return -1;
+            break;
+        case 2:
+            if(wt != PB_WT_VARINT || pb_get_varint(&msg, &len)) return -1;
+            break;
+        default:
+            if(pb_skip(&msg, wt)) return -1;
+        }
+    }
+
+    /* The length must end within the last byte */
+    if(len > (uint64_t)bits_size * 8 || (uint64_t)bits_size * 8 - len > 7)
+        return -1;
+
+    if(pb_copy(buf, size, bits, bits_size)) return -1;
+    *bits_unused = (int)((uint64_t)bits_size * 8 - len);
+    return 0;
+}
+
+int
+pb_get_message(pb_input_t *pi, enum pb_wire_type wt,
+               pb_type_decoder_f *decoder, const asn_codec_ctx_t *opt_codec_ctx,
+               const asn_TYPE_descriptor_t *td, void **sptr) {
+    const uint8_t *buf;
+    size_t size;
+    asn_dec_rval_t rv;
+
+    if(pb_get_bytes(pi, wt, &buf, &size)) return -1;
+
+    rv = decoder(opt_codec_ctx, td, sptr, buf, size);
+    return (rv.code == RC_OK) ? 0 : -1;
+}
+
+int
+pb_get_packed(pb_input_t *pi, enum pb_wire_type *wt, pb_input_t *values) {
+    if(*wt == PB_WT_LEN) {
+        size_t size;
+        if(pb_get_bytes(pi, *wt, &values->ptr, &size)) return -1;
+        values->end = values->ptr + size;
+        *wt = PB_WT_VARINT;
+        return 0;
+    }
+
+    /* A single value */
+    if(*wt != PB_WT_VARINT) return -1;
+    values->ptr = pi->ptr;
+    if(pb_skip(pi, *wt)) return -1;
+    values->end = pi->ptr;
+    return 0;
+}
+
+static int
+pb_buffer_consume(const void *buffer, size_t size, void *key) {
+    pb_buffer_t *pb = (pb_buffer_t *)key;
+
+    if(pb->size - pb->length < size) return -1;
+
+    memcpy(pb->buffer + pb->length, buffer, size);
+    pb->length += size;
+    return 0;
+}
+
+void
+pb_buffer_init(pb_buffer_t *pb, void *buffer, size_t size) {
+    pb->po.cb = pb_buffer_consume;
+    pb->po.app_key = pb;
+    pb->po.encoded = 0;
+    pb->buffer = (uint8_t *)buffer;
+    pb->size = size;
+    pb->length = 0;
+}
+
+int
+pb_begin_message(pb_buffer_t *pb, unsigned field, size_t *mark) {
+    static const uint8_t length = 0;
+
+    if(pb_put_tag(&pb->po, field, PB_WT_LEN)) return -1;
+    /* Most of the messages are shorter than 128 bytes */
+    if(pb_buffer_consume(&length, 1, pb)) return -1;
+    pb->po.encoded++;
+
+    *mark = pb->length;
+    return 0;
+}
+
+int
+pb_end_message(pb_buffer_t *pb, size_t mark) {
+    size_t size = pb->length - mark;
+    size_t extra = pb_varint_size(size) - 1;
+    uint8_t *ptr;
+
+    if(extra) {
+        if(pb->size - pb->length < extra) return -1;
+        memmove(pb->buffer + mark + extra, pb->buffer + mark, size);
+        pb->length += extra;
+        pb->po.encoded += extra;
+    }
+
+    for(ptr = pb->buffer + mark - 1; size >= 0x80; size >>= 7)
+        *ptr++ = (uint8_t)(size | 0x80);
+    *ptr = (uint8_t)size;
+
+    return 0;
+}
+
+#ifndef	ASN_DISABLE_PER_SUPPORT
+
+asn_dec_rval_t
+pb_uper_convert(pb_uper_converter_f *converter,
+                const asn_codec_ctx_t *opt_codec_ctx,
+                const asn_TYPE_descriptor_t *td, const void *buffer,
+                size_t size, void *pb_buffer, size_t pb_buffer_size,
+                size_t *pb_size) {
+    asn_codec_ctx_t s_codec_ctx;
+    const asn_allocator_t *saved_allocator;
+    asn_dec_rval_t rval;
+    asn_per_data_t pd;
+    pb_buffer_t pb;
+
+    /*
+     * Stack checker requires that the codec context
+     * must be allocated on the stack.
+     */
+    if(opt_codec_ctx) {
+        if(opt_codec_ctx->max_stack_size) {
+            s_codec_ctx = *opt_codec_ctx;
+            opt_codec_ctx = &s_codec_ctx;
+        }
+    } else {
+        /* If context is not given, be security-conscious anyway */
+        memset(&s_codec_ctx, 0, sizeof(s_codec_ctx));
+        s_codec_ctx.max_stack_size = ASN__DEFAULT_STACK_MAX;
+        opt_codec_ctx = &s_codec_ctx;
+    }
+
+    memset(&pd, 0, sizeof(pd));
+    pd.buffer = (const uint8_t *)buffer;
+    pd.nbits = 8 * size;
+
+    pb_buffer_init(&pb, pb_buffer, pb_buffer_size);
+
+    saved_allocator = asn__allocator_enter(opt_codec_ctx);
+    rval = converter(opt_codec_ctx, td, 0, &pd, &pb);
+    asn__allocator_leave(saved_allocator);
+    if(rval.code != RC_OK) {
+        rval.consumed = 0;
+        return rval;
+    }
+
+    /* Same as uper_decode_complete() */
+    rval.consumed = (pd.moved + 7) >> 3;
+    if(!rval.consumed) {
+        if(!size) {
+            rval.code = RC_WMORE;
+            return rval;
+        } else if(((const uint8_t *)buffer)[0] != 0) {
+            ASN__DECODE_FAILED;
+        }
+        rval.consumed = 1;
+    }
+
+    *pb_size = pb.length;
+    return rval;
+}
+
+int
+pb_uper_put_int(pb_buffer_t *pb, unsigned field, int64_t value, int flags) {
+    if(!field) return pb_put_varint(&pb->po, (uint64_t)value);
+    if((flags & PB_UPER_IMPLICIT) && !value) return 0;
+    return pb_put_int(&pb->po, field, value);
+}
+
+asn_dec_rval_t
+pb_uper_put_long(const asn_codec_ctx_t *opt_codec_ctx,
+                 const asn_TYPE_descriptor_t *td,
+                 const asn_per_constraints_t *constraints, asn_per_data_t *pd,
+                 pb_buffer_t *pb, unsigned field, int flags) {
+    union {
+        long l;
+        unsigned long ul;
+    } value;
+    void *value_ptr = &value;
+    asn_dec_rval_t rv;
+
+    value.l = 0;
+    rv = td->op->uper_decoder(opt_codec_ctx, td, constraints, &value_ptr, pd);
+    if(rv.code != RC_OK) return rv;
+
+    if(pb_uper_put_int(pb, field,
+                       (flags & PB_UPER_UNSIGNED) ? (int64_t)value.ul
+                                                  : (int64_t)value.l,
+                       flags))
+        ASN__DECODE_FAILED;
+    return rv;
+}
+
+asn_dec_rval_t
+pb_uper_put_integer(const asn_codec_ctx_t *opt_codec_ctx,
+                    const asn_TYPE_descriptor_t *td,
+                    const asn_per_constraints_t *constraints,
+                    asn_per_data_t *pd, pb_buffer_t *pb, unsigned field,
+                    int flags) {
+    INTEGER_t value;
+    void *value_ptr = &value;
+    asn_dec_rval_t rv;
+    intmax_t v;
+    int ret;
+
+    memset(&value, 0, sizeof(value));
+    rv = td->op->uper_decoder(opt_codec_ctx, td, constraints, &value_ptr, pd);
+    ret = (rv.code == RC_OK)
+          && (asn_INTEGER2imax(&value, &v)
+              || pb_uper_put_int(pb, field, (int64_t)v, flags));
+    ASN_STRUCT_FREE_CONTENTS_ONLY(*td, &value);
+    if(ret) ASN__DECODE_FAILED;
+    return rv;
+}
+
+asn_dec_rval_t
+pb_uper_put_octets(const asn_codec_ctx_t *opt_codec_ctx,
+                   const asn_TYPE_descriptor_t *td,
+                   const asn_per_constraints_t *constraints,
+                   asn_per_data_t *pd, pb_buffer_t *pb, unsigned field,
+                   int flags) {
+    OCTET_STRING_t value;
+    void *value_ptr = &value;
+    asn_dec_rval_t rv;
+    int ret;
+
+    memset(&value, 0, sizeof(value));
+    rv = td->op->uper_decoder(opt_codec_ctx, td, constraints, &value_ptr, pd);
+    ret = (rv.code == RC_OK)
+          && (value.size || !(flags & PB_UPER_IMPLICIT))
+          && pb_put_bytes(&pb->po, field, value.buf, value.size);
+    ASN_STRUCT_FREE_CONTENTS_ONLY(*td, &value);
+    if(ret) ASN__DECODE_FAILED;
+    return rv;
+}
+
+asn_dec_rval_t
+pb_uper_put_bit_string(const asn_codec_ctx_t *opt_codec_ctx,
+                       const asn_TYPE_descriptor_t *td,
+                       const asn_per_constraints_t *constraints,
+                       asn_per_data_t *pd, pb_buffer_t *pb, unsigned field,
+                       int flags) {
+    BIT_STRING_t value;
+    void *value_ptr = &value;
+    asn_dec_rval_t rv;
+    int ret;
+
+    memset(&value, 0, sizeof(value));
+    rv = td->op->uper_decoder(opt_codec_ctx, td, constraints, &value_ptr, pd);
+    ret = (rv.code == RC_OK)
+          && (value.size || !(flags & PB_UPER_IMPLICIT))
+          && pb_put_bit_string(&pb->po, field, value.buf, value.size,
+                               value.bits_unused);
+    ASN_STRUCT_FREE_CONTENTS_ONLY(*td, &value);
+    if(ret) ASN__DECODE_FAILED;
+    return rv;
+}
+
+asn_dec_rval_t
+pb_uper_materialize(const asn_codec_ctx_t *opt_codec_ctx,
+                    const asn_TYPE_descriptor_t *td,
+                    const asn_per_constraints_t *constraints,
+                    asn_per_data_t *pd, pb_buffer_t *pb,
+                    pb_type_encoder_f *encoder) {
+    void *value = 0;
+    asn_dec_rval_t rv;
+    asn_enc_rval_t er;
+
+    rv = td->op->uper_decoder(opt_codec_ctx, td, constraints, &value, pd);
+    if(rv.code == RC_OK) {
+        er = encoder(td, value, pb_buffer_consume, pb);
+        if(er.encoded < 0) {
+            rv.code = RC_FAIL;
+        } else {
+            pb->po.encoded += er.encoded;
+        }
+    }
+    ASN_STRUCT_FREE(*td, value);
+    return rv;
+}
+
+int
+pb_uper_view(asn_per_data_t *pd, size_t nbits, asn_per_data_t *view) {
+    if(pd->refill || pd->nbits - pd->nboff < nbits) return -1;
+
+    memset(view, 0, sizeof(*view));
+    view->buffer = pd->buffer;
+    view->nboff = pd->nboff;
+    view->nbits = pd->nboff + nbits;
+
+    pd->nboff += nbits;
+    pd->moved += nbits;
+    return 0;
+}
+
+ssize_t
+pb_uper_get_count(asn_per_data_t *pd, const asn_TYPE_descriptor_t *td,
+                  const asn_per_constraints_t *constraints, int *repeat) {
+    const asn_per_constraint_t *ct;
+    ssize_t nelems;
+
+    /* Same as SET_OF_decode_uper() */
+    if(constraints) ct = &constraints->size;
+    else if(td->encoding_constraints.per_constraints)
+        ct = &td->encoding_constraints.per_constraints->size;
+    else ct = 0;
+
+    if(ct && ct->flags & APC_EXTENSIBLE) {
+        int value = per_get_few_bits(pd, 1);
+        if(value < 0) return -1;
+        if(value) ct = 0;  /* Not restricted! */
+    }
+
+    *repeat = 0;
+    if(ct && ct->effective_bits >= 0) {
+        /* X.691, #19.5: No length determinant */
+        nelems = per_get_few_bits(pd, ct->effective_bits);
+        if(nelems < 0) return -1;
+        return nelems + ct->lower_bound;
+    }
+
+    return uper_get_length(pd, -1, 0, repeat);
+}
+
+int
+pb_uper_choice_index(asn_per_data_t *pd, const asn_TYPE_descriptor_t *td,
+                     const asn_per_constraints_t *constraints) {
+    const asn_CHOICE_specifics_t *specs =
+        (const asn_CHOICE_specifics_t *)td->specifics;
+    const asn_per_constraint_t *ct;
+    int value;
+
+    /* Same as CHOICE_decode_uper() */
+    if(constraints) ct = &constraints->value;
+    else if(td->encoding_constraints.per_constraints)
+        ct = &td->encoding_constraints.per_constraints->value;
+    else ct = 0;
+
+    if(ct && ct->flags & APC_EXTENSIBLE) {
+        value = per_get_few_bits(pd, 1);
+        if(value < 0) return -1;
+        if(value) ct = 0;  /* Not restricted */
+    }
+
+    if(ct && ct->range_bits >= 0) {
+        value = per_get_few_bits(pd, ct->range_bits);
+        if(value < 0 || value > ct->upper_bound) return -1;
+    } else {
+        if(specs->ext_start == -1) return -1;
+        value = uper_get_nsnnwn(pd);
+        if(value < 0) return -1;
+        value += specs->ext_start;
+        if((unsigned)value >= td->elements_count) return -1;
+    }
+
+    /* Adjust if canonical order is different from natural order */
+    if(specs->from_canonical_order)
+        value = specs->from_canonical_order[value];
+
+    return value;
+}
+
+int
+pb_uper_open_type_begin(asn_per_data_t *pd, pb_uper_open_type_t *ot) {
+    size_t allocated = 0;
+    ssize_t chunk;
+    int repeat;
+
+    memset(ot, 0, sizeof(*ot));
+
+    chunk = uper_get_length(pd, -1, 0, &repeat);
+    if(chunk < 0) return -1;
+    if(!repeat) {
+        /* The contents are read in place */
+        if((size_t)chunk > (pd->nbits - pd->nboff) >> 3) return -1;
+        ot->size = chunk;
+        return pb_uper_view(pd, (size_t)chunk << 3, &ot->pd);
+    }
+
+    /* Same as uper_open_type_get_simple() */
+    for(;;) {
+        if(ot->size + chunk > allocated) {
+            void *ptr;
+            allocated = chunk + (allocated << 2);
+            ptr = REALLOC(ot->copy, allocated);
+            if(!ptr) break;
+            ot->copy = (uint8_t *)ptr;
+        }
+        if(per_get_many_bits(pd, ot->copy + ot->size, 0, chunk << 3)) break;
+        ot->size += chunk;
+        if(!repeat) {
+            ot->pd.buffer = ot->copy;
+            ot->pd.nbits = ot->size << 3;
+            return 0;
+        }
+        chunk = uper_get_length(pd, -1, 0, &repeat);
+        if(chunk < 0) break;
+    }
+
+    FREEMEM(ot->copy);
+    ot->copy = 0;
+    return -1;
+}
+
+int
+pb_uper_open_type_end(pb_uper_open_type_t *ot) {
+    size_t padding = ot->pd.nbits - ot->pd.nboff;
+    int ret = 0;
+
+    /* Same as uper_open_type_get_simple(), X.691#10.1.3 */
+    if((padding >= 8 && !(ot->pd.moved == 0 && ot->size == 1))
+       || per_get_few_bits(&ot->pd, padding) != 0)
+        ret = -1;
+
+    FREEMEM(ot->copy);
+    ot->copy = 0;
+    return ret;
+}
+
+int
+pb_uper_open_type_skip(asn_per_data_t *pd) {
+    pb_uper_open_type_t ot;
+
+    if(pb_uper_open_type_begin(pd, &ot)) return -1;
+    FREEMEM(ot.copy);
+    return 0;
+}
+
+#endif	/* ASN_DISABLE_PER_SUPPORT */
@@ -0,0 +1,276 @@
+/*
+ * Redistribution and modifications are permitted subject to BSD license.
+ */
+#ifndef	PROTOBUF_SUPPORT_H
+#define	PROTOBUF_SUPPORT_H
+
+#include <asn_application.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Protocol Buffers wire format support for the codecs generated by
+ * asn1c -gen-protobuf. The fields are numbered the same way as in the
+ * asn1c -B schema: a SEQUENCE member or a CHOICE alternative is the field
+ * numbered after its position in the type (extension markers excluded),
+ * and the value of the other named types is the message field 1.
+ */
+
+/* Wire types */
+enum pb_wire_type {
+    PB_WT_VARINT = 0,
+    PB_WT_I64 = 1,
+    PB_WT_LEN = 2,
+    PB_WT_I32 = 5
+};
+
+/*
+ * The generated <Type>_encode_protobuf() serializes the value as the contents
+ * of the protobuf message (no outer tag and length). Without a callback,
+ * only the size of the encoding is computed.
+ */
+typedef asn_enc_rval_t(pb_type_encoder_f)(
+    const struct asn_TYPE_descriptor_s *type_descriptor,
+    const void *struct_ptr, asn_app_consume_bytes_f *consume_bytes_cb,
+    void *app_key);
+
+/*
+ * The generated <Type>_decode_protobuf() parses the buffer holding
+ * exactly one message, merging it into the (*struct_ptr).
+ */
+typedef asn_dec_rval_t(pb_type_decoder_f)(
+    const asn_codec_ctx_t *opt_codec_ctx,
+    const struct asn_TYPE_descriptor_s *type_descriptor, void **struct_ptr,
+    const void *buffer, size_t size);
+
+/*
+ * Encoding state of a single message.
+ */
+typedef struct pb_output_s {
+    asn_app_consume_bytes_f *cb;    /* NULL to only compute the size */
+    void *app_key;
+    size_t encoded;                 /* Bytes so far */
+} pb_output_t;
+
+/*
+ * Each of the pb_put_xxx() functions returns 0,
+ * or -1 if the callback or the nested encoder failed.
+ */
+size_t pb_varint_size(uint64_t value);
+int pb_put_varint(pb_output_t *po, uint64_t value);
+int pb_put_tag(pb_output_t *po, unsigned field, enum pb_wire_type wt);
+
+/* bool, int32, int64 and enum fields, negative values take 10 bytes */
+int pb_put_int(pb_output_t *po, unsigned field, int64_t value);
+
+/* bytes and string fields */
+int pb_put_bytes(pb_output_t *po, unsigned field, const void *buf,
+                 size_t size);
+
+/* asn1.v1.BitString message: bytes value = 1, uint32 len = 2 */
+int pb_put_bit_string(pb_output_t *po, unsigned field, const uint8_t *buf,
+                      size_t size, int bits_unused);
+
+/* Embedded message, encoded by the generated encoder */
+int pb_put_message(pb_output_t *po, unsigned field, pb_type_encoder_f *encoder,
+                   const struct asn_TYPE_descriptor_s *td, const void *sptr);
+
+/*
+ * Encode the message into the buffer, using the generated encoder.
+ * Returns the number of bytes, or -1 with ENOMEM if they did not fit.
+ */
+asn_enc_rval_t pb_encode_to_buffer(pb_type_encoder_f *encoder,
+                                   const struct asn_TYPE_descriptor_s *td,
+                                   const void *sptr, void *buffer,
+                                   size_t buffer_size);
+
+/*
+ * Decoding state of a single message.
+ */
+typedef struct pb_input_s {
+    const uint8_t *ptr;
+    const uint8_t *end;
+} pb_input_t;
+
+/*
+ * Each of the pb_get_xxx() functions returns 0, or -1 if the data
+ * is malformed, truncated, of the wrong wire type or does not fit the value.
+ */
+int pb_get_tag(pb_input_t *pi, unsigned *field, enum pb_wire_type *wt);
+int pb_get_varint(pb_input_t *pi, uint64_t *value);
+int pb_skip(pb_input_t *pi, enum pb_wire_type wt);
+
+int pb_get_bool(pb_input_t *pi, enum pb_wire_type wt, int *value);
+int pb_get_long(pb_input_t *pi, enum pb_wire_type wt, long *value);
+int pb_get_ulong(pb_input_t *pi, enum pb_wire_type wt, unsigned long *value);
+int pb_get_int64(pb_input_t *pi, enum pb_wire_type wt, int64_t *value);
+
+/* Length-delimited field, pointing into the input buffer */
+int pb_get_bytes(pb_input_t *pi, enum pb_wire_type wt, const uint8_t **buf,
+                 size_t *size);
+
+/*
+ * bytes and string fields, copied into the (*buf) of OCTET STRING
+ * replacing the previous contents.
+ */
+int pb_get_octets(pb_input_t *pi, enum pb_wire_type wt, uint8_t **buf,
+                  size_t *size);
+
+/* asn1.v1.BitString message, copied into the BIT STRING */
+int pb_get_bit_string(pb_input_t *pi, enum pb_wire_type wt, uint8_t **buf,
+                      size_t *size, int *bits_unused);
+
+/* Embedded message, decoded by the generated decoder */
+int pb_get_message(pb_input_t *pi, enum pb_wire_type wt,
+                   pb_type_decoder_f *decoder,
+                   const asn_codec_ctx_t *opt_codec_ctx,
+                   const struct asn_TYPE_descriptor_s *td, void **sptr);
+
+/*
+ * A repeated scalar field comes either packed, or one value per field.
+ * Yields the input to read the values from with pb_get_bool() etc.
+ * using the returned (*wt).
+ */
+int pb_get_packed(pb_input_t *pi, enum pb_wire_type *wt, pb_input_t *values);
+
+/*
+ * The message written into the caller supplied buffer, as the lengths
+ * of the embedded messages are patched in after their contents.
+ */
+typedef struct pb_buffer_s {
+    pb_output_t po;                 /* For pb_put_xxx(), appends to buffer */
+    uint8_t *buffer;
+    size_t size;
+    size_t length;                  /* Bytes so far */
+} pb_buffer_t;
+
+void pb_buffer_init(pb_buffer_t *pb, void *buffer, size_t size);
+
+/*
+ * Embedded message of yet unknown length. The tag and the room for
+ * a single byte length go first, the contents are moved further
+ * by pb_end_message() if the length takes more.
+ */
+int pb_begin_message(pb_buffer_t *pb, unsigned field, size_t *mark);
+int pb_end_message(pb_buffer_t *pb, size_t mark);
+
+/*
+ * The generated <Type>_uper_to_protobuf() reads the Unaligned PER encoding
+ * of the value and writes the contents of its protobuf message, the same
+ * bytes <Type>_encode_protobuf() produces for the decoded value, without
+ * decoding it into the structure.
+ */
+typedef asn_dec_rval_t(pb_uper_converter_f)(
+    const asn_codec_ctx_t *opt_codec_ctx,
+    const struct asn_TYPE_descriptor_s *type_descriptor,
+    const asn_per_constraints_t *constraints, asn_per_data_t *pd,
+    pb_buffer_t *pb);
+
+/*
+ * Convert the complete UPER encoding (see uper_decode_complete())
+ * into the protobuf message. The (rval.consumed) is the number of bytes
+ * of the UPER encoding, (*pb_size) is the size of the message.
+ */
+asn_dec_rval_t pb_uper_convert(pb_uper_converter_f *converter,
+                               const asn_codec_ctx_t *opt_codec_ctx,
+                               const struct asn_TYPE_descriptor_s *td,
+                               const void *buffer, size_t size,
+                               void *pb_buffer, size_t pb_buffer_size,
+                               size_t *pb_size);
+
+/*
+ * The following is used by the generated converters.
+ */
+
+/* How pb_uper_put_xxx() write the value */
+enum pb_uper_flags {
+    PB_UPER_IMPLICIT = 1,   /* Zero value is not sent */
+    PB_UPER_UNSIGNED = 2    /* The value is unsigned long */
+};
+
+/*
+ * Decode the value with the type's UPER decoder into a temporary,
+ * and write it as the field. The field 0 stands for the element
+ * of the packed repeated field, written without the tag.
+ */
+asn_dec_rval_t pb_uper_put_long(const asn_codec_ctx_t *opt_codec_ctx,
+                                const struct asn_TYPE_descriptor_s *td,
+                                const asn_per_constraints_t *constraints,
+                                asn_per_data_t *pd, pb_buffer_t *pb,
+                                unsigned field, int flags);
+asn_dec_rval_t pb_uper_put_integer(const asn_codec_ctx_t *opt_codec_ctx,
+                                   const struct asn_TYPE_descriptor_s *td,
+                                   const asn_per_constraints_t *constraints,
+                                   asn_per_data_t *pd, pb_buffer_t *pb,
+                                   unsigned field, int flags);
+asn_dec_rval_t pb_uper_put_octets(const asn_codec_ctx_t *opt_codec_ctx,
+                                  const struct asn_TYPE_descriptor_s *td,
+                                  const asn_per_constraints_t *constraints,
+                                  asn_per_data_t *pd, pb_buffer_t *pb,
+                                  unsigned field, int flags);
+asn_dec_rval_t pb_uper_put_bit_string(const asn_codec_ctx_t *opt_codec_ctx,
+                                      const struct asn_TYPE_descriptor_s *td,
+                                      const asn_per_constraints_t *constraints,
+                                      asn_per_data_t *pd, pb_buffer_t *pb,
+                                      unsigned field, int flags);
+
+/* Write the int32, int64 or enum value, see pb_uper_put_long() */
+int pb_uper_put_int(pb_buffer_t *pb, unsigned field, int64_t value,
+                    int flags);
+
+/*
+ * Decode the value into the structure and write it with the generated
+ * encoder, for the types the converter does not walk through.
+ */
+asn_dec_rval_t pb_uper_materialize(const asn_codec_ctx_t *opt_codec_ctx,
+                                   const struct asn_TYPE_descriptor_s *td,
+                                   const asn_per_constraints_t *constraints,
+                                   asn_per_data_t *pd, pb_buffer_t *pb,
+                                   pb_type_encoder_f *encoder);
+
+/*
+ * Take the next (nbits) of the input as the bit stream of their own,
+ * such as the presence bitmap of SEQUENCE.
+ */
+int pb_uper_view(asn_per_data_t *pd, size_t nbits, asn_per_data_t *view);
+
+/*
+ * The number of the elements of SEQUENCE OF, X.691#20.6.
+ * If (*repeat) is set, the next chunk of elements is preceded
+ * by uper_get_length().
+ */
+ssize_t pb_uper_get_count(asn_per_data_t *pd,
+                          const struct asn_TYPE_descriptor_s *td,
+                          const asn_per_constraints_t *constraints,
+                          int *repeat);
+
+/*
+ * The index of the CHOICE alternative in the (td->elements), or -1.
+ * The extension alternatives come as the open types.
+ */
+int pb_uper_choice_index(asn_per_data_t *pd,
+                         const struct asn_TYPE_descriptor_s *td,
+                         const asn_per_constraints_t *constraints);
+
+/*
+ * The contents of the open type, X.691#11.2, read from (ot->pd).
+ * The fragmented contents are reassembled into the (copy).
+ */
+typedef struct pb_uper_open_type_s {
+    asn_per_data_t pd;
+    size_t size;                    /* Bytes of the contents */
+    uint8_t *copy;
+} pb_uper_open_type_t;
+
+int pb_uper_open_type_begin(asn_per_data_t *pd, pb_uper_open_type_t *ot);
+/* Check the padding of the contents, and release them */
+int pb_uper_open_type_end(pb_uper_open_type_t *ot);
+int pb_uper_open_type_skip(asn_per_data_t *pd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* PROTOBUF_SUPPORT_H */
@@ -15,6 +15,8 @@ xer_decode(const asn_codec_ctx_t *opt_codec_ctx,
            const asn_TYPE_descriptor_t *td, void **struct_ptr,
            const void *buffer, size_t size) {
     asn_codec_ctx_t s_codec_ctx;
+    const asn_allocator_t *saved_allocator;
+    asn_dec_rval_t rval;
 
 	/*
 	 * Stack checker requires that the codec context
@@ -35,7 +37,11 @@ xer_decode(const asn_codec_ctx_t *opt_codec_ctx,
 	/*
 	 * Invoke type-specific decoder.
 	 */
-	return td->op->xer_decoder(opt_codec_ctx, td, struct_ptr, 0, buffer, size);
+	saved_allocator = asn__allocator_enter(opt_codec_ctx);
+	rval = td->op->xer_decoder(opt_codec_ctx, td, struct_ptr, 0, buffer, size);
+	asn__allocator_leave(saved_allocator);
+
+	return rval;
 }
 
 
@@ -107,6 +113,15 @@ xer_next_token(int *stateContext, const void *buffer, size_t size, pxer_chunk_ty
 
 xer_check_tag_e
 xer_check_tag(const void *buf_ptr, int size, const char *need_tag) {
+	const char *name;
+	size_t name_len;
+
+	return xer_check_tag_name(buf_ptr, size, need_tag, &name, &name_len);
+}
+
+xer_check_tag_e
+xer_check_tag_name(const void *buf_ptr, int size, const char *need_tag,
+		const char **name, size_t *name_len) {
 	const char *buf = (const char *)buf_ptr;
 	const char *end;
 	xer_check_tag_e ct = XCT_OPENING;
@@ -136,35 +151,87 @@ xer_check_tag(const void *buf_ptr, int size, const char *need_tag) {
 		}
 	}
 
-	/* Sometimes we don't care about the tag */
-	if(!need_tag || !*need_tag)
-		return (xer_check_tag_e)(XCT__UNK__MASK | ct);
-
 	/*
-	 * Determine the tag name.
+	 * Determine the tag name: "<abc def/>", whitespace is normal.
 	 */
-	for(end = buf + size; buf < end; buf++, need_tag++) {
-		int b = *buf, n = *need_tag;
-		if(b != n) {
-			if(n == 0) {
-				switch(b) {
-				case 0x09: case 0x0a: case 0x0c: case 0x0d:
-				case 0x20:
-					/* "<abc def/>": whitespace is normal */
-					return ct;
-				}
-			}
-			return (xer_check_tag_e)(XCT__UNK__MASK | ct);
-		}
-		if(b == 0)
+	for(*name = buf, end = buf + size; buf < end; buf++) {
+		switch(*buf) {
+		case 0x09: case 0x0a: case 0x0c: case 0x0d:
+		case 0x20:
+			break;
+		case 0:
 			return XCT_BROKEN;	/* Embedded 0 in buf?! */
+		default:
+			continue;
+		}
+		break;
 	}
-	if(*need_tag)
+	*name_len = buf - *name;
+
+	/* Sometimes we don't care about the tag */
+	if(!need_tag || !*need_tag)
+		return (xer_check_tag_e)(XCT__UNK__MASK | ct);
+
+	if(strncmp(need_tag, *name, *name_len) || need_tag[*name_len])
 		return (xer_check_tag_e)(XCT__UNK__MASK | ct);
 
 	return ct;
 }
 
+/*
+ * The hash of the member name and its slot in asn_TYPE_name2member_t.
+ * The asn1c compiler builds the tables using the same functions.
+ */
+static uint32_t
+xer_name_hash(const char *name, size_t name_len) {
+	uint32_t h = 2166136261u;	/* FNV-1a */
+	size_t i;
+	for(i = 0; i < name_len; i++) {
+		h ^= (uint8_t)name[i];
+		h *= 16777619u;
+	}
+	return h;
+}
+
+static uint32_t
+xer_name_slot(uint32_t hash, unsigned displacement) {
+	uint32_t h = hash + displacement * 0x9e3779b9u;
+	h ^= h >> 16;
+	h *= 0x85ebca6bu;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35u;
+	h ^= h >> 16;
+	return h;
+}
+
+ssize_t
+xer_find_member(const asn_TYPE_member_t *elements, size_t from, size_t to,
+		const asn_TYPE_name2member_t *opt_name2el,
+		const char *name, size_t name_len) {
+	size_t n;
+
+	if(opt_name2el) {
+		uint32_t hash = xer_name_hash(name, name_len);
+		unsigned displacement = opt_name2el->displacement[
+			hash & (opt_name2el->buckets - 1)];
+		int el_no = opt_name2el->slot2el[
+			xer_name_slot(hash, displacement)
+				& (opt_name2el->slots - 1)];
+		if(el_no < 0 || (size_t)el_no < from || (size_t)el_no >= to)
+			return -1;
+		from = el_no;
+		to = from + 1;
+	}
+
+	for(n = from; n < to; n++) {
+		const char *el_name = elements[n].name;
+		if(strncmp(el_name, name, name_len) == 0 && !el_name[name_len])
+			return n;
+	}
+
+	return -1;
+}
+
 
 #undef	ADVANCE
 #define	ADVANCE(num_bytes)	do {				\
@@ -87,6 +87,28 @@ ssize_t xer_next_token(int *stateContext,
 xer_check_tag_e xer_check_tag(const void *buf_ptr, int size,
 		const char *need_tag);
 
+/*
+ * Same as xer_check_tag(), also yielding the name of the tag
+ * (when it is not XCT_BROKEN), to look up the members by.
+ */
+xer_check_tag_e xer_check_tag_name(const void *buf_ptr, int size,
+		const char *need_tag, const char **name, size_t *name_len);
+
+/*
+ * Find the member named by the tag among the (elements) numbered
+ * from (from) up to, but not including, (to). The (opt_name2el)
+ * hash is used if available, otherwise the members are scanned.
+ * RETURN VALUES:
+ * >=0:	The number of the member.
+ *  -1:	No such member in the given range.
+ */
+struct asn_TYPE_member_s;		/* Forward declaration */
+struct asn_TYPE_name2member_s;	/* Forward declaration */
+ssize_t xer_find_member(const struct asn_TYPE_member_s *elements,
+		size_t from, size_t to,
+		const struct asn_TYPE_name2member_s *opt_name2el,
+		const char *name, size_t name_len);
+
 /*
  * Get the number of bytes consisting entirely of XER whitespace characters.
  * RETURN VALUES:
@@ -76,6 +76,23 @@ _charclass[256] = {
 #define TOKEN_CB_FINAL(_type, _ns, _current_too)		\
 	TOKEN_CB_CALL( _type ## _FINAL_CHUNK_TYPE , _ns, _current_too, 1)
 
+/*
+ * Advance to the next occurrence of the character, or to the last
+ * character of the buffer if there is none (and leave the state alone).
+ * The text, comments and attribute values are the bulk of the XER input,
+ * so these are scanned by memchr(3) rather than byte by byte:
+ * the C libraries implement it with the widest vector instructions
+ * the CPU supports, selected at run time.
+ */
+#define	SKIP_TO(ch)	do {					\
+		const char *_found = memchr(p, ch, end - p);	\
+		if(!_found) {					\
+			p = end - 1;				\
+			goto next_char;				\
+		}						\
+		p = _found;					\
+	} while(0)
+
 /*
  * Parser itself
  */
@@ -93,9 +110,12 @@ ssize_t pxml_parse(int *stateContext, const void *xmlbuf, size_t size, pxml_call
 		 * Initial state: we're in the middle of some text,
 		 * or just have started.
 		 */
-		if (C == LANGLE) 
-			/* We're now in the tag, probably */
-			TOKEN_CB(PXML_TEXT, ST_TAG_START, 0);
+		if (C != LANGLE) {
+			/* Skip the rest of the text at once */
+			SKIP_TO(LANGLE);
+		}
+		/* We're now in the tag, probably */
+		TOKEN_CB(PXML_TEXT, ST_TAG_START, 0);
 		break;
 	  case ST_TAG_START:
 		if (ALPHA(C) || (C == CSLASH))
@@ -149,10 +169,11 @@ ssize_t pxml_parse(int *stateContext, const void *xmlbuf, size_t size, pxml_call
 		/*
 		 * Tag attribute's string value in quotes.
 		 */
-		if(C == CQUOTE) {
-			/* Return back to the tag state */
-			state = ST_TAG_BODY;
+		if(C != CQUOTE) {
+			SKIP_TO(CQUOTE);
 		}
+		/* Return back to the tag state */
+		state = ST_TAG_BODY;
 		break;
 	  case ST_TAG_UNQUOTED_STRING:
 		if(C == RANGLE) {
@@ -181,9 +202,10 @@ ssize_t pxml_parse(int *stateContext, const void *xmlbuf, size_t size, pxml_call
 		}
 		break;
 	  case ST_COMMENT:
-		if(C == CDASH) {
-			state = ST_COMMENT_CLO_DASH2;
+		if(C != CDASH) {
+			SKIP_TO(CDASH);
 		}
+		state = ST_COMMENT_CLO_DASH2;
 		break;
 	  case ST_COMMENT_CLO_DASH2:
 		if(C == CDASH) {
@@ -203,6 +225,8 @@ ssize_t pxml_parse(int *stateContext, const void *xmlbuf, size_t size, pxml_call
 		}
 		break;
 	  } /* switch(*ptr) */
+	next_char:
+		;
 	} /* for() */
 
 	/*
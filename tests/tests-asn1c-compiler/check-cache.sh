@@ -0,0 +1,95 @@
+#!/bin/sh
+
+# Check that the output retrieved from the -fcache-dir cache
+# is the same as the one compiled anew.
+
+# Test diff(1) capabilities
+diff -a . . 2>/dev/null && diffArgs="-a"		# Assume text files
+diff -u . . 2>/dev/null && diffArgs="$diffArgs -u"	# Unified diff output
+
+finalExitCode=0
+
+LAST_FAILED=""
+print_status() {
+    if [ -n "${LAST_FAILED}" ]; then
+        echo "Error while processing $LAST_FAILED"
+    fi
+}
+
+trap print_status EXIT
+
+top_srcdir="${top_srcdir:-../..}"
+top_builddir="${top_builddir:-../..}"
+
+template=.tmp.check-cache.$$
+cachedir=${template}.dir
+
+for ref in ${top_srcdir}/tests/tests-asn1c-compiler/*.asn1.-P*; do
+	# Figure out the initial source file used to generate this output.
+	src=$(echo "$ref" | sed -e 's/\.-[-a-zA-Z0-9=]*$//')
+	# Figure out compiler flags used to create the file.
+	flags=$(echo "$ref" | sed -e 's/.*\.-//')
+	echo "Checking $src against $ref, using the cache"
+	oldversion=${template}.old
+	LANG=C sed -e 's/^found in .*/found in .../' < "$ref" > "$oldversion"
+	rm -rf "$cachedir"
+	# Fill the cache in, then retrieve from it
+	for pass in store retrieve; do
+		newversion=${template}.$pass
+		ec=0
+		(${top_builddir}/asn1c/asn1c -S ${top_srcdir}/skeletons -no-gen-OER -no-gen-PER -fcache-dir="$cachedir" "-$flags" "$src" | LANG=C sed -e 's/^found in .*/found in .../' > "$newversion") || ec=$?
+		if [ $ec = 0 ]; then
+			diff $diffArgs "$oldversion" "$newversion" || ec=$?
+		fi
+		if [ $ec != 0 ]; then
+			LAST_FAILED="$ref (from $src, $pass)"
+			finalExitCode=$ec
+		fi
+		rm -f $newversion
+	done
+	rm -f $oldversion
+done
+
+rm -rf "$cachedir"
+
+# Edit the imported module, and check that the importer is regenerated
+echo "Checking that the importers of a changed module are not reused"
+imported=${template}.imported.asn1
+importer=${template}.importer.asn1
+cat > "$importer" <<EOM
+ModuleImporter { iso org(3) dod(6) internet(1) private(4) enterprise(1)
+	spelio(9363) software(1) asn1c(5) test(1) 2 }
+DEFINITIONS ::= BEGIN
+	IMPORTS maxValue FROM ModuleImported { iso org(3) dod(6) internet(1)
+		private(4) enterprise(1) spelio(9363) software(1) asn1c(5)
+		test(1) 1 };
+	Value ::= INTEGER (0..maxValue)
+END
+EOM
+rm -rf "$cachedir"
+for max in 100 200; do
+	cat > "$imported" <<EOM
+ModuleImported { iso org(3) dod(6) internet(1) private(4) enterprise(1)
+	spelio(9363) software(1) asn1c(5) test(1) 1 }
+DEFINITIONS ::= BEGIN
+	maxValue INTEGER ::= $max
+END
+EOM
+	ec=0
+	${top_builddir}/asn1c/asn1c -S ${top_srcdir}/skeletons -no-gen-OER -no-gen-PER -P "$importer" "$imported" > ${template}.fresh || ec=$?
+	${top_builddir}/asn1c/asn1c -S ${top_srcdir}/skeletons -no-gen-OER -no-gen-PER -fcache-dir="$cachedir" -P "$importer" "$imported" > ${template}.cached || ec=$?
+	if [ $ec = 0 ]; then
+		diff $diffArgs ${template}.fresh ${template}.cached || ec=$?
+	fi
+	if [ $ec = 0 ]; then
+		grep -q "value <= $max" ${template}.cached || ec=$?
+	fi
+	if [ $ec != 0 ]; then
+		LAST_FAILED="$importer (maxValue $max)"
+		finalExitCode=$ec
+	fi
+done
+rm -f "$imported" "$importer" ${template}.fresh ${template}.cached
+rm -rf "$cachedir"
+
+exit $finalExitCode
@@ -0,0 +1,153 @@
+/*
+ * Verify the OPTIONAL members stored inline (-finline-optionals).
+ */
+#undef	NDEBUG
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <string.h>
+#include <assert.h>
+
+#include <T.h>
+
+enum { IDX_flag, IDX_count, IDX_big, IDX_color, IDX_mandatory, IDX_octets,
+       IDX_text, IDX_nothing, IDX_ref, IDX_dflt, IDX_ext_opt, IDX_ext_mand };
+
+static BOOLEAN_t ext_mand_value = 1;
+
+static void
+fill(T_t *t, int some) {
+    memset(t, 0, sizeof(*t));
+    t->mandatory = 42;
+    t->ext_mand = &ext_mand_value;
+    if(some) {
+        t->count = 200;
+        ASN_SEQUENCE_MKPRESENT(&t->_presence_map, IDX_count);
+        t->color = color_blue;
+        ASN_SEQUENCE_MKPRESENT(&t->_presence_map, IDX_color);
+        OCTET_STRING_fromString(&t->octets, "octets");
+        ASN_SEQUENCE_MKPRESENT(&t->_presence_map, IDX_octets);
+        ASN_SEQUENCE_MKPRESENT(&t->_presence_map, IDX_nothing);
+        t->ext_opt = -5;
+        ASN_SEQUENCE_MKPRESENT(&t->_presence_map, IDX_ext_opt);
+    } else {
+        /* Values of the absent members are not to be encoded */
+        t->big = 12345;
+        t->flag = 1;
+    }
+}
+
+static void
+check_decoded(const T_t *source, const T_t *decoded) {
+    int idx;
+
+    for(idx = IDX_flag; idx <= IDX_ext_mand; idx++) {
+        if(idx == IDX_ref || idx == IDX_dflt || idx == IDX_ext_mand
+           || idx == IDX_mandatory)
+            continue;
+        assert(!ASN_SEQUENCE_ISPRESENT(source, idx)
+               == !ASN_SEQUENCE_ISPRESENT(decoded, idx));
+    }
+    assert(decoded->mandatory == 42);
+    assert(!ASN_SEQUENCE_ISPRESENT(decoded, IDX_big) && decoded->big == 0);
+    assert(asn_DEF_T.op->compare_struct(&asn_DEF_T, source, decoded) == 0);
+}
+
+static void
+check_ber(const T_t *source) {
+    uint8_t buf[256];
+    T_t *decoded = 0;
+    asn_enc_rval_t er;
+    asn_dec_rval_t dr;
+
+    er = der_encode_to_buffer(&asn_DEF_T, source, buf, sizeof(buf));
+    assert(er.encoded > 0);
+    dr = ber_decode(0, &asn_DEF_T, (void **)&decoded, buf, er.encoded);
+    assert(dr.code == RC_OK && (ssize_t)dr.consumed == er.encoded);
+    check_decoded(source, decoded);
+    ASN_STRUCT_FREE(asn_DEF_T, decoded);
+}
+
+static void
+check_xer(const T_t *source) {
+    uint8_t buf[1024];
+    T_t *decoded = 0;
+    asn_enc_rval_t er;
+    asn_dec_rval_t dr;
+
+    er = asn_encode_to_buffer(0, ATS_BASIC_XER, &asn_DEF_T, source, buf,
+                              sizeof(buf));
+    assert(er.encoded > 0);
+    dr = xer_decode(0, &asn_DEF_T, (void **)&decoded, buf, er.encoded);
+    assert(dr.code == RC_OK);
+    check_decoded(source, decoded);
+    ASN_STRUCT_FREE(asn_DEF_T, decoded);
+}
+
+static void
+check_oer(const T_t *source_with_extensions) {
+    uint8_t buf[256];
+    T_t source = *source_with_extensions;
+    T_t *decoded = 0;
+    asn_enc_rval_t er;
+    asn_dec_rval_t dr;
+
+    /*
+     * The OER decoder loses the extension bit of a multi-byte preamble,
+     * so stick to the root components here.
+     */
+    source.ext_mand = 0;
+    ASN_SEQUENCE_MKABSENT(&source._presence_map, IDX_ext_opt);
+
+    er = oer_encode_to_buffer(&asn_DEF_T, 0, &source, buf, sizeof(buf));
+    assert(er.encoded > 0);
+    dr = oer_decode(0, &asn_DEF_T, (void **)&decoded, buf, er.encoded);
+    assert(dr.code == RC_OK && (ssize_t)dr.consumed == er.encoded);
+    check_decoded(&source, decoded);
+    ASN_STRUCT_FREE(asn_DEF_T, decoded);
+}
+
+static void
+check_uper(const T_t *source) {
+    uint8_t buf[256];
+    T_t *decoded = 0;
+    asn_enc_rval_t er;
+    asn_dec_rval_t dr;
+
+    er = uper_encode_to_buffer(&asn_DEF_T, 0, source, buf, sizeof(buf));
+    assert(er.encoded > 0);
+    dr = uper_decode_complete(0, &asn_DEF_T, (void **)&decoded, buf,
+                              (er.encoded + 7) / 8);
+    assert(dr.code == RC_OK);
+    check_decoded(source, decoded);
+    ASN_STRUCT_FREE(asn_DEF_T, decoded);
+}
+
+int
+main() {
+    T_t source;
+    int some;
+
+    for(some = 0; some < 2; some++) {
+        fill(&source, some);
+        assert(asn_check_constraints(&asn_DEF_T, &source, 0, 0) == 0);
+        check_ber(&source);
+        check_xer(&source);
+        check_oer(&source);
+        check_uper(&source);
+        source.ext_mand = 0;
+        ASN_STRUCT_RESET(asn_DEF_T, &source);
+    }
+
+    /* The absent member's value is not constrained */
+    fill(&source, 0);
+    source.count = 1000;
+    assert(asn_check_constraints(&asn_DEF_T, &source, 0, 0) == 0);
+    ASN_SEQUENCE_MKPRESENT(&source._presence_map, IDX_count);
+    assert(asn_check_constraints(&asn_DEF_T, &source, 0, 0) != 0);
+    ASN_SEQUENCE_MKABSENT(&source._presence_map, IDX_count);
+    source.ext_mand = 0;
+    ASN_STRUCT_RESET(asn_DEF_T, &source);
+
+    return 0;
+}
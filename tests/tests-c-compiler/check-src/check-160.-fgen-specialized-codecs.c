@@ -0,0 +1,188 @@
+/*
+ * Verify the specialized UPER codecs (-fgen-specialized-codecs)
+ * against the table-driven ones.
+ */
+#undef	NDEBUG
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <string.h>
+#include <assert.h>
+
+#include <T.h>
+
+static asn_TYPE_operation_t *specialized_T;
+static asn_TYPE_operation_t *specialized_Ref;
+
+static void
+use_specialized(int specialized) {
+    asn_DEF_T.op = specialized ? specialized_T : &asn_OP_SEQUENCE;
+    asn_DEF_Ref.op = specialized ? specialized_Ref : &asn_OP_SEQUENCE;
+}
+
+static asn_enc_rval_t
+encode(int specialized, const T_t *t, uint8_t *buf, size_t size) {
+    asn_enc_rval_t er;
+    use_specialized(specialized);
+    er = uper_encode_to_buffer(&asn_DEF_T, 0, t, buf, size);
+    use_specialized(1);
+    return er;
+}
+
+static asn_dec_rval_t
+decode(int specialized, T_t **t, const uint8_t *buf, size_t size) {
+    asn_dec_rval_t dr;
+    use_specialized(specialized);
+    dr = uper_decode_complete(0, &asn_DEF_T, (void **)t, buf, size);
+    use_specialized(1);
+    return dr;
+}
+
+/*
+ * Both codecs must produce the same bits and the same structures.
+ */
+static void
+check_same(const T_t *t) {
+    uint8_t buf1[1024];
+    uint8_t buf2[1024];
+    asn_enc_rval_t er1 = encode(1, t, buf1, sizeof(buf1));
+    asn_enc_rval_t er2 = encode(0, t, buf2, sizeof(buf2));
+    T_t *t1 = 0;
+    T_t *t2 = 0;
+    asn_dec_rval_t dr1;
+    asn_dec_rval_t dr2;
+
+    assert(er1.encoded == er2.encoded);
+    if(er1.encoded == -1) return;
+    assert(memcmp(buf1, buf2, (er1.encoded + 7) / 8) == 0);
+
+    dr1 = decode(1, &t1, buf1, (er1.encoded + 7) / 8);
+    dr2 = decode(0, &t2, buf1, (er1.encoded + 7) / 8);
+    assert(dr1.code == RC_OK && dr2.code == RC_OK);
+    assert(dr1.consumed == dr2.consumed);
+    assert(asn_DEF_T.op->compare_struct(&asn_DEF_T, t1, t2) == 0);
+
+    ASN_STRUCT_FREE(asn_DEF_T, t1);
+    ASN_STRUCT_FREE(asn_DEF_T, t2);
+}
+
+static void
+fill(T_t *t) {
+    memset(t, 0, sizeof(*t));
+    t->small = 200;
+    t->Signed = -42;
+    t->single = 5;
+    t->flag = 1;
+    t->color = color_blue;
+    t->ecolor = ecolor_green;
+    t->sparse = sparse_two;
+    t->ext_int = 10;
+    t->small_ref = 15;
+    OCTET_STRING_fromString(&t->text, "text");
+    t->wide = 4000000000UL;
+}
+
+static void
+check_cases() {
+    static long twenty = 20;
+    static BOOLEAN_t flag = 0;
+    static long seven = 7;
+    static long three = 3;
+    static long four = 4;
+    uint8_t buf[1024];
+    asn_dec_rval_t dr;
+    T_t *decoded = 0;
+    T_t t;
+
+    fill(&t);
+    check_same(&t);
+
+    /* Values outside of the extension root */
+    t.ecolor = ecolor_blue;
+    t.ext_int = 20;
+    check_same(&t);
+
+    /* Optional and DEFAULT members */
+    t.count = &twenty;
+    t.flag_opt = &flag;
+    t.dflt = 6;
+    t.dflt3 = &three;
+    check_same(&t);
+    t.dflt3 = &four;
+    check_same(&t);
+
+    /* Extension additions */
+    t.ext_dflt = &seven;
+    check_same(&t);
+    t.ext_dflt = 0;
+    t.ext_opt = &twenty;
+    check_same(&t);
+    t.ext_opt = 0;
+
+    /* Constraint violations */
+    t.small = 256;
+    check_same(&t);
+    t.small = 0;
+    t.single = 4;
+    check_same(&t);
+    t.single = 5;
+    t.color = 3;
+    check_same(&t);
+    t.color = color_red;
+
+    /* Extension addition with a DEFAULT is filled-in when decoding */
+    t.count = 0;
+    t.flag_opt = 0;
+    t.dflt3 = 0;
+    assert(encode(1, &t, buf, sizeof(buf)).encoded > 0);
+    dr = decode(1, &decoded, buf, sizeof(buf));
+    assert(dr.code == RC_OK);
+    assert(decoded->ext_dflt && *decoded->ext_dflt == 7);
+    assert(decoded->dflt3 && *decoded->dflt3 == 3);
+    ASN_STRUCT_FREE(asn_DEF_T, decoded);
+
+    /* Out of range value in the stream: signed is 8 bits for 201 values */
+    memset(buf, 0xff, sizeof(buf));
+    buf[0] = 0x7f;  /* No extensions */
+    decoded = 0;
+    dr = decode(1, &decoded, buf, sizeof(buf));
+    assert(dr.code == RC_FAIL);
+    ASN_STRUCT_FREE(asn_DEF_T, decoded);
+    decoded = 0;
+    dr = decode(0, &decoded, buf, sizeof(buf));
+    assert(dr.code == RC_FAIL);
+    ASN_STRUCT_FREE(asn_DEF_T, decoded);
+
+    ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_IA5String, &t.text);
+}
+
+static void
+check_random() {
+    int i;
+
+    for(i = 0; i < 1000; i++) {
+        T_t *t = 0;
+        if(asn_random_fill(&asn_DEF_T, (void **)&t, 1000) == 0) {
+            T_t *nested;
+            /* The filler ignores the constraints of the referenced type */
+            for(nested = t; nested; nested = nested->ref ? nested->ref->t : 0)
+                nested->small_ref &= 0x0f;
+            check_same(t);
+        }
+        ASN_STRUCT_FREE(asn_DEF_T, t);
+    }
+}
+
+int
+main() {
+    specialized_T = asn_DEF_T.op;
+    specialized_Ref = asn_DEF_Ref.op;
+    assert(specialized_T != &asn_OP_SEQUENCE);
+    assert(specialized_Ref != &asn_OP_SEQUENCE);
+    assert(specialized_T->uper_encoder != SEQUENCE_encode_uper);
+
+    check_cases();
+    check_random();
+
+    return 0;
+}
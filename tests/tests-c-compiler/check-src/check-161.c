@@ -0,0 +1,199 @@
+/*
+ * Verify the constraints checking while encoding
+ * (asn_codec_ctx_t.check_constraints).
+ */
+#undef	NDEBUG
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <string.h>
+#include <errno.h>
+#include <assert.h>
+
+#include <T.h>
+#include <Pair.h>
+
+static const enum asn_transfer_syntax syntaxes[] = {
+    ATS_DER, ATS_BASIC_XER, ATS_CANONICAL_XER, ATS_BASIC_OER,
+    ATS_UNALIGNED_BASIC_PER, ATS_UNALIGNED_CANONICAL_PER};
+#define ALL_SYNTAXES (sizeof(syntaxes) / sizeof(syntaxes[0]))
+#define BER_XER_SYNTAXES 3
+
+static long list_items[5] = {1, 2, 3, 4, 5};
+static Small_t set_items[2] = {7, 8};
+
+static void
+fill(T_t *t, Inner_t *inner) {
+    int i;
+
+    memset(t, 0, sizeof(*t));
+    t->small = 100;
+    t->odd = 3;
+    for(i = 0; i < 2; i++) {
+        ASN_SEQUENCE_ADD(&t->list.list, &list_items[i]);
+        ASN_SET_ADD(&t->set.list, &set_items[i]);
+    }
+    t->choice.present = choice_PR_a;
+    t->choice.choice.a = 7;
+    memset(inner, 0, sizeof(*inner));
+    inner->x = 15;
+    inner->y = 1;
+    t->inner = inner;
+}
+
+static void
+release(T_t *t) {
+    /* The members are not owned */
+    asn_sequence_empty(&t->list.list);
+    asn_set_empty(&t->set.list);
+}
+
+/*
+ * The value is encoded the same way, whether the constraints are checked
+ * or not.
+ */
+static void
+check_valid(const asn_TYPE_descriptor_t *td, const void *sptr,
+            size_t nsyntaxes) {
+    asn_codec_ctx_t ctx;
+    size_t i;
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.check_constraints = 1;
+
+    assert(asn_check_constraints(td, sptr, 0, 0) == 0);
+
+    for(i = 0; i < nsyntaxes; i++) {
+        uint8_t buf1[512];
+        uint8_t buf2[512];
+        asn_enc_rval_t er1 =
+            asn_encode_to_buffer(0, syntaxes[i], td, sptr, buf1, sizeof(buf1));
+        asn_enc_rval_t er2 = asn_encode_to_buffer(&ctx, syntaxes[i], td, sptr,
+                                                  buf2, sizeof(buf2));
+        assert(er1.encoded > 0);
+        assert(er1.encoded == er2.encoded);
+        assert(memcmp(buf1, buf2, er1.encoded) == 0);
+    }
+}
+
+/*
+ * Every encoder refuses the value, pointing at the offending member.
+ */
+static void
+check_invalid(const asn_TYPE_descriptor_t *td, const void *sptr,
+              size_t nsyntaxes, const void *failed_ptr) {
+    char errbuf[128];
+    size_t errlen = sizeof(errbuf);
+    asn_codec_ctx_t ctx;
+    size_t i;
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.check_constraints = 1;
+
+    assert(asn_check_constraints(td, sptr, errbuf, &errlen) == -1);
+    fprintf(stderr, "Expecting failure: %s\n", errbuf);
+
+    for(i = 0; i < nsyntaxes; i++) {
+        uint8_t buf[512];
+        asn_enc_rval_t er;
+        errno = 0;
+        er = asn_encode_to_buffer(&ctx, syntaxes[i], td, sptr, buf,
+                                  sizeof(buf));
+        assert(er.encoded == -1);
+        assert(errno == EBADF);
+        assert(er.structure_ptr == failed_ptr);
+        assert(er.failed_type);
+    }
+}
+
+int
+main() {
+    Inner_t inner;
+    Pair_t pair;
+    Small_t small;
+    long ext;
+    T_t t;
+
+    fill(&t, &inner);
+    check_valid(&asn_DEF_T, &t, ALL_SYNTAXES);
+    t.inner = 0;
+    check_valid(&asn_DEF_T, &t, ALL_SYNTAXES);
+    ext = 2;
+    t.ext = &ext;
+    check_valid(&asn_DEF_T, &t, ALL_SYNTAXES);
+    release(&t);
+
+    /* Outside of the PER-visible range */
+    fill(&t, &inner);
+    t.small = 101;
+    check_invalid(&asn_DEF_T, &t, ALL_SYNTAXES, &t.small);
+    release(&t);
+
+    /* Within the PER-visible range, yet not permitted */
+    fill(&t, &inner);
+    t.odd = 2;
+    check_invalid(&asn_DEF_T, &t, ALL_SYNTAXES, &t.odd);
+    release(&t);
+
+    /* SEQUENCE OF size and its elements */
+    fill(&t, &inner);
+    ASN_SEQUENCE_ADD(&t.list.list, &list_items[2]);
+    ASN_SEQUENCE_ADD(&t.list.list, &list_items[3]);
+    ASN_SEQUENCE_ADD(&t.list.list, &list_items[4]);
+    check_invalid(&asn_DEF_T, &t, ALL_SYNTAXES, &t.list);
+    release(&t);
+    fill(&t, &inner);
+    list_items[1] = 10;
+    check_invalid(&asn_DEF_T, &t, ALL_SYNTAXES, &list_items[1]);
+    list_items[1] = 2;
+    release(&t);
+
+    /* SET OF elements of a constrained type */
+    fill(&t, &inner);
+    set_items[1] = 16;
+    check_invalid(&asn_DEF_T, &t, ALL_SYNTAXES, &set_items[1]);
+    set_items[1] = 8;
+    release(&t);
+
+    /* CHOICE alternatives */
+    fill(&t, &inner);
+    t.choice.choice.a = 8;
+    check_invalid(&asn_DEF_T, &t, ALL_SYNTAXES, &t.choice.choice.a);
+    t.choice.present = choice_PR_b;
+    memset(&t.choice.choice.b, 0, sizeof(t.choice.choice.b));
+    OCTET_STRING_fromString(&t.choice.choice.b, "ab");
+    check_valid(&asn_DEF_T, &t, ALL_SYNTAXES);
+    ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_IA5String, &t.choice.choice.b);
+    OCTET_STRING_fromString(&t.choice.choice.b, "abc");
+    check_invalid(&asn_DEF_T, &t, ALL_SYNTAXES, &t.choice.choice.b);
+    ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_IA5String, &t.choice.choice.b);
+    release(&t);
+
+    /* Members of a nested SEQUENCE */
+    fill(&t, &inner);
+    inner.x = 21;
+    check_invalid(&asn_DEF_T, &t, ALL_SYNTAXES, &inner.x);
+    release(&t);
+
+    /* Members of a SET */
+    memset(&pair, 0, sizeof(pair));
+    pair.x = 20;
+    check_valid(&asn_DEF_Pair, &pair, BER_XER_SYNTAXES);
+    pair.x = 9;
+    check_invalid(&asn_DEF_Pair, &pair, BER_XER_SYNTAXES, &pair.x);
+
+    /* Extension additions */
+    fill(&t, &inner);
+    ext = 4;
+    t.ext = &ext;
+    check_invalid(&asn_DEF_T, &t, ALL_SYNTAXES, &ext);
+    release(&t);
+
+    /* The outermost value */
+    small = 15;
+    check_valid(&asn_DEF_Small, &small, ALL_SYNTAXES);
+    small = 16;
+    check_invalid(&asn_DEF_Small, &small, ALL_SYNTAXES, &small);
+
+    return 0;
+}
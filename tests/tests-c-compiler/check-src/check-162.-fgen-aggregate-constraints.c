@@ -0,0 +1,278 @@
+/*
+ * Verify the aggregated constraint checkers (-fgen-aggregate-constraints)
+ * against the table-driven one, and the marking of the structures
+ * validated by asn_decode().
+ */
+#undef	NDEBUG
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <string.h>
+#include <errno.h>
+#include <assert.h>
+
+#include <T.h>
+#include <Outer.h>
+
+static asn_constr_check_f *aggregated_T;
+static asn_constr_check_f *aggregated_Inner;
+static asn_constr_check_f *aggregated_Outer;
+
+static void
+use_aggregated(int aggregated) {
+    asn_DEF_T.encoding_constraints.general_constraints =
+        aggregated ? aggregated_T : SEQUENCE_constraint;
+    asn_DEF_Inner.encoding_constraints.general_constraints =
+        aggregated ? aggregated_Inner : SEQUENCE_constraint;
+    asn_DEF_Outer.encoding_constraints.general_constraints =
+        aggregated ? aggregated_Outer : SEQUENCE_constraint;
+}
+
+struct failure {
+    int count;
+    const asn_TYPE_descriptor_t *td;
+    const void *sptr;
+};
+
+static void
+failed_cb(void *key, const asn_TYPE_descriptor_t *td, const void *sptr,
+          const char *fmt, ...) {
+    struct failure *f = (struct failure *)key;
+    (void)fmt;
+    if(f->count++ == 0) {
+        f->td = td;
+        f->sptr = sptr;
+    }
+}
+
+static int
+check(int aggregated, const T_t *t, struct failure *f) {
+    int ret;
+    memset(f, 0, sizeof(*f));
+    use_aggregated(aggregated);
+    ret = asn_DEF_T.encoding_constraints.general_constraints(&asn_DEF_T, t,
+                                                             failed_cb, f);
+    use_aggregated(1);
+    return ret;
+}
+
+/*
+ * Both checkers must agree on the outcome and on the offending value.
+ */
+static int
+check_same(const T_t *t) {
+    struct failure f1;
+    struct failure f2;
+    int ret1 = check(1, t, &f1);
+    int ret2 = check(0, t, &f2);
+
+    assert(ret1 == ret2);
+    assert(f1.count == f2.count);
+    assert(f1.td == f2.td);
+    assert(f1.sptr == f2.sptr);
+
+    return ret1;
+}
+
+static void
+fill(T_t *t) {
+    memset(t, 0, sizeof(*t));
+    t->small = 100;
+    t->Signed = -100;
+    t->odd = 5;
+    t->big = 4000000000UL;
+    t->full = 4294967295UL;
+    t->True = 1;
+    t->small_ref = 15;
+    OCTET_STRING_fromString(&t->text, "text");
+    t->inner.x = 10;
+}
+
+static void
+check_cases() {
+    static long count = 65535;
+    static Small_t ref_opt = 0;
+    static long ext = 3;
+    Inner_t inner_opt;
+    Outer_t outer;
+    T_t t;
+
+    fill(&t);
+    assert(check_same(&t) == 0);
+    t.count = &count;
+    t.ref_opt = &ref_opt;
+    t.ext = &ext;
+    memset(&inner_opt, 0, sizeof(inner_opt));
+    inner_opt.x = 20;
+    t.inner_opt = &inner_opt;
+    assert(check_same(&t) == 0);
+
+    /* Each of the members in turn */
+    t.small = 101;
+    assert(check_same(&t) == -1);
+    t.small = -1;
+    assert(check_same(&t) == -1);
+    t.small = 0;
+    t.Signed = -101;
+    assert(check_same(&t) == -1);
+    t.Signed = 100;
+    t.odd = 4;
+    assert(check_same(&t) == -1);
+    t.odd = 1;
+    t.big = 4000000001UL;
+    assert(check_same(&t) == -1);
+    t.big = 0;
+    t.True = 0;
+    assert(check_same(&t) == -1);
+    t.True = 2;
+    t.small_ref = 16;
+    assert(check_same(&t) == -1);
+    t.small_ref = 0;
+    count = 65536;
+    assert(check_same(&t) == -1);
+    count = 0;
+    ref_opt = -1;
+    assert(check_same(&t) == -1);
+    ref_opt = 15;
+    ext = 4;
+    assert(check_same(&t) == -1);
+    ext = 0;
+    t.inner.x = 21;
+    assert(check_same(&t) == -1);
+    t.inner.x = 15;
+    inner_opt.x = 9;
+    assert(check_same(&t) == -1);
+    inner_opt.x = 10;
+    assert(check_same(&t) == 0);
+
+    /* The mandatory member kept by pointer */
+    memset(&outer, 0, sizeof(outer));
+    inner_opt.outer = &outer;
+    assert(check_same(&t) == -1);
+    outer.inner = &inner_opt;
+    inner_opt.outer = 0;
+    t.inner.outer = &outer;
+    assert(check_same(&t) == 0);
+    outer.y = 2;
+    assert(check_same(&t) == -1);
+    outer.y = 1;
+    t.inner.outer = 0;
+
+    /* Other members */
+    ASN_STRUCT_RESET(asn_DEF_IA5String, &t.text);
+    assert(check_same(&t) == -1);
+    OCTET_STRING_fromString(&t.text, "123456789");
+    assert(check_same(&t) == -1);
+    ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_IA5String, &t.text);
+}
+
+static void
+check_random() {
+    int i;
+
+    for(i = 0; i < 1000; i++) {
+        T_t *t = 0;
+        if(asn_random_fill(&asn_DEF_T, (void **)&t, 1000) == 0) {
+            check_same(t);
+            /* Break some of the values */
+            t->small += i % 3 - 1;
+            t->Signed += i % 5 - 2;
+            t->small_ref += i % 7 - 3;
+            if(t->count) *t->count += i % 11 - 5;
+            t->inner.x += i % 13 - 6;
+            check_same(t);
+        }
+        ASN_STRUCT_FREE(asn_DEF_T, t);
+    }
+}
+
+/*
+ * The validating decoder rejects the bad values,
+ * and marks the structures which passed.
+ */
+static void
+check_decode(int aggregated) {
+    asn_codec_ctx_t ctx;
+    uint8_t buf[256];
+    asn_enc_rval_t er;
+    asn_dec_rval_t rval;
+    T_t *decoded = 0;
+    Inner_t inner_opt;
+    T_t t;
+
+    use_aggregated(aggregated);
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.check_constraints = 1;
+
+    fill(&t);
+    memset(&inner_opt, 0, sizeof(inner_opt));
+    inner_opt.x = 11;
+    t.inner_opt = &inner_opt;
+    er = asn_encode_to_buffer(0, ATS_DER, &asn_DEF_T, &t, buf, sizeof(buf));
+    assert(er.encoded > 0);
+
+    rval = asn_decode(&ctx, ATS_DER, &asn_DEF_T, (void **)&decoded, buf,
+                      er.encoded);
+    assert(rval.code == RC_OK);
+    assert(ASN_SEQUENCE_CONSTRAINTS_OK(decoded));
+    assert(ASN_SEQUENCE_CONSTRAINTS_OK(&decoded->inner));
+    assert(ASN_SEQUENCE_CONSTRAINTS_OK(decoded->inner_opt));
+    assert(asn_check_constraints(&asn_DEF_T, decoded, 0, 0) == 0);
+
+    /* Not checked again until the mark is cleared */
+    decoded->inner_opt->x = 21;
+    assert(asn_check_constraints(&asn_DEF_T, decoded, 0, 0) == 0);
+    ASN_SEQUENCE_CONSTRAINTS_UNKNOWN(decoded);
+    assert(asn_check_constraints(&asn_DEF_T, decoded, 0, 0) == 0);
+    ASN_SEQUENCE_CONSTRAINTS_UNKNOWN(decoded->inner_opt);
+    assert(asn_check_constraints(&asn_DEF_T, decoded, 0, 0) == -1);
+    ASN_STRUCT_FREE(asn_DEF_T, decoded);
+    decoded = 0;
+
+    /* Not marked without asking for the check */
+    rval = asn_decode(0, ATS_DER, &asn_DEF_T, (void **)&decoded, buf,
+                      er.encoded);
+    assert(rval.code == RC_OK);
+    assert(!ASN_SEQUENCE_CONSTRAINTS_OK(decoded));
+    ASN_STRUCT_FREE(asn_DEF_T, decoded);
+    decoded = 0;
+
+    /* DER encoder does not check the constraints */
+    inner_opt.x = 21;
+    er = asn_encode_to_buffer(0, ATS_DER, &asn_DEF_T, &t, buf, sizeof(buf));
+    assert(er.encoded > 0);
+    rval = asn_decode(0, ATS_DER, &asn_DEF_T, (void **)&decoded, buf,
+                      er.encoded);
+    assert(rval.code == RC_OK);
+    ASN_STRUCT_FREE(asn_DEF_T, decoded);
+    decoded = 0;
+    errno = 0;
+    rval = asn_decode(&ctx, ATS_DER, &asn_DEF_T, (void **)&decoded, buf,
+                      er.encoded);
+    assert(rval.code == RC_FAIL);
+    assert(errno == EBADF);
+    assert(!ASN_SEQUENCE_CONSTRAINTS_OK(decoded));
+    ASN_STRUCT_FREE(asn_DEF_T, decoded);
+
+    ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_IA5String, &t.text);
+
+    use_aggregated(1);
+}
+
+int
+main() {
+    aggregated_T = asn_DEF_T.encoding_constraints.general_constraints;
+    aggregated_Inner = asn_DEF_Inner.encoding_constraints.general_constraints;
+    aggregated_Outer = asn_DEF_Outer.encoding_constraints.general_constraints;
+    assert(aggregated_T != SEQUENCE_constraint);
+    assert(aggregated_Inner != SEQUENCE_constraint);
+    assert(aggregated_Outer != SEQUENCE_constraint);
+
+    check_cases();
+    check_random();
+    check_decode(1);
+    check_decode(0);
+
+    return 0;
+}
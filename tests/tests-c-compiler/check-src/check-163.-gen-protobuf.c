@@ -0,0 +1,364 @@
+/*
+ * Verify the protobuf codecs generated by -gen-protobuf: the round trip,
+ * the wire format of the -B schema, and the rejection of malformed input.
+ */
+#undef	NDEBUG
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <string.h>
+#include <assert.h>
+
+#include <T.h>
+#include <Ch.h>
+#include <Outer.h>
+#include <Ref.h>
+#include <ColorRef.h>
+#include <Smalls.h>
+#include <Flags.h>
+#include <Name.h>
+
+static size_t
+encode(pb_type_encoder_f *encoder, const asn_TYPE_descriptor_t *td,
+       const void *sptr, uint8_t *buf, size_t size) {
+    asn_enc_rval_t er;
+    asn_enc_rval_t er_size;
+
+    er = pb_encode_to_buffer(encoder, td, sptr, buf, size);
+    assert(er.encoded >= 0);
+
+    /* Without a callback, only the size is computed */
+    er_size = encoder(td, sptr, 0, 0);
+    assert(er_size.encoded == er.encoded);
+
+    return er.encoded;
+}
+
+static void *
+decode(pb_type_decoder_f *decoder, const asn_TYPE_descriptor_t *td,
+       const uint8_t *buf, size_t size) {
+    asn_dec_rval_t rv;
+    void *sptr = 0;
+
+    rv = decoder(0, td, &sptr, buf, size);
+    if(rv.code != RC_OK) {
+        ASN_STRUCT_FREE(*td, sptr);
+        return 0;
+    }
+    assert(rv.consumed == size);
+    return sptr;
+}
+
+/*
+ * Encoding and decoding back yields the same value and the same bytes.
+ */
+static void
+check_roundtrip(pb_type_encoder_f *encoder, pb_type_decoder_f *decoder,
+                const asn_TYPE_descriptor_t *td, const void *sptr) {
+    asn_enc_rval_t er;
+    uint8_t *buf1;
+    uint8_t *buf2;
+    size_t size;
+    void *decoded;
+
+    er = encoder(td, sptr, 0, 0);
+    assert(er.encoded >= 0);
+    size = er.encoded;
+    buf1 = (uint8_t *)malloc(size + 1);
+    buf2 = (uint8_t *)malloc(size + 1);
+    assert(buf1 && buf2);
+
+    assert(encode(encoder, td, sptr, buf1, size) == size);
+    decoded = decode(decoder, td, buf1, size);
+    assert(decoded);
+    assert(td->op->compare_struct(td, sptr, decoded) == 0);
+    assert(encode(encoder, td, decoded, buf2, size + 1) == size);
+    assert(memcmp(buf1, buf2, size) == 0);
+    free(buf1);
+    free(buf2);
+    ASN_STRUCT_FREE(*td, decoded);
+}
+
+static void
+check_bytes(pb_type_encoder_f *encoder, const asn_TYPE_descriptor_t *td,
+            const void *sptr, const char *expected, size_t expected_size) {
+    uint8_t buf[128];
+    size_t size = encode(encoder, td, sptr, buf, sizeof(buf));
+    assert(size == expected_size);
+    assert(memcmp(buf, expected, size) == 0);
+}
+
+#define CHECK_BYTES(type, sptr, bytes)                                   \
+    check_bytes(type##_encode_protobuf, &asn_DEF_##type, sptr, bytes,    \
+                sizeof(bytes) - 1)
+
+#define DECODE(type, bytes)                                              \
+    ((type##_t *)decode(type##_decode_protobuf, &asn_DEF_##type,         \
+                        (const uint8_t *)bytes, sizeof(bytes) - 1))
+
+static int
+decode_free(pb_type_decoder_f *decoder, const asn_TYPE_descriptor_t *td,
+            const uint8_t *buf, size_t size) {
+    void *sptr = decode(decoder, td, buf, size);
+    ASN_STRUCT_FREE(*td, sptr);
+    return sptr != 0;
+}
+
+#define DECODE_FREE(type, bytes)                                         \
+    decode_free(type##_decode_protobuf, &asn_DEF_##type,                 \
+                (const uint8_t *)bytes, sizeof(bytes) - 1)
+
+/*
+ * The wire format, as protoc would produce it for the -B schema.
+ */
+static void
+check_wire_format() {
+    Inner_t inner;
+    Inner_t inner2;
+    Outer_t outer;
+    Ch_t ch;
+    Flags_t flags;
+    BOOLEAN_t t = 1;
+    BOOLEAN_t f = 0;
+    ColorRef_t color = Color_blue;
+
+    memset(&inner, 0, sizeof(inner));
+    CHECK_BYTES(Inner, &inner, "");
+    inner.x = 150;
+    CHECK_BYTES(Inner, &inner, "\x08\x96\x01");
+
+    /* Negative numbers take 10 bytes */
+    memset(&ch, 0, sizeof(ch));
+    ch.present = Ch_PR_a;
+    ch.choice.a = -1;
+    CHECK_BYTES(Ch, &ch, "\x08\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01");
+
+    /* The alternative is sent even if it is 0 */
+    ch.choice.a = 0;
+    CHECK_BYTES(Ch, &ch, "\x08\x00");
+    ch.present = Ch_PR_d;
+    CHECK_BYTES(Ch, &ch, "\x20\x00");
+
+    /* Embedded message */
+    memset(&inner2, 0, sizeof(inner2));
+    inner2.x = 2;
+    memset(&outer, 0, sizeof(outer));
+    outer.y = 1;
+    outer.inner = &inner2;
+    CHECK_BYTES(Outer, &outer, "\x08\x01\x12\x02\x08\x02");
+
+    /* Packed repeated scalars */
+    memset(&flags, 0, sizeof(flags));
+    ASN_SEQUENCE_ADD(&flags.list, &t);
+    ASN_SEQUENCE_ADD(&flags.list, &f);
+    ASN_SEQUENCE_ADD(&flags.list, &t);
+    CHECK_BYTES(Flags, &flags, "\x0a\x03\x01\x00\x01");
+    asn_sequence_empty(&flags.list);
+
+    /* Reference to ENUMERATED is the enum */
+    CHECK_BYTES(ColorRef, &color, "\x08\x02");
+}
+
+/*
+ * The input protoc would accept.
+ */
+static void
+check_decoding() {
+    Flags_t *flags;
+    Inner_t *inner;
+    Outer_t *outer;
+    T_t *t;
+    Ch_t *ch;
+
+    /* Repeated scalars packed or not, even mixed */
+    flags = DECODE(Flags, "\x08\x01\x0a\x02\x00\x01\x08\x00");
+    assert(flags);
+    assert(flags->list.count == 4);
+    assert(*flags->list.array[0] == 1);
+    assert(*flags->list.array[1] == 0);
+    assert(*flags->list.array[2] == 1);
+    assert(*flags->list.array[3] == 0);
+    ASN_STRUCT_FREE(asn_DEF_Flags, flags);
+
+    /* Unknown fields are skipped */
+    inner = DECODE(Inner,
+                   "\xf8\x06\x05"               /* 111: varint */
+                   "\x08\x07"                   /* x = 7 */
+                   "\x2a\x03\x01\x02\x03"       /* 5: bytes */
+                   "\x31\x01\x02\x03\x04\x05\x06\x07\x08" /* 6: fixed64 */
+                   "\x3d\x01\x02\x03\x04");     /* 7: fixed32 */
+    assert(inner);
+    assert(inner->x == 7);
+    assert(!inner->outer);
+    ASN_STRUCT_FREE(asn_DEF_Inner, inner);
+
+    /* The last value of a scalar wins, the messages are merged */
+    outer = DECODE(Outer, "\x08\x01\x12\x02\x08\x05\x08\x02\x12\x00");
+    assert(outer);
+    assert(outer->y == 2);
+    assert(outer->inner->x == 5);
+    assert(!outer->inner->outer);
+    ASN_STRUCT_FREE(asn_DEF_Outer, outer);
+
+    /* The last alternative wins */
+    ch = DECODE(Ch, "\x12\x03\x61\x62\x63\x08\x05");
+    assert(ch);
+    assert(ch->present == Ch_PR_a);
+    assert(ch->choice.a == 5);
+    ASN_STRUCT_FREE(asn_DEF_Ch, ch);
+    ch = DECODE(Ch, "\x12\x01\x61\x12\x02\x62\x63");
+    assert(ch);
+    assert(ch->present == Ch_PR_b);
+    assert(ch->choice.b.size == 2);
+    assert(memcmp(ch->choice.b.buf, "bc", 3) == 0);
+    ASN_STRUCT_FREE(asn_DEF_Ch, ch);
+
+    /* The scalars are 0 unless sent, a mandatory CHOICE is not */
+    t = DECODE(T, "\x92\x01\x02\x08\x01");
+    assert(t);
+    assert(t->small == 0);
+    assert(t->choice.present == Ch_PR_a);
+    assert(t->huge.size == 1 && t->huge.buf[0] == 0);
+    assert(!t->count);
+    ASN_STRUCT_FREE(asn_DEF_T, t);
+}
+
+/*
+ * The input which is to be rejected.
+ */
+static void
+check_malformed() {
+    /* Truncated varint, length, value */
+    assert(!DECODE(Inner, "\x08"));
+    assert(!DECODE(Inner, "\x08\x80"));
+    assert(!DECODE(Inner, "\x2a"));
+    assert(!DECODE(Inner, "\x2a\x03\x01\x02"));
+    assert(!DECODE(Inner, "\x31\x01\x02"));
+    /* Varint longer than 10 bytes */
+    assert(!DECODE(Inner,
+                   "\x08\xff\xff\xff\xff\xff\xff\xff\xff\xff\x02"));
+    /* Field number 0, groups */
+    assert(!DECODE(Inner, "\x00\x01"));
+    assert(!DECODE(Inner, "\x0b\x0c"));
+    /* Wrong wire type */
+    assert(!DECODE(Inner, "\x0a\x01\x00"));
+    assert(!DECODE(Name, "\x08\x01"));
+    /* Embedded message is broken */
+    assert(!DECODE(Outer, "\x12\x02\x08\x80"));
+    /* The mandatory message kept by pointer is absent */
+    assert(!DECODE(Outer, "\x08\x01"));
+    /* No CHOICE alternative */
+    assert(!DECODE(Ch, ""));
+    assert(!DECODE(Ch, "\x28\x01"));
+    /* BIT STRING length beyond the bytes, or short of the last one */
+    assert(DECODE_FREE(T, "\x92\x01\x02\x08\x01"
+                          "\x52\x05\x0a\x01\xff\x10\x08"));
+    assert(!DECODE(T, "\x92\x01\x02\x08\x01\x52\x05\x0a\x01\xff\x10\x09"));
+    assert(!DECODE(T, "\x92\x01\x02\x08\x01"
+                      "\x52\x06\x0a\x02\xff\xff\x10\x08"));
+}
+
+static void
+check_unencodable() {
+    uint8_t buf[128];
+    asn_enc_rval_t er;
+    Outer_t outer;
+    Ch_t ch;
+    Inner_t inner;
+    T_t t;
+    double real = 1.5;
+
+    memset(&outer, 0, sizeof(outer));
+    er = Outer_encode_protobuf(&asn_DEF_Outer, &outer, 0, 0);
+    assert(er.encoded == -1);
+
+    memset(&ch, 0, sizeof(ch));
+    er = Ch_encode_protobuf(&asn_DEF_Ch, &ch, 0, 0);
+    assert(er.encoded == -1);
+
+    /* REAL is not in the -B schema */
+    memset(&t, 0, sizeof(t));
+    t.choice.present = Ch_PR_a;
+    er = T_encode_protobuf(&asn_DEF_T, &t, 0, 0);
+    assert(er.encoded > 0);
+    t.real = &real;
+    er = T_encode_protobuf(&asn_DEF_T, &t, 0, 0);
+    assert(er.encoded == -1);
+
+    /* Does not fit */
+    memset(&inner, 0, sizeof(inner));
+    inner.x = 150;
+    er = pb_encode_to_buffer(Inner_encode_protobuf, &asn_DEF_Inner, &inner,
+                             buf, 2);
+    assert(er.encoded == -1);
+}
+
+/*
+ * Out of the size budget, the random fill leaves the mandatory members
+ * absent. Such values are not encodable and are not checked.
+ */
+static int
+check_random_roundtrip(pb_type_encoder_f *encoder, pb_type_decoder_f *decoder,
+                       const asn_TYPE_descriptor_t *td, void *sptr) {
+    if(encoder(td, sptr, 0, 0).encoded < 0) {
+        assert(asn_check_constraints(td, sptr, 0, 0) != 0);
+        return 0;
+    }
+    check_roundtrip(encoder, decoder, td, sptr);
+    return 1;
+}
+
+#define CHECK_RANDOM(type, sptr)                                         \
+    check_random_roundtrip(type##_encode_protobuf, type##_decode_protobuf, \
+                           &asn_DEF_##type, sptr)
+
+static void
+check_random() {
+    int checked = 0;
+    int i;
+
+    for(i = 0; i < 500; i++) {
+        T_t *t = 0;
+        Outer_t *outer = 0;
+        Ref_t *ref = 0;
+        Smalls_t *smalls = 0;
+        Name_t *name = 0;
+
+        if(asn_random_fill(&asn_DEF_T, (void **)&t, 8000) == 0) {
+            ASN_STRUCT_FREE(asn_DEF_NativeReal, t->real);
+            t->real = 0;
+            checked += CHECK_RANDOM(T, t);
+        }
+        ASN_STRUCT_FREE(asn_DEF_T, t);
+
+        if(asn_random_fill(&asn_DEF_Outer, (void **)&outer, 1000) == 0)
+            checked += CHECK_RANDOM(Outer, outer);
+        ASN_STRUCT_FREE(asn_DEF_Outer, outer);
+
+        if(asn_random_fill(&asn_DEF_Ref, (void **)&ref, 1000) == 0)
+            checked += CHECK_RANDOM(Ref, ref);
+        ASN_STRUCT_FREE(asn_DEF_Ref, ref);
+
+        if(asn_random_fill(&asn_DEF_Smalls, (void **)&smalls, 1000) == 0)
+            checked += CHECK_RANDOM(Smalls, smalls);
+        ASN_STRUCT_FREE(asn_DEF_Smalls, smalls);
+
+        if(asn_random_fill(&asn_DEF_Name, (void **)&name, 100) == 0)
+            checked += CHECK_RANDOM(Name, name);
+        ASN_STRUCT_FREE(asn_DEF_Name, name);
+    }
+
+    fprintf(stderr, "Checked %d random values\n", checked);
+    assert(checked > 1000);
+}
+
+int
+main() {
+    check_wire_format();
+    check_decoding();
+    check_malformed();
+    check_unencodable();
+    check_random();
+
+    return 0;
+}
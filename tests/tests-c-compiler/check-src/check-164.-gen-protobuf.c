@@ -0,0 +1,220 @@
+/*
+ * Verify the UPER to protobuf converters generated by -gen-protobuf:
+ * whatever the UPER decoder followed by the protobuf encoder makes of
+ * the input, the converter makes the same.
+ */
+#undef	NDEBUG
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <string.h>
+#include <assert.h>
+
+#include <S.h>
+#include <Alt.h>
+#include <Item.h>
+#include <Mixed.h>
+#include <Version1.h>
+#include <Version2.h>
+#include <Count.h>
+#include <Codes.h>
+
+#define	BUFFER_SIZE	8192
+
+/*
+ * Decode the UPER into the structure and encode it with the protobuf
+ * encoder. Returns the size of the message, or -1 if either fails.
+ */
+static ssize_t
+reference(pb_type_encoder_f *encoder, const asn_TYPE_descriptor_t *td,
+          const uint8_t *uper, size_t uper_size, uint8_t *buf,
+          size_t *consumed) {
+    asn_dec_rval_t rv;
+    asn_enc_rval_t er;
+    void *sptr = 0;
+
+    rv = uper_decode_complete(0, td, &sptr, uper, uper_size);
+    if(rv.code != RC_OK) {
+        ASN_STRUCT_FREE(*td, sptr);
+        return -1;
+    }
+    er = pb_encode_to_buffer(encoder, td, sptr, buf, BUFFER_SIZE);
+    ASN_STRUCT_FREE(*td, sptr);
+    *consumed = rv.consumed;
+    return er.encoded;
+}
+
+/*
+ * Returns 1 if the input is converted, 0 if it is rejected as it should be.
+ */
+static int
+check_conversion(pb_uper_converter_f *converter, pb_type_encoder_f *encoder,
+                 const asn_TYPE_descriptor_t *td, const uint8_t *uper,
+                 size_t uper_size) {
+    uint8_t *expected = malloc(BUFFER_SIZE);
+    uint8_t *actual;
+    ssize_t expected_size;
+    size_t actual_size = 0;
+    size_t consumed = 0;
+    asn_dec_rval_t rv;
+
+    assert(expected);
+    expected_size =
+        reference(encoder, td, uper, uper_size, expected, &consumed);
+
+    /* Exactly the room the message needs */
+    actual = malloc(expected_size > 0 ? expected_size : 1);
+    assert(actual);
+    rv = pb_uper_convert(converter, 0, td, uper, uper_size, actual,
+                         expected_size > 0 ? expected_size : 0, &actual_size);
+    if(expected_size < 0) {
+        assert(rv.code != RC_OK);
+        free(expected);
+        free(actual);
+        return 0;
+    }
+    assert(rv.code == RC_OK);
+    assert(rv.consumed == consumed);
+    assert(actual_size == (size_t)expected_size);
+    assert(memcmp(actual, expected, actual_size) == 0);
+
+    /* The message does not fit one byte less */
+    if(expected_size) {
+        rv = pb_uper_convert(converter, 0, td, uper, uper_size, actual,
+                             expected_size - 1, &actual_size);
+        assert(rv.code != RC_OK);
+    }
+
+    free(expected);
+    free(actual);
+    return 1;
+}
+
+/*
+ * Convert the encoding of the value, and the truncated or damaged
+ * versions of it.
+ */
+static int
+check_value(pb_uper_converter_f *converter, pb_type_encoder_f *encoder,
+            const asn_TYPE_descriptor_t *td, const asn_TYPE_descriptor_t *etd,
+            const void *sptr) {
+    asn_enc_rval_t er;
+    uint8_t *uper;
+    uint8_t *damaged;
+    size_t size;
+    int i;
+
+    uper = malloc(BUFFER_SIZE);
+    assert(uper);
+    er = uper_encode_to_buffer(etd, 0, sptr, uper, BUFFER_SIZE);
+    if(er.encoded < 0) {
+        /* Random fill does not always satisfy the constraints */
+        free(uper);
+        return 0;
+    }
+    size = (er.encoded + 7) >> 3;
+
+    if(!check_conversion(converter, encoder, td, uper, size)) {
+        /* The value is not in the -B schema */
+        free(uper);
+        return 0;
+    }
+
+    for(i = 0; i < (int)size; i++) {
+        damaged = malloc(i ? i : 1);
+        assert(damaged);
+        memcpy(damaged, uper, i);
+        (void)check_conversion(converter, encoder, td, damaged, i);
+        free(damaged);
+    }
+
+    damaged = malloc(size);
+    assert(damaged);
+    for(i = 0; i < 8; i++) {
+        size_t bit = random() % (size * 8);
+        memcpy(damaged, uper, size);
+        damaged[bit >> 3] ^= 1 << (bit & 7);
+        (void)check_conversion(converter, encoder, td, damaged, size);
+    }
+    free(damaged);
+
+    free(uper);
+    return 1;
+}
+
+#define	CHECK_VALUE(type, sptr)                                            \
+    check_value(type##_uper_to_protobuf, type##_encode_protobuf,           \
+                &asn_DEF_##type, &asn_DEF_##type, sptr)
+
+#define	CHECK_RANDOM(type, size)                                           \
+    do {                                                                   \
+        void *sptr = 0;                                                    \
+        if(asn_random_fill(&asn_DEF_##type, &sptr, size) == 0)             \
+            checked += CHECK_VALUE(type, sptr);                            \
+        ASN_STRUCT_FREE(asn_DEF_##type, sptr);                             \
+    } while(0)
+
+/*
+ * The DEFAULT values left out of the UPER encoding are sent.
+ */
+static void
+check_defaults() {
+    static const uint8_t version1[] = {0x40};
+    S_t s;
+    void *sptr = &s;
+
+    memset(&s, 0, sizeof(s));
+    s.small = 1;
+    s.fixed = 7;
+    s.flag = 1;
+    assert(OCTET_STRING_fromString(&s.text, "text") == 0);
+    assert(OCTET_STRING_fromBuf(&s.octets, "1234", 4) == 0);
+    s.alt.present = Alt_PR_e_int;
+    s.alt.choice.e_int = 3;
+    assert(ASN_SEQUENCE_ADD(&s.flags.list, calloc(1, sizeof(BOOLEAN_t)))
+           == 0);
+
+    assert(CHECK_VALUE(S, sptr) == 1);
+    ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_S, &s);
+
+    /* Version1 with no extensions */
+    assert(check_conversion(Version1_uper_to_protobuf,
+                            Version1_encode_protobuf, &asn_DEF_Version1,
+                            version1, sizeof(version1)) == 1);
+}
+
+static void
+check_random() {
+    int checked = 0;
+    int i;
+
+    for(i = 0; i < 200; i++) {
+        void *v2 = 0;
+
+        CHECK_RANDOM(S, 2000);
+        CHECK_RANDOM(Alt, 200);
+        CHECK_RANDOM(Item, 200);
+        CHECK_RANDOM(Mixed, 200);
+        CHECK_RANDOM(Version1, 100);
+        CHECK_RANDOM(Count, 100);
+        CHECK_RANDOM(Codes, 100);
+
+        /* The extensions unknown to Version1 are skipped */
+        if(asn_random_fill(&asn_DEF_Version2, &v2, 200) == 0)
+            checked += check_value(Version1_uper_to_protobuf,
+                                   Version1_encode_protobuf,
+                                   &asn_DEF_Version1, &asn_DEF_Version2, v2);
+        ASN_STRUCT_FREE(asn_DEF_Version2, v2);
+    }
+
+    fprintf(stderr, "Checked %d random values\n", checked);
+    assert(checked > 1000);
+}
+
+int
+main() {
+    check_defaults();
+    check_random();
+
+    return 0;
+}
@@ -0,0 +1,217 @@
+/*
+ * Verify the XER decoding of the types whose members are looked up
+ * by the hash of their names.
+ */
+#undef	NDEBUG
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <string.h>
+#include <assert.h>
+
+#include <Wide.h>
+#include <WideV1.h>
+#include <WideSet.h>
+#include <WideChoice.h>
+#include <Narrow.h>
+
+static void *
+decode(const asn_TYPE_descriptor_t *td, const char *xml, int expect_ok) {
+    asn_dec_rval_t rv;
+    void *sptr = 0;
+
+    rv = xer_decode(0, td, &sptr, xml, strlen(xml));
+    if(expect_ok) {
+        if(rv.code != RC_OK) {
+            fprintf(stderr, "Failed to decode %s: %s\n", td->name, xml);
+            assert(rv.code == RC_OK);
+        }
+        assert(strspn(xml + rv.consumed, " \t\r\n") ==
+               strlen(xml + rv.consumed));
+        return sptr;
+    } else {
+        if(rv.code == RC_OK) {
+            fprintf(stderr, "Unexpectedly decoded %s: %s\n", td->name, xml);
+            assert(rv.code != RC_OK);
+        }
+        ASN_STRUCT_FREE(*td, sptr);
+        return 0;
+    }
+}
+
+static void
+check_round_trip(const asn_TYPE_descriptor_t *td, const void *sptr) {
+    static const enum asn_transfer_syntax syntaxes[] = {ATS_BASIC_XER,
+                                                        ATS_CANONICAL_XER};
+    size_t i;
+
+    for(i = 0; i < sizeof(syntaxes) / sizeof(syntaxes[0]); i++) {
+        asn_encode_to_new_buffer_result_t res;
+        void *decoded;
+
+        res = asn_encode_to_new_buffer(0, syntaxes[i], td, sptr);
+        assert(res.buffer);
+        decoded = decode(td, res.buffer, 1);
+        assert(td->op->compare_struct(td, sptr, decoded) == 0);
+        ASN_STRUCT_FREE(*td, decoded);
+        free(res.buffer);
+    }
+}
+
+#define CHECK_RANDOM(type, size)                                       \
+    do {                                                               \
+        void *sptr = 0;                                                \
+        if(asn_random_fill(&asn_DEF_##type, &sptr, size) == 0) {       \
+            check_round_trip(&asn_DEF_##type, sptr);                   \
+            checked++;                                                 \
+        }                                                              \
+        ASN_STRUCT_FREE(asn_DEF_##type, sptr);                         \
+    } while(0)
+
+static void
+check_random() {
+    int checked = 0;
+    int i;
+
+    for(i = 0; i < 200; i++) {
+        CHECK_RANDOM(Wide, 200);
+        CHECK_RANDOM(WideSet, 200);
+        CHECK_RANDOM(WideChoice, 200);
+        CHECK_RANDOM(Narrow, 200);
+    }
+
+    fprintf(stderr, "Checked %d random values\n", checked);
+    assert(checked > 500);
+}
+
+static void
+check_sequence() {
+    Wide_t *wide;
+    WideV1_t *v1;
+
+    wide = decode(&asn_DEF_Wide,
+                  "<Wide><alpha>1</alpha><gamma>3</gamma>"
+                  "<epsilon/><theta>8</theta><kappa><true/></kappa>"
+                  "<mu>extension</mu></Wide>",
+                  1);
+    assert(wide->alpha == 1);
+    assert(!wide->beta);
+    assert(wide->gamma && *wide->gamma == 3);
+    assert(wide->epsilon);
+    assert(wide->theta == 8);
+    assert(wide->kappa && *wide->kappa);
+    assert(!wide->lambda);
+    assert(wide->mu && wide->mu->size == 9);
+    ASN_STRUCT_FREE(asn_DEF_Wide, wide);
+
+    /* Whitespace after the name */
+    wide = decode(&asn_DEF_Wide,
+                  "<Wide><alpha >1</alpha><theta\t>8</theta\n></Wide>", 1);
+    assert(wide->alpha == 1 && wide->theta == 8);
+    ASN_STRUCT_FREE(asn_DEF_Wide, wide);
+
+    /* Out of order */
+    decode(&asn_DEF_Wide, "<Wide><theta>8</theta><alpha>1</alpha></Wide>", 0);
+    decode(&asn_DEF_Wide,
+           "<Wide><alpha>1</alpha><gamma>3</gamma><beta><true/></beta>"
+           "<theta>8</theta></Wide>",
+           0);
+    /* Missing mandatory member */
+    decode(&asn_DEF_Wide, "<Wide><alpha>1</alpha><iota>8</iota></Wide>", 0);
+    /* Twice */
+    decode(&asn_DEF_Wide,
+           "<Wide><alpha>1</alpha><alpha>1</alpha><theta>8</theta></Wide>", 0);
+    /* Not quite the names */
+    decode(&asn_DEF_Wide, "<Wide><alph>1</alph><theta>8</theta></Wide>", 0);
+    decode(&asn_DEF_Wide, "<Wide><alphaa>1</alphaa><theta>8</theta></Wide>",
+           0);
+    decode(&asn_DEF_Wide, "<Wide><Alpha>1</Alpha><theta>8</theta></Wide>", 0);
+
+    /* The unknown extensions are skipped */
+    v1 = decode(&asn_DEF_WideV1,
+                "<WideV1><alpha>1</alpha><theta>8</theta>"
+                "<lambda>11</lambda><mu>extension</mu><nu><a/><b>c</b></nu>"
+                "</WideV1>",
+                1);
+    assert(v1->alpha == 1 && v1->theta == 8);
+    ASN_STRUCT_FREE(asn_DEF_WideV1, v1);
+
+    /* But the root members are not */
+    decode(&asn_DEF_WideV1,
+           "<WideV1><alpha>1</alpha><omega>2</omega><theta>8</theta></WideV1>",
+           0);
+}
+
+static void
+check_set() {
+    WideSet_t *set;
+
+    set = decode(&asn_DEF_WideSet,
+                 "<WideSet><s9><false/></s9><s2>2</s2><s1>1</s1><s5/>"
+                 "<s10>unknown</s10></WideSet>",
+                 1);
+    assert(set->s1 == 1);
+    assert(set->s2 && *set->s2 == 2);
+    assert(set->s5);
+    assert(set->s9 && !*set->s9);
+    assert(!set->s3);
+    ASN_STRUCT_FREE(asn_DEF_WideSet, set);
+
+    /* Twice */
+    decode(&asn_DEF_WideSet, "<WideSet><s1>1</s1><s2>2</s2><s1>1</s1></WideSet>",
+           0);
+    /* Missing mandatory member */
+    decode(&asn_DEF_WideSet, "<WideSet><s2>2</s2></WideSet>", 0);
+}
+
+static void
+check_choice() {
+    WideChoice_t *choice;
+    Narrow_t *narrow;
+
+    choice = decode(&asn_DEF_WideChoice,
+                    "<WideChoice><c9><true/></c9></WideChoice>", 1);
+    assert(choice->present == WideChoice_PR_c9);
+    assert(choice->choice.c9);
+    ASN_STRUCT_FREE(asn_DEF_WideChoice, choice);
+
+    choice = decode(&asn_DEF_WideChoice,
+                    "<WideChoice><c6><alpha>1</alpha><theta>8</theta></c6>"
+                    "</WideChoice>",
+                    1);
+    assert(choice->present == WideChoice_PR_c6);
+    assert(choice->choice.c6.alpha == 1);
+    ASN_STRUCT_FREE(asn_DEF_WideChoice, choice);
+
+    /* The unknown alternative is an extension */
+    choice = decode(&asn_DEF_WideChoice,
+                    "<WideChoice><c10>10</c10></WideChoice>", 1);
+    assert(choice->present == WideChoice_PR_NOTHING);
+    ASN_STRUCT_FREE(asn_DEF_WideChoice, choice);
+
+    choice = decode(&asn_DEF_WideChoice, "<WideChoice><c>10</c></WideChoice>",
+                    1);
+    assert(choice->present == WideChoice_PR_NOTHING);
+    ASN_STRUCT_FREE(asn_DEF_WideChoice, choice);
+
+    decode(&asn_DEF_WideChoice, "<WideChoice><c1>1</c1><c2><true/></c2>"
+                                "</WideChoice>", 0);
+
+    narrow = decode(&asn_DEF_Narrow,
+                    "<Narrow><two><c8>8</c8></two></Narrow>", 1);
+    assert(!narrow->one);
+    assert(narrow->two && narrow->two->present == WideChoice_PR_c8);
+    ASN_STRUCT_FREE(asn_DEF_Narrow, narrow);
+
+    decode(&asn_DEF_Narrow, "<Narrow><three>3</three></Narrow>", 0);
+}
+
+int
+main() {
+    check_sequence();
+    check_set();
+    check_choice();
+    check_random();
+
+    return 0;
+}
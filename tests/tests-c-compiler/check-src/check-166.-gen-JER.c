@@ -0,0 +1,266 @@
+/*
+ * Verify the JER (JSON) codecs generated with -gen-JER: the round trip
+ * in both pretty and minified forms, the decoding of the input arriving
+ * piecewise or with the object members in any order, and the rejection
+ * of malformed input.
+ */
+#undef	NDEBUG
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <string.h>
+#include <assert.h>
+
+#include <T.h>
+#include <Ch.h>
+#include <St.h>
+#include <Inner.h>
+#include <Frame.h>
+
+static void *
+decode(const asn_TYPE_descriptor_t *td, const char *json, int expect_ok) {
+    asn_dec_rval_t rv;
+    void *sptr = 0;
+
+    rv = jer_decode(0, td, &sptr, json, strlen(json));
+    if(expect_ok) {
+        if(rv.code != RC_OK) {
+            fprintf(stderr, "Failed to decode %s: %s\n", td->name, json);
+            assert(rv.code == RC_OK);
+        }
+        assert(strspn(json + rv.consumed, " \t\r\n") ==
+               strlen(json + rv.consumed));
+        return sptr;
+    } else {
+        if(rv.code == RC_OK) {
+            fprintf(stderr, "Unexpectedly decoded %s: %s\n", td->name, json);
+            assert(rv.code != RC_OK);
+        }
+        ASN_STRUCT_FREE(*td, sptr);
+        return 0;
+    }
+}
+
+/*
+ * Feed the decoder with the growing prefix of the input,
+ * restarting it from where it has stopped.
+ */
+static void *
+decode_piecewise(const asn_TYPE_descriptor_t *td, const char *json,
+                 size_t size) {
+    size_t offset = 0;
+    size_t avail = 0;
+    void *sptr = 0;
+
+    for(;;) {
+        asn_dec_rval_t rv =
+            jer_decode(0, td, &sptr, json + offset, avail - offset);
+        offset += rv.consumed;
+        assert(offset <= avail);
+        if(rv.code == RC_OK) break;
+        assert(rv.code == RC_WMORE);
+        assert(avail < size);
+        avail++;
+    }
+
+    return sptr;
+}
+
+static void
+check_round_trip(const asn_TYPE_descriptor_t *td, const void *sptr) {
+    static const enum asn_transfer_syntax syntaxes[] = {ATS_JER,
+                                                        ATS_JER_MINIFIED};
+    size_t i;
+
+    for(i = 0; i < sizeof(syntaxes) / sizeof(syntaxes[0]); i++) {
+        asn_encode_to_new_buffer_result_t res;
+        void *decoded;
+
+        res = asn_encode_to_new_buffer(0, syntaxes[i], td, sptr);
+        if(!res.buffer) {
+            fprintf(stderr, "Failed to encode %s\n", td->name);
+            asn_fprint(stderr, td, sptr);
+            assert(res.buffer);
+        }
+        assert(res.result.encoded > 0);
+        assert(((char *)res.buffer)[res.result.encoded - 1] == '\n');
+        if(syntaxes[i] == ATS_JER_MINIFIED) {
+            assert(!memchr(res.buffer, '\n', res.result.encoded - 1));
+        }
+
+        decoded = decode(td, res.buffer, 1);
+        assert(td->op->compare_struct(td, sptr, decoded) == 0);
+        ASN_STRUCT_FREE(*td, decoded);
+
+        decoded = decode_piecewise(td, res.buffer, res.result.encoded);
+        assert(td->op->compare_struct(td, sptr, decoded) == 0);
+        ASN_STRUCT_FREE(*td, decoded);
+        free(res.buffer);
+    }
+}
+
+#define CHECK_RANDOM(type, size)                                       \
+    do {                                                               \
+        void *sptr = 0;                                                \
+        if(asn_random_fill(&asn_DEF_##type, &sptr, size) == 0) {       \
+            check_round_trip(&asn_DEF_##type, sptr);                   \
+            checked++;                                                 \
+        }                                                              \
+        ASN_STRUCT_FREE(asn_DEF_##type, sptr);                         \
+    } while(0)
+
+static void
+check_random() {
+    int checked = 0;
+    int i;
+
+    /* The Open Types of Frame can not be filled in randomly */
+    for(i = 0; i < 300; i++) {
+        CHECK_RANDOM(T, 1000);
+        CHECK_RANDOM(Ch, 200);
+        CHECK_RANDOM(St, 200);
+    }
+
+    fprintf(stderr, "Checked %d random values\n", checked);
+    assert(checked > 500);
+}
+
+static void
+check_choice() {
+    Ch_t *ch;
+
+    ch = decode(&asn_DEF_Ch, "{ \"b\" : \"text\" }", 1);
+    assert(ch->present == Ch_PR_b);
+    assert(ch->choice.b.size == 4);
+    ASN_STRUCT_FREE(asn_DEF_Ch, ch);
+
+    ch = decode(&asn_DEF_Ch, "{\"c\":{\"x\":-5,\"y\":true}}", 1);
+    assert(ch->present == Ch_PR_c);
+    assert(ch->choice.c.x == -5);
+    assert(ch->choice.c.y && *ch->choice.c.y);
+    ASN_STRUCT_FREE(asn_DEF_Ch, ch);
+
+    /* The unknown alternative is an extension */
+    ch = decode(&asn_DEF_Ch, "{\"e\":{\"z\":[1,{}]}}", 1);
+    assert(ch->present == Ch_PR_NOTHING);
+    ASN_STRUCT_FREE(asn_DEF_Ch, ch);
+
+    decode(&asn_DEF_Ch, "{}", 0);
+    decode(&asn_DEF_Ch, "{\"a\":1,\"d\":null}", 0);
+    decode(&asn_DEF_Ch, "{\"a\":\"1\"}", 0);
+    decode(&asn_DEF_Ch, "{\"d\":null", 0);
+}
+
+static void
+check_set() {
+    St_t *st;
+
+    st = decode(&asn_DEF_St, "{\"r\":\"abc\",\"p\":7}", 1);
+    assert(st->p == 7);
+    assert(!st->q);
+    assert(st->r.size == 3);
+    ASN_STRUCT_FREE(asn_DEF_St, st);
+
+    /* Twice */
+    decode(&asn_DEF_St, "{\"p\":7,\"r\":\"abc\",\"p\":7}", 0);
+    /* Missing mandatory member */
+    decode(&asn_DEF_St, "{\"p\":7,\"q\":false}", 0);
+    /* Not extensible */
+    decode(&asn_DEF_St, "{\"p\":7,\"r\":\"abc\",\"s\":1}", 0);
+}
+
+static void
+check_sequence() {
+    static const char reordered[] = "{\"y\":true, \"x\":1}";
+    Frame_t *frame;
+    Inner_t *inner;
+    T_t *t;
+
+    frame = decode(&asn_DEF_Frame, "{\"ident\":2,\"value\":\"blue\"}", 1);
+    assert(frame->ident == 2);
+    assert(frame->value.present == value_PR_Color);
+    assert(frame->value.choice.Color == Color_blue);
+    ASN_STRUCT_FREE(asn_DEF_Frame, frame);
+
+    frame = decode(&asn_DEF_Frame, "{\"ident\":1,\"value\":{\"x\":3}}", 1);
+    assert(frame->value.present == value_PR_Inner);
+    assert(frame->value.choice.Inner.x == 3);
+    ASN_STRUCT_FREE(asn_DEF_Frame, frame);
+
+    decode(&asn_DEF_Frame, "{\"ident\":2,\"value\":{\"x\":3}}", 0);
+    decode(&asn_DEF_Frame, "{\"ident\":2,\"value\":\"yellow\"}", 0);
+
+    t = decode(&asn_DEF_T,
+               "{\"small\":1,\"signed\":-1,\"big\":4294967295,\"wide\":0,"
+               "\"flag\":false,\"color\":\"green\",\"nothing\":null,"
+               "\"octets\":\"00ff\",\"text\":\"\\u00e9\",\"ia5\":\"\","
+               "\"bmp\":\"\\u20ac\",\"universal\":\"\\ud83d\\ude00\","
+               "\"bits\":{\"value\":\"F0\",\"length\":4},"
+               "\"oid\":\"1.2.3\",\"roid\":\"4.5\",\"real\":\"INF\","
+               "\"inner\":{\"x\":1},\"list\":[],\"names\":[\"a\",\"b\"],"
+               "\"items\":[{\"x\":1},{\"x\":2,\"y\":false}],"
+               "\"choice\":{\"d\":null},\"set\":{\"p\":0,\"r\":\"\"},"
+               "\"ext\":9,\"future\":{\"a\":[true,null]}}",
+               1);
+    assert(t->big == 4294967295UL);
+    assert(t->color == Color_green);
+    assert(t->octets.size == 2 && t->octets.buf[1] == 0xff);
+    assert(t->text.size == 2);
+    assert(t->bmp.size == 2);
+    assert(t->universal.size == 4);
+    assert(t->bits.size == 1 && t->bits.bits_unused == 4);
+    assert(t->real && *t->real > 0);
+    assert(!t->count);
+    assert(!t->level);
+    assert(t->list.list.count == 0);
+    assert(t->names.list.count == 2);
+    assert(t->items.list.count == 2);
+    assert(t->ext && *t->ext == 9);
+    check_round_trip(&asn_DEF_T, t);
+    ASN_STRUCT_FREE(asn_DEF_T, t);
+
+    /* Out of order */
+    inner = decode(&asn_DEF_Inner, reordered, 1);
+    assert(inner->x == 1 && inner->y && *inner->y);
+    ASN_STRUCT_FREE(asn_DEF_Inner, inner);
+    inner = decode_piecewise(&asn_DEF_Inner, reordered, strlen(reordered));
+    assert(inner->x == 1 && inner->y && *inner->y);
+    ASN_STRUCT_FREE(asn_DEF_Inner, inner);
+    t = decode(&asn_DEF_T,
+               "{\"future\":1,\"set\":{\"r\":\"\",\"p\":0},\"ext\":9,"
+               "\"choice\":{\"a\":5},\"inner\":{\"y\":false,\"x\":2},"
+               "\"items\":[],\"names\":[],\"list\":[],"
+               "\"real\":0.5,\"roid\":\"4\",\"oid\":\"1.2\","
+               "\"bits\":{\"value\":\"\",\"length\":0},\"universal\":\"\","
+               "\"bmp\":\"\",\"ia5\":\"\",\"text\":\"\",\"octets\":\"\","
+               "\"nothing\":null,\"color\":\"red\",\"flag\":true,\"wide\":0,"
+               "\"big\":0,\"signed\":-2,\"small\":3}",
+               1);
+    assert(t->small == 3 && t->Signed == -2);
+    assert(t->choice.present == Ch_PR_a && t->choice.choice.a == 5);
+    assert(t->inner.x == 2 && t->inner.y && !*t->inner.y);
+    assert(t->ext && *t->ext == 9);
+    check_round_trip(&asn_DEF_T, t);
+    ASN_STRUCT_FREE(asn_DEF_T, t);
+    /* Twice */
+    decode(&asn_DEF_Inner, "{\"x\":1,\"y\":true,\"x\":1}", 0);
+    decode(&asn_DEF_Inner, "{\"y\":true,\"x\":1,\"y\":true}", 0);
+    /* Missing mandatory member */
+    decode(&asn_DEF_Inner, "{\"y\":true}", 0);
+    decode(&asn_DEF_Inner, "{}", 0);
+    /* Not extensible */
+    decode(&asn_DEF_Inner, "{\"x\":1,\"z\":2}", 0);
+    /* Broken JSON */
+    decode(&asn_DEF_Ch, "{\"a\":1,}", 0);
+    decode(&asn_DEF_Ch, "{\"a\" 1}", 0);
+    decode(&asn_DEF_Ch, "[\"a\",1]", 0);
+}
+
+int
+main() {
+    check_choice();
+    check_set();
+    check_sequence();
+    check_random();
+    return 0;
+}
@@ -0,0 +1,177 @@
+/*
+ * Verify that ber_decode() gives the same result whether the one-octet tags
+ * and the short lengths are taken by the short cut in ber_check_tags() or,
+ * when the data is fed in small pieces, by the general path.
+ */
+#undef	NDEBUG
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <string.h>
+#include <assert.h>
+
+#include <Message.h>
+#include <Strict.h>
+
+/*
+ * Decode the whole buffer at once, expecting the given outcome.
+ */
+static void *
+decode(const asn_TYPE_descriptor_t *td, const void *buf, size_t size,
+       enum asn_dec_rval_code_e expected_code) {
+    asn_dec_rval_t rv;
+    void *sptr = 0;
+
+    rv = ber_decode(0, td, &sptr, buf, size);
+    if(rv.code != expected_code) {
+        fprintf(stderr, "Decoded %s of %zu bytes: %d instead of %d\n",
+                td->name, size, rv.code, expected_code);
+        assert(!"Unexpected decoding result");
+    }
+
+    if(expected_code == RC_OK) {
+        assert(rv.consumed == size);
+    } else {
+        ASN_STRUCT_FREE(*td, sptr);
+        sptr = 0;
+    }
+
+    return sptr;
+}
+
+/*
+ * Decode the buffer by restarting the decoder with one more byte at a time.
+ */
+static void *
+decode_bytewise(const asn_TYPE_descriptor_t *td, const uint8_t *buf,
+                size_t size) {
+    void *sptr = 0;
+    size_t consumed = 0;
+    size_t avail;
+
+    for(avail = 0; avail <= size; avail++) {
+        asn_dec_rval_t rv =
+            ber_decode(0, td, &sptr, buf + consumed, avail - consumed);
+        consumed += rv.consumed;
+        if(rv.code == RC_OK) {
+            assert(consumed == size);
+            return sptr;
+        }
+        assert(rv.code == RC_WMORE);
+    }
+
+    assert(!"Not decoded by the end of data");
+    return 0;
+}
+
+static void
+check_random() {
+    int checked = 0;
+    int i;
+
+    for(i = 0; i < 500; i++) {
+        Message_t *msg = 0;
+        asn_encode_to_new_buffer_result_t res;
+        void *decoded;
+        size_t size;
+
+        if(asn_random_fill(&asn_DEF_Message, (void **)&msg, 2000) != 0) {
+            ASN_STRUCT_FREE(asn_DEF_Message, msg);
+            continue;
+        }
+        res = asn_encode_to_new_buffer(0, ATS_DER, &asn_DEF_Message, msg);
+        assert(res.buffer);
+
+        decoded = decode(&asn_DEF_Message, res.buffer, res.result.encoded,
+                         RC_OK);
+        assert(asn_DEF_Message.op->compare_struct(&asn_DEF_Message, msg,
+                                                  decoded)
+               == 0);
+        ASN_STRUCT_FREE(asn_DEF_Message, decoded);
+
+        if(checked < 50) {
+            decoded = decode_bytewise(&asn_DEF_Message, res.buffer,
+                                      res.result.encoded);
+            assert(asn_DEF_Message.op->compare_struct(&asn_DEF_Message, msg,
+                                                      decoded)
+                   == 0);
+            ASN_STRUCT_FREE(asn_DEF_Message, decoded);
+        }
+
+        /* Any truncation leaves the decoder wanting more */
+        for(size = 0; size < (size_t)res.result.encoded;
+            size += 1 + size / 8) {
+            decode(&asn_DEF_Message, res.buffer, size, RC_WMORE);
+        }
+
+        free(res.buffer);
+        ASN_STRUCT_FREE(asn_DEF_Message, msg);
+        checked++;
+    }
+
+    fprintf(stderr, "Checked %d random values\n", checked);
+    assert(checked > 400);
+}
+
+static void
+check_indefinite() {
+    /* Strict { a 5, c { 1 } } */
+    static const uint8_t indefinite[] = {0x30, 0x80, 0x02, 0x01, 0x05,
+                                         0xa2, 0x80, 0x02, 0x01, 0x01,
+                                         0x00, 0x00, 0x00, 0x00};
+    static const uint8_t definite[] = {0x30, 0x08, 0x02, 0x01, 0x05,
+                                       0xa2, 0x03, 0x02, 0x01, 0x01};
+    /* The missing c */
+    static const uint8_t incomplete[] = {0x30, 0x80, 0x02, 0x01, 0x05,
+                                         0x81, 0x01, 0x07, 0x00, 0x00};
+    /* The unknown [3] in the non-extensible type */
+    static const uint8_t unknown[] = {0x30, 0x08, 0x02, 0x01, 0x05,
+                                      0xa2, 0x00, 0x83, 0x01, 0x00};
+    /* The end of contents in the definite length SEQUENCE OF */
+    static const uint8_t misplaced[] = {0x30, 0x0a, 0x02, 0x01, 0x05,
+                                        0xa2, 0x05, 0x02, 0x01, 0x01,
+                                        0x00, 0x00};
+    Strict_t *st;
+    Strict_t *st2;
+
+    st = decode(&asn_DEF_Strict, indefinite, sizeof(indefinite), RC_OK);
+    assert(st->a == 5);
+    assert(!st->b);
+    assert(st->c.list.count == 1 && *st->c.list.array[0] == 1);
+    st2 = decode(&asn_DEF_Strict, definite, sizeof(definite), RC_OK);
+    assert(asn_DEF_Strict.op->compare_struct(&asn_DEF_Strict, st, st2) == 0);
+    ASN_STRUCT_FREE(asn_DEF_Strict, st2);
+    st2 = decode_bytewise(&asn_DEF_Strict, indefinite, sizeof(indefinite));
+    assert(asn_DEF_Strict.op->compare_struct(&asn_DEF_Strict, st, st2) == 0);
+    ASN_STRUCT_FREE(asn_DEF_Strict, st);
+    ASN_STRUCT_FREE(asn_DEF_Strict, st2);
+
+    decode(&asn_DEF_Strict, indefinite, sizeof(indefinite) - 1, RC_WMORE);
+    decode(&asn_DEF_Strict, incomplete, sizeof(incomplete), RC_FAIL);
+    decode(&asn_DEF_Strict, unknown, sizeof(unknown), RC_FAIL);
+    decode(&asn_DEF_Strict, misplaced, sizeof(misplaced), RC_FAIL);
+}
+
+static void
+check_extension() {
+    /* Message { 1, search { "", sub, 0, TRUE, {}, [9] '01'H, [10] '' } } */
+    static const uint8_t ext[] = {0x30, 0x17, 0x02, 0x01, 0x01, 0x63, 0x12,
+                                  0x04, 0x00, 0x0a, 0x01, 0x02, 0x02, 0x01,
+                                  0x00, 0x01, 0x01, 0xff, 0x31, 0x00, 0x89,
+                                  0x01, 0x01, 0x8a, 0x00};
+    Message_t *msg;
+
+    msg = decode(&asn_DEF_Message, ext, sizeof(ext), RC_OK);
+    assert(msg->messageID == 1);
+    assert(msg->protocolOp.present == protocolOp_PR_search);
+    assert(msg->protocolOp.choice.search.typesOnly);
+    ASN_STRUCT_FREE(asn_DEF_Message, msg);
+}
+
+int
+main() {
+    check_indefinite();
+    check_extension();
+    check_random();
+    return 0;
+}
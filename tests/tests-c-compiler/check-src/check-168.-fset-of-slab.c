@@ -0,0 +1,157 @@
+/*
+ * Verify that the PER and OER decoders put the SET OF and SEQUENCE OF
+ * elements into the slab (-fset-of-slab), decoding the same values as
+ * the other decoders allocating them one by one, and that the lists
+ * are not oversized by the bogus element counts.
+ */
+#undef	NDEBUG
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <string.h>
+#include <assert.h>
+
+#include <Message.h>
+#include <Numbers.h>
+
+/*
+ * The elements of the list come from its slab, one after another.
+ */
+static void
+check_slab(const Message_t *msg, int slab) {
+    int i;
+
+    if(!slab) {
+        assert(!msg->items._asn_slab);
+        assert(!msg->numbers._asn_slab);
+        assert(!msg->groups._asn_slab);
+        return;
+    }
+
+    assert(!msg->items.list.count == !msg->items._asn_slab);
+    for(i = 1; i < msg->items.list.count; i++) {
+        assert((const char *)msg->items.list.array[i]
+               == (const char *)msg->items.list.array[i - 1]
+                      + sizeof(Item_t));
+    }
+    assert(!msg->numbers.list.count == !msg->numbers._asn_slab);
+    for(i = 1; i < msg->numbers.list.count; i++) {
+        assert(msg->numbers.list.array[i]
+               == msg->numbers.list.array[i - 1] + 1);
+    }
+}
+
+static void
+check_round_trip(enum asn_transfer_syntax syntax, int slab,
+                 const Message_t *msg) {
+    asn_encode_to_new_buffer_result_t res;
+    Message_t *decoded = 0;
+    Message_t *copy = 0;
+    Item_t *item;
+    asn_dec_rval_t rv;
+    size_t size;
+
+    res = asn_encode_to_new_buffer(0, syntax, &asn_DEF_Message, msg);
+    if(!res.buffer) {
+        fprintf(stderr, "Failed to encode %s\n", asn_DEF_Message.name);
+        asn_fprint(stderr, &asn_DEF_Message, msg);
+        assert(res.buffer);
+    }
+
+    rv = asn_decode(0, syntax, &asn_DEF_Message, (void **)&decoded,
+                    res.buffer, res.result.encoded);
+    assert(rv.code == RC_OK);
+    assert(asn_DEF_Message.op->compare_struct(&asn_DEF_Message, msg, decoded)
+           == 0);
+    check_slab(decoded, slab);
+
+    /* The copy has its own elements */
+    assert(ASN_STRUCT_COPY(asn_DEF_Message, (void **)&copy, decoded) == 0);
+    check_slab(copy, 0);
+    assert(asn_DEF_Message.op->compare_struct(&asn_DEF_Message, copy, decoded)
+           == 0);
+    ASN_STRUCT_FREE(asn_DEF_Message, copy);
+
+    /* The elements added past the slab are freed along with it */
+    item = calloc(1, sizeof(*item));
+    assert(item);
+    assert(ASN_SEQUENCE_ADD(&decoded->items.list, item) == 0);
+    ASN_STRUCT_FREE(asn_DEF_Message, decoded);
+
+    /* Free the partially decoded lists */
+    for(size = 0; size < (size_t)res.result.encoded; size += 1 + size / 4) {
+        decoded = 0;
+        rv = asn_decode(0, syntax, &asn_DEF_Message, (void **)&decoded,
+                        res.buffer, size);
+        assert(rv.code != RC_OK);
+        ASN_STRUCT_FREE(asn_DEF_Message, decoded);
+    }
+
+    free(res.buffer);
+}
+
+static void
+check_random() {
+    int checked = 0;
+    int i;
+
+    for(i = 0; i < 300; i++) {
+        Message_t *msg = 0;
+        if(asn_random_fill(&asn_DEF_Message, (void **)&msg, 4000) == 0) {
+            check_slab(msg, 0);
+            check_round_trip(ATS_UNALIGNED_BASIC_PER, 1, msg);
+            check_round_trip(ATS_BASIC_OER, 1, msg);
+            check_round_trip(ATS_DER, 0, msg);
+            checked++;
+        }
+        ASN_STRUCT_FREE(asn_DEF_Message, msg);
+    }
+
+    fprintf(stderr, "Checked %d random values\n", checked);
+    assert(checked > 200);
+}
+
+static void
+check_bogus_count() {
+    /* 16383 elements claimed, followed by the single byte */
+    static const uint8_t per[] = {0xbf, 0xff, 0x01};
+    static const uint8_t oer[] = {0x02, 0x3f, 0xff, 0x01};
+    Numbers_t *nums = 0;
+    asn_dec_rval_t rv;
+
+    rv = asn_decode(0, ATS_UNALIGNED_BASIC_PER, &asn_DEF_Numbers,
+                    (void **)&nums, per, sizeof(per));
+    assert(rv.code != RC_OK);
+    assert(nums && nums->list.size <= 8);
+    ASN_STRUCT_FREE(asn_DEF_Numbers, nums);
+
+    nums = 0;
+    rv = asn_decode(0, ATS_BASIC_OER, &asn_DEF_Numbers, (void **)&nums, oer,
+                    sizeof(oer));
+    assert(rv.code != RC_OK);
+    assert(nums && nums->list.size <= 1);
+    ASN_STRUCT_FREE(asn_DEF_Numbers, nums);
+}
+
+static void
+check_reserve() {
+    A_SET_OF(Item_t) set;
+
+    memset(&set, 0, sizeof(set));
+
+    assert(asn_set_reserve(&set, 10) == 0);
+    assert(set.size == 10 && set.count == 0);
+    assert(asn_set_reserve(&set, 5) == 0);
+    assert(set.size == 10);
+
+    asn_set_empty(&set);
+    assert(!set.array && set.count == 0 && set.size == 0);
+}
+
+int
+main() {
+    check_reserve();
+    check_bogus_count();
+    check_random();
+    return 0;
+}
@@ -0,0 +1,232 @@
+/*
+ * Verify that the SEQUENCE OF types keeping their simple values in place
+ * (-fpacked-sequence-of) are coded the same way as the pointer lists,
+ * that the constraints of the values are checked and reported precisely,
+ * and that the lists are not oversized by the bogus element counts.
+ */
+#undef	NDEBUG
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <string.h>
+#include <assert.h>
+
+#include <Message.h>
+#include <Bytes.h>
+#include <Alias.h>
+
+static void
+check_round_trip(enum asn_transfer_syntax syntax, const Message_t *msg) {
+    asn_encode_to_new_buffer_result_t res;
+    Message_t *decoded = 0;
+    asn_dec_rval_t rv;
+    size_t size;
+
+    res = asn_encode_to_new_buffer(0, syntax, &asn_DEF_Message, msg);
+    if(res.result.encoded < 0) {
+        fprintf(stderr, "Failed to encode %s with %d\n", asn_DEF_Message.name,
+                (int)syntax);
+        asn_fprint(stderr, &asn_DEF_Message, msg);
+        assert(res.result.encoded >= 0);
+    }
+
+    rv = asn_decode(0, syntax, &asn_DEF_Message, (void **)&decoded,
+                    res.buffer, res.result.encoded);
+    if(rv.code != RC_OK) {
+        fprintf(stderr, "Failed to decode %s with %d: %.*s\n",
+                asn_DEF_Message.name, (int)syntax, (int)res.result.encoded,
+                (char *)res.buffer);
+        assert(rv.code == RC_OK);
+    }
+    assert(asn_DEF_Message.op->compare_struct(&asn_DEF_Message, msg, decoded)
+           == 0);
+    ASN_STRUCT_FREE(asn_DEF_Message, decoded);
+
+    /* Free the partially decoded lists */
+    for(size = 0; size < (size_t)res.result.encoded; size += 1 + size / 4) {
+        decoded = 0;
+        rv = asn_decode(0, syntax, &asn_DEF_Message, (void **)&decoded,
+                        res.buffer, size);
+        assert(rv.code != RC_OK);
+        ASN_STRUCT_FREE(asn_DEF_Message, decoded);
+    }
+
+    free(res.buffer);
+}
+
+static void
+check_all_syntaxes(const Message_t *msg) {
+    check_round_trip(ATS_DER, msg);
+    check_round_trip(ATS_BASIC_XER, msg);
+    check_round_trip(ATS_CANONICAL_XER, msg);
+    check_round_trip(ATS_JER, msg);
+    check_round_trip(ATS_BASIC_OER, msg);
+    check_round_trip(ATS_UNALIGNED_BASIC_PER, msg);
+}
+
+static void
+fill_message(Message_t *msg, int n) {
+    int i;
+
+    memset(msg, 0, sizeof(*msg));
+    for(i = 0; i < n; i++) {
+        assert(ASN_SEQUENCE_VALUES_ADD(&msg->octets.list, (i * 7) & 0xff) == 0);
+        assert(ASN_SEQUENCE_VALUES_ADD(&msg->deltas.list, (i * 13) % 1500 - 500) == 0);
+        assert(ASN_SEQUENCE_VALUES_ADD(&msg->numbers.list, -i * 100003L) == 0);
+        assert(ASN_SEQUENCE_VALUES_ADD(&msg->colors.list, i % 3) == 0);
+        assert(ASN_SEQUENCE_VALUES_ADD(&msg->reals.list, i * 0.5) == 0);
+        assert(ASN_SEQUENCE_VALUES_ADD(&msg->zeros.list, 0) == 0);
+        if(i < 8)
+            assert(ASN_SEQUENCE_VALUES_ADD(&msg->flags.list, i & 1) == 0);
+    }
+    if(n == 0) assert(ASN_SEQUENCE_VALUES_ADD(&msg->flags.list, 1) == 0);
+}
+
+static void
+check_values() {
+    Message_t msg;
+    int n;
+
+    for(n = 0; n <= 200; n += 1 + n) {
+        fill_message(&msg, n);
+        assert(msg.octets.list.count == n);
+        assert(msg.octets.list.size >= n);
+        check_all_syntaxes(&msg);
+        ASN_STRUCT_RESET(asn_DEF_Message, &msg);
+        assert(!msg.octets.list.array && !msg.octets.list.count);
+    }
+}
+
+static void
+check_constraints() {
+    asn_encode_to_new_buffer_result_t res;
+    asn_codec_ctx_t ctx;
+    char errbuf[128];
+    size_t errlen;
+    Message_t msg;
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.check_constraints = 1;
+
+    fill_message(&msg, 10);
+    errlen = sizeof(errbuf);
+    assert(asn_check_constraints(&asn_DEF_Message, &msg, errbuf, &errlen)
+           == 0);
+
+    /* The offending value is pointed at */
+    msg.octets.list.array[7] = 256;
+    errlen = sizeof(errbuf);
+    assert(asn_check_constraints(&asn_DEF_Message, &msg, errbuf, &errlen)
+           == -1);
+    fprintf(stderr, "%s\n", errbuf);
+
+    res = asn_encode_to_new_buffer(&ctx, ATS_DER, &asn_DEF_Message, &msg);
+    assert(res.result.encoded == -1);
+    free(res.buffer);
+    assert(res.result.structure_ptr == &msg.octets.list.array[7]);
+
+    res = asn_encode_to_new_buffer(0, ATS_UNALIGNED_BASIC_PER,
+                                   &asn_DEF_Message, &msg);
+    assert(res.result.encoded == -1);
+    free(res.buffer);
+
+    msg.octets.list.array[7] = 255;
+    msg.deltas.list.array[9] = -1001;
+    res = asn_encode_to_new_buffer(&ctx, ATS_BASIC_OER, &asn_DEF_Message,
+                                   &msg);
+    assert(res.result.encoded == -1);
+    free(res.buffer);
+    assert(res.result.structure_ptr == &msg.deltas.list.array[9]);
+
+    msg.deltas.list.array[9] = 1000;
+    res = asn_encode_to_new_buffer(&ctx, ATS_BASIC_XER, &asn_DEF_Message,
+                                   &msg);
+    assert(res.buffer);
+    free(res.buffer);
+
+    ASN_STRUCT_RESET(asn_DEF_Message, &msg);
+}
+
+static void
+check_random() {
+    int checked = 0;
+    int i;
+
+    for(i = 0; i < 300; i++) {
+        Message_t *msg = 0;
+        /* The random lists may fall short of their SIZE constraints */
+        if(asn_random_fill(&asn_DEF_Message, (void **)&msg, 4000) == 0
+           && asn_check_constraints(&asn_DEF_Message, msg, 0, 0) == 0) {
+            check_round_trip(ATS_DER, msg);
+            check_round_trip(ATS_BASIC_OER, msg);
+            check_round_trip(ATS_UNALIGNED_BASIC_PER, msg);
+            checked++;
+        }
+        ASN_STRUCT_FREE(asn_DEF_Message, msg);
+    }
+
+    fprintf(stderr, "Checked %d random values\n", checked);
+    assert(checked > 200);
+}
+
+static void
+check_bogus_count() {
+    /* 16383 elements claimed, followed by the single byte */
+    static const uint8_t per[] = {0xbf, 0xff, 0x01};
+    static const uint8_t oer[] = {0x02, 0x3f, 0xff, 0x01};
+    Bytes_t *bytes = 0;
+    asn_dec_rval_t rv;
+
+    rv = asn_decode(0, ATS_UNALIGNED_BASIC_PER, &asn_DEF_Bytes,
+                    (void **)&bytes, per, sizeof(per));
+    assert(rv.code != RC_OK);
+    assert(bytes && bytes->list.size <= 8);
+    ASN_STRUCT_FREE(asn_DEF_Bytes, bytes);
+
+    bytes = 0;
+    rv = asn_decode(0, ATS_BASIC_OER, &asn_DEF_Bytes, (void **)&bytes, oer,
+                    sizeof(oer));
+    assert(rv.code != RC_OK);
+    assert(bytes && bytes->list.size <= 1);
+    ASN_STRUCT_FREE(asn_DEF_Bytes, bytes);
+}
+
+static void
+check_alias() {
+    asn_encode_to_new_buffer_result_t res;
+    Bytes_t bytes;
+    Alias_t *alias = 0;
+    asn_dec_rval_t rv;
+    int i;
+
+    memset(&bytes, 0, sizeof(bytes));
+    for(i = 0; i < 1000; i++)
+        assert(ASN_SEQUENCE_VALUES_ADD(&bytes.list, i % 251) == 0);
+
+    res = asn_encode_to_new_buffer(0, ATS_UNALIGNED_BASIC_PER, &asn_DEF_Bytes,
+                                   &bytes);
+    assert(res.buffer);
+    /* 8 bits per value, plus the length determinant */
+    assert(res.result.encoded == 1002);
+
+    rv = asn_decode(0, ATS_UNALIGNED_BASIC_PER, &asn_DEF_Alias,
+                    (void **)&alias, res.buffer, res.result.encoded);
+    assert(rv.code == RC_OK);
+    assert(alias->list.count == 1000 && alias->list.size == 1000);
+    assert(asn_DEF_Alias.op->compare_struct(&asn_DEF_Bytes, &bytes, alias)
+           == 0);
+
+    ASN_STRUCT_FREE(asn_DEF_Alias, alias);
+    ASN_STRUCT_RESET(asn_DEF_Bytes, &bytes);
+    free(res.buffer);
+}
+
+int
+main() {
+    check_values();
+    check_constraints();
+    check_bogus_count();
+    check_alias();
+    check_random();
+    return 0;
+}
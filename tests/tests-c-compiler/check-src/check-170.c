@@ -0,0 +1,267 @@
+/*
+ * Verify that asn_encoded_size() agrees with the encoders,
+ * that it doesn't allocate memory while sizing DER, OER and UPER,
+ * nor write to the structure, and that the sizes cached in the SEQUENCE
+ * structures by asn_encoded_size_cached() are reused until they are
+ * declared unknown.
+ */
+#undef	NDEBUG
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <string.h>
+#include <assert.h>
+
+#include <Message.h>
+#include <Empty.h>
+
+static size_t allocations;
+
+static void *
+counting_calloc(size_t nmemb, size_t size, void *opaque) {
+    (void)opaque;
+    allocations++;
+    return calloc(nmemb, size);
+}
+static void *
+counting_malloc(size_t size, void *opaque) {
+    (void)opaque;
+    allocations++;
+    return malloc(size);
+}
+static void *
+counting_realloc(void *ptr, size_t size, void *opaque) {
+    (void)opaque;
+    allocations++;
+    return realloc(ptr, size);
+}
+static void
+counting_free(void *ptr, void *opaque) {
+    (void)opaque;
+    free(ptr);
+}
+
+static const asn_allocator_t counting_allocator = {
+    counting_calloc, counting_malloc, counting_realloc, counting_free, 0};
+
+static const enum asn_transfer_syntax sized_syntaxes[] = {
+    ATS_DER, ATS_BASIC_OER, ATS_UNALIGNED_BASIC_PER};
+
+static ssize_t
+encoded_size(enum asn_transfer_syntax syntax, const asn_TYPE_descriptor_t *td,
+             void *sptr, int cached) {
+    const asn_allocator_t *saved_allocator;
+    size_t saved_allocations = allocations;
+    ssize_t size;
+
+    saved_allocator = asn_set_thread_allocator(&counting_allocator);
+    if(cached)
+        size = asn_encoded_size_cached(syntax, td, sptr);
+    else
+        size = asn_encoded_size(syntax, td, sptr);
+    asn_set_thread_allocator(saved_allocator);
+
+    if(allocations != saved_allocations) {
+        fprintf(stderr, "Sizing %s with %d allocated %zu times\n", td->name,
+                (int)syntax, allocations - saved_allocations);
+        assert(allocations == saved_allocations);
+    }
+
+    return size;
+}
+
+static ssize_t
+actual_size(enum asn_transfer_syntax syntax, const asn_TYPE_descriptor_t *td,
+            const void *sptr) {
+    asn_encode_to_new_buffer_result_t res;
+
+    res = asn_encode_to_new_buffer(0, syntax, td, sptr);
+    assert(res.result.encoded >= 0);
+    free(res.buffer);
+
+    return res.result.encoded;
+}
+
+static void
+check_size(enum asn_transfer_syntax syntax, const asn_TYPE_descriptor_t *td,
+           void *sptr) {
+    ssize_t expected = actual_size(syntax, td, sptr);
+    ssize_t size = encoded_size(syntax, td, sptr, 0);
+
+    if(size != expected) {
+        fprintf(stderr, "%s sized %zd with %d, encoded %zd\n", td->name, size,
+                (int)syntax, expected);
+        asn_fprint(stderr, td, sptr);
+        assert(size == expected);
+    }
+
+    /* Caching the sizes in the structure, then from them */
+    assert(encoded_size(syntax, td, sptr, 1) == expected);
+    assert(encoded_size(syntax, td, sptr, 1) == expected);
+    assert(encoded_size(syntax, td, sptr, 0) == expected);
+}
+
+static void
+check_all_syntaxes(const asn_TYPE_descriptor_t *td, void *sptr) {
+    size_t i;
+
+    for(i = 0; i < sizeof(sized_syntaxes) / sizeof(sized_syntaxes[0]); i++)
+        check_size(sized_syntaxes[i], td, sptr);
+
+    /* Nothing to skip over with XER, sized by counting the output */
+    assert(asn_encoded_size(ATS_BASIC_XER, td, sptr)
+           == actual_size(ATS_BASIC_XER, td, sptr));
+}
+
+static Record_t *
+new_record(long id, const char *payload) {
+    Record_t *rec = calloc(1, sizeof(*rec));
+    assert(rec);
+    rec->id = id;
+    if(payload) {
+        rec->payload =
+            OCTET_STRING_new_fromBuf(&asn_DEF_OCTET_STRING, payload, -1);
+        assert(rec->payload);
+    }
+    return rec;
+}
+
+static void
+fill_message(Message_t *msg, int n) {
+    long *tag;
+    int i;
+
+    memset(msg, 0, sizeof(*msg));
+    msg->header.version = 3;
+    assert(OCTET_STRING_fromString(&msg->header.name, "sizes") == 0);
+    for(i = 0; i < n; i++) {
+        Record_t *rec = new_record(i * 1000003L - 7, (i & 1) ? "payload" : 0);
+        rec->flag = (i % 3 == 0);
+        if(i % 4 == 1) {
+            rec->inner = calloc(1, sizeof(*rec->inner));
+            assert(rec->inner);
+            rec->inner->version = i & 0xff;
+            assert(OCTET_STRING_fromString(&rec->inner->name, "inner") == 0);
+        }
+        assert(ASN_SEQUENCE_ADD(&msg->records.list, rec) == 0);
+        tag = calloc(1, sizeof(*tag));
+        assert(tag);
+        *tag = 100 - i * 37;
+        assert(ASN_SET_ADD(&msg->tags.list, tag) == 0);
+    }
+}
+
+static void
+check_values() {
+    Message_t msg;
+    int n;
+
+    for(n = 0; n <= 50; n += 1 + n) {
+        fill_message(&msg, n);
+        check_all_syntaxes(&asn_DEF_Message, &msg);
+
+        /* The extensions, coded as the open types by UPER */
+        msg.trailer = new_record(-1, "trailer");
+        msg.trailer->inner = calloc(1, sizeof(*msg.trailer->inner));
+        assert(msg.trailer->inner);
+        assert(OCTET_STRING_fromString(&msg.trailer->inner->name, "t") == 0);
+        msg.body = calloc(1, sizeof(*msg.body));
+        assert(msg.body);
+        msg.body->present = Body_PR_record;
+        msg.body->choice.record.id = 42;
+        ASN_SEQUENCE_ENCODED_SIZE_UNKNOWN(&msg);
+        check_all_syntaxes(&asn_DEF_Message, &msg);
+
+        ASN_STRUCT_RESET(asn_DEF_Message, &msg);
+    }
+}
+
+static void
+check_empty() {
+    Empty_t empty;
+
+    memset(&empty, 0, sizeof(empty));
+    check_all_syntaxes(&asn_DEF_Empty, &empty);
+    /* The complete encoding of X.691 #11.1 */
+    assert(asn_encoded_size(ATS_UNALIGNED_BASIC_PER, &asn_DEF_Empty, &empty)
+           == 1);
+}
+
+static void
+check_cached() {
+    static const char *names[] = {"longer name", "sizes", "x"};
+    Message_t msg;
+    size_t i;
+
+    fill_message(&msg, 10);
+
+    for(i = 0; i < sizeof(sized_syntaxes) / sizeof(sized_syntaxes[0]); i++) {
+        enum asn_transfer_syntax syntax = sized_syntaxes[i];
+        ssize_t size;
+
+        /* Nothing is cached by the plain sizing */
+        size = encoded_size(syntax, &asn_DEF_Message, &msg, 0);
+        assert(size == actual_size(syntax, &asn_DEF_Message, &msg));
+        assert(!msg._asn_ctx.encoded_syntax);
+        assert(!msg.header._asn_ctx.encoded_syntax);
+
+        size = encoded_size(syntax, &asn_DEF_Message, &msg, 1);
+        assert(size == actual_size(syntax, &asn_DEF_Message, &msg));
+        assert(msg._asn_ctx.encoded_syntax);
+
+        assert(OCTET_STRING_fromString(&msg.header.name, names[i]) == 0);
+        assert(actual_size(syntax, &asn_DEF_Message, &msg) != size);
+
+        /* The stale size is reused, but only by the cached sizing */
+        assert(encoded_size(syntax, &asn_DEF_Message, &msg, 1) == size);
+        assert(encoded_size(syntax, &asn_DEF_Message, &msg, 0)
+               == actual_size(syntax, &asn_DEF_Message, &msg));
+
+        /* Still, the header is sized by its own stale size */
+        ASN_SEQUENCE_ENCODED_SIZE_UNKNOWN(&msg);
+        assert(encoded_size(syntax, &asn_DEF_Message, &msg, 1) == size);
+
+        ASN_SEQUENCE_ENCODED_SIZE_UNKNOWN(&msg.header);
+        ASN_SEQUENCE_ENCODED_SIZE_UNKNOWN(&msg);
+        size = encoded_size(syntax, &asn_DEF_Message, &msg, 1);
+        assert(size == actual_size(syntax, &asn_DEF_Message, &msg));
+        ASN_SEQUENCE_ENCODED_SIZE_UNKNOWN(&msg.header);
+        ASN_SEQUENCE_ENCODED_SIZE_UNKNOWN(&msg);
+    }
+
+    /* Not sizing the values for the encoders */
+    assert(asn_encoded_size(ATS_DER, 0, &msg) == -1);
+    assert(asn_encoded_size(ATS_DER, &asn_DEF_Message, 0) == -1);
+    assert(asn_encoded_size(ATS_CER, &asn_DEF_Message, &msg) == -1);
+    assert(asn_encoded_size_cached(ATS_DER, &asn_DEF_Message, 0) == -1);
+
+    ASN_STRUCT_RESET(asn_DEF_Message, &msg);
+}
+
+static void
+check_random() {
+    int checked = 0;
+    int i;
+
+    for(i = 0; i < 300; i++) {
+        Message_t *msg = 0;
+        if(asn_random_fill(&asn_DEF_Message, (void **)&msg, 2000) == 0
+           && asn_check_constraints(&asn_DEF_Message, msg, 0, 0) == 0) {
+            check_all_syntaxes(&asn_DEF_Message, msg);
+            checked++;
+        }
+        ASN_STRUCT_FREE(asn_DEF_Message, msg);
+    }
+
+    fprintf(stderr, "Checked %d random values\n", checked);
+    assert(checked > 200);
+}
+
+int
+main() {
+    check_values();
+    check_empty();
+    check_cached();
+    check_random();
+    return 0;
+}
@@ -0,0 +1,316 @@
+/*
+ * Verify that the copy_struct operations produce the deep copies
+ * equal to the originals and independent of them, either allocated
+ * or filled in place, without the decoder contexts and the cached
+ * checks and sizes, and that the partial copies are not leaked.
+ */
+#undef	NDEBUG
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <string.h>
+#include <assert.h>
+
+#include <Message.h>
+#include <Frame.h>
+
+enum { IDX_count = 10, IDX_note = 11 };
+
+static size_t allocations_left;
+
+static void *
+failing_calloc(size_t nmemb, size_t size, void *opaque) {
+    (void)opaque;
+    if(!allocations_left) return 0;
+    allocations_left--;
+    return calloc(nmemb, size);
+}
+static void *
+failing_malloc(size_t size, void *opaque) {
+    (void)opaque;
+    if(!allocations_left) return 0;
+    allocations_left--;
+    return malloc(size);
+}
+static void *
+failing_realloc(void *ptr, size_t size, void *opaque) {
+    (void)opaque;
+    if(!allocations_left) return 0;
+    allocations_left--;
+    return realloc(ptr, size);
+}
+static void
+failing_free(void *ptr, void *opaque) {
+    (void)opaque;
+    free(ptr);
+}
+
+static const asn_allocator_t failing_allocator = {
+    failing_calloc, failing_malloc, failing_realloc, failing_free, 0};
+
+static void
+check_der_equal(const asn_TYPE_descriptor_t *td, const void *a,
+                const void *b) {
+    asn_encode_to_new_buffer_result_t ra;
+    asn_encode_to_new_buffer_result_t rb;
+
+    ra = asn_encode_to_new_buffer(0, ATS_DER, td, a);
+    rb = asn_encode_to_new_buffer(0, ATS_DER, td, b);
+    assert(ra.result.encoded >= 0);
+    assert(ra.result.encoded == rb.result.encoded);
+    assert(memcmp(ra.buffer, rb.buffer, ra.result.encoded) == 0);
+    free(ra.buffer);
+    free(rb.buffer);
+}
+
+static Message_t *
+copy_message(const Message_t *msg) {
+    Message_t *copy = 0;
+
+    assert(ASN_STRUCT_COPY(asn_DEF_Message, &copy, msg) == 0);
+    assert(copy && copy != msg);
+    if(asn_DEF_Message.op->compare_struct(&asn_DEF_Message, msg, copy)) {
+        asn_fprint(stderr, &asn_DEF_Message, msg);
+        asn_fprint(stderr, &asn_DEF_Message, copy);
+        assert(!"Copy differs");
+    }
+
+    return copy;
+}
+
+static void
+fill_message(Message_t *msg) {
+    static const asn_oid_arc_t arcs[] = {1, 3, 6, 1, 4, 1, 9363};
+    Inner_t *item;
+    int i;
+
+    memset(msg, 0, sizeof(*msg));
+    msg->id = -42;
+    msg->ratio = 0.25;
+    msg->flag = 1;
+    msg->color = Color_blue;
+    assert(OCTET_STRING_fromBuf(&msg->octets, "\0\1\2\3", 4) == 0);
+    assert(OCTET_STRING_fromString(&msg->text, "text") == 0);
+    msg->bits.buf = calloc(1, 3);
+    assert(msg->bits.buf);
+    msg->bits.buf[0] = 0xf0;
+    msg->bits.size = 2;
+    msg->bits.bits_unused = 4;
+    assert(OBJECT_IDENTIFIER_set_arcs(&msg->oid, arcs,
+                                      sizeof(arcs) / sizeof(arcs[0]))
+           == 0);
+    assert(RELATIVE_OID_set_arcs(&msg->roid, arcs + 4, 3) == 0);
+    msg->count = 200;
+    ASN_SEQUENCE_MKPRESENT(&msg->_presence_map, IDX_count);
+    msg->inner = calloc(1, sizeof(*msg->inner));
+    assert(msg->inner);
+    msg->inner->x = 7;
+    for(i = 0; i < 5; i++)
+        assert(ASN_SEQUENCE_VALUES_ADD(&msg->samples.list, i * 100 - 200)
+               == 0);
+    for(i = 0; i < 3; i++) {
+        item = calloc(1, sizeof(*item));
+        assert(item);
+        item->x = i;
+        assert(ASN_SEQUENCE_ADD(&msg->items.list, item) == 0);
+    }
+    assert(ASN_SET_ADD(&msg->names.list,
+                       OCTET_STRING_new_fromBuf(&asn_DEF_IA5String,
+                                                "name", -1))
+           == 0);
+    msg->choice.present = Ch_PR_c;
+    msg->choice.choice.c.x = 9;
+    msg->set.p = 1;
+    assert(OCTET_STRING_fromString(&msg->set.r, "r") == 0);
+}
+
+static void
+check_independent() {
+    Message_t msg;
+    Message_t *copy;
+
+    fill_message(&msg);
+    copy = copy_message(&msg);
+    check_der_equal(&asn_DEF_Message, &msg, copy);
+
+    /* Nothing is shared */
+    assert(copy->octets.buf != msg.octets.buf);
+    assert(copy->oid.buf != msg.oid.buf);
+    assert(copy->inner != msg.inner);
+    assert(copy->samples.list.array != msg.samples.list.array);
+    assert(copy->items.list.array != msg.items.list.array);
+    assert(copy->items.list.array[0] != msg.items.list.array[0]);
+    assert(copy->names.list.array[0] != msg.names.list.array[0]);
+    assert(copy->bits.bits_unused == 4);
+    assert(ASN_SEQUENCE_ISPRESENT(copy, IDX_count));
+    assert(!ASN_SEQUENCE_ISPRESENT(copy, IDX_note));
+
+    /* Modifying the copy leaves the original alone */
+    copy->octets.buf[0] = 0xff;
+    copy->inner->x = 8;
+    copy->samples.list.array[4] = 1000;
+    copy->items.list.array[2]->x = 3;
+    copy->choice.choice.c.x = 10;
+    assert(asn_DEF_Message.op->compare_struct(&asn_DEF_Message, &msg, copy)
+           != 0);
+    assert(msg.octets.buf[0] == 0);
+    assert(msg.inner->x == 7);
+    assert(msg.samples.list.array[4] == 200);
+    assert(msg.items.list.array[2]->x == 2);
+    assert(msg.choice.choice.c.x == 9);
+
+    /* Freeing the original leaves the copy alone */
+    ASN_STRUCT_RESET(asn_DEF_Message, &msg);
+    assert(copy->octets.size == 4 && copy->octets.buf[3] == 3);
+    assert(copy->items.list.count == 3);
+
+    ASN_STRUCT_FREE(asn_DEF_Message, copy);
+}
+
+static void
+check_in_place() {
+    Message_t msg;
+    Message_t copy;
+    void *dst = &copy;
+
+    fill_message(&msg);
+    memset(&copy, 0, sizeof(copy));
+
+    /* Filled in, as a member of the enclosing structure would be */
+    assert(ASN_STRUCT_COPY(asn_DEF_Message, &dst, &msg) == 0);
+    assert(dst == &copy);
+    assert(asn_DEF_Message.op->compare_struct(&asn_DEF_Message, &msg, &copy)
+           == 0);
+
+    ASN_STRUCT_RESET(asn_DEF_Message, &copy);
+    ASN_STRUCT_RESET(asn_DEF_Message, &msg);
+}
+
+static void
+check_context() {
+    Message_t msg;
+    Message_t *copy;
+
+    fill_message(&msg);
+    SEQUENCE_mark_constraints_ok(&asn_DEF_Message, &msg);
+    assert(asn_encoded_size_cached(ATS_DER, &asn_DEF_Message, &msg) > 0);
+    assert(msg._asn_ctx.constraints_ok && msg._asn_ctx.encoded_syntax);
+    assert(msg.inner->_asn_ctx.encoded_syntax);
+
+    /* The checks and sizes cached in the original don't apply to the copy */
+    copy = copy_message(&msg);
+    assert(!copy->_asn_ctx.constraints_ok && !copy->_asn_ctx.encoded_syntax);
+    assert(!copy->inner->_asn_ctx.encoded_syntax);
+    assert(!copy->choice.choice.c._asn_ctx.encoded_syntax);
+
+    ASN_STRUCT_FREE(asn_DEF_Message, copy);
+    ASN_STRUCT_RESET(asn_DEF_Message, &msg);
+}
+
+static void
+check_open_type() {
+    Frame_t frame;
+    Frame_t *copy = 0;
+
+    memset(&frame, 0, sizeof(frame));
+    frame.ident = 1;
+    frame.value.present = value_PR_Inner;
+    frame.value.choice.Inner.x = 3;
+    frame.value.choice.Inner.y = 1;
+    ASN_SEQUENCE_MKPRESENT(&frame.value.choice.Inner._presence_map, 1);
+
+    assert(ASN_STRUCT_COPY(asn_DEF_Frame, &copy, &frame) == 0);
+    assert(copy->value.present == value_PR_Inner);
+    assert(ASN_SEQUENCE_ISPRESENT(&copy->value.choice.Inner, 1));
+    assert(asn_DEF_Frame.op->compare_struct(&asn_DEF_Frame, &frame, copy)
+           == 0);
+    check_der_equal(&asn_DEF_Frame, &frame, copy);
+    ASN_STRUCT_FREE(asn_DEF_Frame, copy);
+    ASN_STRUCT_RESET(asn_DEF_Frame, &frame);
+
+    /* Nothing present, nothing to copy */
+    copy = 0;
+    assert(ASN_STRUCT_COPY(asn_DEF_Frame, &copy, &frame) == 0);
+    assert(copy->value.present == value_PR_NOTHING);
+    ASN_STRUCT_FREE(asn_DEF_Frame, copy);
+}
+
+static int
+copy_failing(void **dst, const Message_t *msg, size_t limit) {
+    const asn_allocator_t *saved_allocator;
+    int ret;
+
+    saved_allocator = asn_set_thread_allocator(&failing_allocator);
+    allocations_left = limit;
+    ret = ASN_STRUCT_COPY(asn_DEF_Message, dst, msg);
+    asn_set_thread_allocator(saved_allocator);
+
+    return ret;
+}
+
+static void
+check_out_of_memory() {
+    Message_t msg;
+    Message_t in_place;
+    Message_t zero;
+    Message_t *copy;
+    size_t in_place_limit;
+    size_t limit;
+
+    fill_message(&msg);
+    memset(&zero, 0, sizeof(zero));
+
+    /* Fail every single allocation in turn, then succeed */
+    for(in_place_limit = 0;; in_place_limit++) {
+        void *dst = &in_place;
+        memset(&in_place, 0, sizeof(in_place));
+        if(copy_failing(&dst, &msg, in_place_limit) == 0) break;
+        /* Whatever was copied is freed, leaks are caught by ASan */
+        assert(memcmp(&in_place, &zero, sizeof(zero)) == 0);
+    }
+    ASN_STRUCT_RESET(asn_DEF_Message, &in_place);
+
+    for(limit = 0;; limit++) {
+        copy = 0;
+        if(copy_failing((void **)&copy, &msg, limit) == 0) break;
+        assert(copy == 0);
+    }
+    ASN_STRUCT_FREE(asn_DEF_Message, copy);
+
+    fprintf(stderr, "Copied with %zu allocations\n", limit);
+    assert(limit == in_place_limit + 1);
+    assert(limit > 10);
+
+    ASN_STRUCT_RESET(asn_DEF_Message, &msg);
+}
+
+static void
+check_random() {
+    int checked = 0;
+    int i;
+
+    for(i = 0; i < 300; i++) {
+        Message_t *msg = 0;
+        if(asn_random_fill(&asn_DEF_Message, (void **)&msg, 2000) == 0
+           && asn_check_constraints(&asn_DEF_Message, msg, 0, 0) == 0) {
+            Message_t *copy = copy_message(msg);
+            ASN_STRUCT_FREE(asn_DEF_Message, copy);
+            checked++;
+        }
+        ASN_STRUCT_FREE(asn_DEF_Message, msg);
+    }
+
+    fprintf(stderr, "Checked %d random values\n", checked);
+    assert(checked > 200);
+}
+
+int
+main() {
+    check_independent();
+    check_in_place();
+    check_context();
+    check_open_type();
+    check_out_of_memory();
+    check_random();
+    return 0;
+}
@@ -0,0 +1,274 @@
+#include <stdio.h>
+#include <assert.h>
+#include <math.h>
+
+#include <asn_internal.h>
+#include <jer_decoder.h>
+#include <jer_encoder.h>
+#include <NativeInteger.h>
+#include <NativeReal.h>
+#include <INTEGER.h>
+#include <BOOLEAN.h>
+#include <NULL.h>
+#include <OCTET_STRING.h>
+#include <UTF8String.h>
+#include <BIT_STRING.h>
+#include <OBJECT_IDENTIFIER.h>
+
+static void
+check_next(const char *jerbuf, int expected_chunk_size,
+           pjer_chunk_type_e expected_chunk_type) {
+    int jerbuf_len = strlen(jerbuf);
+    pjer_chunk_type_e ch_type;
+    ssize_t ch_size;
+
+    if(expected_chunk_size == -1) expected_chunk_size = jerbuf_len;
+    ch_size = jer_next_token(jerbuf, jerbuf_len, &ch_type);
+
+    printf("[%s]:%d\n", jerbuf, jerbuf_len);
+    printf("chunk sizes: %ld vs %ld, chunk types: %d vs %ld\n", (long)ch_size,
+           (long)expected_chunk_size, ch_type, (long)expected_chunk_type);
+
+    if(expected_chunk_type == PJER_WMORE) {
+        assert(ch_size == 0);
+        assert(ch_type == PJER_WMORE);
+    } else {
+        assert(ch_size == expected_chunk_size);
+        assert(ch_type == expected_chunk_type);
+    }
+}
+
+/*
+ * Tokenize the JSON fed by pieces of the given size at most,
+ * the way the JER decoders do it, and compare with the whole-buffer pass.
+ */
+static void
+check_pieces(const char *json, size_t piece) {
+    size_t size = strlen(json);
+    size_t consumed = 0;
+    size_t fed = 0;
+    size_t tokens = 0;
+    size_t ref_tokens = 0;
+
+    /* Count the tokens in the whole buffer */
+    for(;;) {
+        pjer_chunk_type_e ch_type;
+        ssize_t ch_size =
+            jer_next_token(json + consumed, size - consumed, &ch_type);
+        assert(ch_size >= 0);
+        if(ch_type == PJER_WMORE) break;
+        consumed += ch_size;
+        ref_tokens++;
+    }
+    assert(consumed <= size);
+
+    consumed = 0;
+    for(;;) {
+        pjer_chunk_type_e ch_type;
+        ssize_t ch_size;
+        if(fed < consumed + piece) fed = consumed + piece;
+        if(fed > size) fed = size;
+        ch_size = jer_next_token(json + consumed, fed - consumed, &ch_type);
+        assert(ch_size >= 0);
+        if(ch_type == PJER_WMORE) {
+            if(fed == size) break;
+            fed++;
+            continue;
+        }
+        /* Whitespace may come split, the rest may not */
+        if(ch_type != PJER_WHITESPACE) tokens++;
+        consumed += ch_size;
+    }
+
+    printf("[%s] by %zu: %zu significant tokens of %zu\n", json, piece, tokens,
+           ref_tokens);
+    assert(tokens <= ref_tokens);
+}
+
+static void
+check_unescape(const char *str, const char *expected, ssize_t expected_len) {
+    char buf[64];
+    ssize_t ret = jer_string_unescape(str, strlen(str), buf);
+    printf("Unescape [%s] => %ld\n", str, (long)ret);
+    assert(ret == expected_len);
+    if(ret >= 0) assert(memcmp(buf, expected, ret) == 0);
+}
+
+struct buf {
+    char data[512];
+    size_t size;
+};
+
+static int
+buf_append(const void *data, size_t size, void *key) {
+    struct buf *b = (struct buf *)key;
+    if(b->size + size >= sizeof(b->data)) return -1;
+    memcpy(b->data + b->size, data, size);
+    b->size += size;
+    b->data[b->size] = '\0';
+    return 0;
+}
+
+/*
+ * Encode the value, compare with the expected JSON and decode it back.
+ */
+static void
+check_roundtrip(asn_TYPE_descriptor_t *td, const void *sptr,
+                enum jer_encoder_flags_e flags, const char *expected) {
+    struct buf b;
+    asn_enc_rval_t er;
+    asn_dec_rval_t rv;
+    void *decoded = 0;
+
+    b.size = 0;
+    b.data[0] = '\0';
+    er = jer_encode(td, sptr, flags, buf_append, &b);
+    printf("%s encoded as [%s]\n", td->name, b.data);
+    assert(er.encoded == (ssize_t)b.size);
+    assert(strcmp(b.data, expected) == 0);
+
+    rv = jer_decode(0, td, &decoded, b.data, b.size);
+    assert(rv.code == RC_OK);
+    /* The trailing newline is left unconsumed */
+    assert(rv.consumed == b.size - 1);
+    assert(td->op->compare_struct(td, sptr, decoded) == 0);
+    ASN_STRUCT_FREE(*td, decoded);
+}
+
+static void
+check_decode(asn_TYPE_descriptor_t *td, const char *json,
+             enum asn_dec_rval_code_e expected_code) {
+    asn_dec_rval_t rv;
+    void *decoded = 0;
+
+    rv = jer_decode(0, td, &decoded, json, strlen(json));
+    printf("%s decoded from [%s]: code %d\n", td->name, json, rv.code);
+    assert(rv.code == expected_code);
+    ASN_STRUCT_FREE(*td, decoded);
+}
+
+static void
+check_primitives(void) {
+    long l;
+    double d;
+    BOOLEAN_t b;
+    NULL_t n = 0;
+    INTEGER_t i;
+    OCTET_STRING_t os;
+    BIT_STRING_t bs;
+    OBJECT_IDENTIFIER_t oid;
+    uint8_t bits[] = {0xa5, 0xc0};
+    asn_oid_arc_t arcs[] = {1, 3, 6, 1, 4294967295U};
+
+    l = -123456789;
+    check_roundtrip(&asn_DEF_NativeInteger, &l, JER_F_BASIC, "-123456789\n");
+    l = 0;
+    check_roundtrip(&asn_DEF_NativeInteger, &l, JER_F_MINIFIED, "0\n");
+
+    memset(&i, 0, sizeof(i));
+    assert(asn_umax2INTEGER(&i, UINTMAX_MAX / 2) == 0);
+    check_roundtrip(&asn_DEF_INTEGER, &i, JER_F_BASIC,
+                    sizeof(intmax_t) == 8 ? "9223372036854775807\n"
+                                          : "2147483647\n");
+    ASN_STRUCT_RESET(asn_DEF_INTEGER, &i);
+
+    d = 0.5;
+    check_roundtrip(&asn_DEF_NativeReal, &d, JER_F_BASIC, "5.0E-1\n");
+    d = -INFINITY;
+    check_roundtrip(&asn_DEF_NativeReal, &d, JER_F_BASIC, "\"-INF\"\n");
+    d = -0.0;
+    check_roundtrip(&asn_DEF_NativeReal, &d, JER_F_MINIFIED, "\"-0\"\n");
+
+    b = 1;
+    check_roundtrip(&asn_DEF_BOOLEAN, &b, JER_F_BASIC, "true\n");
+    b = 0;
+    check_roundtrip(&asn_DEF_BOOLEAN, &b, JER_F_BASIC, "false\n");
+    check_roundtrip(&asn_DEF_NULL, &n, JER_F_BASIC, "null\n");
+
+    memset(&os, 0, sizeof(os));
+    OCTET_STRING_fromBuf(&os, "\x01\xab\xff", 3);
+    check_roundtrip(&asn_DEF_OCTET_STRING, &os, JER_F_BASIC, "\"01ABFF\"\n");
+    OCTET_STRING_fromString(&os, "q\"\\\n\x01 \xd0\x96");
+    check_roundtrip(&asn_DEF_UTF8String, &os, JER_F_BASIC,
+                    "\"q\\\"\\\\\\n\\u0001 \xd0\x96\"\n");
+    ASN_STRUCT_RESET(asn_DEF_OCTET_STRING, &os);
+
+    memset(&bs, 0, sizeof(bs));
+    bs.buf = bits;
+    bs.size = sizeof(bits);
+    bs.bits_unused = 6;
+    check_roundtrip(&asn_DEF_BIT_STRING, &bs, JER_F_MINIFIED,
+                    "{\"value\":\"A5C0\",\"length\":10}\n");
+    check_roundtrip(&asn_DEF_BIT_STRING, &bs, JER_F_BASIC,
+                    "{\n    \"value\": \"A5C0\",\n    \"length\": 10\n}\n");
+
+    memset(&oid, 0, sizeof(oid));
+    assert(OBJECT_IDENTIFIER_set_arcs(&oid, arcs, 5) == 0);
+    check_roundtrip(&asn_DEF_OBJECT_IDENTIFIER, &oid, JER_F_BASIC,
+                    "\"1.3.6.1.4294967295\"\n");
+    ASN_STRUCT_RESET(asn_DEF_OBJECT_IDENTIFIER, &oid);
+
+    /* The literal at the end of the buffer is not complete yet */
+    check_decode(&asn_DEF_NativeInteger, "42", RC_WMORE);
+    check_decode(&asn_DEF_NativeInteger, " 42 ", RC_OK);
+    check_decode(&asn_DEF_NativeInteger, "042 ", RC_FAIL);
+    check_decode(&asn_DEF_NativeInteger, "-0 ", RC_OK);
+    check_decode(&asn_DEF_NativeInteger, "1.0 ", RC_FAIL);
+    check_decode(&asn_DEF_NativeInteger, "\"1\"", RC_FAIL);
+    check_decode(&asn_DEF_NativeInteger, "99999999999999999999999 ", RC_FAIL);
+    check_decode(&asn_DEF_NativeReal, "1e3 ", RC_OK);
+    check_decode(&asn_DEF_NativeReal, "0x10 ", RC_FAIL);
+    check_decode(&asn_DEF_NativeReal, "\"Infinity\"", RC_FAIL);
+    check_decode(&asn_DEF_BOOLEAN, "True ", RC_FAIL);
+    check_decode(&asn_DEF_OCTET_STRING, "\"ABC\"", RC_FAIL);
+    check_decode(&asn_DEF_OCTET_STRING, "\"abcd\"", RC_OK);
+    check_decode(&asn_DEF_UTF8String, "\"\\ud800\"", RC_FAIL);
+    check_decode(&asn_DEF_BIT_STRING, "{\"length\":9,\"value\":\"FF80\"}",
+                 RC_OK);
+    check_decode(&asn_DEF_BIT_STRING, "{\"length\":17,\"value\":\"FF80\"}",
+                 RC_FAIL);
+    check_decode(&asn_DEF_BIT_STRING, "\"FF80\"", RC_OK);
+    check_decode(&asn_DEF_OBJECT_IDENTIFIER, "\"1.3.\"", RC_FAIL);
+}
+
+int
+main() {
+    check_next("", 0, PJER_WMORE);
+    check_next(" ", -1, PJER_WHITESPACE);
+    check_next(" \t\r\n{", 4, PJER_WHITESPACE);
+    check_next("{", -1, PJER_DLM);
+    check_next("}}", 1, PJER_DLM);
+    check_next(":1", 1, PJER_DLM);
+    check_next("\"", 0, PJER_WMORE);
+    check_next("\"abc", 0, PJER_WMORE);
+    check_next("\"a\\\"", 0, PJER_WMORE);
+    check_next("\"a\\\"\"", -1, PJER_STRING);
+    check_next("\"a\\\\\"b", 5, PJER_STRING);
+    check_next("\"a,b\":", 5, PJER_STRING);
+    check_next("123", 0, PJER_WMORE);
+    check_next("123,", 3, PJER_LITERAL);
+    check_next("-1.5e+3]", 7, PJER_LITERAL);
+    check_next("true ", 4, PJER_LITERAL);
+    check_next("null}", 4, PJER_LITERAL);
+
+    check_pieces("{\"a\": [1, 2.5, \"x\\\"y\"], \"b\" : null}", 1);
+    check_pieces("{\"a\": [1, 2.5, \"x\\\"y\"], \"b\" : null}", 3);
+    check_pieces("[ true,false , {} ]", 1);
+
+    check_unescape("", "", 0);
+    check_unescape("abc", "abc", 3);
+    check_unescape("\\\"\\\\\\/\\b\\f\\n\\r\\t", "\"\\/\b\f\n\r\t", 8);
+    check_unescape("\\u0041\\u00e9", "A\xc3\xa9", 3);
+    check_unescape("\\u20AC", "\xe2\x82\xac", 3);
+    check_unescape("\\ud83d\\ude00", "\xf0\x9f\x98\x80", 4);
+    check_unescape("\\ud83d", 0, -1);
+    check_unescape("\\ude00", 0, -1);
+    check_unescape("\\u12", 0, -1);
+    check_unescape("\\x", 0, -1);
+    check_unescape("\\", 0, -1);
+    check_unescape("\t", 0, -1);
+
+    check_primitives();
+
+    return 0;
+}
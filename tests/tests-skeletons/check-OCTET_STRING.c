@@ -5,6 +5,7 @@
 
 #include <OCTET_STRING.h>
 #include <BIT_STRING.h>
+#include <ANY.h>
 
 enum encoding_type { HEX, BINARY, UTF8 };
 
@@ -83,6 +84,122 @@ encode(char *orig, char *encoded) {
 	ASN_STRUCT_RESET(asn_DEF_OCTET_STRING, &os);
 }
 
+/*
+ * Feed the BER decoder with the growing prefix of the input,
+ * restarting it from where it has stopped. This makes the constructed
+ * strings go through the stack of expectations.
+ */
+static enum asn_dec_rval_code_e
+decode_ber_by_bytes(asn_TYPE_descriptor_t *td, void **stp,
+		const uint8_t *ber, size_t size) {
+	size_t offset = 0;
+	size_t avail = 0;
+
+	for(;;) {
+		asn_dec_rval_t rc = ber_decode(0, td, stp, ber + offset,
+			avail - offset);
+		offset += rc.consumed;
+		if(rc.code != RC_WMORE || avail == size)
+			return rc.code;
+		avail++;
+	}
+}
+
+#define check_ber(td, ber, verify, code) \
+	check_ber_impl(__LINE__, td, ber, sizeof(ber), \
+		(const uint8_t *)verify, sizeof(verify) - 1, code)
+
+static void
+check_ber_impl(int lineno, asn_TYPE_descriptor_t *td, const uint8_t *ber,
+		size_t size, const uint8_t *verify, size_t verlen,
+		enum asn_dec_rval_code_e expected_code) {
+	OCTET_STRING_t *st = 0;
+	OCTET_STRING_t *st2 = 0;
+	asn_dec_rval_t rc;
+	enum asn_dec_rval_code_e code2;
+
+	rc = ber_decode(0, td, (void **)&st, ber, size);
+	code2 = decode_ber_by_bytes(td, (void **)&st2, ber, size);
+	printf("%03d: %s of %zu bytes => code %d, by bytes %d\n",
+		lineno, td->name, size, rc.code, code2);
+
+	assert(rc.code == expected_code);
+	assert(code2 == expected_code);
+	if(expected_code == RC_OK) {
+		assert(rc.consumed == size);
+		assert(st->size == verlen);
+		assert(!memcmp(st->buf, verify, verlen));
+		assert(st->buf[st->size] == '\0');
+		assert(td->op->compare_struct(td, st, st2) == 0);
+	}
+
+	ASN_STRUCT_FREE(*td, st);
+	ASN_STRUCT_FREE(*td, st2);
+}
+
+/*
+ * CER encoding of a large string: the segments of 1000 bytes.
+ */
+static void
+check_cer(size_t segments) {
+	size_t size = 2 + segments * (4 + 1000) + 5 + 2;
+	uint8_t *ber = malloc(size);
+	uint8_t *verify = malloc(segments * 1000 + 3);
+	uint8_t *b = ber;
+	size_t s, i;
+
+	assert(ber && verify);
+	*b++ = 0x24;
+	*b++ = 0x80;
+	for(s = 0; s < segments; s++) {
+		*b++ = 0x04;
+		*b++ = 0x82;
+		*b++ = 0x03;
+		*b++ = 0xe8;
+		for(i = 0; i < 1000; i++) {
+			*b++ = verify[s * 1000 + i] = (s + i) & 0xff;
+		}
+	}
+	memcpy(b, "\x04\x03" "end" "\0\0", 7);
+	memcpy(verify + segments * 1000, "end", 3);
+	b += 7;
+	assert((size_t)(b - ber) == size);
+
+	check_ber_impl(__LINE__, &asn_DEF_OCTET_STRING, ber, size, verify,
+		segments * 1000 + 3, RC_OK);
+	/* No end of contents */
+	check_ber_impl(__LINE__, &asn_DEF_OCTET_STRING, ber, size - 1, 0, 0,
+		RC_WMORE);
+
+	free(ber);
+	free(verify);
+}
+
+static void
+check_constructed() {
+	static const uint8_t nested[] = {0x24, 0x0c, 0x04, 0x02, 'a', 'b',
+		0x24, 0x06, 0x04, 0x01, 'c', 0x04, 0x01, 'd'};
+	static const uint8_t mixed[] = {0x24, 0x0a, 0x24, 0x80, 0x04, 0x02,
+		'x', 'y', 0x00, 0x00, 0x04, 0x00};
+	static const uint8_t bits[] = {0x23, 0x80, 0x03, 0x02, 0x00, 0xff,
+		0x03, 0x02, 0x04, 0xf0, 0x00, 0x00};
+	static const uint8_t any[] = {0x30, 0x80, 0x02, 0x01, 0x05,
+		0x00, 0x00};
+	static const uint8_t bad_tag[] = {0x24, 0x04, 0x02, 0x02, 'a', 'b'};
+	static const uint8_t too_long[] = {0x24, 0x03, 0x04, 0x02, 'a', 'b'};
+	static const uint8_t truncated[] = {0x24, 0x80, 0x04, 0x01, 'a'};
+
+	check_ber(&asn_DEF_OCTET_STRING, nested, "abcd", RC_OK);
+	check_ber(&asn_DEF_OCTET_STRING, mixed, "xy", RC_OK);
+	check_ber(&asn_DEF_BIT_STRING, bits, "\xff\xf0", RC_OK);
+	check_ber(&asn_DEF_ANY, any, "\x30\x80\x02\x01\x05\x00\x00", RC_OK);
+	check_ber(&asn_DEF_OCTET_STRING, bad_tag, "", RC_FAIL);
+	check_ber(&asn_DEF_OCTET_STRING, too_long, "", RC_FAIL);
+	check_ber(&asn_DEF_OCTET_STRING, truncated, "", RC_WMORE);
+	check_cer(1);
+	check_cer(100);
+}
+
 int
 main() {
 
@@ -149,6 +266,8 @@ main() {
 	encode("a\bc", "a<bs/>c");
 	encode("ab\01c\ndef\r\n", "ab<soh/>c\ndef\r\n");
 
+	check_constructed();
+
 	return 0;
 }
 
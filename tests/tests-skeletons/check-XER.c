@@ -39,6 +39,80 @@ check_next(char *xerbuf, int expected_chunk_size, pxer_chunk_type_e expected_chu
 	}
 }
 
+/*
+ * The tokens returned by xer_next_token(), the adjacent pieces
+ * of the text and comments glued together.
+ */
+struct xer_tokens {
+	pxer_chunk_type_e types[64];
+	size_t offsets[65];
+	int count;
+};
+
+/*
+ * Tokenize the XML fed by pieces of the given size at most,
+ * the way the XER decoders do it.
+ */
+static void
+xer_tokens_parse(struct xer_tokens *t, const char *xml, size_t piece) {
+	size_t size = strlen(xml);
+	size_t consumed = 0;
+	size_t fed = 0;
+	int state = 0;
+
+	memset(t, 0, sizeof(*t));
+	while(consumed < size) {
+		pxer_chunk_type_e ch_type;
+		ssize_t ret;
+
+		ret = xer_next_token(&state, xml + consumed, fed - consumed,
+		                     &ch_type);
+		assert(ret >= 0 && consumed + ret <= fed);
+		if(ret == 0) {
+			assert(ch_type == PXER_WMORE);
+			if(fed == size) break;
+			fed += piece;
+			if(fed > size) fed = size;
+			continue;
+		}
+		consumed += ret;
+
+		if(t->count && ch_type != PXER_TAG
+		   && t->types[t->count - 1] == ch_type) {
+			t->offsets[t->count] = consumed;
+		} else {
+			assert(t->count < 64);
+			t->types[t->count++] = ch_type;
+			t->offsets[t->count] = consumed;
+		}
+	}
+}
+
+static void
+check_tokens(const char *xml, const char *expected_types) {
+	static const char letters[] = "?tTC";
+	struct xer_tokens whole;
+	size_t piece;
+	int i;
+
+	xer_tokens_parse(&whole, xml, strlen(xml) ? strlen(xml) : 1);
+	printf("[%s]: %d tokens\n", xml, whole.count);
+	assert(whole.count == (int)strlen(expected_types));
+	for(i = 0; i < whole.count; i++) {
+		assert(letters[whole.types[i]] == expected_types[i]);
+	}
+
+	for(piece = 1; piece < strlen(xml); piece++) {
+		struct xer_tokens pieces;
+		xer_tokens_parse(&pieces, xml, piece);
+		assert(pieces.count == whole.count);
+		assert(memcmp(pieces.types, whole.types,
+		              whole.count * sizeof(whole.types[0])) == 0);
+		assert(memcmp(pieces.offsets, whole.offsets,
+		              (whole.count + 1) * sizeof(whole.offsets[0])) == 0);
+	}
+}
+
 int
 main() {
 
@@ -90,5 +164,21 @@ main() {
 	check_next("<!--blah--", -1, PXER_WMORE);
 	check_next("<!--blah-->", -1, PXER_COMMENT);
 
+	/* t: tag, T: text, C: comment */
+	check_tokens("", "");
+	check_tokens("text", "T");
+	check_tokens("<a>", "t");
+	check_tokens("<a>text</a>", "tTt");
+	check_tokens("<a>3 < 4</a>", "tTt");
+	check_tokens("<a>a long text, longer than the vector registers are</a>",
+		"tTt");
+	check_tokens("<a b=\"<>\" c=d>x</a>", "tTt");
+	check_tokens("<a b=\"long quoted value with <tags/> inside\"/>", "t");
+	check_tokens("<a><!-- comment - with -- dashes -->b</a>", "tCTt");
+	check_tokens("<!---->", "C");
+	check_tokens("x<!-- unterminated comment", "TC");
+	check_tokens("<a>text<b", "tT");
+	check_tokens("<a\n\tb = \"1\"\n>\n\t<b/>\n</a>\n", "tTtTtT");
+
 	return 0;
 }
@@ -0,0 +1,117 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include <asn_application.h>
+#include <OCTET_STRING.h>
+
+struct counters {
+    int allocs;
+    int reallocs;
+    int frees;
+};
+
+static void *
+count_calloc(size_t nmemb, size_t size, void *opaque) {
+    ((struct counters *)opaque)->allocs++;
+    return calloc(nmemb, size);
+}
+
+static void *
+count_malloc(size_t size, void *opaque) {
+    ((struct counters *)opaque)->allocs++;
+    return malloc(size);
+}
+
+static void *
+count_realloc(void *ptr, size_t size, void *opaque) {
+    ((struct counters *)opaque)->reallocs++;
+    return realloc(ptr, size);
+}
+
+static void
+count_free(void *ptr, void *opaque) {
+    ((struct counters *)opaque)->frees++;
+    free(ptr);
+}
+
+/* OCTET STRING "abc" */
+static const uint8_t encoded[] = {0x04, 0x03, 'a', 'b', 'c'};
+
+static OCTET_STRING_t *
+decode(const asn_codec_ctx_t *opt_codec_ctx) {
+    OCTET_STRING_t *st = 0;
+    asn_dec_rval_t rval;
+
+    rval = ber_decode(opt_codec_ctx, &asn_DEF_OCTET_STRING, (void **)&st,
+                      encoded, sizeof(encoded));
+    assert(rval.code == RC_OK);
+    assert(st && st->size == 3 && memcmp(st->buf, "abc", 3) == 0);
+    return st;
+}
+
+static void
+check_context_allocator() {
+    struct counters cnt = {0, 0, 0};
+    asn_allocator_t allocator = {count_calloc, count_malloc, count_realloc,
+                                 count_free, 0};
+    asn_codec_ctx_t ctx;
+    const asn_allocator_t *prev;
+    OCTET_STRING_t *st;
+
+    allocator.opaque = &cnt;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.allocator = &allocator;
+
+    st = decode(&ctx);
+    fprintf(stderr, "Context allocator: %d allocs, %d reallocs\n", cnt.allocs,
+            cnt.reallocs);
+    assert(cnt.allocs > 0);
+    assert(cnt.frees == 0);
+
+    /* The allocator is in effect only for the duration of the call */
+    ASN_STRUCT_FREE(asn_DEF_OCTET_STRING, decode(0));
+    assert(cnt.frees == 0);
+
+    /* Free with the same allocator in effect */
+    prev = asn_set_thread_allocator(&allocator);
+    assert(prev == NULL);
+    ASN_STRUCT_FREE(asn_DEF_OCTET_STRING, st);
+    prev = asn_set_thread_allocator(prev);
+    assert(prev == &allocator);
+    assert(cnt.frees >= cnt.allocs);
+}
+
+static void
+check_default_allocator() {
+    struct counters cnt = {0, 0, 0};
+    asn_allocator_t allocator = {count_calloc, count_malloc, count_realloc,
+                                 count_free, 0};
+    asn_encode_to_new_buffer_result_t res;
+    OCTET_STRING_t *st;
+
+    allocator.opaque = &cnt;
+    asn_set_default_allocator(&allocator);
+
+    st = decode(0);
+    res = asn_encode_to_new_buffer(0, ATS_DER, &asn_DEF_OCTET_STRING, st);
+    assert(res.buffer);
+    assert(res.result.encoded == sizeof(encoded));
+    assert(memcmp(res.buffer, encoded, sizeof(encoded)) == 0);
+    allocator.free_fn(res.buffer, allocator.opaque);
+    ASN_STRUCT_FREE(asn_DEF_OCTET_STRING, st);
+
+    asn_set_default_allocator(NULL);
+
+    fprintf(stderr, "Default allocator: %d allocs, %d frees\n", cnt.allocs,
+            cnt.frees);
+    assert(cnt.allocs > 0);
+    assert(cnt.frees >= cnt.allocs);
+}
+
+int
+main() {
+    check_context_allocator();
+    check_default_allocator();
+    return 0;
+}
@@ -376,11 +376,95 @@ check_asn_bits_sweep() {
 	}
 }
 
+static int
+bit_at(const uint8_t *buf, size_t n) {
+	return (buf[n >> 3] >> (7 - (n & 7))) & 1;
+}
+
+typedef struct {
+	uint8_t buf[128];
+	size_t size;
+} bits_collector_t;
+
+static int Collect(const void *data, size_t size, void *op_key) {
+	bits_collector_t *c = op_key;
+	assert(c->size + size <= sizeof(c->buf));
+	memcpy(c->buf + c->size, data, size);
+	c->size += size;
+	return 0;
+}
+
+/*
+ * Move the long runs of bits, copied a word at a time, at every bit offset.
+ */
+static void
+check_asn_bits_many_at_offsets() {
+	uint8_t src[72];
+	uint8_t dst[72];
+	int offset;
+	int nbits;
+	size_t i;
+
+	for(i = 0; i < sizeof(src); i++)
+		src[i] = (uint8_t)(i * 151 + 7);
+
+	for(offset = 0; offset < 16; offset++) {
+	  for(nbits = 0; nbits <= 8 * 64; nbits += 13) {
+		asn_bit_data_t pos;
+		asn_bit_outp_t out;
+		bits_collector_t collected;
+		int ret;
+
+		memset(&pos, 0, sizeof(pos));
+		pos.buffer = src;
+		pos.nbits = 8 * sizeof(src);
+		memset(dst, 0, sizeof(dst));
+
+		ret = asn_get_few_bits(&pos, offset);
+		assert(ret >= 0);
+		ret = asn_get_many_bits(&pos, dst, 0, nbits);
+		assert(ret == 0);
+		assert(pos.moved == (size_t)(offset + nbits));
+		for(i = 0; i < (size_t)nbits; i++)
+			assert(bit_at(dst, i) == bit_at(src, offset + i));
+		ret = asn_get_few_bits(&pos, 3);
+		assert(ret == (bit_at(src, offset + nbits) << 2
+			| bit_at(src, offset + nbits + 1) << 1
+			| bit_at(src, offset + nbits + 2)));
+
+		memset(&out, 0, sizeof(out));
+		memset(&collected, 0, sizeof(collected));
+		out.buffer = out.tmpspace;
+		out.nbits = 8 * sizeof(out.tmpspace);
+		out.output = Collect;
+		out.op_key = &collected;
+
+		ret = asn_put_few_bits(&out, 0x5555, offset);
+		assert(ret == 0);
+		ret = asn_put_many_bits(&out, src, nbits);
+		assert(ret == 0);
+		ret = asn_put_few_bits(&out, 0x7, 3);
+		assert(ret == 0);
+		ret = asn_put_aligned_flush(&out);
+		assert(ret == 0);
+		assert(collected.size == (size_t)(offset + nbits + 3 + 7) / 8);
+		assert(out.flushed_bytes == collected.size);
+		for(i = 0; i < (size_t)offset; i++)
+			assert(bit_at(collected.buf, i) == (int)((0x5555 >> (offset - 1 - i)) & 1));
+		for(i = 0; i < (size_t)nbits; i++)
+			assert(bit_at(collected.buf, offset + i) == bit_at(src, i));
+		for(i = 0; i < 3; i++)
+			assert(bit_at(collected.buf, offset + nbits + i) == 1);
+	  }
+	}
+}
+
 int
 main() {
 	check_asn_bits_decoding();
 	check_asn_bits_encoding();
 	check_asn_bits_encoding_auto();
 	check_asn_bits_sweep();
+	check_asn_bits_many_at_offsets();
 	return 0;
 }
@@ -0,0 +1,176 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+
+#include <asn_application.h>
+#include <OCTET_STRING.h>
+#include <INTEGER.h>
+
+struct collector {
+    uint8_t buf[32768];
+    size_t size;
+    int calls;
+    int fail_after;     /* Fail the call with this number, if positive */
+};
+
+static int
+collect_cb(const void *buffer, size_t size, void *key) {
+    struct collector *c = key;
+    c->calls++;
+    if(c->fail_after > 0 && c->calls >= c->fail_after) return -1;
+    assert(c->size + size <= sizeof(c->buf));
+    memcpy(c->buf + c->size, buffer, size);
+    c->size += size;
+    return 0;
+}
+
+static void
+fill_octets(OCTET_STRING_t *st, size_t size) {
+    size_t i;
+    memset(st, 0, sizeof(*st));
+    st->buf = malloc(size + 1);
+    assert(st->buf);
+    for(i = 0; i < size; i++) st->buf[i] = 'a' + (i % 26);
+    st->buf[size] = '\0';
+    st->size = size;
+}
+
+/*
+ * The callback of asn_encode() receives the whole output in a few chunks.
+ */
+static void
+check_callback_chunks(enum asn_transfer_syntax syntax, size_t octets) {
+    struct collector c;
+    asn_encode_to_new_buffer_result_t res;
+    OCTET_STRING_t st;
+    asn_enc_rval_t er;
+
+    fill_octets(&st, octets);
+    memset(&c, 0, sizeof(c));
+
+    er = asn_encode(0, syntax, &asn_DEF_OCTET_STRING, &st, collect_cb, &c);
+    assert(er.encoded > 0);
+    assert((size_t)er.encoded == c.size);
+    fprintf(stderr, "%zu octets in %zu bytes, %d calls\n", octets, c.size,
+            c.calls);
+    assert(c.calls <= (int)(c.size / 512) + 1);
+
+    res = asn_encode_to_new_buffer(0, syntax, &asn_DEF_OCTET_STRING, &st);
+    assert(res.buffer);
+    assert(res.result.encoded == er.encoded);
+    assert(memcmp(res.buffer, c.buf, c.size) == 0);
+    assert(((char *)res.buffer)[c.size] == '\0');
+    free(res.buffer);
+
+    ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_OCTET_STRING, &st);
+}
+
+/*
+ * The callback failure is reported as EIO, in the middle of the encoding
+ * and at the final flush.
+ */
+static void
+check_callback_failure() {
+    struct collector c;
+    OCTET_STRING_t st;
+    asn_enc_rval_t er;
+
+    fill_octets(&st, 3000);
+
+    memset(&c, 0, sizeof(c));
+    c.fail_after = 1;
+    errno = 0;
+    er = asn_encode(0, ATS_DER, &asn_DEF_OCTET_STRING, &st, collect_cb, &c);
+    assert(er.encoded == -1);
+    assert(errno == EIO);
+
+    memset(&c, 0, sizeof(c));
+    c.fail_after = 1;
+    errno = 0;
+    st.size = 10;
+    er = asn_encode(0, ATS_DER, &asn_DEF_OCTET_STRING, &st, collect_cb, &c);
+    assert(er.encoded == -1);
+    assert(errno == EIO);
+    assert(c.calls == 1);
+
+    ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_OCTET_STRING, &st);
+}
+
+/*
+ * asn_encode_to_buffer() fills the buffer and counts the rest.
+ */
+static void
+check_to_buffer() {
+    uint8_t buf[16];
+    uint8_t full[256];
+    OCTET_STRING_t st;
+    asn_enc_rval_t er;
+    size_t size;
+    size_t n;
+
+    fill_octets(&st, 40);
+
+    er = asn_encode_to_buffer(0, ATS_BASIC_XER, &asn_DEF_OCTET_STRING, &st,
+                              full, sizeof(full));
+    assert(er.encoded > 0 && (size_t)er.encoded <= sizeof(full));
+    size = er.encoded;
+
+    for(n = 0; n <= sizeof(buf); n++) {
+        er = asn_encode_to_buffer(0, ATS_BASIC_XER, &asn_DEF_OCTET_STRING, &st,
+                                  buf, n);
+        assert(er.encoded == (ssize_t)size);
+    }
+
+    er = asn_encode_to_buffer(0, ATS_BASIC_XER, &asn_DEF_OCTET_STRING, &st, 0,
+                              0);
+    assert(er.encoded == (ssize_t)size);
+
+    ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_OCTET_STRING, &st);
+}
+
+/*
+ * The encoders write into the asn_output_buffer_t
+ * passed along with asn_output_buffer_consume_bytes().
+ */
+static void
+check_encoder_output() {
+    struct collector c;
+    uint8_t scratch[8];
+    asn_output_buffer_t ob;
+    INTEGER_t st;
+    asn_enc_rval_t er;
+    int i;
+
+    memset(&c, 0, sizeof(c));
+    memset(&st, 0, sizeof(st));
+    asn_output_buffer_init(&ob, scratch, sizeof(scratch), collect_cb, &c);
+
+    for(i = 0; i < 10; i++) {
+        assert(asn_long2INTEGER(&st, 1000 * i) == 0);
+        er = der_encode(&asn_DEF_INTEGER, &st, asn_output_buffer_consume_bytes,
+                        &ob);
+        assert(er.encoded > 0);
+    }
+    assert(c.calls < 10);
+    assert(asn_output_buffer_flush(&ob) == 0);
+    assert(ob.length == 0);
+    assert(c.size == ASN_OUTPUT_BUFFER_WRITTEN(&ob));
+    assert(c.size == 3 + 9 * 4);
+    assert(memcmp(c.buf, "\x02\x01\x00\x02\x02\x03\xe8", 7) == 0);
+
+    ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_INTEGER, &st);
+}
+
+int
+main() {
+    check_callback_chunks(ATS_DER, 10);
+    check_callback_chunks(ATS_DER, 5000);
+    check_callback_chunks(ATS_BASIC_XER, 5000);
+    check_callback_chunks(ATS_NONSTANDARD_PLAINTEXT, 2000);
+    check_callback_failure();
+    check_to_buffer();
+    check_encoder_output();
+    return 0;
+}